@@ -17,9 +17,6 @@ let package = Package(
       name: "BPMFVS",
       resources: [
         .process("Resources"),
-      ],
-      swiftSettings: [
-        .defaultIsolation(MainActor.self), // set Default Actor Isolation
       ]
     ),
     .testTarget(
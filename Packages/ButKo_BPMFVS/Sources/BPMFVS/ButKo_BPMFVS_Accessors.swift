@@ -15,7 +15,6 @@ public enum BPMFVS {
   // MARK: Public
 
   public static func getBPMFVSDataURL() -> URL? {
-    // Bundle.module is MainActor-isolated in this context.
     Bundle.module.url(forResource: "phonic_table_Z", withExtension: "txt")
   }
 
@@ -31,83 +30,74 @@ public enum BPMFVS {
     return normalized
   }
 
+  /// 預先開啟查詢表（記憶體映射並驗證檔頭），以免首次轉換時才承擔這筆開銷。可在任意執行緒上呼叫。
+  /// - Returns: 查詢表是否可用。
+  @discardableResult
+  public static func prewarm() -> Bool {
+    cachedLookupTable != nil
+  }
+
   public static func convert(value: String, reading: String) -> String {
     guard value.count == 1 else { return value }
-    let normalizedReading = normalizeBPMFVSReading(reading)
-    guard let slot = cachedLookupTable?.slot(of: value, for: normalizedReading) else {
-      return value
-    }
-    guard slot > 0 else { return value }
-    guard let selector = UnicodeScalar(variationSelectorBase + UInt32(slot)) else {
-      return value
-    }
-    return value + String(selector)
+    return convert(sentence: CollectionOfOne((value: value, readings: [reading])))
   }
 
   public static func convert(value: String, readings: [String]) -> String {
-    guard value.count == readings.count else { return value }
-    return zip(value, readings).reduce(into: "") { partialResult, pair in
-      partialResult += convert(value: String(pair.0), reading: pair.1)
-    }
+    convert(sentence: CollectionOfOne((value: value, readings: readings)))
   }
 
-  public static func convertToBPMFVS(smashedPairs: [(key: String, value: String)]) -> String {
+  /// 一次轉換整個組句結果。
+  ///
+  /// 字數與讀音數不一致的片段（比如字音不相符的節點）會原樣保留；
+  /// 其餘片段則逐字查表，於需要時在該字後方追加異體字選擇器。
+  /// 查表全程直接讀取預先編譯的查詢表，不會為每個字建立字串。
+  /// - Parameter sentence: 依序排列的片段，各自帶有其值與逐字讀音。
+  public static func convert(sentence: some Sequence<(value: String, readings: [String])>) -> String {
     var converted = ""
-    smashedPairs.forEach { key, value in
-      let subKeys = key.split(separator: "\t")
-      switch subKeys.count {
-      case 1:
-        let reading = subKeys[0].description
-        if reading.isEmpty || reading.first == "_" {
+    guard let table = cachedLookupTable else {
+      sentence.forEach { converted += $0.value }
+      return converted
+    }
+    table.withLookup { lookup in
+      sentence.forEach { value, readings in
+        guard value.count == readings.count else {
           converted += value
           return
         }
-        converted += convert(value: value, reading: reading)
-      default:
-        converted += value
+        zip(value, readings).forEach { character, reading in
+          converted.unicodeScalars.append(contentsOf: character.unicodeScalars)
+          var scalars = character.unicodeScalars.makeIterator()
+          guard let scalar = scalars.next(), scalars.next() == nil else { return }
+          guard let syllableCode = CompiledTable.syllableCode(of: reading) else { return }
+          guard let slot = lookup.slot(of: scalar, syllableCode: syllableCode), slot > 0 else { return }
+          guard let selector = Unicode.Scalar(variationSelectorBase + UInt32(slot)) else { return }
+          converted.unicodeScalars.append(selector)
+        }
       }
     }
     return converted
   }
 
-  // MARK: Private
-
-  private struct LookupTable {
-    // MARK: Lifecycle
-
-    init(fileURL: URL) throws {
-      var readingsByValue = [String: [String: Int]]()
-      let rawText = try String(contentsOf: fileURL, encoding: .utf8)
-      rawText.enumerateLines { currentLine, _ in
-        guard !currentLine.isEmpty, currentLine.first != "#" else { return }
-        let cells = currentLine.split(separator: "\t", omittingEmptySubsequences: false)
-        guard cells.count >= 4 else { return }
-        let value = cells[0].description
-        var readingMap = [String: Int]()
-        cells.dropFirst(3).enumerated().forEach { index, reading in
-          let normalizedReading = BPMFVS.normalizeBPMFVSReading(reading.description)
-          if readingMap[normalizedReading] == nil {
-            readingMap[normalizedReading] = index
-          }
-        }
-        readingsByValue[value] = readingMap
-      }
-      self.readingsByValue = readingsByValue
-    }
-
-    // MARK: Internal
+  public static func convertToBPMFVS(smashedPairs: [(key: String, value: String)]) -> String {
+    // 以 Tab 串接的多個讀音代表字音不相符的節點，故不予轉換。
+    convert(sentence: smashedPairs.lazy.map { key, value in
+      (value: value, readings: key.contains("\t") ? [] : [key])
+    })
+  }
 
-    let readingsByValue: [String: [String: Int]]
+  // MARK: Internal
 
-    func slot(of value: String, for reading: String) -> Int? {
-      readingsByValue[value]?[reading]
-    }
+  /// 預先編譯的查詢表（見 `CompiledTable`）。
+  static func getCompiledTableURL() -> URL? {
+    Bundle.module.url(forResource: "phonic_table_Z", withExtension: "bpmfvs")
   }
 
+  // MARK: Private
+
   private static let variationSelectorBase: UInt32 = 0xE01E0
 
-  private static let cachedLookupTable: LookupTable? = {
-    guard let fileURL = getBPMFVSDataURL() else { return nil }
-    return try? LookupTable(fileURL: fileURL)
+  private static let cachedLookupTable: CompiledTable? = {
+    guard let fileURL = getCompiledTableURL() else { return nil }
+    return CompiledTable(fileURL: fileURL)
   }()
 }
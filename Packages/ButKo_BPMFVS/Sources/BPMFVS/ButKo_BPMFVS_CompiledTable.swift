@@ -0,0 +1,203 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+// 該檔案不包括 ButKo BPMFVS 原始資料實作。BPMFVS 原始資料著作權資訊詳見：
+// http://github.com/ButTaiwan/bpmfvs/raw/refs/heads/master/NOTICE.txt
+
+import Foundation
+
+// MARK: - BPMFVS.CompiledTable
+
+extension BPMFVS {
+  /// 自 `phonic_table_Z.txt` 預先編譯而成的二進位查詢表（`phonic_table_Z.bpmfvs`）。
+  ///
+  /// 檔案以記憶體映射的方式開啟，查詢時直接讀取映射區，不會建立任何字串或辭典。
+  /// 格式如下（整數皆為 little-endian）：
+  /// - 檔頭（16 位元組）：magic `BPVS`、版本、字數、讀音槽總數（後三者皆為 UInt32）。
+  /// - 字表（每字 8 位元組）：Unicode scalar 值、該字首個讀音槽的索引（皆為 UInt32），依 scalar 值排序。
+  /// - 讀音槽（每槽 2 位元組）：音節碼（見 `syllableCode(of:)`）。同一字的讀音槽連續存放，
+  ///   順序即原始資料檔的讀音順序，其索引就是要套用的異體字選擇器序號。無法編碼的讀音以 0 佔位。
+  struct CompiledTable {
+    // MARK: Lifecycle
+
+    /// 驗證並包裝給定的二進位資料。格式不符時回傳 nil。
+    init?(data: Data) {
+      guard data.count >= Self.headerSize else { return nil }
+      let header: (magic: UInt32, version: UInt32, entryCount: Int, slotCount: Int) = data.withUnsafeBytes {
+        (
+          UInt32(littleEndian: $0.loadUnaligned(fromByteOffset: 0, as: UInt32.self)),
+          UInt32(littleEndian: $0.loadUnaligned(fromByteOffset: 4, as: UInt32.self)),
+          Int(UInt32(littleEndian: $0.loadUnaligned(fromByteOffset: 8, as: UInt32.self))),
+          Int(UInt32(littleEndian: $0.loadUnaligned(fromByteOffset: 12, as: UInt32.self)))
+        )
+      }
+      guard header.magic == Self.magic, header.version == Self.version else { return nil }
+      guard data.count == Self.headerSize + header.entryCount * Self.entrySize + header.slotCount * 2 else {
+        return nil
+      }
+      self.data = data
+      self.entryCount = header.entryCount
+      self.slotCount = header.slotCount
+    }
+
+    /// 以記憶體映射的方式開啟預先編譯的查詢表。
+    init?(fileURL: URL) {
+      guard let data = try? Data(contentsOf: fileURL, options: [.alwaysMapped]) else { return nil }
+      self.init(data: data)
+    }
+
+    // MARK: Internal
+
+    /// 在查詢表的映射區上進行查詢的輕量視圖，僅在 `withLookup` 的閉包內有效。
+    struct Lookup {
+      // MARK: Internal
+
+      /// 查詢給定字元在給定讀音下的讀音槽序號。
+      func slot(of scalar: Unicode.Scalar, syllableCode: UInt16) -> Int? {
+        guard let entryIndex = entryIndex(of: scalar.value) else { return nil }
+        let lowerBound = Int(word(at: CompiledTable.headerSize + entryIndex * CompiledTable.entrySize + 4))
+        let upperBound = entryIndex + 1 < entryCount
+          ? Int(word(at: CompiledTable.headerSize + (entryIndex + 1) * CompiledTable.entrySize + 4))
+          : slotCount
+        for slotIndex in lowerBound ..< upperBound where halfWord(ofSlot: slotIndex) == syllableCode {
+          return slotIndex - lowerBound
+        }
+        return nil
+      }
+
+      // MARK: Fileprivate
+
+      fileprivate let buffer: UnsafeRawBufferPointer
+      fileprivate let entryCount: Int
+      fileprivate let slotCount: Int
+
+      // MARK: Private
+
+      private var slotsOffset: Int { CompiledTable.headerSize + entryCount * CompiledTable.entrySize }
+
+      private func word(at offset: Int) -> UInt32 {
+        UInt32(littleEndian: buffer.loadUnaligned(fromByteOffset: offset, as: UInt32.self))
+      }
+
+      private func halfWord(ofSlot slotIndex: Int) -> UInt16 {
+        UInt16(littleEndian: buffer.loadUnaligned(fromByteOffset: slotsOffset + slotIndex * 2, as: UInt16.self))
+      }
+
+      private func entryIndex(of scalarValue: UInt32) -> Int? {
+        var lowerBound = 0
+        var upperBound = entryCount
+        while lowerBound < upperBound {
+          let middle = (lowerBound + upperBound) / 2
+          let current = word(at: CompiledTable.headerSize + middle * CompiledTable.entrySize)
+          if current == scalarValue { return middle }
+          if current < scalarValue {
+            lowerBound = middle + 1
+          } else {
+            upperBound = middle
+          }
+        }
+        return nil
+      }
+    }
+
+    let data: Data
+    let entryCount: Int
+    let slotCount: Int
+
+    /// 將注音讀音編碼成 14 位元的音節碼：聲母（5 位元）、介音（2 位元）、韻母（4 位元）、聲調（3 位元）。
+    ///
+    /// 各成分不論出現順序（故「˙ㄉㄜ」與「ㄉㄜ˙」等價），陰平可以不標或標為「1」，空白會被略過。
+    /// 含有其他字元、或同一成分出現兩次時回傳 nil。
+    static func syllableCode(of reading: some StringProtocol) -> UInt16? {
+      var consonant: UInt16 = 0
+      var semivowel: UInt16 = 0
+      var vowel: UInt16 = 0
+      var tone: UInt16 = 0
+      var hasComponent = false
+      for scalar in reading.unicodeScalars {
+        let value = scalar.value
+        switch value {
+        case 0x3105 ... 0x3119: // ㄅ ~ ㄙ
+          guard consonant == 0 else { return nil }
+          consonant = UInt16(value - 0x3104)
+        case 0x3127 ... 0x3129: // ㄧ ~ ㄩ
+          guard semivowel == 0 else { return nil }
+          semivowel = UInt16(value - 0x3126)
+        case 0x311A ... 0x3126: // ㄚ ~ ㄦ
+          guard vowel == 0 else { return nil }
+          vowel = UInt16(value - 0x3119)
+        case 0x02CA, 0x02C7, 0x02CB, 0x02D9: // ˊ ˇ ˋ ˙
+          guard tone == 0 else { return nil }
+          switch value {
+          case 0x02CA: tone = 1
+          case 0x02C7: tone = 2
+          case 0x02CB: tone = 3
+          default: tone = 4
+          }
+        case 0x31: continue // 陰平
+        default:
+          guard scalar.properties.isWhitespace else { return nil }
+          continue
+        }
+        hasComponent = true
+      }
+      guard hasComponent else { return nil }
+      return consonant << 9 | semivowel << 7 | vowel << 3 | tone
+    }
+
+    /// 將原始資料檔編譯成二進位查詢表。僅供重新生成 `phonic_table_Z.bpmfvs` 與單元測試使用。
+    static func compile(fromRawText rawText: String) -> Data {
+      var slotsByScalar = [UInt32: [UInt16]]()
+      rawText.enumerateLines { currentLine, _ in
+        guard !currentLine.isEmpty, currentLine.first != "#" else { return }
+        let cells = currentLine.split(separator: "\t", omittingEmptySubsequences: false)
+        guard cells.count >= 4, cells[0].unicodeScalars.count == 1 else { return }
+        guard let scalar = cells[0].unicodeScalars.first else { return }
+        slotsByScalar[scalar.value] = cells.dropFirst(3).map { syllableCode(of: $0) ?? 0 }
+      }
+      let sortedScalars = slotsByScalar.keys.sorted()
+      let slotCount = slotsByScalar.values.reduce(0) { $0 + $1.count }
+      var result = Data()
+      result.reserveCapacity(headerSize + sortedScalars.count * entrySize + slotCount * 2)
+      func append<T: FixedWidthInteger>(_ value: T) {
+        withUnsafeBytes(of: value.littleEndian) { result.append(contentsOf: $0) }
+      }
+      append(magic)
+      append(version)
+      append(UInt32(sortedScalars.count))
+      append(UInt32(slotCount))
+      var slotStart: UInt32 = 0
+      sortedScalars.forEach { scalar in
+        append(scalar)
+        append(slotStart)
+        slotStart += UInt32(slotsByScalar[scalar]?.count ?? 0)
+      }
+      sortedScalars.forEach { scalar in
+        slotsByScalar[scalar]?.forEach { append($0) }
+      }
+      return result
+    }
+
+    func withLookup<R>(_ body: (Lookup) throws -> R) rethrows -> R {
+      try data.withUnsafeBytes { buffer in
+        try body(Lookup(buffer: buffer, entryCount: entryCount, slotCount: slotCount))
+      }
+    }
+
+    // MARK: Fileprivate
+
+    fileprivate static let headerSize = 16
+    fileprivate static let entrySize = 8
+
+    // MARK: Private
+
+    /// 「BPVS」（以 little-endian 讀出時的數值）。
+    private static let magic: UInt32 = 0x5356_5042
+    private static let version: UInt32 = 1
+  }
+}
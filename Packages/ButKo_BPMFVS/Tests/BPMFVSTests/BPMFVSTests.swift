@@ -1,4 +1,5 @@
 @testable import BPMFVS
+import Foundation
 import Testing
 
 @Suite("BPMFVSTests")
@@ -35,4 +36,79 @@ struct BPMFVSTests {
   func testLeavesMultiCharacterDisplaySegmentUntouchedWhenCountsMismatch() {
     #expect(BPMFVS.convert(value: "咱地", readings: ["ㄗㄚˊ"]) == "咱地")
   }
+
+  @Test
+  func testConvertsWholeSentenceAndKeepsMismatchedSegments() {
+    let vs1 = String(try! #require(UnicodeScalar(0xE01E1)))
+    let sentence: [(value: String, readings: [String])] = [
+      (value: "咱地", readings: ["ㄗㄚˊ", "ㄉㄜ˙"]),
+      (value: "，", readings: ["_punctuation_,"]),
+      (value: "咱們", readings: ["ㄗㄚˊ"]),
+      (value: "地", readings: ["˙ㄉㄜ"]),
+    ]
+    #expect(BPMFVS.convert(sentence: sentence) == "咱\(vs1)地\(vs1)，咱們地\(vs1)")
+    #expect(BPMFVS.convertToBPMFVS(smashedPairs: [(key: "ㄗㄚˊ", value: "咱"), (key: "ㄗㄚˊ\tㄇㄣ˙", value: "咱")]) == "咱\(vs1)咱")
+  }
+
+  @Test
+  func testSyllableCodeIgnoresComponentOrder() {
+    typealias Table = BPMFVS.CompiledTable
+    #expect(Table.syllableCode(of: "˙ㄉㄜ") == Table.syllableCode(of: "ㄉㄜ˙"))
+    #expect(Table.syllableCode(of: "ㄉㄜ1") == Table.syllableCode(of: " ㄉㄜ"))
+    #expect(Table.syllableCode(of: "ㄉㄜ") != Table.syllableCode(of: "ㄉㄜˋ"))
+    #expect(Table.syllableCode(of: "ㄦ") != nil)
+    #expect(Table.syllableCode(of: "") == nil)
+    #expect(Table.syllableCode(of: "ㄉㄉㄜ") == nil)
+    #expect(Table.syllableCode(of: "_punctuation_,") == nil)
+  }
+
+  /// 預先編譯的查詢表須與原始資料檔同步。不同步時，會將重新生成的檔案寫到暫存目錄，以便替換。
+  @Test
+  func testShippedCompiledTableMatchesRawData() throws {
+    let rawURL = try #require(BPMFVS.getBPMFVSDataURL())
+    let compiledURL = try #require(BPMFVS.getCompiledTableURL())
+    let regenerated = BPMFVS.CompiledTable.compile(fromRawText: try String(contentsOf: rawURL, encoding: .utf8))
+    let shipped = try Data(contentsOf: compiledURL)
+    if regenerated != shipped {
+      let outputURL = FileManager.default.temporaryDirectory.appendingPathComponent("phonic_table_Z.bpmfvs")
+      try regenerated.write(to: outputURL)
+      Issue.record("phonic_table_Z.bpmfvs is outdated. A regenerated copy is written to: \(outputURL.path)")
+    }
+    #expect(BPMFVS.CompiledTable(data: regenerated) != nil)
+    #expect(BPMFVS.CompiledTable(data: regenerated.dropLast()) == nil)
+  }
+
+  /// 逐字逐讀音比對：查詢結果須與舊版（以正規化讀音字串為鍵的辭典）的語意一致。
+  @Test
+  func testCompiledTableMatchesLegacySemanticsForEveryReading() throws {
+    let rawURL = try #require(BPMFVS.getBPMFVSDataURL())
+    let rawText = try String(contentsOf: rawURL, encoding: .utf8)
+    var checkedCount = 0
+    var mismatches = [String]()
+    rawText.enumerateLines { currentLine, _ in
+      guard !currentLine.isEmpty, currentLine.first != "#" else { return }
+      let cells = currentLine.split(separator: "\t", omittingEmptySubsequences: false)
+      guard cells.count >= 4 else { return }
+      let value = cells[0].description
+      var legacyMap = [String: Int]()
+      cells.dropFirst(3).enumerated().forEach { index, reading in
+        let normalized = BPMFVS.normalizeBPMFVSReading(reading.description)
+        if legacyMap[normalized] == nil { legacyMap[normalized] = index }
+      }
+      legacyMap.forEach { reading, slot in
+        // 輸入法傳入的輕聲讀音會把「˙」放在最後。
+        let typedReading = reading.first == "˙" ? String(reading.dropFirst()) + "˙" : reading
+        var expected = value
+        if slot > 0, let selector = UnicodeScalar(0xE01E0 + UInt32(slot)) {
+          expected.unicodeScalars.append(selector)
+        }
+        checkedCount += 1
+        if BPMFVS.convert(value: value, reading: typedReading) != expected {
+          mismatches.append("\(value) \(typedReading)")
+        }
+      }
+    }
+    #expect(checkedCount > 20_000)
+    #expect(mismatches.isEmpty, "\(mismatches.prefix(10))")
+  }
 }
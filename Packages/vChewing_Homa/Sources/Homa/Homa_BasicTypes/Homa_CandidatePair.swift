@@ -10,17 +10,30 @@ extension Homa {
     public init(_ tuplet: CandidatePairRAW) {
       self.keyArray = tuplet.keyArray
       self.value = tuplet.value
+      self.provenance = []
     }
 
-    public init(keyArray: [String], value: String) {
+    public init(keyArray: [String], value: String, provenance: Gram.Provenance = []) {
       self.keyArray = keyArray
       self.value = value
+      self.provenance = provenance
+    }
+
+    public init(from decoder: any Decoder) throws {
+      let container = try decoder.container(keyedBy: CodingKeys.self)
+      self.keyArray = try container.decode([String].self, forKey: .keyArray)
+      self.value = try container.decode(String.self, forKey: .value)
+      let rawProvenance = try container.decodeIfPresent(UInt8.self, forKey: .provenance) ?? 0
+      self.provenance = .init(rawValue: rawProvenance)
     }
 
     // MARK: Public
 
     public let keyArray: [String]
     public let value: String
+    /// 該候選字詞所源自的元圖的來源標記，於組字器收集候選時自元圖直接謄入。
+    /// 僅屬於附帶資訊，不參與相等比較與雜湊。
+    public let provenance: Gram.Provenance
 
     public var raw: CandidatePairRAW {
       (keyArray, value)
@@ -47,6 +60,23 @@ extension Homa {
     public func weighted(_ score: Double) -> CandidatePairWeighted {
       CandidatePairWeighted(pair: self, weight: score)
     }
+
+    public func encode(to encoder: any Encoder) throws {
+      var container = encoder.container(keyedBy: CodingKeys.self)
+      try container.encode(keyArray, forKey: .keyArray)
+      try container.encode(value, forKey: .value)
+      if !provenance.isEmpty {
+        try container.encode(provenance.rawValue, forKey: .provenance)
+      }
+    }
+
+    // MARK: Internal
+
+    enum CodingKeys: String, CodingKey {
+      case keyArray
+      case value
+      case provenance = "prov"
+    }
   }
 
   @frozen
@@ -64,7 +94,7 @@ extension Homa {
     }
 
     public init(gram: Gram) {
-      self.pair = .init(keyArray: gram.keyArray, value: gram.current)
+      self.pair = .init(keyArray: gram.keyArray, value: gram.current, provenance: gram.provenance)
       self.weight = gram.probability
     }
 
@@ -10,7 +10,12 @@ extension Homa {
   public struct Gram: Codable, CustomStringConvertible, Equatable, Sendable, Hashable {
     // MARK: Lifecycle
 
-    public init(_ rawTuple: GramRAW, backoff: Double = 0, id: FIUUID = .init()) {
+    public init(
+      _ rawTuple: GramRAW,
+      backoff: Double = 0,
+      provenance: Provenance = [],
+      id: FIUUID = .init()
+    ) {
       self.id = id
       self.keyArray = rawTuple.keyArray
       self.current = rawTuple.value
@@ -21,6 +26,7 @@ extension Homa {
       }
       self.probability = rawTuple.probability
       self.backoff = backoff
+      self.provenance = provenance
     }
 
     public init(
@@ -29,6 +35,7 @@ extension Homa {
       previous: String? = nil,
       probability: Double = 0,
       backoff: Double = 0,
+      provenance: Provenance = [],
       id: FIUUID = .init()
     ) {
       self.id = id
@@ -41,6 +48,7 @@ extension Homa {
       self.current = current
       self.probability = probability
       self.backoff = backoff
+      self.provenance = provenance
     }
 
     public init(from decoder: any Decoder) throws {
@@ -50,6 +58,8 @@ extension Homa {
       self.previous = try container.decodeIfPresent(String.self, forKey: .previous)
       self.probability = try container.decode(Double.self, forKey: .probability)
       self.backoff = try container.decode(Double.self, forKey: .backoff)
+      let rawProvenance = try container.decodeIfPresent(UInt8.self, forKey: .provenance) ?? 0
+      self.provenance = .init(rawValue: rawProvenance)
       self.id = .init()
     }
 
@@ -62,6 +72,8 @@ extension Homa {
     public let previous: String?
     public let probability: Double
     public let backoff: Double // 最大單元圖機率
+    /// 該元圖的來源旗標，由語言模組在生成元圖時標記。不參與相等比較與雜湊。
+    public let provenance: Provenance
 
     public var isUnigram: Bool { previous == nil }
 
@@ -114,7 +126,22 @@ extension Homa {
         current: current,
         previous: previous,
         probability: probability,
-        backoff: backoff
+        backoff: backoff,
+        provenance: provenance
+      )
+    }
+
+    /// 生成追加了給定來源旗標的一份拷貝（識別碼不變）。
+    public func withProvenance(_ extraProvenance: Provenance) -> Self {
+      guard !provenance.isSuperset(of: extraProvenance) else { return self }
+      return .init(
+        keyArray: keyArray,
+        current: current,
+        previous: previous,
+        probability: probability,
+        backoff: backoff,
+        provenance: provenance.union(extraProvenance),
+        id: id
       )
     }
 
@@ -141,6 +168,9 @@ extension Homa {
       try container.encodeIfPresent(previous, forKey: .previous)
       try container.encode(probability, forKey: .probability)
       try container.encode(backoff, forKey: .backoff)
+      if !provenance.isEmpty {
+        try container.encode(provenance.rawValue, forKey: .provenance)
+      }
     }
 
     // MARK: Internal
@@ -151,10 +181,46 @@ extension Homa {
       case previous = "prev"
       case probability = "prob"
       case backoff = "bkof"
+      case provenance = "prov"
     }
   }
 }
 
+// MARK: - Homa.Gram.Provenance
+
+extension Homa.Gram {
+  /// 元圖的來源旗標。
+  ///
+  /// 同一個元圖可以同時帶有多個旗標（例如「使用者辭典裡的巨集」、或「經過語彙置換的原廠詞條」）。
+  /// 候選字詞的朗讀、篩選、與選字窗的裝飾可以直接讀取這些旗標，無須另行維護雜湊集合。
+  public struct Provenance: OptionSet, Codable, Hashable, Sendable {
+    // MARK: Lifecycle
+
+    public init(rawValue: UInt8) {
+      self.rawValue = rawValue
+    }
+
+    // MARK: Public
+
+    /// 原廠辭典。
+    public static let factory = Self(rawValue: 1 << 0)
+    /// 使用者辭典。
+    public static let user = Self(rawValue: 1 << 1)
+    /// 由 InputToken 巨集（含日期時間便捷輸入）展開而得。
+    public static let macro = Self(rawValue: 1 << 2)
+    /// 磁帶模式。
+    public static let cassette = Self(rawValue: 1 << 3)
+    /// 漸退記憶模組的建議。
+    public static let perceived = Self(rawValue: 1 << 4)
+    /// 經過語彙置換。
+    public static let replacement = Self(rawValue: 1 << 5)
+    /// 符號（含使用者符號資料與原廠符號詞條）。
+    public static let symbol = Self(rawValue: 1 << 6)
+
+    public let rawValue: UInt8
+  }
+}
+
 extension Array where Element == Homa.Gram {
   var asGramTypes: (unigrams: [Element], bigrams: [Element]) {
     reduce(into: ([Element](), [Element]())) { result, element in
@@ -45,14 +45,72 @@ extension Homa {
 // MARK: - Homa.GramBorderPointMap
 
 extension Homa {
-  /// 預先計算的「座標 ↔ 幅節索引」對照表載體。
-  /// 供陣列擴充函式以單次掃描同時建構兩張對照字典、再於多次查詢間重複使用，
-  /// 避免 `[GramInPath]` 的每個查詢 API 各自重建字典。
-  internal struct GramBorderPointMap {
-    /// 以幅節索引查座標（Region → Cursor）。
-    internal let regionCursorMap: [Int: Int]
+  /// 組句結果的節點邊界表：以前綴和的形式記錄每個幅節的起點座標。
+  ///
+  /// 建構成本為 O(n)（單次掃描、不建立任何字典），之後的「座標 ↔ 幅節索引」查詢皆為二分搜尋。
+  /// 組字器會在每次組句時一併建構並快取當前組句結果的邊界表（`assembledSentenceBorderMap`），
+  /// 故游標移動、標記、以及組字區顯示等場合不必每次重新掃描整個組句結果。
+  public struct GramBorderPointMap: Hashable, Sendable {
+    // MARK: Lifecycle
+
+    /// 依照給定的組句結果建構邊界表。
+    public init(_ sentence: some Sequence<Homa.GramInPath>) {
+      var borders = [0]
+      borders.reserveCapacity(sentence.underestimatedCount + 1)
+      var cursorCounter = 0
+      sentence.forEach { gram in
+        cursorCounter += gram.keyArray.count
+        borders.append(cursorCounter)
+      }
+      self.borders = borders
+    }
+
+    // MARK: Public
+
+    /// 各幅節的起點座標。最後一筆為總讀音單元數量，故元素數量比幅節數量多一。
+    public let borders: [Int]
+
+    /// 幅節數量。
+    public var regionCount: Int { borders.count - 1 }
+
+    /// 總讀音單元數量。
+    public var totalKeyCount: Int { borders[borders.count - 1] }
+
     /// 以座標查幅節索引（Cursor → Region）。
-    internal let cursorRegionMap: [Int: Int]
+    ///
+    /// 位於句尾的座標對應 `regionCount`；座標 -1 視為 0（防呆）；其餘超界的座標回傳 nil。
+    /// 幅節長度為零的節點不佔據任何座標。
+    public func regionIndex(ofCursor cursor: Int) -> Int? {
+      if cursor == -1 { return 0 } // 防呆
+      guard (0 ... totalKeyCount).contains(cursor) else { return nil }
+      // 找出最後一個起點不大於給定座標的邊界。
+      var lowerBound = 0
+      var upperBound = borders.count
+      while lowerBound < upperBound {
+        let middle = (lowerBound + upperBound) / 2
+        if borders[middle] <= cursor {
+          lowerBound = middle + 1
+        } else {
+          upperBound = middle
+        }
+      }
+      return lowerBound - 1
+    }
+
+    /// 以幅節索引查座標（Region → Cursor）。索引等於 `regionCount` 時回傳句尾座標。
+    public func cursor(ofRegion regionIndex: Int) -> Int? {
+      borders.indices.contains(regionIndex) ? borders[regionIndex] : nil
+    }
+
+    /// 以字典的形式輸出「座標 → 幅節索引」對照表，與 `[GramInPath].cursorRegionMap` 的內容一致。
+    public var cursorRegionMap: [Int: Int] {
+      var result: [Int: Int] = [-1: 0] // 防呆
+      (0 ..< regionCount).forEach { regionIndex in
+        (borders[regionIndex] ..< borders[regionIndex + 1]).forEach { result[$0] = regionIndex }
+      }
+      result[totalKeyCount] = regionCount
+      return result
+    }
   }
 }
 
@@ -223,27 +281,14 @@ extension Array where Element == Homa.GramInPath {
   /// 從一個節點陣列當中取出目前的索引鍵陣列。
   public var keyArrays: [[String]] { map(\.keyArray) }
 
-  /// 返回一連串的節點起點。結果為 (Result A, Result B) 字典陣列。
-  /// Result A 以索引查座標，Result B 以座標查索引。
-  private func makeGramBorderPointMap() -> Homa.GramBorderPointMap {
-    // Result A 以索引查座標，Result B 以座標查索引。
-    var resultA = [Int: Int]()
-    var resultB: [Int: Int] = [-1: 0] // 防呆
-    var cursorCounter = 0
-    enumerated().forEach { gramCounter, neta in
-      resultA[gramCounter] = cursorCounter
-      neta.keyArray.forEach { _ in
-        resultB[cursorCounter] = gramCounter
-        cursorCounter += 1
-      }
-    }
-    resultA[count] = cursorCounter
-    resultB[cursorCounter] = count
-    return .init(regionCursorMap: resultA, cursorRegionMap: resultB)
-  }
+  /// 建構該組句結果的節點邊界表。
+  ///
+  /// 若要查詢的是組字器當前的組句結果，請直接使用組字器快取的 `assembledSentenceBorderMap`。
+  public var borderPointMap: Homa.GramBorderPointMap { .init(self) }
 
   /// 返回一個字典，以座標查索引。允許以游標位置查詢其屬於第幾個幅節座標（從 0 開始算）。
-  public var cursorRegionMap: [Int: Int] { makeGramBorderPointMap().cursorRegionMap }
+  /// - Remark: 該屬性每次都會建構整張字典；單次查詢請改用 `borderPointMap.regionIndex(ofCursor:)`。
+  public var cursorRegionMap: [Int: Int] { borderPointMap.cursorRegionMap }
 
   /// 總讀音單元數量。在絕大多數情況下，可視為總幅節長度。
   public var totalKeyCount: Int { reduce(0) { $0 + $1.keyArray.count } }
@@ -251,29 +296,30 @@ extension Array where Element == Homa.GramInPath {
   /// 根據給定的游標，返回其前後最近的節點邊界。
   /// - Parameter cursor: 給定的游標。
   public func contextRange(ofGivenCursor cursor: Int) -> Range<Int> {
-    contextRange(ofGivenCursor: cursor, using: makeGramBorderPointMap())
+    contextRange(ofGivenCursor: cursor, using: borderPointMap)
   }
 
-  /// 根據給定的游標，返回其前後最近的節點邊界（使用預先建構的對照表）。
+  /// 根據給定的游標，返回其前後最近的節點邊界（使用預先建構的邊界表）。
   /// - Parameters:
   ///   - cursor: 給定的游標。
-  ///   - map: 預先建構的「座標 ↔ 幅節索引」對照表。
-  internal func contextRange(
+  ///   - map: 以該陣列建構的節點邊界表。
+  public func contextRange(
     ofGivenCursor cursor: Int,
     using map: Homa.GramBorderPointMap
   )
     -> Range<Int> {
     guard !isEmpty else { return 0 ..< 0 }
-    let frontestSegLength = reversed()[0].keyArray.count
+    let totalKeyCount = map.totalKeyCount
+    let frontestSegLength = self[count - 1].keyArray.count
     var nilReturn = (totalKeyCount - frontestSegLength) ..< totalKeyCount
     if cursor >= totalKeyCount { return nilReturn } // 防呆
     let cursor = Swift.max(0, cursor) // 防呆
     nilReturn = cursor ..< cursor
     // 下文按道理來講不應該會出現 nilReturn。
-    guard let rearNodeID = map.cursorRegionMap[cursor] else { return nilReturn }
-    guard let rearIndex = map.regionCursorMap[rearNodeID]
+    guard let rearNodeID = map.regionIndex(ofCursor: cursor) else { return nilReturn }
+    guard let rearIndex = map.cursor(ofRegion: rearNodeID)
     else { return nilReturn }
-    guard let frontIndex = map.regionCursorMap[rearNodeID + 1]
+    guard let frontIndex = map.cursor(ofRegion: rearNodeID + 1)
     else { return nilReturn }
     return rearIndex ..< frontIndex
   }
@@ -283,23 +329,23 @@ extension Array where Element == Homa.GramInPath {
   ///   - cursor: 給定游標位置。
   /// - Returns: 查找結果。
   public func findGram(at cursor: Int) -> (gram: Homa.GramInPath, range: Range<Int>)? {
-    findGram(at: cursor, using: makeGramBorderPointMap())
+    findGram(at: cursor, using: borderPointMap)
   }
 
-  /// 在陣列內以給定游標位置找出對應的節點（使用預先建構的對照表）。
+  /// 在陣列內以給定游標位置找出對應的節點（使用預先建構的邊界表）。
   /// - Parameters:
   ///   - cursor: 給定游標位置。
-  ///   - map: 預先建構的「座標 ↔ 幅節索引」對照表。
+  ///   - map: 以該陣列建構的節點邊界表。
   /// - Returns: 查找結果。
-  internal func findGram(
+  public func findGram(
     at cursor: Int,
     using map: Homa.GramBorderPointMap
   )
     -> (gram: Homa.GramInPath, range: Range<Int>)? {
     guard !isEmpty else { return nil }
-    let cursor = Swift.max(0, Swift.min(cursor, totalKeyCount - 1)) // 防呆
+    let cursor = Swift.max(0, Swift.min(cursor, map.totalKeyCount - 1)) // 防呆
     let range = contextRange(ofGivenCursor: cursor, using: map)
-    guard let rearNodeID = map.cursorRegionMap[cursor] else { return nil }
+    guard let rearNodeID = map.regionIndex(ofCursor: cursor) else { return nil }
     guard count - 1 >= rearNodeID else { return nil }
     return (self[rearNodeID], range)
   }
@@ -308,16 +354,16 @@ extension Array where Element == Homa.GramInPath {
   ///
   /// 此處不需要針對 cursor 做邊界檢查。
   public func isCursorCuttingChar(cursor: Int) -> Bool {
-    isCursorCuttingChar(cursor: cursor, using: makeGramBorderPointMap())
+    isCursorCuttingChar(cursor: cursor, using: borderPointMap)
   }
 
-  /// 偵測是否出現游標切斷組字區內字元的情況（使用預先建構的對照表）。
+  /// 偵測是否出現游標切斷組字區內字元的情況（使用預先建構的邊界表）。
   ///
   /// 此處不需要針對 cursor 做邊界檢查。
-  internal func isCursorCuttingChar(cursor: Int, using map: Homa.GramBorderPointMap) -> Bool {
+  public func isCursorCuttingChar(cursor: Int, using map: Homa.GramBorderPointMap) -> Bool {
     let index = cursor
     var isBound = (index == contextRange(ofGivenCursor: index, using: map).lowerBound)
-    if index == totalKeyCount { isBound = true }
+    if index == map.totalKeyCount { isBound = true }
     let rawResult = findGram(at: index, using: map)?.gram.isReadingMismatched ?? false
     return !isBound && rawResult
   }
@@ -326,16 +372,16 @@ extension Array where Element == Homa.GramInPath {
   ///
   /// 此處不需要針對 cursor 做邊界檢查。
   public func isCursorCuttingRegion(cursor: Int) -> Bool {
-    isCursorCuttingRegion(cursor: cursor, using: makeGramBorderPointMap())
+    isCursorCuttingRegion(cursor: cursor, using: borderPointMap)
   }
 
-  /// 偵測游標是否切斷區域（使用預先建構的對照表）。
+  /// 偵測游標是否切斷區域（使用預先建構的邊界表）。
   ///
   /// 此處不需要針對 cursor 做邊界檢查。
-  internal func isCursorCuttingRegion(cursor: Int, using map: Homa.GramBorderPointMap) -> Bool {
+  public func isCursorCuttingRegion(cursor: Int, using map: Homa.GramBorderPointMap) -> Bool {
     let index = cursor
     var isBound = (index == contextRange(ofGivenCursor: index, using: map).lowerBound)
-    if index == totalKeyCount { isBound = true }
+    if index == map.totalKeyCount { isBound = true }
     return !isBound
   }
 
@@ -26,6 +26,7 @@ extension Homa {
       self.gramAvailabilityChecker = gramAvailabilityChecker
       self.config = config
       self.perceptor = perceptor
+      self.assembledSentenceBorderMap = .init(config.assembledSentence)
       self.gramQueryCache = [:]
       self.gramQueryCacheOrder = []
     }
@@ -40,6 +41,8 @@ extension Homa {
       self.perceptor = target.perceptor
       self.gramQueryCache = target.gramQueryCache
       self.gramQueryCacheOrder = target.gramQueryCacheOrder
+      self.assemblyGeneration = target.assemblyGeneration
+      self.assembledSentenceBorderMap = target.assembledSentenceBorderMap
     }
 
     // MARK: Public
@@ -72,13 +75,33 @@ extension Homa {
     /// 最近一次組句結果。
     public var assembledSentence: [GramInPath] {
       get { config.assembledSentence }
-      set { config.assembledSentence = newValue }
+      set {
+        config.assembledSentence = newValue
+        assemblyGeneration = .init()
+        assembledSentenceBorderMap = .init(newValue)
+      }
     }
 
+    /// 最近一次組句結果的節點邊界表，隨 `assembledSentence` 一併更新。
+    ///
+    /// 需要針對當前組句結果查詢游標所在節點、節點邊界等資訊時，
+    /// 請將此表傳給 `[GramInPath]` 的各個 `using:` 查詢函式，以免每次重新掃描整個組句結果。
+    public private(set) var assembledSentenceBorderMap = Homa.GramBorderPointMap([])
+
+    /// 組句世代戳記：每當 `assembledSentence` 被改寫（含清空）時都會換發新值。
+    ///
+    /// 該值在全域範圍內唯一（不同組字器副本之間亦不會撞號），
+    /// 故外部可將其作為「組句結果是否有變」的快取失效依據，而無須比對整個組句結果陣列。
+    /// 硬拷貝出來的副本會沿用原本的戳記，因為兩者的組句結果完全相同。
+    public private(set) var assemblyGeneration = FIUUID()
+
     /// 該組字器已經插入的的索引鍵，以陣列的形式存放。
     public private(set) var keys: [PossibleKey] {
       get { config.keys }
-      set { config.keys = newValue }
+      set {
+        config.keys = newValue
+        gridGeneration &+= 1
+      }
     }
 
     /// 回傳當前組句結果所對應的真實讀音索引鍵陣列。
@@ -91,9 +114,15 @@ extension Homa {
     /// 該組字器的幅節單元陣列。
     /// - Remark: setter 為 `internal`：組字器在模組內部需要就地改寫節點狀態（節點為
     /// Struct、無法再靠引用穿透值拷貝），但對模組外部維持唯讀。
+    ///
+    /// 經由此屬性的改寫皆視為軌格結構變動（會令候選字快取失效）。
+    /// 僅改動節點覆寫狀態、而不動到元圖內容的場合，請直接改寫 `config.segments`。
     public internal(set) var segments: [Segment] {
       get { config.segments }
-      set { config.segments = newValue }
+      set {
+        config.segments = newValue
+        gridGeneration &+= 1
+      }
     }
 
     /// 該組字器的敲字游標位置。
@@ -111,7 +140,10 @@ extension Homa {
     /// 該軌格內可以允許的最大幅節長度。
     public var maxSegLength: Int {
       get { config.maxSegLength }
-      set { config.maxSegLength = newValue }
+      set {
+        config.maxSegLength = newValue
+        gridGeneration &+= 1
+      }
     }
 
     /// 該組字器的長度，組字器內已經插入的單筆索引鍵的數量，也就是內建漢字讀音的數量（唯讀）。
@@ -156,6 +188,9 @@ extension Homa {
     /// 最近一次的組句結果陣列也會被清空。游標跳轉換算表也會被清空。
     public func clear() {
       config.clear()
+      assemblyGeneration = .init()
+      assembledSentenceBorderMap = .init([])
+      gridGeneration &+= 1
       gramQueryCache.removeAll(keepingCapacity: true)
       gramQueryCacheOrder.removeAll(keepingCapacity: true)
     }
@@ -260,7 +295,7 @@ extension Homa {
     /// 偵測是否出現游標切斷組字區內字元的情況。
     public func isCursorCuttingChar(isMarker: Bool = false) -> Bool {
       let index = isMarker ? marker : cursor
-      return assembledSentence.isCursorCuttingChar(cursor: index)
+      return assembledSentence.isCursorCuttingChar(cursor: index, using: assembledSentenceBorderMap)
     }
 
     /// 判斷游標是否可以繼續沿著給定方向移動。
@@ -323,23 +358,23 @@ extension Homa {
         throw Homa.Exception.cursorAlreadyAtBorder
       default: break
       }
-      guard let currentRegion = assembledSentence.cursorRegionMap[target] else {
+      let borderMap = assembledSentenceBorderMap
+      guard let currentRegion = borderMap.regionIndex(ofCursor: target) else {
         throw Homa.Exception.cursorRegionMapMatchingFailure
       }
       let guardedCurrentRegion = min(assembledSentence.count - 1, currentRegion)
       let aRegionForward = max(currentRegion - 1, 0)
-      let currentRegionBorderRear: Int = assembledSentence[
-        0 ..< currentRegion
-      ].map(\.segLength).reduce(0, +)
+      // 邊界表內的各筆起點座標即為前方所有幅節長度的和，不必再逐一加總。
+      let currentRegionBorderRear: Int = borderMap.borders[currentRegion]
       switch target {
       case currentRegionBorderRear:
         switch direction {
         case .front:
           target = (currentRegion > assembledSentence.count)
             ? keys.count
-            : assembledSentence[0 ... guardedCurrentRegion].map(\.segLength).reduce(0, +)
+            : borderMap.borders[guardedCurrentRegion + 1]
         case .rear:
-          target = assembledSentence[0 ..< aRegionForward].map(\.segLength).reduce(0, +)
+          target = borderMap.borders[aRegionForward]
         }
       default:
         switch direction {
@@ -383,10 +418,13 @@ extension Homa {
         }
       }
       var nodesChangedCounter = 0
+      var windowsVisited = 0
+      let probe = Homa.PerfHooks.begin("Homa.Assembler.assignNodes")
       rangeOfPositions.forEach { position in
         let rangeOfLengths = 1 ... min(maxSegLength, rangeOfPositions.upperBound - position)
         rangeOfLengths.forEach { theLength in
           guard position + theLength <= keys.count, position >= 0 else { return }
+          windowsVisited += 1
           let alternativesSlice = keys[position ..< (position + theLength)]
           let queriedGrams = queryGramsForAlternatives(alternativesSlice)
           if (0 ..< segments.count).contains(position),
@@ -415,6 +453,9 @@ extension Homa {
           nodesChangedCounter += 1
         }
       }
+      Homa.PerfHooks.end(probe)
+      Homa.PerfHooks.count("Homa.Assembler.assignNodes.windows", by: windowsVisited)
+      Homa.PerfHooks.count("Homa.Assembler.assignNodes.nodesChanged", by: nodesChangedCounter)
       guard nodesChangedCounter != 0 else { throw Homa.Exception.noNodesAssigned }
       assemble()
     }
@@ -431,6 +472,20 @@ extension Homa {
       config.restoreFromNodeOverrideStatusMirror(mirror)
     }
 
+    // MARK: Internal
+
+    /// 目前巢狀開啟的覆寫交易層數。詳見 `performOverrideTransaction()`。
+    internal var overrideTransactionDepth = 0
+
+    /// 軌格結構世代：索引鍵、幅節、或節點元圖內容有變動時遞增。
+    ///
+    /// 節點覆寫狀態的變動（選字、爬軌時的自動覆寫）不影響候選字清單，故不計入。
+    internal private(set) var gridGeneration = 0
+
+    /// `fetchCandidates()` 的結果快取，僅在 `candidateCacheGeneration == gridGeneration` 時有效。
+    internal var candidateCache = [CandidateCacheKey: [Homa.CandidatePairWeighted]]()
+    internal var candidateCacheGeneration = 0
+
     // MARK: Private
 
     private struct GramQueryCacheKey: Hashable {
@@ -507,8 +562,10 @@ extension Homa {
       -> [Homa.Gram] {
       let cacheKey = GramQueryCacheKey(keyArraySlice)
       if let cached = gramQueryCache[cacheKey] {
+        Homa.PerfHooks.count("Homa.Assembler.gramQuery.cacheHit")
         return cached
       }
+      Homa.PerfHooks.count("Homa.Assembler.gramQuery.cacheMiss")
       var newResult = gramQuerier(Array(keyArraySlice))
       newResult.sort(by: Self.sortGram)
       // 就地去重（依身份雜湊），與舊版「sorted + compactMap」的語義完全一致：
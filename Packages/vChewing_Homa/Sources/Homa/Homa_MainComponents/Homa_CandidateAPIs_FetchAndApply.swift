@@ -14,6 +14,9 @@ extension Homa.Assembler {
   /// 返回在當前位置的所有候選字詞（以詞音配對的形式）。如果組字器內有幅節、且游標
   /// 位於組字器的（文字輸入順序的）最前方（也就是游標位置的數值是最大合規數值）的
   /// 話，那麼這裡會對 location 的位置自動減去 1、以免去在呼叫該函式後再處理的麻煩。
+  ///
+  /// 結果會依（糾偏後的位置, 篩選條件）快取，直到軌格結構有變動為止；
+  /// 故在未敲字刪字的情況下反覆開啟選字窗或輪替候選字時，不會重新掃描節點。
   /// - Parameter location: 游標位置，必須是顯示的游標位置、不得做任何事先糾偏處理。
   /// - Returns: 候選字音配對陣列。
   public func fetchCandidates(
@@ -21,8 +24,7 @@ extension Homa.Assembler {
     filter givenFilter: CandidateFetchFilter = .all
   )
     -> [Homa.CandidatePairWeighted] {
-    var result = [Homa.CandidatePairWeighted]()
-    guard !keys.isEmpty else { return result }
+    guard !keys.isEmpty else { return [] }
     var location = max(min(givenLocation ?? cursor, keys.count), 0)
     var filter = givenFilter
     if filter == .endAt {
@@ -30,6 +32,38 @@ extension Homa.Assembler {
       location -= 1
     }
     location = max(min(location, keys.count - 1), 0)
+    if candidateCacheGeneration != gridGeneration {
+      candidateCache.removeAll(keepingCapacity: true)
+      candidateCacheGeneration = gridGeneration
+    }
+    let cacheKey = CandidateCacheKey(location: location, filter: filter)
+    if let cached = candidateCache[cacheKey] {
+      Homa.PerfHooks.count("Homa.Assembler.fetchCandidates.cacheHit")
+      return cached
+    }
+    Homa.PerfHooks.count("Homa.Assembler.fetchCandidates.cacheMiss")
+    let result = collectCandidates(at: location, filter: filter)
+    candidateCache[cacheKey] = result
+    return result
+  }
+
+  // MARK: Internal
+
+  /// `fetchCandidates()` 的快取索引鍵。位置與篩選條件皆為糾偏之後的結果。
+  internal struct CandidateCacheKey: Hashable {
+    let location: Int
+    let filter: CandidateFetchFilter
+  }
+
+  // MARK: Private
+
+  /// 實際掃描節點以收集候選字詞，並依「幅節長度、讀音、權重」降冪排列。
+  private func collectCandidates(
+    at location: Int,
+    filter: CandidateFetchFilter
+  )
+    -> [Homa.CandidatePairWeighted] {
+    var result = [Homa.CandidatePairWeighted]()
     let anchors: [(location: Int, node: Homa.Node)] = fetchOverlappingNodes(at: location)
     let keyAtCursor = keys[location]
     let cursorAlternatives = keyAtCursor.allValues
@@ -52,28 +86,41 @@ extension Homa.Assembler {
         }
         let newCandidate = Homa.CandidatePair(
           keyArray: gram.keyArray,
-          value: gram.current
+          value: gram.current,
+          provenance: gram.provenance
         ).weighted(gram.probability)
-        guard !seen.contains(newCandidate.pair) else { return }
+        guard seen.insert(newCandidate.pair).inserted else { return }
         result.append(newCandidate)
-        seen.insert(newCandidate.pair)
       }
     }
-    // 預先為每個候選字算好排序鍵值，避免 comparator 在每次比較時重新 joined() 出字串
-    // （原先每次候選窗開啟都會產生 O(n·log n) 個一次性字串）。
+    // 同一讀音的候選字共用同一個整數排序名次：僅對相異的讀音字串排序一次，
+    // 而不是替每個候選字各自 joined() 出排序用字串。
+    var joinedKeys = [[String]: String]()
+    result.forEach { candidate in
+      guard joinedKeys[candidate.pair.keyArray] == nil else { return }
+      joinedKeys[candidate.pair.keyArray] = candidate.pair.keyArray.joined(separator: "-")
+    }
+    var ranksOfJoinedKeys = [String: Int]()
+    Set(joinedKeys.values).sorted().enumerated().forEach { rank, joinedKey in
+      ranksOfJoinedKeys[joinedKey] = rank
+    }
     let keyed = result.map { candidate in
       (
         segLength: candidate.pair.segLength,
-        joinedKey: candidate.pair.keyArray.joined(separator: "-"),
+        keyRank: joinedKeys[candidate.pair.keyArray].flatMap { ranksOfJoinedKeys[$0] } ?? 0,
         weight: candidate.weight,
         candidate: candidate
       )
     }
     return keyed.sorted {
-      ($0.segLength, $0.joinedKey, $0.weight) > ($1.segLength, $1.joinedKey, $1.weight)
+      ($0.segLength, $0.keyRank, $0.weight) > ($1.segLength, $1.keyRank, $1.weight)
     }.map(\.candidate)
   }
+}
 
+// MARK: - Extending Assembler for Candidates (Apply).
+
+extension Homa.Assembler {
   /// 使用給定的候選字（詞音配對），將給定位置的節點的候選字詞改為與之一致的候選字詞。
   ///
   /// 該函式僅用作過程函式。
@@ -152,6 +199,29 @@ extension Homa.Assembler {
     )
   }
 
+  /// 以交易的方式批次覆寫候選字詞。
+  ///
+  /// 閉包內的每一次覆寫都只改動軌格上的節點狀態，不會各自重新組句；
+  /// 組句（`assemble()`）僅在最外層的交易結束時執行一次（閉包拋出錯誤時亦然）。
+  /// 交易可以巢狀開啟，內層交易結束時不會組句。
+  ///
+  /// - Remark: 交易期間 `assembledSentence` 維持交易開始前的內容，
+  /// 且交易內的覆寫不會向感知器（或 perceptionHandler）回報任何觀測結果。
+  /// - Parameter body: 在交易內執行的覆寫作業。
+  /// - Returns: 閉包的回傳值。
+  @discardableResult
+  public func performOverrideTransaction<R>(_ body: () throws -> R) rethrows -> R {
+    overrideTransactionDepth += 1
+    defer {
+      overrideTransactionDepth -= 1
+      if overrideTransactionDepth == 0 { assemble() }
+    }
+    return try body()
+  }
+
+  /// 目前是否處於覆寫交易當中。
+  public var isInOverrideTransaction: Bool { overrideTransactionDepth > 0 }
+
   // MARK: Internal implementations.
 
   /// 使用給定的候選字（詞音配對）、或給定的候選字詞字串，將給定位置的節點的候選字詞改為與之一致的候選字詞。
@@ -182,7 +252,9 @@ extension Homa.Assembler {
       throw Homa.Exception.nothingOverriddenAtNode
     }
 
-    let shouldObserve = perceptionHandler != nil || perceptor != nil
+    // 覆寫交易期間不組句，故也無從觀測覆寫前後的組句差異。
+    let isInTransaction = isInOverrideTransaction
+    let shouldObserve = !isInTransaction && (perceptionHandler != nil || perceptor != nil)
     let previouslyAssembled: [Homa.GramInPath] = shouldObserve ? assemble() : []
     let cursorBeforeOverride = min(keys.count, location)
 
@@ -216,7 +288,7 @@ extension Homa.Assembler {
             currentUnigramIndex: nodeCopy.currentGramIndex
           )
         }
-        segments[anchor.location][anchor.node.segLength] = nodeCopy
+        config.segments[anchor.location][anchor.node.segLength] = nodeCopy
         // 保存修改後的節點拷貝（含覆寫狀態），供後續重疊節點處理讀取。
         overridden = (location: anchor.location, node: nodeCopy)
         break
@@ -234,7 +306,7 @@ extension Homa.Assembler {
     }
 
     defer {
-      let currentAssembled = assemble()
+      let currentAssembled: [Homa.GramInPath] = isInTransaction ? [] : assemble()
       if shouldObserve {
         let intel = Homa.makePerceptionIntel(
           previouslyAssembled: previouslyAssembled,
@@ -277,7 +349,7 @@ extension Homa.Assembler {
             isExplicitlyOverridden: nodeCopy.isExplicitlyOverridden,
             currentUnigramIndex: nodeCopy.currentGramIndex
           )
-          segments[anchor.location][anchor.node.segLength] = nodeCopy
+          config.segments[anchor.location][anchor.node.segLength] = nodeCopy
         }
         continue
       }
@@ -294,7 +366,7 @@ extension Homa.Assembler {
         } else {
           nodeCopy.overridingScore /= 4
         }
-        segments[anchor.location][anchor.node.segLength] = nodeCopy
+        config.segments[anchor.location][anchor.node.segLength] = nodeCopy
       }
     }
   }
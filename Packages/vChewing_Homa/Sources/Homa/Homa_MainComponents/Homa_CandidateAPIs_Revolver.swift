@@ -70,9 +70,10 @@ extension Homa.Assembler {
     if currentSentence.isEmpty { currentSentence = assemble() }
 
     // 獲取當前游標位置和區域資訊
-    let regionMap = currentSentence.cursorRegionMap
+    let borderMap = assembledSentenceBorderMap
     let candidateCursorPos = getLogicalCandidateCursorPosition(forCursor: cursorType)
-    guard let regionID = regionMap[candidateCursorPos], assembledSentence.count > regionID else {
+    guard let regionID = borderMap.regionIndex(ofCursor: candidateCursorPos),
+          assembledSentence.count > regionID else {
       throw Homa.Exception.cursorOutOfReasonableNodeRegions
     }
 
@@ -82,7 +83,7 @@ extension Homa.Assembler {
       keyArray: currentGramInPath.keyArray,
       value: currentGramInPath.value
     )
-    let currentRange = currentSentence.contextRange(ofGivenCursor: candidateCursorPos)
+    let currentRange = currentSentence.contextRange(ofGivenCursor: candidateCursorPos, using: borderMap)
 
     // Soft revolve：過濾掉會跨越鄰近 explicit 節點的候選，僅在安全子集內輪替。
     // 一個候選為「不安全」若其 segLength > 1 且覆寫範圍涵蓋任何「非當前節點」的 explicit 節點。
@@ -165,7 +166,10 @@ extension Homa.Assembler {
       }
 
       let currentSentence = assembledSentence
-      let currentGramAtCursor = currentSentence.findGram(at: candidateCursorPos)?.gram
+      let currentGramAtCursor = currentSentence.findGram(
+        at: candidateCursorPos,
+        using: assembledSentenceBorderMap
+      )?.gram
       let currentPairAtCursor = currentGramAtCursor.map {
         Homa.CandidatePair(
           keyArray: $0.keyArray,
@@ -43,87 +43,92 @@ extension Homa.Assembler {
     // 沒有任何可鞏固區間的話，提前結束。
     guard !consolidationRange.isEmpty else { return }
 
+    // 鞏固的對象是鞏固前的組句結果，故先取得其快照與邊界表。
+    let sentenceSnapshot = assembledSentence
+    let borderMap = assembledSentenceBorderMap
     // 用於避免重複處理同一節點。
-    var nodeIndices = [Int]()
+    var nodeIndices = Set<Int>()
 
-    // 自鞏固下界開始掃描，逐節點鎖定並處理內容。
-    var position = consolidationRange.lowerBound
-    while position < consolidationRange.upperBound {
-      guard let regionIndex = assembledSentence.cursorRegionMap[position] else {
-        // 該位置沒有對應節點，往後尋找。
-        position += 1
-        continue
-      }
-      if nodeIndices.contains(regionIndex) {
-        // 同一節點已處理，跳過重複索引。
-        position += 1
-        continue
-      }
-      nodeIndices.append(regionIndex)
+    // 所有鎖定都在同一筆覆寫交易內進行，僅在交易結束時重新組句一次。
+    try performOverrideTransaction {
+      // 自鞏固下界開始掃描，逐節點鎖定並處理內容。
+      var position = consolidationRange.lowerBound
+      while position < consolidationRange.upperBound {
+        guard let regionIndex = borderMap.regionIndex(ofCursor: position) else {
+          // 該位置沒有對應節點，往後尋找。
+          position += 1
+          continue
+        }
+        guard nodeIndices.insert(regionIndex).inserted else {
+          // 同一節點已處理，跳過重複索引。
+          position += 1
+          continue
+        }
 
-      guard assembledSentence.indices.contains(regionIndex) else { break }
-      guard let currentHit = assembledSentence.findGram(at: position) else {
-        position += 1
-        continue
-      }
-      let currentNode = currentHit.gram
-      let nodeLength = currentNode.keyArray.count
-      guard nodeLength > 0 else {
-        position += 1
-        continue
-      }
+        guard sentenceSnapshot.indices.contains(regionIndex) else { break }
+        guard let currentHit = sentenceSnapshot.findGram(at: position, using: borderMap) else {
+          position += 1
+          continue
+        }
+        let currentNode = currentHit.gram
+        let nodeLength = currentNode.keyArray.count
+        guard nodeLength > 0 else {
+          position += 1
+          continue
+        }
 
-      let nodeStart = currentHit.range.lowerBound
-      let nodeRange = currentHit.range
-      let overlapsTarget = nodeRange.overlaps(candidateRange)
-      var nextPosition = nodeStart
+        let nodeStart = currentHit.range.lowerBound
+        let nodeRange = currentHit.range
+        let overlapsTarget = nodeRange.overlaps(candidateRange)
+        var nextPosition = nodeStart
 
-      let values = currentNode.value.map(\.description)
+        let values = currentNode.value.map(\.description)
 
-      if !overlapsTarget {
-        // 節點不與覆寫範圍接觸時，先嘗試整段覆寫，失敗再退回逐鍵覆寫流程。
-        attempt: do {
-          try overrideNodeAsWhole(currentNode, at: nodeStart)
-          position = nodeStart + nodeLength
+        if !overlapsTarget {
+          // 節點不與覆寫範圍接觸時，先嘗試整段覆寫，失敗再退回逐鍵覆寫流程。
+          attempt: do {
+            try overrideNodeAsWhole(currentNode, at: nodeStart)
+            position = nodeStart + nodeLength
+            continue
+          } catch {
+            break attempt
+          }
+          guard values.count == currentNode.keyArray.count else {
+            position = nodeStart + nodeLength
+            continue
+          }
+          for (subPosition, key) in currentNode.keyArray.enumerated() {
+            guard values.count > subPosition else { break }
+            let pair = Homa.CandidatePair(keyArray: [key], value: values[subPosition])
+            try? overrideCandidate(pair, at: nextPosition)
+            nextPosition += 1
+          }
+          position = nextPosition
           continue
-        } catch {
-          break attempt
         }
+
         guard values.count == currentNode.keyArray.count else {
+          // 與覆寫範圍相交但缺少完整值時，改用強制整段覆寫。
+          attempt: do {
+            try overrideNodeAsWhole(currentNode, at: nodeStart)
+            position = nodeStart + nodeLength
+            continue
+          } catch {
+            break attempt
+          }
           position = nodeStart + nodeLength
           continue
         }
+
+        // 節點與覆寫範圍相交且值完整，改以逐鍵覆寫確保最終內容與原值一致。
         for (subPosition, key) in currentNode.keyArray.enumerated() {
           guard values.count > subPosition else { break }
           let pair = Homa.CandidatePair(keyArray: [key], value: values[subPosition])
-          try? overrideCandidate(pair, at: nextPosition)
+          try overrideCandidate(pair, at: nextPosition)
           nextPosition += 1
         }
         position = nextPosition
-        continue
       }
-
-      guard values.count == currentNode.keyArray.count else {
-        // 與覆寫範圍相交但缺少完整值時，改用強制整段覆寫。
-        attempt: do {
-          try overrideNodeAsWhole(currentNode, at: nodeStart)
-          position = nodeStart + nodeLength
-          continue
-        } catch {
-          break attempt
-        }
-        position = nodeStart + nodeLength
-        continue
-      }
-
-      // 節點與覆寫範圍相交且值完整，改以逐鍵覆寫確保最終內容與原值一致。
-      for (subPosition, key) in currentNode.keyArray.enumerated() {
-        guard values.count > subPosition else { break }
-        let pair = Homa.CandidatePair(keyArray: [key], value: values[subPosition])
-        try overrideCandidate(pair, at: nextPosition)
-        nextPosition += 1
-      }
-      position = nextPosition
     }
   }
 
@@ -145,6 +150,7 @@ extension Homa.Assembler {
     -> (range: Range<Int>, debugInfo: String) {
     // 暫存既有句子內容，以便乾操控後恢復。
     let currentAssembledSentence = assembledSentence
+    let currentBorderMap = assembledSentenceBorderMap
     var frontBoundaryEX = candidateRange.upperBound
     var rearBoundaryEX = candidateRange.lowerBound
     var debugIntelToPrint = ""
@@ -173,38 +179,46 @@ extension Homa.Assembler {
       isExplicitlyOverridden: true,
       enforceRetokenization: true
     )) != nil {
-      assemble()
+      // 覆寫函式只會在覆寫交易以外自行組句。
+      if isInOverrideTransaction { assemble() }
       let probeCursor = Swift.min(
         Swift.max(candidateRange.lowerBound, cursorPosition),
         Swift.max(candidateRange.upperBound - 1, candidateRange.lowerBound)
       )
-      let range = assembledSentence.contextRange(ofGivenCursor: probeCursor)
+      let range = assembledSentence.contextRange(
+        ofGivenCursor: probeCursor,
+        using: assembledSentenceBorderMap
+      )
       rearBoundaryEX = Swift.min(rearBoundaryEX, range.lowerBound)
       frontBoundaryEX = Swift.max(frontBoundaryEX, range.upperBound)
       debugIntelToPrint.append("EX: \(rearBoundaryEX)..<\(frontBoundaryEX), ")
     }
 
     // 與當前上下文邊界做比較，計算初步的鞏固範圍。
-    let initialRange = currentAssembledSentence.contextRange(ofGivenCursor: cursorPosition)
+    let initialRange = currentAssembledSentence.contextRange(
+      ofGivenCursor: cursorPosition,
+      using: currentBorderMap
+    )
     var rearBoundary = Swift.min(initialRange.lowerBound, rearBoundaryEX)
     var frontBoundary = Swift.max(initialRange.upperBound, frontBoundaryEX)
     debugIntelToPrint.append("INI: \(rearBoundary)..<\(frontBoundary), ")
 
-    // 向後計算
-    // 先往游標後方跳 Segment 以取得最靠後的安全邊界。
-    let cursorTempBackup = cursor
-    while cursor > rearBoundary {
-      try? jumpCursorBySegment(to: .rear)
-    }
-    rearBoundary = Swift.min(cursor, rearBoundary)
+    // 以試算後的組句結果的節點邊界擴張鞏固範圍。
+    // 效果等同於從當前游標反覆呼叫 `jumpCursorBySegment()` 直到越過邊界為止，
+    // 但不必真的挪動游標。邊界表的起點座標本身即為遞增排列。
+    let borderPoints = assembledSentenceBorderMap.borders
 
-    // 再往前跳 Segment，避免超出句子長度與範圍。
-    cursor = cursorTempBackup
-    while cursor < frontBoundary {
-      try? jumpCursorBySegment(to: .front)
-    }
-    frontBoundary = Swift.min(Swift.max(cursor, frontBoundary), length)
-    cursor = cursorTempBackup
+    // 向後計算：取得不超過後側邊界的最靠後的節點邊界。
+    let rearBorder = cursor > rearBoundary
+      ? (borderPoints.last { $0 <= rearBoundary } ?? 0)
+      : cursor
+    rearBoundary = Swift.min(rearBorder, rearBoundary)
+
+    // 向前計算：取得不小於前側邊界的最靠前的節點邊界，避免超出句子長度與範圍。
+    let frontBorder = cursor < frontBoundary
+      ? (borderPoints.first { $0 >= frontBoundary } ?? length)
+      : cursor
+    frontBoundary = Swift.min(Swift.max(frontBorder, frontBoundary), length)
 
     debugIntelToPrint.append("FIN: \(rearBoundary)..<\(frontBoundary)")
 
@@ -11,7 +11,9 @@ extension Homa.Assembler {
   /// - Returns: 組句結果（已選字詞陣列）。
   @discardableResult
   public func assemble() -> [Homa.GramInPath] {
+    let probe = Homa.PerfHooks.begin("Homa.Assembler.assemble")
     let result = Homa.PathFinder.run(config: &config)
+    Homa.PerfHooks.end(probe)
     assembledSentence = result
     return assembledSentence
   }
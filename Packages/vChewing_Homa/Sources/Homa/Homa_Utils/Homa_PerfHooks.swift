@@ -0,0 +1,78 @@
+// (c) 2025 and onwards The vChewing Project (LGPL v3.0 License or later).
+// ====================
+// This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
+
+// MARK: - Homa.PerfHooks
+
+extension Homa {
+  /// 熱路徑量測掛鉤。
+  ///
+  /// Homa 不依賴任何時鐘或同步原語，故計時與彙整工作皆交由宿主注入的 `sink` 處理。
+  /// 只有在以 `-DVCHEWING_PERF_PROBES` 建置時，組字器才會呼叫這些掛鉤；
+  /// 否則 `begin()` / `end()` / `count()` 皆為空函式、會在編譯期被消除。
+  public enum PerfHooks {
+    // MARK: Public
+
+    /// 宿主提供的量測資料接收端。
+    public struct Sink {
+      // MARK: Lifecycle
+
+      /// - Parameters:
+      ///   - now: 單調時鐘（奈秒）。
+      ///   - recordSpan: 接收已結束的計時區段。
+      ///   - recordCounter: 接收計數器增量。
+      public init(
+        now: @escaping () -> UInt64,
+        recordSpan: @escaping (_ name: String, _ nanoseconds: UInt64) -> (),
+        recordCounter: @escaping (_ name: String, _ delta: Int) -> ()
+      ) {
+        self.now = now
+        self.recordSpan = recordSpan
+        self.recordCounter = recordCounter
+      }
+
+      // MARK: Internal
+
+      let now: () -> UInt64
+      let recordSpan: (_ name: String, _ nanoseconds: UInt64) -> ()
+      let recordCounter: (_ name: String, _ delta: Int) -> ()
+    }
+
+    /// 計時區段的憑據。未啟用量測時不攜帶任何資料。
+    public struct Token {
+      #if VCHEWING_PERF_PROBES
+        let name: StaticString
+        let startTime: UInt64
+      #endif
+    }
+
+    /// 宿主注入的量測資料接收端。應於啟動時設定一次。
+    nonisolated(unsafe) public static var sink: Sink?
+
+    // MARK: Internal
+
+    @inline(__always)
+    static func begin(_ name: StaticString) -> Token {
+      #if VCHEWING_PERF_PROBES
+        return Token(name: name, startTime: sink?.now() ?? 0)
+      #else
+        return Token()
+      #endif
+    }
+
+    @inline(__always)
+    static func end(_ token: Token) {
+      #if VCHEWING_PERF_PROBES
+        guard let sink else { return }
+        sink.recordSpan(token.name.description, sink.now() &- token.startTime)
+      #endif
+    }
+
+    @inline(__always)
+    static func count(_ name: StaticString, by delta: Int = 1) {
+      #if VCHEWING_PERF_PROBES
+        sink?.recordCounter(name.description, delta)
+      #endif
+    }
+  }
+}
@@ -1132,6 +1132,67 @@ public struct HomaTestsAdvanced: HomaTestSuite {
     #expect(assembler.assembledSentence.map(\ .value) == ["幾", "呼氣", "坑"])
   }
 
+  @Test("[Homa] Assembler_CandidateCacheFollowsGridGeneration")
+  func testCandidateCacheFollowsGridGeneration() async throws {
+    let mockLM = TestLM(rawData: HomaTests.strLMSampleDataHutao)
+    let assembler = Homa.Assembler(
+      gramQuerier: { mockLM.queryGrams($0) }
+    )
+    try ["neng2", "liu2", "yi4"].forEach { try assembler.insertKey($0) }
+    let candidatesBefore = assembler.fetchCandidates(filter: .endAt)
+    #expect(candidatesBefore.first?.pair.value == "留意")
+    #expect(assembler.candidateCache.count == 1)
+
+    // 覆寫只改動節點狀態，不令快取失效。
+    let generationBefore = assembler.gridGeneration
+    try assembler.overrideCandidate(.init(keyArray: ["yi4"], value: "亦"), at: 2)
+    #expect(assembler.gridGeneration == generationBefore)
+    #expect(assembler.fetchCandidates(filter: .endAt) == candidatesBefore)
+
+    // 敲字會令快取失效，且新的候選字清單反映新的讀音。
+    try assembler.insertKey("lv3")
+    #expect(assembler.gridGeneration != generationBefore)
+    let candidatesAfter = assembler.fetchCandidates(filter: .endAt)
+    #expect(candidatesAfter.first?.pair.value == "一縷")
+    #expect(candidatesAfter.allSatisfy { $0.pair.keyArray.last == "lv3" })
+    #expect(assembler.candidateCache.count == 1)
+  }
+
+  @Test("[Homa] Assembler_OverrideTransactionAssemblesOnceAtCommit")
+  func testOverrideTransactionAssemblesOnceAtCommit() async throws {
+    let mockLM = TestLM(rawData: HomaTests.strLMSampleDataHutao)
+    let assembler = Homa.Assembler(
+      gramQuerier: { mockLM.queryGrams($0) }
+    )
+    try ["neng2", "liu2", "yi4", "lv3", "fang1"].forEach { try assembler.insertKey($0) }
+    assembler.assemble()
+    let sequential = assembler.copy
+    let overrides: [(location: Int, pair: Homa.CandidatePair)] = [
+      (1, .init(keyArray: ["liu2"], value: "流")),
+      (2, .init(keyArray: ["yi4"], value: "亦")),
+      (3, .init(keyArray: ["lv3", "fang1"], value: "呂方")),
+    ]
+
+    var perceptionCount = 0
+    assembler.perceptor = { _ in perceptionCount += 1 }
+    let generationBefore = assembler.assemblyGeneration
+    let sentenceBefore = assembler.assembledSentence.values
+    try assembler.performOverrideTransaction {
+      try overrides.forEach { try assembler.overrideCandidate($0.pair, at: $0.location) }
+      // 交易期間不組句。
+      #expect(assembler.isInOverrideTransaction)
+      #expect(assembler.assemblyGeneration == generationBefore)
+      #expect(assembler.assembledSentence.values == sentenceBefore)
+    }
+    #expect(!assembler.isInOverrideTransaction)
+    #expect(assembler.assemblyGeneration != generationBefore)
+    #expect(perceptionCount == 0)
+
+    try overrides.forEach { try sequential.overrideCandidate($0.pair, at: $0.location) }
+    #expect(assembler.assembledSentence.values == sequential.assembledSentence.values)
+    #expect(assembler.assembledSentence.values == ["能", "流", "亦", "呂方"])
+  }
+
   /// 邊緣案例測試：再創世的凱歌（再創紀の凱歌）。
   @Test("[Homa] Perception Intel API (SaisoukiNoGaika)")
   func testPerceptionIntel_SaisoukiNoGaika() async throws {
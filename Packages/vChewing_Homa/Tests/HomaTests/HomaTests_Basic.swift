@@ -2,6 +2,7 @@
 // ====================
 // This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
 
+import Foundation
 import HomaSharedTestComponents
 import Testing
 
@@ -106,6 +107,47 @@ public struct HomaTestsBasic: HomaTestSuite {
     #expect(Set([lhs, rhs]).count == 1)
   }
 
+  @Test("[Homa] Gram_ProvenanceIsMetadataOnly")
+  func testGramProvenanceIsMetadataOnly() async throws {
+    let plain = Homa.Gram(keyArray: ["ㄅㄛ"], current: "波", probability: -1)
+    let tagged = plain.withProvenance([.user, .macro])
+    #expect(tagged.id == plain.id)
+    #expect(tagged.provenance == [.user, .macro])
+    #expect(tagged.withProvenance(.user).provenance == [.user, .macro])
+    // 來源旗標不參與相等比較與雜湊。
+    #expect(tagged == plain)
+    #expect(Set([tagged, plain]).count == 1)
+    #expect(tagged.withNewIdentity().provenance == tagged.provenance)
+    // 編碼時僅在旗標非空時寫出，舊資料解碼後旗標為空。
+    let decodedTagged = try JSONDecoder().decode(Homa.Gram.self, from: JSONEncoder().encode(tagged))
+    #expect(decodedTagged.provenance == [.user, .macro])
+    let encodedPlain = try JSONEncoder().encode(plain)
+    #expect(!String(decoding: encodedPlain, as: UTF8.self).contains("prov"))
+    #expect(try JSONDecoder().decode(Homa.Gram.self, from: encodedPlain).provenance.isEmpty)
+  }
+
+  @Test("[Homa] CandidatePair_CarriesGramProvenance")
+  func testCandidatePairCarriesGramProvenance() async throws {
+    let assembler = Homa.Assembler(
+      gramQuerier: { keyArray in
+        let flatKeys = keyArray.map(\.first)
+        return [
+          Homa.Gram(keyArray: flatKeys, current: "波", probability: -1, provenance: .factory),
+          Homa.Gram(keyArray: flatKeys, current: "MACRO@TEST", probability: -2, provenance: [.user, .macro]),
+        ]
+      }
+    )
+    try assembler.insertKey("ㄅㄛ")
+    let fetched = assembler.fetchCandidates(at: 0).map(\.pair)
+    #expect(fetched.first { $0.value == "波" }?.provenance == .factory)
+    #expect(fetched.first { $0.value == "MACRO@TEST" }?.provenance == [.user, .macro])
+    // 來源旗標不參與相等比較與雜湊；編碼時僅在旗標非空時寫出。
+    let macroPair = try #require(fetched.first { $0.provenance.contains(.macro) })
+    #expect(macroPair == Homa.CandidatePair(keyArray: macroPair.keyArray, value: macroPair.value))
+    let decoded = try JSONDecoder().decode(Homa.CandidatePair.self, from: JSONEncoder().encode(macroPair))
+    #expect(decoded.provenance == [.user, .macro])
+  }
+
   @Test("[Homa] Assembler_QueryGramsPreservesSourceOrderForEqualScorePeers")
   func testAssemblerQueryGramsPreservesSourceOrderForEqualScorePeers() async throws {
     let assembler = Homa.Assembler(
@@ -378,4 +420,96 @@ public struct HomaTestsBasic: HomaTestSuite {
     #expect(pos1_len1 != nil)
     #expect(pos1_len1!.grams.map(\.current) == ["之"])
   }
+
+  @Test("[Homa] GramBorderPointMap_MatchesLegacyDictionarySemantics")
+  func testGramBorderPointMapMatchesLegacyDictionarySemantics() async throws {
+    func makeGram(_ keys: [String], _ value: String) -> Homa.GramInPath {
+      .init(gram: .init(keyArray: keys, current: value), isExplicit: false)
+    }
+    let sentences: [[Homa.GramInPath]] = [
+      [],
+      [makeGram(["gao1"], "高")],
+      [makeGram(["gao1", "ke1", "ji4"], "高科技"), makeGram(["gong1", "si1"], "公司"), makeGram(["de5"], "的")],
+      // 讀音與字數不一致的節點、以及讀音為空的節點。
+      [makeGram(["_emoji"], "🌳🌳"), makeGram([], "∅"), makeGram(["nian2", "zhong1"], "年終"), makeGram([], "∅")],
+    ]
+    for sentence in sentences {
+      // 舊版以兩張字典實作的「座標 ↔ 幅節索引」對照表。
+      var legacyRegionCursorMap = [Int: Int]()
+      var legacyCursorRegionMap: [Int: Int] = [-1: 0]
+      var cursorCounter = 0
+      sentence.enumerated().forEach { gramCounter, neta in
+        legacyRegionCursorMap[gramCounter] = cursorCounter
+        neta.keyArray.forEach { _ in
+          legacyCursorRegionMap[cursorCounter] = gramCounter
+          cursorCounter += 1
+        }
+      }
+      legacyRegionCursorMap[sentence.count] = cursorCounter
+      legacyCursorRegionMap[cursorCounter] = sentence.count
+
+      let map = sentence.borderPointMap
+      #expect(map.totalKeyCount == sentence.totalKeyCount)
+      #expect(map.cursorRegionMap == legacyCursorRegionMap)
+      #expect(sentence.cursorRegionMap == legacyCursorRegionMap)
+      for region in -2 ... (sentence.count + 2) {
+        #expect(map.cursor(ofRegion: region) == legacyRegionCursorMap[region])
+      }
+      for cursor in -3 ... (cursorCounter + 3) {
+        #expect(map.regionIndex(ofCursor: cursor) == legacyCursorRegionMap[cursor])
+        // 舊版 contextRange(ofGivenCursor:) 的實作。
+        let legacyRange: Range<Int> = {
+          guard !sentence.isEmpty else { return 0 ..< 0 }
+          let frontestSegLength = sentence.reversed()[0].keyArray.count
+          var nilReturn = (cursorCounter - frontestSegLength) ..< cursorCounter
+          if cursor >= cursorCounter { return nilReturn }
+          let cursor = Swift.max(0, cursor)
+          nilReturn = cursor ..< cursor
+          guard let rearNodeID = legacyCursorRegionMap[cursor] else { return nilReturn }
+          guard let rearIndex = legacyRegionCursorMap[rearNodeID] else { return nilReturn }
+          guard let frontIndex = legacyRegionCursorMap[rearNodeID + 1] else { return nilReturn }
+          return rearIndex ..< frontIndex
+        }()
+        #expect(sentence.contextRange(ofGivenCursor: cursor) == legacyRange)
+        #expect(sentence.contextRange(ofGivenCursor: cursor, using: map) == legacyRange)
+        let legacyHit: (gram: Homa.GramInPath, range: Range<Int>)? = {
+          guard !sentence.isEmpty else { return nil }
+          let cursor = Swift.max(0, Swift.min(cursor, cursorCounter - 1))
+          let range = sentence.contextRange(ofGivenCursor: cursor)
+          guard let rearNodeID = legacyCursorRegionMap[cursor] else { return nil }
+          guard sentence.count - 1 >= rearNodeID else { return nil }
+          return (sentence[rearNodeID], range)
+        }()
+        let hit = sentence.findGram(at: cursor, using: map)
+        #expect(hit?.gram == legacyHit?.gram)
+        #expect(hit?.range == legacyHit?.range)
+        let isBound = cursor == legacyRange.lowerBound || cursor == cursorCounter
+        #expect(sentence.isCursorCuttingRegion(cursor: cursor, using: map) == !isBound)
+        #expect(
+          sentence.isCursorCuttingChar(cursor: cursor, using: map)
+            == (!isBound && (legacyHit?.gram.isReadingMismatched ?? false))
+        )
+      }
+    }
+  }
+
+  @Test("[Homa] Assembler_CachesAssembledSentenceBorderMap")
+  func testAssemblerCachesAssembledSentenceBorderMap() async throws {
+    let mockLM = TestLM(rawData: HomaTests.strLMSampleDataHutao)
+    let assembler = Homa.Assembler(
+      gramQuerier: { mockLM.queryGrams($0) }
+    )
+    #expect(assembler.assembledSentenceBorderMap.borders == [0])
+    try ["neng2", "liu2", "yi4", "lv3"].forEach { try assembler.insertKey($0) }
+    #expect(assembler.assembledSentence.values == ["能", "留意", "旅"])
+    #expect(assembler.assembledSentenceBorderMap.borders == [0, 1, 3, 4])
+    #expect(assembler.assembledSentenceBorderMap == assembler.assembledSentence.borderPointMap)
+    #expect(assembler.copy.assembledSentenceBorderMap == assembler.assembledSentenceBorderMap)
+    try assembler.jumpCursorBySegment(to: .rear)
+    #expect(assembler.cursor == 3)
+    try assembler.jumpCursorBySegment(to: .rear)
+    #expect(assembler.cursor == 1)
+    assembler.clear()
+    #expect(assembler.assembledSentenceBorderMap.borders == [0])
+  }
 }
@@ -196,6 +196,96 @@ public struct HomaPerformanceTests: HomaTestSuite {
     )
   }
 
+  @Test("[Homa] Bench_LongSentenceConsolidation")
+  func testLongSentenceConsolidation() async throws {
+    print("// Starting long sentence consolidation benchmark")
+
+    let mockLM = TestLM(rawData: HomaTests.strLMSampleDataHutao)
+    let phrase = ["you1", "die2", "neng2", "liu2", "yi4", "lv3", "fang1"]
+
+    // 分別以短句與長句量測每次選字前鞏固的平均耗時，以觀察耗時是否隨句長線性成長。
+    func measureAverageConsolidationTime(repeating times: Int) throws -> Double {
+      let assembler = Homa.Assembler(
+        gramQuerier: { mockLM.queryGrams($0) }
+      )
+      for _ in 0 ..< times {
+        try phrase.forEach { try assembler.insertKey($0) }
+      }
+      assembler.assemble()
+      var totalTime: Double = 0
+      var rounds = 0
+      for cursor in 1 ... assembler.length {
+        assembler.cursor = cursor
+        guard let candidate = assembler.fetchCandidates(filter: .endAt).first else { continue }
+        totalTime += try Self.measureTime {
+          try assembler.consolidateCandidateCursorContext(
+            for: candidate.pair,
+            cursorType: .placedFront
+          )
+        }
+        rounds += 1
+      }
+      #expect(rounds > 0)
+      #expect(assembler.assembledSentence.totalKeyCount == assembler.length)
+      return totalTime / Double(Swift.max(rounds, 1))
+    }
+
+    let shortAverage = try measureAverageConsolidationTime(repeating: 1)
+    let longAverage = try measureAverageConsolidationTime(repeating: 12)
+    print("// Short sentence (\(phrase.count) keys) - Average consolidation time: \(shortAverage)s")
+    print("// Long sentence (\(phrase.count * 12) keys) - Average consolidation time: \(longAverage)s")
+
+    // 效能斷言 - 長句的單次鞏固不該超過 10ms。
+    #expect(
+      longAverage < 0.01,
+      "Long sentence consolidation should be under 10ms on average, was \(longAverage)s"
+    )
+  }
+
+  @Test("[Homa] Bench_ConsecutiveRevolves")
+  func testConsecutiveRevolves() async throws {
+    print("// Starting consecutive revolves benchmark")
+
+    let mockLM = TestLM(rawData: HomaTests.strLMSampleDataHutao)
+    let assembler = Homa.Assembler(
+      gramQuerier: { mockLM.queryGrams($0) }
+    )
+    let phrase = ["you1", "die2", "neng2", "liu2", "yi4", "lv3", "fang1"]
+    let keys = Array((phrase + phrase + phrase).prefix(20))
+    try keys.forEach { try assembler.insertKey($0) }
+    assembler.assemble()
+    // 游標置於第 12 個讀音（yi4）正後方，輪替該處的候選字。
+    assembler.cursor = 12
+
+    let gridGenerationBefore = assembler.gridGeneration
+    let iterations = 100
+    var revolvedValues = Set<String>()
+    let totalTime = try Self.measureTime {
+      for _ in 0 ..< iterations {
+        let revolved = try assembler.revolveCandidate(
+          cursorType: .placedFront,
+          counterClockwise: false
+        )
+        revolvedValues.insert(revolved.0.pair.value)
+      }
+    }
+
+    let averageTime = totalTime / Double(iterations)
+    print("// Revolved through \(revolvedValues.count) distinct candidates")
+    print("// Consecutive revolves - Average time: \(averageTime)s")
+    print("// Consecutive revolves - Total time: \(totalTime)s for \(iterations) iterations")
+
+    // 輪替只改動節點覆寫狀態，候選字清單應全程沿用快取。
+    #expect(assembler.gridGeneration == gridGenerationBefore)
+    #expect(revolvedValues.count > 1)
+
+    // 效能斷言 - 單次輪替（含鞏固與覆寫）不該超過 5ms。
+    #expect(
+      averageTime < 0.005,
+      "Revolving a candidate should be under 5ms on average, was \(averageTime)s"
+    )
+  }
+
   // MARK: Private
 
   private func generateRealisticChineseInput() -> (keys: [String], mockData: String) {
@@ -16,10 +16,7 @@ let package = Package(
   targets: [
     .target(
       name: "Hotenka",
-      dependencies: [],
-      swiftSettings: [
-        .defaultIsolation(MainActor.self), // set Default Actor Isolation
-      ]
+      dependencies: []
     ),
     .testTarget(
       name: "HotenkaTests",
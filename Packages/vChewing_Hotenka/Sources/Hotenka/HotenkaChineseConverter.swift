@@ -10,7 +10,7 @@ import Foundation
 
 // MARK: - DictType
 
-public enum DictType: Int, CaseIterable {
+public enum DictType: Int, CaseIterable, Sendable {
   case zhHantTW = 0
   case zhHantHK = 1
   case zhHansSG = 2
@@ -42,7 +42,7 @@ public enum Hotenka {}
 
 // MARK: - HotenkaChineseConverter
 
-public final class HotenkaChineseConverter {
+public final class HotenkaChineseConverter: Sendable {
   // MARK: Lifecycle
 
   public init(stringMapPath: String) throws {
@@ -59,46 +59,48 @@ public final class HotenkaChineseConverter {
   // MARK: Public
 
   public func convert(_ input: String, to dictType: DictType) -> String {
-    let normalizedInput = input.precomposedStringWithCanonicalMapping
-    let maximumKeyLength = maximumKeyLengths[dictType.rawValue]
-    guard maximumKeyLength > 0 else { return normalizedInput }
-
-    var result = String()
-    result.reserveCapacity(normalizedInput.utf8.count)
-    var currentIndex = normalizedInput.startIndex
+    var scratch = ConversionScratch()
+    return Self.convert(
+      input,
+      using: stringMap,
+      dict: dictType,
+      maximumKeyLength: maximumKeyLengths[dictType.rawValue],
+      scratch: &scratch
+    )
+  }
 
-    while currentIndex < normalizedInput.endIndex {
-      let remainingCount = normalizedInput.distance(
-        from: currentIndex,
-        to: normalizedInput.endIndex
+  /// 批次轉換。所有輸入共用同一組暫存緩衝區，適合選字窗這類一次要轉換幾十筆短字串的場合。
+  public func convert(_ inputs: [String], to dictType: DictType) -> [String] {
+    let maximumKeyLength = maximumKeyLengths[dictType.rawValue]
+    var scratch = ConversionScratch()
+    return inputs.map {
+      Self.convert(
+        $0,
+        using: stringMap,
+        dict: dictType,
+        maximumKeyLength: maximumKeyLength,
+        scratch: &scratch
       )
-      var candidateLength = min(maximumKeyLength, remainingCount)
-      var matchedValue: String?
-      var matchedEndIndex = currentIndex
-
-      while candidateLength > 0 {
-        let candidateEndIndex = normalizedInput.index(currentIndex, offsetBy: candidateLength)
-        let candidateKey = String(normalizedInput[currentIndex ..< candidateEndIndex])
-
-        if let value = stringMap.query(dict: dictType, key: candidateKey) {
-          matchedValue = value
-          matchedEndIndex = candidateEndIndex
-          break
-        }
+    }
+  }
 
-        candidateLength -= 1
-      }
+  /// 依序套用轉換鏈內的各個辭典（比如先轉康熙、再轉 JIS）。
+  ///
+  /// 每個辭典各自完整跑一趟最長匹配：後一趟的匹配可能橫跨前一趟已改寫過的內容，
+  /// 故無法預先合成為單一份辭典表。
+  public func convert(_ input: String, through chain: [DictType]) -> String {
+    convert([input], through: chain)[0]
+  }
 
-      if let matchedValue {
-        result.append(matchedValue)
-        currentIndex = matchedEndIndex
-      } else {
-        result.append(normalizedInput[currentIndex])
-        currentIndex = normalizedInput.index(after: currentIndex)
+  /// 依序套用轉換鏈內的各個辭典，批次處理。
+  public func convert(_ inputs: [String], through chain: [DictType]) -> [String] {
+    guard chain.count > 1 else {
+      guard let dictType = chain.first else {
+        return inputs.map(\.precomposedStringWithCanonicalMapping)
       }
+      return convert(inputs, to: dictType)
     }
-
-    return result
+    return chain.reduce(inputs) { convert($0, to: $1) }
   }
 
   public func query(dict dictType: DictType, key: String) -> String? {
@@ -124,9 +126,83 @@ public final class HotenkaChineseConverter {
 
   // MARK: Private
 
+  /// 轉換時重複使用的暫存緩衝區。
+  private struct ConversionScratch {
+    /// 各字位起點的 UTF-8 偏移量（末元素為總長度）。
+    var boundaries: [Int] = []
+    /// 轉換結果的 UTF-8 位元組。
+    var output: [UInt8] = []
+  }
+
   private let stringMap: Hotenka.StringMap
   private let maximumKeyLengths: [Int]
 
+  /// 最長匹配轉換。直接以 UTF-8 位元組查詢辭典、並將查得的值原樣複製到輸出緩衝區，
+  /// 整個過程只會在最後建立一次結果字串。
+  private static func convert(
+    _ input: String,
+    using stringMap: Hotenka.StringMap,
+    dict dictType: DictType,
+    maximumKeyLength: Int,
+    scratch: inout ConversionScratch
+  )
+    -> String {
+    var normalizedInput = input.precomposedStringWithCanonicalMapping
+    guard maximumKeyLength > 0, !normalizedInput.isEmpty else { return normalizedInput }
+
+    scratch.boundaries.removeAll(keepingCapacity: true)
+    var utf8Offset = 0
+    for char in normalizedInput {
+      scratch.boundaries.append(utf8Offset)
+      utf8Offset += char.utf8.count
+    }
+    scratch.boundaries.append(utf8Offset)
+    scratch.output.removeAll(keepingCapacity: true)
+    scratch.output.reserveCapacity(utf8Offset)
+
+    let converted: Bool = normalizedInput.withUTF8 { inputBytes in
+      stringMap.withUnsafeStorage { (baseAddress: UnsafePointer<UInt8>) -> Bool? in
+        let boundaries = scratch.boundaries
+        let charCount = boundaries.count - 1
+        var currentIndex = 0
+        while currentIndex < charCount {
+          var candidateLength = min(maximumKeyLength, charCount - currentIndex)
+          var matched = false
+          while candidateLength > 0 {
+            let candidateKey = UnsafeBufferPointer(
+              rebasing: inputBytes[boundaries[currentIndex] ..< boundaries[currentIndex + candidateLength]]
+            )
+            if let valueSlice = stringMap.valueSlice(
+              dict: dictType,
+              keyBytes: candidateKey,
+              baseAddress: baseAddress
+            ) {
+              scratch.output.append(
+                contentsOf: UnsafeBufferPointer(
+                  start: baseAddress.advanced(by: valueSlice.start),
+                  count: valueSlice.end - valueSlice.start
+                )
+              )
+              currentIndex += candidateLength
+              matched = true
+              break
+            }
+            candidateLength -= 1
+          }
+          if !matched {
+            scratch.output.append(
+              contentsOf: inputBytes[boundaries[currentIndex] ..< boundaries[currentIndex + 1]]
+            )
+            currentIndex += 1
+          }
+        }
+        return true
+      } ?? false
+    }
+    guard converted else { return normalizedInput }
+    return String(decoding: scratch.output, as: UTF8.self)
+  }
+
   private static func makeMaximumKeyLengths(from stringMap: Hotenka.StringMap) -> [Int] {
     DictType.allCases.map { dictType in
       stringMap.maximumKeyLength(for: dictType)
@@ -9,7 +9,7 @@
 import Foundation
 
 extension Hotenka {
-  public struct StringMap {
+  public struct StringMap: Sendable {
     // MARK: Lifecycle
 
     public init(fileURL: URL) throws {
@@ -176,66 +176,21 @@ extension Hotenka {
     }
 
     public func query(dict dictType: DictType, key searchKey: String) -> String? {
-      let descriptor = descriptors[dictType.rawValue]
-      guard descriptor.entryCount > 0 else { return nil }
+      guard descriptors[dictType.rawValue].entryCount > 0 else { return nil }
       let searchKeyBytes = Array(searchKey.utf8)
 
-      return storage.withUnsafeBytes { rawBytes in
-        guard let baseAddress = rawBytes.bindMemory(to: UInt8.self).baseAddress else {
-          return nil
-        }
-
-        var lowerBound = 0
-        var upperBound = descriptor.entryCount - 1
-        while lowerBound <= upperBound {
-          let candidateIndex = lowerBound + (upperBound - lowerBound) / 2
-          guard let entryStart = entryOffset(
-            for: candidateIndex,
-            descriptor: descriptor,
-            baseAddress: baseAddress
+      return withUnsafeStorage { baseAddress in
+        searchKeyBytes.withUnsafeBufferPointer { keyBytes in
+          valueSlice(dict: dictType, keyBytes: keyBytes, baseAddress: baseAddress)
+        }.map { valueSlice in
+          String(
+            decoding: UnsafeBufferPointer(
+              start: baseAddress.advanced(by: valueSlice.start),
+              count: valueSlice.end - valueSlice.start
+            ),
+            as: UTF8.self
           )
-          else {
-            return nil
-          }
-
-          let entryEnd: Int
-          if candidateIndex + 1 < descriptor.entryCount {
-            guard let nextStart = entryOffset(
-              for: candidateIndex + 1,
-              descriptor: descriptor,
-              baseAddress: baseAddress
-            )
-            else {
-              return nil
-            }
-            entryEnd = nextStart
-          } else {
-            entryEnd = descriptor.dataEnd
-          }
-
-          let comparison = Self.compare(
-            searchKeyBytes,
-            baseAddress: baseAddress,
-            entryStart: entryStart,
-            entryEnd: entryEnd
-          )
-
-          if comparison == 0 {
-            return Self.decodeValue(
-              baseAddress: baseAddress,
-              entryStart: entryStart,
-              entryEnd: entryEnd
-            )
-          }
-
-          if comparison < 0 {
-            upperBound = candidateIndex - 1
-          } else {
-            lowerBound = candidateIndex + 1
-          }
         }
-
-        return nil
       }
     }
 
@@ -254,6 +209,84 @@ extension Hotenka {
       storage.count
     }
 
+    /// 以儲存區的起始位址執行給定的操作。儲存區為空時不執行、直接回傳 nil。
+    func withUnsafeStorage<R>(_ body: (UnsafePointer<UInt8>) -> R?) -> R? {
+      storage.withUnsafeBytes { rawBytes in
+        guard let baseAddress = rawBytes.bindMemory(to: UInt8.self).baseAddress else {
+          return nil
+        }
+        return body(baseAddress)
+      }
+    }
+
+    /// 以 UTF-8 位元組直接二分搜尋給定辭典，不建立任何中間字串。
+    /// - Parameters:
+    ///   - dictType: 辭典。
+    ///   - keyBytes: 已經過 NFC 正規化的索引鍵 UTF-8 位元組。
+    ///   - baseAddress: 經由 `withUnsafeStorage()` 取得的儲存區起始位址。
+    /// - Returns: 值在儲存區內的位置；查無結果則為 nil。
+    func valueSlice(
+      dict dictType: DictType,
+      keyBytes: UnsafeBufferPointer<UInt8>,
+      baseAddress: UnsafePointer<UInt8>
+    )
+      -> ValueSlice? {
+      let descriptor = descriptors[dictType.rawValue]
+      guard descriptor.entryCount > 0 else { return nil }
+
+      var lowerBound = 0
+      var upperBound = descriptor.entryCount - 1
+      while lowerBound <= upperBound {
+        let candidateIndex = lowerBound + (upperBound - lowerBound) / 2
+        guard let entryStart = entryOffset(
+          for: candidateIndex,
+          descriptor: descriptor,
+          baseAddress: baseAddress
+        )
+        else {
+          return nil
+        }
+
+        let entryEnd: Int
+        if candidateIndex + 1 < descriptor.entryCount {
+          guard let nextStart = entryOffset(
+            for: candidateIndex + 1,
+            descriptor: descriptor,
+            baseAddress: baseAddress
+          )
+          else {
+            return nil
+          }
+          entryEnd = nextStart
+        } else {
+          entryEnd = descriptor.dataEnd
+        }
+
+        let comparison = Self.compare(
+          keyBytes,
+          baseAddress: baseAddress,
+          entryStart: entryStart,
+          entryEnd: entryEnd
+        )
+
+        if comparison == 0 {
+          return Self.decodeValueSlice(
+            entryStart: entryStart,
+            entryEnd: entryEnd,
+            baseAddress: baseAddress
+          )
+        }
+
+        if comparison < 0 {
+          upperBound = candidateIndex - 1
+        } else {
+          lowerBound = candidateIndex + 1
+        }
+      }
+
+      return nil
+    }
+
     func string(for valueSlice: ValueSlice) -> String {
       storage.withUnsafeBytes { rawBytes in
         guard let baseAddress = rawBytes.bindMemory(to: UInt8.self).baseAddress else {
@@ -550,7 +583,7 @@ extension Hotenka {
     }
 
     private static func compare(
-      _ lhs: [UInt8],
+      _ lhs: UnsafeBufferPointer<UInt8>,
       baseAddress: UnsafePointer<UInt8>,
       entryStart: Int,
       entryEnd: Int
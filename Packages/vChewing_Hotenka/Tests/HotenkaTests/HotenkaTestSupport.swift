@@ -25,6 +25,18 @@ enum HotenkaTestSupport {
 
   static let sampleInput = "为中华崛起而读书"
 
+  /// 選字窗內常見的候選字，用於批次轉換的測試與效能評測。
+  static let sampleCandidates = [
+    "为中华崛起而读书", "為中華崛起而讀書", "一丝不挂", "一絲不掛", "读书", "讀書", "中华", "中華",
+    "崛起", "而", "为", "為", "爲", "书", "書",
+  ]
+
+  static func nanosecondsElapsed(_ task: () -> ()) -> UInt64 {
+    let startTime = DispatchTime.now().uptimeNanoseconds
+    task()
+    return DispatchTime.now().uptimeNanoseconds - startTime
+  }
+
   static func ensureStringMapFixture() throws -> URL {
     let outputURL = testDataURL.appendingPathComponent("convdict.stringmap")
     try stringMapFixtureData().write(to: outputURL, options: .atomic)
@@ -96,6 +96,88 @@ struct HotenkaTests {
     #expect(profile.retainedIndexBytes < profile.stringMapStorageBytes)
   }
 
+  @Test
+  func batchConversionMatchesSingleConversion() throws {
+    let url = try HotenkaTestSupport.ensureStringMapFixture()
+    let converter = try HotenkaChineseConverter(stringMapPath: url.path)
+    let inputs = HotenkaTestSupport.sampleCandidates + ["", "e\u{301}", HotenkaTestSupport.sampleInput]
+    for dictType in DictType.allCases {
+      #expect(converter.convert(inputs, to: dictType) == inputs.map { converter.convert($0, to: dictType) })
+    }
+  }
+
+  @Test
+  func conversionChainMatchesSequentialConversion() throws {
+    let url = try HotenkaTestSupport.ensureStringMapFixture()
+    let stringMap = try Hotenka.StringMap(fileURL: url)
+    let converter = HotenkaChineseConverter(stringMap: stringMap)
+    let chain: [DictType] = [.zhHantKX, .zhHansJP]
+
+    // 將兩趟辭典的索引鍵兩兩相接，以涵蓋後一趟的匹配橫跨前一趟已改寫過的內容的情形。
+    var headKeys: [String] = []
+    var tailKeys: [String] = []
+    stringMap.forEachEntry(dict: .zhHantKX) { key, _ in headKeys.append(key) }
+    stringMap.forEachEntry(dict: .zhHansJP) { key, _ in tailKeys.append(key) }
+    var inputs = [HotenkaTestSupport.sampleInput, "為中華崛起而讀書"] + HotenkaTestSupport.sampleCandidates
+    for head in headKeys {
+      for tail in tailKeys {
+        inputs.append(head + tail)
+        inputs.append(tail + head)
+      }
+    }
+    let sequential = inputs.map {
+      converter.convert(converter.convert($0, to: .zhHantKX), to: .zhHansJP)
+    }
+    #expect(converter.convert(inputs, through: chain) == sequential)
+    #expect(converter.convert("為中華崛起而讀書", through: chain) == "為中華崛起而読書")
+    #expect(converter.convert("綜合著", through: chain) == "総合著")
+    #expect(converter.convert("聯合著", through: chain) == "連合著")
+    #expect(converter.convert("著白堊", through: chain) == "著白亜")
+  }
+
+  @Test
+  func conversionThroughputBenchmark() throws {
+    let url = try HotenkaTestSupport.ensureStringMapFixture()
+    let converter = try HotenkaChineseConverter(stringMapPath: url.path)
+    let chain: [DictType] = [.zhHantKX, .zhHansJP]
+    // 模擬 60 筆候選字的選字窗，反覆轉換 200 次。
+    let window = (0 ..< 60).map { HotenkaTestSupport.sampleCandidates[$0 % HotenkaTestSupport.sampleCandidates.count] }
+    let rounds = 200
+
+    var sequentialResult: [String] = []
+    let sequentialTime = HotenkaTestSupport.nanosecondsElapsed {
+      for _ in 0 ..< rounds {
+        sequentialResult = window.map {
+          converter.convert(converter.convert($0, to: .zhHantKX), to: .zhHansJP)
+        }
+      }
+    }
+    var chainResult: [String] = []
+    let chainTime = HotenkaTestSupport.nanosecondsElapsed {
+      for _ in 0 ..< rounds {
+        chainResult = converter.convert(window, through: chain)
+      }
+    }
+    var singleResult: [String] = []
+    let singleTime = HotenkaTestSupport.nanosecondsElapsed {
+      for _ in 0 ..< rounds {
+        singleResult = window.map { converter.convert($0, to: .zhHantTW) }
+      }
+    }
+    var batchResult: [String] = []
+    let batchTime = HotenkaTestSupport.nanosecondsElapsed {
+      for _ in 0 ..< rounds {
+        batchResult = converter.convert(window, to: .zhHantTW)
+      }
+    }
+
+    #expect(chainResult == sequentialResult)
+    #expect(batchResult == singleResult)
+    let itemCount = window.count * rounds
+    print("// [BENCH] Hotenka \(itemCount) items: KX→JP per-item \(sequentialTime / 1_000)µs, batch \(chainTime / 1_000)µs")
+    print("// [BENCH] Hotenka \(itemCount) items: TW per-item \(singleTime / 1_000)µs, batch \(batchTime / 1_000)µs")
+  }
+
   // MARK: Private
 
   private func makeEmptyDictionaryStore() -> [String: [String: String]] {
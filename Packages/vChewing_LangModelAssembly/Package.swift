@@ -68,6 +68,7 @@ let package = Package(
         "LMAssemblyMaterials4Tests",
         .product(name: "Homa", package: "vChewing_Homa"),
         .product(name: "HomaSharedTestComponents", package: "vChewing_Homa"),
+        .product(name: "Shared", package: "vChewing_Shared"),
         .product(name: "Tekkon", package: "vChewing_Tekkon"),
       ],
       swiftSettings: [
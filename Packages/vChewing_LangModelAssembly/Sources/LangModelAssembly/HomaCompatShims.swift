@@ -17,8 +17,22 @@ import Homa
 extension Homa.Gram {
   /// Convenience initialiser matching the old Megrez.Unigram signature.
   @inlinable
-  nonisolated public init(keyArray: [String] = [], value: String = "", score: Double = 0, id: FIUUID = .init()) {
-    self.init(keyArray: keyArray, current: value, previous: nil, probability: score, backoff: 0, id: id)
+  nonisolated public init(
+    keyArray: [String] = [],
+    value: String = "",
+    score: Double = 0,
+    provenance: Provenance = [],
+    id: FIUUID = .init()
+  ) {
+    self.init(
+      keyArray: keyArray,
+      current: value,
+      previous: nil,
+      probability: score,
+      backoff: 0,
+      provenance: provenance,
+      id: id
+    )
   }
 }
 
@@ -14,7 +14,7 @@ import Foundation
 /// 然後再讓這個 Token 用 .translated() 自我表述出轉換結果。
 
 extension LMAssembly {
-  enum InputToken {
+  nonisolated enum InputToken {
     case timeZone(shortened: Bool)
     case timeNow(shortened: Bool)
     case date(dayDelta: Int = 0, yearDelta: Int = 0, shortened: Bool = true, luna: Bool = false)
@@ -27,19 +27,26 @@ extension LMAssembly {
 
 // MARK: - 正式對外投入使用的 API。
 
-extension String {
+nonisolated extension String {
+  /// 是否以「MACRO@」開頭。僅比對 UTF-8 位元組，不做任何記憶體配置。
+  public var isInputTokenCandidate: Bool {
+    utf8.starts(with: LMAssembly.InputToken.prefixBytes)
+  }
+
   public func parseAsInputToken(isCHS: Bool) -> [String] {
-    LMAssembly.InputToken.parse(from: self).map { $0.translated(isCHS: isCHS) }.flatMap { $0 }
-      .deduplicated
+    guard isInputTokenCandidate else { return [] }
+    return LMAssembly.InputToken.Expander.shared.expand(self, isCHS: isCHS)
   }
 }
 
 // MARK: - Parser parsing raw token value to construct token.
 
-extension LMAssembly.InputToken {
+nonisolated extension LMAssembly.InputToken {
+  static let prefixBytes: [UInt8] = Array("MACRO@".utf8)
+
   static func parse(from rawToken: String) -> [LMAssembly.InputToken] {
     var result: [LMAssembly.InputToken] = []
-    guard rawToken.prefix(6) == "MACRO@" else { return result }
+    guard rawToken.isInputTokenCandidate else { return result }
     var mapParams: [String: Int] = [:]
     let tokenComponents = rawToken.dropFirst(6).split(separator: "_").map { param in
       let result = param.uppercased()
@@ -75,12 +82,23 @@ extension LMAssembly.InputToken {
 
 // MARK: - Parser parsing token itself.
 
-extension LMAssembly.InputToken {
-  func translated(isCHS: Bool) -> [String] {
-    let locale = Locale(identifier: isCHS ? "zh-Hans" : "zh-Hant-TW")
-    let formatter = DateFormatter()
-    formatter.locale = locale
-    let currentDate = Date()
+nonisolated extension LMAssembly.InputToken {
+  /// 該 Token 的展開結果在多長的時間區間內保持不變，供展開引擎決定快取的分桶方式。
+  var memoGranularity: Expander.Granularity {
+    switch self {
+    case let .timeNow(shortened): shortened ? .minute : .second
+    default: .day
+    }
+  }
+
+  /// 展開該 Token。
+  /// - Parameters:
+  ///   - isCHS: 是否輸出簡體中文。
+  ///   - currentDate: 視為「現在」的時刻。
+  ///   - context: 展開引擎提供的長期留存的日曆與日期格式器。
+  /// - Returns: 展開結果。
+  func translated(isCHS: Bool, at currentDate: Date, context: Expander.Context) -> [String] {
+    let calendar = context.gregorianCalendar
     var dateToDescribe = currentDate // 接下來會針對給定參數修正這個資料值。
     var results: [String] = []
 
@@ -89,9 +107,9 @@ extension LMAssembly.InputToken {
       switch type {
       case .year:
         var delta = DateComponents()
-        let thisYear = Calendar.current.dateComponents([.year], from: currentDate).year ?? 2_018
+        let thisYear = calendar.dateComponents([.year], from: currentDate).year ?? 2_018
         delta.year = max(deltaValue, thisYear * -1)
-        dateToDescribe = Calendar.current.date(byAdding: delta, to: currentDate) ?? currentDate
+        dateToDescribe = calendar.date(byAdding: delta, to: currentDate) ?? currentDate
       case .day:
         let dayLength = 60 * 60 * 24
         dateToDescribe = dateToDescribe.addingTimeInterval(Double(dayLength * deltaValue))
@@ -99,12 +117,18 @@ extension LMAssembly.InputToken {
       }
     }
 
+    /// 內部函式，以給定的格式與曆法描述 dateToDescribe。
+    func describe(_ format: String, calendar identifier: Calendar.Identifier = .gregorian) -> String {
+      context.formatter(format, calendar: identifier).string(from: dateToDescribe)
+    }
+
     // 計算結果。
     switch self {
     case let .timeZone(shortened): // 時區
-      let resultToAdd = TimeZone.current.localizedName(
-        for: shortened ? .shortGeneric : .standard, locale: locale
-      ) ?? TimeZone.current.description
+      let timeZone = context.timeZone
+      let resultToAdd = timeZone.localizedName(
+        for: shortened ? .shortGeneric : .standard, locale: context.locale
+      ) ?? timeZone.description
       results.append(resultToAdd)
     case let .timeNow(shortened): // 當前時間
       var formats = [String]()
@@ -115,8 +139,7 @@ extension LMAssembly.InputToken {
       case (true, false): formats.append(contentsOf: ["HH:mm:ss", "HH点mm分ss秒", "HH时mm分ss秒"])
       }
       formats.forEach { formatString in
-        formatter.dateFormat = formatString
-        results.append(formatter.string(from: dateToDescribe))
+        results.append(describe(formatString))
       }
       let resultsExtra: [String] = results.compactMap {
         guard !$0.contains(":") else { return nil }
@@ -135,12 +158,8 @@ extension LMAssembly.InputToken {
       applyDelta(for: .day, delta: dayDelta)
       // 農曆單獨處理。
       guard !hasLuna else {
-        formatter.calendar = .init(identifier: .chinese)
-        formatter.dateStyle = .medium
-        formatter.dateFormat = "MMMd"
-        let dateString = formatter.string(from: dateToDescribe)
-        formatter.dateFormat = "U"
-        let yearGanzhi = formatter.string(from: dateToDescribe)
+        let dateString = describe("MMMd", calendar: .chinese)
+        let yearGanzhi = describe("U", calendar: .chinese)
         results.append("\(yearGanzhi)年\(dateString)")
         if let yearZodiac = mapGanzhiToZodiac[yearGanzhi] {
           results.append("\(isCHS ? yearZodiac.1 : yearZodiac.0)年\(dateString)")
@@ -152,15 +171,13 @@ extension LMAssembly.InputToken {
       ]
       var additionalResult: String?
       for (i, formatString) in formats.enumerated() {
-        formatter.dateFormat = formatString
-        let dateStr = formatter.string(from: dateToDescribe)
-        switch (i == 0, shortened) {
-        case (false, true): formatter.dateFormat = "yy年"
-        case (true, false): formatter.dateFormat = "y-"
-        case (false, false): formatter.dateFormat = "y年"
-        case (true, true): formatter.dateFormat = "yy-"
+        let dateStr = describe(formatString)
+        let yearStr: String = switch (i == 0, shortened) {
+        case (false, true): describe("yy年")
+        case (true, false): describe("y-")
+        case (false, false): describe("y年")
+        case (true, true): describe("yy-")
         }
-        let yearStr = formatter.string(from: dateToDescribe)
         if i == 1 {
           let anotherDateStr = dateStr.convertArabicNumeralsToChinese(onlyDigits: false)
           let anotherYearStr = yearStr.convertArabicNumeralsToChinese(onlyDigits: true)
@@ -175,26 +192,18 @@ extension LMAssembly.InputToken {
       }
     case let .week(dayDelta, shortened): // 星期
       applyDelta(for: .day, delta: dayDelta)
-      formatter.dateFormat = shortened ? "EE" : "EEEE"
-      results.append(formatter.string(from: dateToDescribe))
+      results.append(describe(shortened ? "EE" : "EEEE"))
     case let .year(yearDelta): // 年度
       applyDelta(for: .year, delta: yearDelta)
-      formatter.dateFormat = "U年"
-      formatter.calendar = .init(identifier: .gregorian)
-      let result = formatter.string(from: dateToDescribe)
+      let result = describe("U年")
       results.append(result)
       results.append(result.convertArabicNumeralsToChinese(onlyDigits: true))
     case let .yearGanzhi(yearDelta): // 幹支（其實嚴格來講「干支」才是錯的）
       applyDelta(for: .year, delta: yearDelta)
-      formatter.dateFormat = "U年"
-      formatter.calendar = .init(identifier: .chinese)
-      let result = formatter.string(from: dateToDescribe)
-      results.append(result)
+      results.append(describe("U年", calendar: .chinese))
     case let .yearZodiac(yearDelta): // 十二生肖
       applyDelta(for: .year, delta: yearDelta)
-      formatter.dateFormat = "U"
-      formatter.calendar = .init(identifier: .chinese)
-      let rawKey = formatter.string(from: dateToDescribe)
+      let rawKey = describe("U", calendar: .chinese)
       guard let rawResultPair = mapGanzhiToZodiac[rawKey] else { break }
       let rawResult = isCHS ? rawResultPair.1 : rawResultPair.0
       results.append(rawResult + "年")
@@ -206,7 +215,7 @@ extension LMAssembly.InputToken {
 
 /// 註一：天干地支在簡體中文與繁體中文的寫法完全雷同。
 /// 註二：此處採吐蕃的陰陽五行生肖法、而非突厥五行納音生肖法。
-private let mapGanzhiToZodiac: [String: (String, String)] = [
+nonisolated private let mapGanzhiToZodiac: [String: (String, String)] = [
   "甲子": ("木鼠", "木鼠"), "乙丑": ("木牛", "木牛"), "丙寅": ("火虎", "火虎"), "丁卯": ("火兔", "火兔"),
   "戊辰": ("土龍", "土龙"), "己巳": ("土蛇", "土蛇"), "庚午": ("金馬", "金马"), "辛未": ("金羊", "金羊"),
   "壬申": ("水猴", "水猴"), "癸酉": ("水雞", "水鸡"), "甲戌": ("木狗", "木狗"), "乙亥": ("木豬", "木猪"),
@@ -226,7 +235,7 @@ private let mapGanzhiToZodiac: [String: (String, String)] = [
 
 // MARK: - Date Time Language Conversion Extension
 
-private let tableMappingArabicDatesToChinese: [String: String] = {
+nonisolated private let tableMappingArabicDatesToChinese: [String: String] = {
   let formatter = NumberFormatter()
   formatter.locale = Locale(identifier: "zh-Hant-TW") // 預設是英文，設定為中文。繁簡一致。
   formatter.numberStyle = .spellOut
@@ -238,11 +247,11 @@ private let tableMappingArabicDatesToChinese: [String: String] = {
 }()
 
 /// 預先排序好的 key 陣列（按長度遞減），避免每次呼叫重新排序。
-private let sortedArabicDateKeys: [String] = {
+nonisolated private let sortedArabicDateKeys: [String] = {
   tableMappingArabicDatesToChinese.keys.sorted { $0.count > $1.count }
 }()
 
-extension String {
+nonisolated extension String {
   /// 將給定的字串當中的阿拉伯數字轉為漢語小寫，逐字轉換。
   /// - Parameter target: 要進行轉換操作的對象，會直接修改該對象。
   fileprivate func convertArabicNumeralsToChinese(onlyDigits: Bool) -> String {
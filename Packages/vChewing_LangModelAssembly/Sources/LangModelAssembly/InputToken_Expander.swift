@@ -0,0 +1,188 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+import SwiftExtension
+
+// MARK: - LMAssembly.InputToken.Expander
+
+extension LMAssembly.InputToken {
+  /// InputToken 的展開引擎。
+  ///
+  /// 使用者在「今天日期」之類的讀音後方繼續打字時，組字器每次重新組句都會再查詢一次這些讀音。
+  /// 故此處將 Calendar 與 DateFormatter 按語系長期留存，並以「(token, 時間桶, 是否簡體中文)」為鍵記住展開結果：
+  /// 日期、星期、年度、時區以「日」分桶，時間以「分」（帶秒者以「秒」）分桶。
+  /// 時鐘與時區皆可注入，以便在單元測試（含 Linux）當中得到確定的結果。
+  nonisolated final class Expander: Sendable {
+    // MARK: Lifecycle
+
+    /// - Parameters:
+    ///   - clock: 用來取得「現在」的時鐘。
+    ///   - timeZone: 用來取得當前時區的函式。
+    init(
+      clock: @escaping @Sendable () -> Date = { Date() },
+      timeZone: @escaping @Sendable () -> TimeZone = { TimeZone.current }
+    ) {
+      self.clock = clock
+      self.timeZoneProvider = timeZone
+    }
+
+    // MARK: Internal
+
+    /// 快取的分桶粒度。
+    enum Granularity: Int, Comparable {
+      case second = 1
+      case minute = 60
+      case day = 86_400
+
+      // MARK: Internal
+
+      static func < (lhs: Self, rhs: Self) -> Bool { lhs.rawValue < rhs.rawValue }
+
+      /// 給定時刻在給定時區當中所屬的時間桶。
+      func bucket(of date: Date, in timeZone: TimeZone) -> Int {
+        let localTime = date.timeIntervalSince1970 + Double(timeZone.secondsFromGMT(for: date))
+        return Int((localTime / Double(rawValue)).rounded(.down))
+      }
+    }
+
+    /// 展開單個 Token 時可用的長期留存物件。僅在 `expand` 的鎖內有效。
+    struct Context {
+      // MARK: Internal
+
+      let locale: Locale
+      let timeZone: TimeZone
+      let gregorianCalendar: Calendar
+
+      /// 取得給定格式與曆法的日期格式器。
+      func formatter(_ format: String, calendar identifier: Calendar.Identifier) -> DateFormatter {
+        pool.formatter(format, calendar: identifier, locale: locale, timeZone: timeZone)
+      }
+
+      // MARK: Fileprivate
+
+      fileprivate let pool: FormatterPool
+    }
+
+    static let shared = Expander()
+
+    /// 展開給定的 Token 字串。
+    func expand(_ rawToken: String, isCHS: Bool) -> [String] {
+      let currentDate = clock()
+      let timeZone = timeZoneProvider()
+      return mtxState.withLock { state in
+        let tokens: [LMAssembly.InputToken]
+        if let parsed = state.parsedTokens[rawToken] {
+          tokens = parsed
+        } else {
+          tokens = LMAssembly.InputToken.parse(from: rawToken)
+          if state.parsedTokens.count >= Self.maxCachedEntryCount { state.parsedTokens.removeAll() }
+          state.parsedTokens[rawToken] = tokens
+        }
+        guard let granularity = tokens.map(\.memoGranularity).min() else { return [] }
+        let memoKey = MemoKey(
+          rawToken: rawToken,
+          granularity: granularity,
+          bucket: granularity.bucket(of: currentDate, in: timeZone),
+          timeZoneID: timeZone.identifier,
+          isCHS: isCHS
+        )
+        if let memorized = state.memo[memoKey] { return memorized }
+        let context = Context(
+          locale: isCHS ? Self.localeCHS : Self.localeCHT,
+          timeZone: timeZone,
+          gregorianCalendar: state.pool.gregorianCalendar(in: timeZone),
+          pool: state.pool
+        )
+        let result = tokens.flatMap {
+          $0.translated(isCHS: isCHS, at: currentDate, context: context)
+        }.deduplicated
+        if state.memo.count >= Self.maxCachedEntryCount { state.memo.removeAll() }
+        state.memo[memoKey] = result
+        return result
+      }
+    }
+
+    /// 清除所有已記住的展開結果（留存的日曆與日期格式器不受影響）。
+    func clearMemo() {
+      mtxState.withLock { state in
+        state.memo.removeAll()
+      }
+    }
+
+    // MARK: Private
+
+    private struct MemoKey: Hashable {
+      let rawToken: String
+      let granularity: Granularity
+      let bucket: Int
+      let timeZoneID: String
+      let isCHS: Bool
+    }
+
+    private struct State {
+      var parsedTokens: [String: [LMAssembly.InputToken]] = [:]
+      var memo: [MemoKey: [String]] = [:]
+      let pool = FormatterPool()
+    }
+
+    private static let maxCachedEntryCount = 256
+    private static let localeCHS = Locale(identifier: "zh-Hans")
+    private static let localeCHT = Locale(identifier: "zh-Hant-TW")
+
+    private let clock: @Sendable () -> Date
+    private let timeZoneProvider: @Sendable () -> TimeZone
+    private let mtxState = NSMutex(State())
+  }
+}
+
+// MARK: - LMAssembly.InputToken.FormatterPool
+
+extension LMAssembly.InputToken {
+  /// 長期留存的日曆與日期格式器。只能在 `Expander` 的鎖內存取。
+  nonisolated fileprivate final class FormatterPool {
+    // MARK: Internal
+
+    func gregorianCalendar(in timeZone: TimeZone) -> Calendar {
+      if gregorian.timeZone != timeZone { gregorian.timeZone = timeZone }
+      return gregorian
+    }
+
+    func formatter(
+      _ format: String,
+      calendar identifier: Calendar.Identifier,
+      locale: Locale,
+      timeZone: TimeZone
+    )
+      -> DateFormatter {
+      let key = FormatterKey(localeID: locale.identifier, calendar: identifier, format: format)
+      if let cached = formatters[key] {
+        if cached.timeZone != timeZone { cached.timeZone = timeZone }
+        return cached
+      }
+      let formatter = DateFormatter()
+      formatter.locale = locale
+      formatter.calendar = Calendar(identifier: identifier)
+      formatter.timeZone = timeZone
+      formatter.dateFormat = format
+      formatters[key] = formatter
+      return formatter
+    }
+
+    // MARK: Private
+
+    private struct FormatterKey: Hashable {
+      let localeID: String
+      let calendar: Calendar.Identifier
+      let format: String
+    }
+
+    private var gregorian = Calendar(identifier: .gregorian)
+    private var formatters: [FormatterKey: DateFormatter] = [:]
+  }
+}
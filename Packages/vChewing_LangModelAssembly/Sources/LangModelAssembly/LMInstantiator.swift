@@ -41,6 +41,7 @@ extension LMAssembly {
     ) {
       self.isCHS = isCHS
       self.mtxLXPerceptor = .init(.init(dataURL: pomDataURL))
+      Self.installPerfProbeSinkIfNeeded()
     }
 
     // MARK: Public
@@ -69,6 +70,9 @@ extension LMAssembly {
       public var allowRescoringSingleKanjiCandidates = false
       public var bypassUserPhrasesData = false
       public var suppressFactoryUnigramsOfKanaSyllables = false
+      /// 原廠辭典嚴格超集查詢（`.strictSuperset`）最多採用的鍵鏈數量與單元圖數量。
+      /// 常見的單音節前綴在完整辭典內可對應上千個鍵鏈，不設限的話每次查詢都得逐一解析詞條。
+      public var factorySupersetLookupLimit = 128
     }
 
     public enum SupplementalLookupStrategy {
@@ -157,9 +161,14 @@ extension LMAssembly {
     public let isCHS: Bool
 
     // 在函式內部用以記錄狀態的開關。
-    public private(set) var config = Config()
+    public private(set) var config = Config() {
+      didSet {
+        if config != oldValue { invalidateUnigramCache() }
+      }
+    }
 
-    public internal(set) var inputTokenHashesArray: Set<Int> = []
+    /// `unigramsFor` 查詢結果快取的命中統計。
+    public var unigramCacheMetrics: UnigramCache.Metrics { unigramCache.metrics }
 
     public var lookupHub: LookupHub { .init(lmi: self) }
 
@@ -169,14 +178,24 @@ extension LMAssembly {
       Self.lmCassette.candidateKeysValidator = validator
     }
 
-    public static func loadCassetteData(path: String) {
+    /// 載入磁帶資料。
+    /// - Parameters:
+    ///   - path: 磁帶檔案路徑。
+    ///   - completionHandler: 載入結束時（無論成敗）於主執行緒呼叫，參數為是否成功載入。
+    public static func loadCassetteData(
+      path: String,
+      completionHandler: (@MainActor @Sendable (Bool) -> ())? = nil
+    ) {
       func load() {
         if FileManager.default.isReadableFile(atPath: path) {
           Self.lmCassette.clear()
           Self.lmCassette.open(path)
+          Self.mtxFactoryGeneration.value &+= 1
           vCLMLog("lmCassette: \(Self.lmCassette.count) entries of data loaded from: \(path)")
+          completionHandler?(true)
         } else {
           vCLMLog("lmCassette: File access failure: \(path)")
+          completionHandler?(false)
         }
       }
       if !Self.asyncLoadingUserData {
@@ -187,6 +206,7 @@ extension LMAssembly {
         LMAssembly.fileHandleQueue.async {
           guard FileManager.default.isReadableFile(atPath: path) else {
             vCLMLog("lmCassette: File access failure: \(path)")
+            asyncOnMain { completionHandler?(false) }
             return
           }
           var newCassette = LMCassette()
@@ -195,7 +215,9 @@ extension LMAssembly {
           let count = newCassette.count
           asyncOnMain {
             Self.lmCassette = newCassette
+            Self.mtxFactoryGeneration.value &+= 1
             vCLMLog("lmCassette: \(count) entries of data loaded from: \(path)")
+            completionHandler?(true)
           }
         }
       }
@@ -207,6 +229,7 @@ extension LMAssembly {
       disconnectFactoryDictionary()
       lmCassette = LMCassette()
       lmPlainBopomofo = LMPlainBopomofo()
+      Self.mtxFactoryGeneration.value &+= 1
       guard restoreAsyncLoadingStrategy else { return }
       asyncLoadingUserData = !UserDefaults.pendingUnitTests
     }
@@ -223,10 +246,17 @@ extension LMAssembly {
       factoryTrie?.flushReverseLookupIndex()
     }
 
-    /// 預先建立原廠辭典反查索引。
+    /// 預先於背景佇列建立原廠辭典反查索引，不阻塞呼叫端執行緒。
     /// 在 RevLookup 視窗顯示時呼叫，使首次查詢無需等待 lazy build。
-    public static func preloadFactoryReverseLookupIndex() {
-      factoryTrie?.ensureReverseLookupIndex()
+    /// - Parameter completion: 建立工作結束後於背景執行緒呼叫（索引已就緒時則立即呼叫）。原廠辭典尚未載入時不會呼叫。
+    /// 建立工作若已被 `flushFactoryReverseLookupIndex()` 作廢，則呼叫時索引仍未就緒。
+    public static func preloadFactoryReverseLookupIndex(completion: (@Sendable () -> ())? = nil) {
+      factoryTrie?.prepareReverseLookupIndexInBackground(completion: completion)
+    }
+
+    /// 原廠辭典反查索引是否已就緒。
+    public static var isFactoryReverseLookupIndexReady: Bool {
+      factoryTrie?.isReverseLookupIndexReady ?? false
     }
 
     @discardableResult
@@ -250,13 +280,7 @@ extension LMAssembly {
       config.suppressFactoryUnigramsOfKanaSyllables = prefs.suppressFactoryUnigramsOfKanaSyllables
     }
 
-    /// 清除 InputToken HashMap。
-    /// 注意：此 HashMap 僅記錄由 InputToken（以 "MACRO@" 開頭的特殊標記）生成的 Unigram。
-    public func purgeInputTokenHashMap() {
-      inputTokenHashesArray.removeAll()
-    }
-
-    /// 清除所有使用者來源的資料（片語、濾除表、符號、關聯詞、置換表、LRU 快取、InputToken 雜湊）。
+    /// 清除所有使用者來源的資料（片語、濾除表、符號、關聯詞、置換表、unigramsFor 快取）。
     /// 不影響原廠辭典（factoryTrie）與半衰記憶模組（lxPerceptor）。
     /// 在切換使用者片語辭典目錄時必須呼叫此方法，以確保舊目錄的資料不會殘留。
     public func purgeUserData() {
@@ -265,17 +289,20 @@ extension LMAssembly {
       lmUserSymbols.clear()
       lmAssociates.clear()
       lmReplacements.clear()
-      unigramLRUCache.removeAll(keepingCapacity: true)
-      inputTokenHashesArray.removeAll(keepingCapacity: true)
+      invalidateUnigramCache()
     }
 
     public func loadUserPhrasesData(path: String, filterPath: String?, async: Bool? = nil) {
       // 無論新檔案是否可讀，都必須先清除舊資料，防止舊目錄內容殘留。
       lmUserPhrases.clear()
       lmFiltered.clear()
-      unigramLRUCache.removeAll(keepingCapacity: true)
+      invalidateUnigramCache()
 
       let shouldAsync = async ?? Self.asyncLoadingUserData
+      // 任何尚未完成的非同步載入都會因此作廢，以免其稍後以舊內容覆蓋本次載入的結果。
+      userPhrasesLoadTicket &+= 1
+      pendingUserPhrasesPath = shouldAsync ? path : nil
+      let ticket = userPhrasesLoadTicket
 
       func loadMain() {
         if FileManager.default.isReadableFile(atPath: path) {
@@ -291,10 +318,12 @@ extension LMAssembly {
         LMAssembly.readFileContentAsync(
           path: path, shouldConsolidate: lmUserPhrases.allowConsolidation
         ) { [weak self] content in
-          guard let self else { return }
+          guard let self, self.userPhrasesLoadTicket == ticket else { return }
+          self.pendingUserPhrasesPath = nil
           LMAssembly.withFileHandleQueueSync {
             self.lmUserPhrases.replaceData(textData: content)
           }
+          self.invalidateUnigramCache()
           self.lmUserPhrases.filePath = path
           vCLMLog("lmUserPhrases: \(self.lmUserPhrases.count) entries of data loaded from: \(path)")
         }
@@ -318,6 +347,7 @@ extension LMAssembly {
           LMAssembly.withFileHandleQueueSync {
             self.lmFiltered.replaceData(textData: content)
           }
+          self.invalidateUnigramCache()
           self.lmFiltered.filePath = filterPath
           vCLMLog("lmFiltered: \(self.lmFiltered.count) entries of data loaded from: \(filterPath)")
         }
@@ -328,7 +358,7 @@ extension LMAssembly {
     public func reloadUserFilterDirectly(path: String) {
       // 無論新檔案是否可讀，都必須先清除舊資料。
       lmFiltered.clear()
-      unigramLRUCache.removeAll(keepingCapacity: true)
+      invalidateUnigramCache()
 
       if FileManager.default.isReadableFile(atPath: path) {
         lmFiltered.open(path)
@@ -341,10 +371,12 @@ extension LMAssembly {
     public func loadUserSymbolData(path: String) {
       // 無論新檔案是否可讀，都必須先清除舊資料。
       lmUserSymbols.clear()
+      invalidateUnigramCache()
 
       func load() {
         if FileManager.default.isReadableFile(atPath: path) {
           lmUserSymbols.open(path)
+          invalidateUnigramCache()
           vCLMLog("lmUserSymbol: \(lmUserSymbols.count) entries of data loaded from: \(path)")
         } else {
           vCLMLog("lmUserSymbol: File access failure: \(path)")
@@ -360,6 +392,7 @@ extension LMAssembly {
           LMAssembly.withFileHandleQueueSync {
             self.lmUserSymbols.replaceData(textData: content)
           }
+          self.invalidateUnigramCache()
           self.lmUserSymbols.filePath = path
           vCLMLog("lmUserSymbol: \(self.lmUserSymbols.count) entries of data loaded from: \(path)")
         }
@@ -403,10 +436,12 @@ extension LMAssembly {
     public func loadReplacementsData(path: String) {
       // 無論新檔案是否可讀，都必須先清除舊資料。
       lmReplacements.clear()
+      invalidateUnigramCache()
 
       func load() {
         if FileManager.default.isReadableFile(atPath: path) {
           lmReplacements.open(path)
+          invalidateUnigramCache()
           vCLMLog("lmReplacements: \(lmReplacements.count) entries of data loaded from: \(path)")
         } else {
           vCLMLog("lmReplacements: File access failure: \(path)")
@@ -423,6 +458,7 @@ extension LMAssembly {
           LMAssembly.withFileHandleQueueSync {
             self.lmReplacements.replaceData(textData: content)
           }
+          self.invalidateUnigramCache()
           self.lmReplacements.filePath = path
           vCLMLog("lmReplacements: \(self.lmReplacements.count) entries of data loaded from: \(path)")
         }
@@ -465,17 +501,17 @@ extension LMAssembly {
         isFiltering
           ? lmFiltered.temporaryMap[keyChain, default: []].append(unigram)
           : lmUserPhrases.temporaryMap[keyChain, default: []].append(unigram)
-      // LRU cache 必須在暫時資料變更時失效，否則後續查詢會返回過時結果。
-      // 注意：cache key 已包含 partiallyMatch 標記，需同時清除兩種變體。
-      unigramLRUCache.removeValue(forKey: "\(keyChain)\tPM0")
-      unigramLRUCache.removeValue(forKey: "\(keyChain)\tPM1")
+      // 快取必須在暫時資料變更時失效，否則後續查詢會返回過時結果。
+      // 注意：快取索引鍵有區分 partiallyMatch 與否，需同時清除兩種變體。
+      unigramCache.removeValue(for: .exact(keyChain: keyChain, partiallyMatch: false))
+      unigramCache.removeValue(for: .exact(keyChain: keyChain, partiallyMatch: true))
     }
 
     /// 該函式主要供單元測試所用。
     public func clearTemporaryData(isFiltering: Bool) {
       _ = isFiltering ? lmFiltered.clear() : lmUserPhrases.clear()
-      // LRU cache 必須在暫時資料變更時失效，否則後續查詢會返回過時結果。
-      unigramLRUCache.removeAll(keepingCapacity: true)
+      // 快取必須在暫時資料變更時失效，否則後續查詢會返回過時結果。
+      invalidateUnigramCache()
     }
 
     /// 自當前記憶體取得指定使用者子語言模組內的原始資料體。
@@ -502,6 +538,8 @@ extension LMAssembly {
     ) {
       var rawText = rawStrData
       LMConsolidator.consolidate(text: &rawText, pragma: true)
+      // 關聯詞語不參與 unigramsFor 的查詢結果，故無須令快取失效。
+      if targetType != .theAssociates { invalidateUnigramCache() }
       switch targetType {
       case .theAssociates:
         lmAssociates.replaceData(textData: rawText)
@@ -521,6 +559,72 @@ extension LMAssembly {
       }
     }
 
+    /// 將大量使用者語彙（比如自其他輸入法匯入的資料）一次性併入使用者語彙辭典。
+    ///
+    /// 與逐筆寫入使用者語彙不同，此處不會逐筆追加檔案、也不會逐筆重新載入：
+    /// 所有資料會先在記憶體內與既有的 entries 歸併去重，之後僅以原子寫入的方式存檔一次。
+    /// - Parameters:
+    ///   - phrases: 要匯入的語彙。無效者、以及與既有使用者語彙重複者會被略過。
+    ///   - path: 使用者語彙檔案路徑。若與目前載入的檔案不同，會先同步載入該檔案再行歸併。
+    ///   - skipFactoryDuplicates: 是否一併略過原廠辭典內已有的配對。
+    /// - Returns: 實際併入的筆數。若使用者語彙檔案無法讀取，則不做任何變動、直接回傳 0。
+    /// - Remark: 若使用者語彙仍在非同步載入中，則會作廢該次載入、改為在此同步載入，
+    /// 以免該次載入稍後以舊內容覆蓋歸併結果。
+    @discardableResult
+    public func bulkImportUserPhrases(
+      _ phrases: some Sequence<UserPhraseInsertable>,
+      path: String? = nil,
+      skipFactoryDuplicates: Bool = true
+    )
+      -> Int {
+      let pendingPath = pendingUserPhrasesPath
+      if pendingPath != nil {
+        userPhrasesLoadTicket &+= 1
+        pendingUserPhrasesPath = nil
+      }
+      if let targetPath = path ?? pendingPath,
+         pendingPath != nil || lmUserPhrases.filePath != targetPath {
+        // 讀取失敗時語彙表已被清空；此時若照常歸併存檔，便會以匯入內容覆蓋使用者的語彙檔案。
+        guard lmUserPhrases.open(targetPath) else { return 0 }
+        invalidateUnigramCache()
+      }
+      let records = phrases.lazy.filter { phrase in
+        guard phrase.isValid else { return false }
+        guard skipFactoryDuplicates else { return true }
+        return !self.factoryCoreUnigramsFor(key: phrase.joinedKey, keyArray: phrase.keyArray)
+          .contains { $0.current == phrase.value }
+      }.map { phrase in
+        LMCoreEX.BulkRecord(
+          keyArray: phrase.keyArray,
+          value: phrase.value,
+          weight: phrase.weight,
+          annotation: phrase.isConverted ? Self.humanCheckRequiredMark : nil
+        )
+      }
+      let insertedCount = lmUserPhrases.mergeBulk(records)
+      guard insertedCount > 0 else { return 0 }
+      invalidateUnigramCache()
+      lmUserPhrases.saveData()
+      return insertedCount
+    }
+
+    /// `bulkImportUserPhrases(_:path:skipFactoryDuplicates:)` 的非同步序列版本。
+    ///
+    /// 會先將序列內容全數收集完畢，再一次性歸併與存檔。
+    @discardableResult
+    public func bulkImportUserPhrases<S: AsyncSequence>(
+      _ phrases: S,
+      path: String? = nil,
+      skipFactoryDuplicates: Bool = true
+    ) async throws
+      -> Int where S.Element == UserPhraseInsertable {
+      var collected: [UserPhraseInsertable] = []
+      for try await phrase in phrases {
+        collected.append(phrase)
+      }
+      return bulkImportUserPhrases(collected, path: path, skipFactoryDuplicates: skipFactoryDuplicates)
+    }
+
     /// 根據給定的索引鍵來確認各個資料庫陣列內是否存在對應的資料。
     /// - Parameter key: 索引鍵陣列。
     /// - Returns: 是否在庫。
@@ -654,30 +758,28 @@ extension LMAssembly {
       // Fast path: single key per position — use existing logic unchanged
       let flatKeyArray = keyArray.map(\.first)
       let keyChain = flatKeyArray.joined(separator: "-")
-      let cacheKey = partiallyMatch ? "\(keyChain)\tPM1" : "\(keyChain)\tPM0"
+      let cacheKey = UnigramCache.Key.exact(keyChain: keyChain, partiallyMatch: partiallyMatch)
       let noEmptyKey = !flatKeyArray.isEmpty && flatKeyArray.allSatisfy { !$0.isEmpty }
       guard noEmptyKey else { return [] }
       /// 給空格鍵指定輸出值。
       let asciiSpace = " "
       if flatKeyArray == [asciiSpace] { return [.init(keyArray: flatKeyArray, value: asciiSpace)] }
-      // 檢查 LRU 快取
-      var hasher = Hasher()
-      hasher.combine(config)
-      hasher.combine(Self.mtxFactoryGeneration.value)
-      let fingerprint = hasher.finalize()
-      if fingerprint != unigramCacheFingerprint {
-        unigramLRUCache.removeAll(keepingCapacity: true)
-        unigramCacheFingerprint = fingerprint
-      }
-      if let cached = unigramLRUCache[cacheKey] {
+      // 檢查快取：只比對資料世代，無須每次都雜湊整份設定。
+      let cacheStamp = unigramCacheStamp
+      if let cached = unigramCache.value(for: cacheKey, stamp: cacheStamp) {
+        PerfProbe.count("LMI.unigramsFor.cacheHit")
         return cached
       }
+      PerfProbe.count("LMI.unigramsFor.cacheMiss")
+      let probeTotal = PerfProbe.begin("LMI.unigramsFor")
+      defer { PerfProbe.end(probeTotal) }
       // `config.bypassUserPhrasesData` 啟用時，除了 Associated Phrases 以外的資料全部忽略。
       /// 準備不同的語言模組容器，開始逐漸往容器陣列內塞入資料。
       var rawAllUnigrams: [Homa.Gram] = []
       rawAllUnigrams.reserveCapacity(Swift.max(16, flatKeyArray.count * 8))
       var factoryCoreUnigramsResult: [Homa.Gram] = []
 
+      let probeFactory = PerfProbe.begin("LMI.unigramsFor.factory")
       if !config.isCassetteEnabled
         || config.isCassetteEnabled && (flatKeyArray.first?.hasPrefix("_") ?? false) {
         // 先給出 NumPad 的結果。
@@ -687,20 +789,20 @@ extension LMAssembly {
           key: keyChain,
           keyArray: flatKeyArray,
           entryType: .zhuyinwen
-        )
+        ).tagged(.factory)
         // nonKanji 內容（假名、鴨蛋零等）對應普通讀音。
         rawAllUnigrams += factoryUnigramsFor(
           key: keyChain,
           keyArray: flatKeyArray,
           entryType: .nonKanji
-        )
+        ).tagged(.factory)
         // `_` 開頭的特殊 key（標點、半形標點、特殊符號）存放在 MISC 欄位。
         if keyChain.hasPrefix("_"), keyChain.count > 1 {
           rawAllUnigrams += factoryUnigramsFor(
             key: keyChain,
             keyArray: flatKeyArray,
             entryType: .letterPunctuations
-          )
+          ).tagged(.factory)
         }
         // 原廠核心辭典內容。
         factoryCoreUnigramsResult = factoryCoreUnigramsFor(
@@ -734,29 +836,32 @@ extension LMAssembly {
           }
         }
         // 正式追加原廠核心辭典檢索結果。
-        rawAllUnigrams += factoryCoreUnigramsResult
+        rawAllUnigrams += factoryCoreUnigramsResult.tagged(.factory)
 
         if config.isCNSEnabled {
           rawAllUnigrams += factoryUnigramsFor(
             key: keyChain,
             keyArray: flatKeyArray,
             entryType: .cns
-          )
+          ).tagged(.factory)
         }
       }
+      PerfProbe.end(probeFactory)
 
       if !config.bypassUserPhrasesData, config.isSymbolEnabled {
-        rawAllUnigrams += lmUserSymbols.unigramsFor(key: keyChain, keyArray: flatKeyArray)
+        rawAllUnigrams += lmUserSymbols.unigramsFor(key: keyChain, keyArray: flatKeyArray).tagged([.user, .symbol])
         if !config.isCassetteEnabled {
           rawAllUnigrams += factoryUnigramsFor(
             key: keyChain,
             keyArray: flatKeyArray,
             entryType: .symbolPhrases
-          )
+          ).tagged([.factory, .symbol])
         }
       }
 
       if !config.bypassUserPhrasesData {
+        let probeUserPhrases = PerfProbe.begin("LMI.unigramsFor.userPhrases")
+        defer { PerfProbe.end(probeUserPhrases) }
         let allowBoostingSingleKanji = config.allowRescoringSingleKanjiCandidates
         let factorySingleReadingValueHashes: Set<Int> = factoryCoreUnigramsResult.reduce(into: []) {
           if $1.keyArray.count == 1 { $0.insert($1.hashValue) }
@@ -791,34 +896,16 @@ extension LMAssembly {
             )
           }
         }
-        allUserPhraseUnigrams = userPhraseUnigrams
+        allUserPhraseUnigrams = userPhraseUnigrams.tagged(.user)
         rawAllUnigrams = allUserPhraseUnigrams + rawAllUnigrams
       }
 
-      // 定期清理 InputToken HashMap 以防止記憶體洩漏
-      cleanupInputTokenHashMapIfNeeded()
-
-      // 分析且處理可能存在的 InputToken（in-place 展開，避免双重陣列）。
-      var expandedUnigrams: [Homa.Gram] = []
-      expandedUnigrams.reserveCapacity(rawAllUnigrams.count)
-      for unigram in rawAllUnigrams {
-        let convertedValues = unigram.current.parseAsInputToken(isCHS: isCHS)
-        if convertedValues.isEmpty {
-          expandedUnigrams.append(unigram)
-        } else {
-          for (absDelta, value) in convertedValues.enumerated() {
-            let newScore: Double = -80 - Double(absDelta) * 0.01
-            expandedUnigrams.append(.init(keyArray: flatKeyArray, value: value, score: newScore))
-            let hashKey = "\(keyChain)\t\(value)".hashValue
-            inputTokenHashesArray.insert(hashKey)
-          }
-        }
-      }
-      rawAllUnigrams = expandedUnigrams
+      // 分析且處理可能存在的 InputToken。
+      expandInputTokens(in: &rawAllUnigrams, keyArray: flatKeyArray)
 
       if config.isCassetteEnabled {
         rawAllUnigrams.insert(
-          contentsOf: Self.lmCassette.unigramsFor(key: keyChain, keyArray: flatKeyArray),
+          contentsOf: Self.lmCassette.unigramsFor(key: keyChain, keyArray: flatKeyArray).tagged(.cassette),
           at: 0
         )
       } else if config.isSCPCEnabled || config.alwaysSupplyETenDOSUnigrams {
@@ -826,7 +913,8 @@ extension LMAssembly {
           Homa.Gram(
             keyArray: flatKeyArray,
             value: $0,
-            score: config.isSCPCEnabled ? 0 : -9.5
+            score: config.isSCPCEnabled ? 0 : -9.5,
+            provenance: .factory
           )
         }
       } else if rawAllUnigrams.isEmpty,
@@ -835,45 +923,26 @@ extension LMAssembly {
         // 原廠辭典查無此讀音、但 lmPlainBopomofo 確認為合法 BPMF 讀音時，
         // 附加低權重候選以履行 hasUnigramsForFast 的語義保證。
         rawAllUnigrams += Self.lmPlainBopomofo.valuesFor(key: keyChain, isCHS: isCHS).map {
-          Homa.Gram(keyArray: flatKeyArray, value: $0, score: -9.5)
+          Homa.Gram(keyArray: flatKeyArray, value: $0, score: -9.5, provenance: .factory)
         }
       }
 
       rawAllUnigrams.append(contentsOf: queryDateTimeUnigrams(with: keyChain, keyArray: flatKeyArray))
 
       if keyChain == "_punctuation_list" {
-        rawAllUnigrams.append(contentsOf: getHaninSymbolMenuUnigrams())
-      }
-
-      // 提前處理語彙置換。
-      if !config.bypassUserPhrasesData, config.isPhraseReplacementEnabled {
-        for i in 0 ..< rawAllUnigrams.count {
-          let oldUnigram = rawAllUnigrams[i]
-          let newValue = lmReplacements.valuesFor(key: oldUnigram.current)
-          guard !newValue.isEmpty else { continue }
-          let newUnigram = Homa.Gram(
-            keyArray: oldUnigram.keyArray,
-            value: newValue,
-            score: oldUnigram.probability
-          )
-          rawAllUnigrams[i] = newUnigram
-        }
+        rawAllUnigrams.append(contentsOf: getHaninSymbolMenuUnigrams().tagged(.symbol))
       }
 
+      // 語彙置換、濾除、去重。
+      let probePostProcess = PerfProbe.begin("LMI.unigramsFor.postProcess")
       let dataAsFilter: Set<String> = config.bypassUserPhrasesData
         ? []
-        : .init(
-          lmFiltered.unigramsFor(key: keyChain, keyArray: flatKeyArray).lazy.map(\.current)
-        )
-      rawAllUnigrams.consolidate(filter: dataAsFilter)
+        : lmFiltered.valueSet(forKey: keyChain)
+      applyReplacementsAndFilter(to: &rawAllUnigrams, filter: dataAsFilter)
+      PerfProbe.end(probePostProcess)
       rawAllUnigrams.sort { $0.probability > $1.probability }
-      // Store in LRU cache with size limit
-      unigramLRUCache[cacheKey] = rawAllUnigrams
-      if unigramLRUCache.count > 1_024 {
-        let half = unigramLRUCache.count / 2
-        let keysToRemove = Array(unigramLRUCache.keys.prefix(half))
-        keysToRemove.forEach { unigramLRUCache.removeValue(forKey: $0) }
-      }
+      // 寫入快取（滿載時以 CLOCK 策略淘汰）。
+      unigramCache.insert(rawAllUnigrams, for: cacheKey, stamp: cacheStamp)
       return rawAllUnigrams
     }
 
@@ -893,8 +962,8 @@ extension LMAssembly {
     static var lmCassette = LMCassette()
     static var lmPlainBopomofo = LMPlainBopomofo()
 
-    /// 原廠辭典世代計數器：每次原廠辭典被重新載入或解除安裝時遞增。
-    /// 供 `unigramsFor` 的 LRU cache fingerprint 使用，確保切換原廠辭典後舊快取自動失效。
+    /// 共用資料世代計數器：每次原廠辭典被重新載入或解除安裝、或磁帶資料被重新載入時遞增。
+    /// 供 `unigramsFor` 的快取世代比對使用，確保切換共用資料後舊快取自動失效。
     nonisolated static let mtxFactoryGeneration: NSMutex<Int> = .init(0)
 
     nonisolated static var factoryTrie: VanguardTrie.TextMapTrie? {
@@ -903,7 +972,7 @@ extension LMAssembly {
       }
       set {
         mtxFactoryTrie.value = newValue
-        mtxFactoryGeneration.value &+= 1
+        Self.mtxFactoryGeneration.value &+= 1
       }
     }
 
@@ -938,6 +1007,11 @@ extension LMAssembly {
       set { mtxLXPerceptor.value = newValue }
     }
 
+    /// 令 `unigramsFor` 的查詢結果快取失效：僅遞增資料世代，快取會在下次存取時整池清空。
+    func invalidateUnigramCache() {
+      dataGeneration &+= 1
+    }
+
     // 確保關聯詞語資料在首次剛需時得以即時載入。
     internal func ensureAssociatesLoaded() {
       if !lmAssociates.isLoaded {
@@ -991,17 +1065,30 @@ extension LMAssembly {
       if let mutator = lxPerceptor {
         mutator(&self.lxPerceptor)
       }
-      // injectTestData 直接修改 sub-LM，必須使 LRU cache 失效。
-      unigramLRUCache.removeAll(keepingCapacity: true)
+      // injectTestData 直接修改 sub-LM，必須使快取失效。
+      invalidateUnigramCache()
     }
 
     // MARK: Private
 
     nonisolated private static let mtxFactoryTrie: NSMutex<VanguardTrie.TextMapTrie?> = .init(nil)
 
-    // LRU cache for unigramsFor
-    private var unigramCacheFingerprint: Int = 0
-    private var unigramLRUCache: [String: [Homa.Gram]] = [:]
+    /// 經繁簡轉換而來、需要人工覆核的語彙的行尾註記（與 `UserPhraseInsertable` 的輸出格式一致）。
+    private static let humanCheckRequiredMark = "#𝙃𝙪𝙢𝙖𝙣𝘾𝙝𝙚𝙘𝙠𝙍𝙚𝙦𝙪𝙞𝙧𝙚𝙙"
+
+    /// 使用者語彙的載入序號：每次載入時遞增，非同步載入完成時據此判斷自身是否已被作廢。
+    private var userPhrasesLoadTicket: UInt64 = 0
+    /// 仍在非同步載入中的使用者語彙檔案路徑。
+    private var pendingUserPhrasesPath: String?
+
+    /// `unigramsFor` 的查詢結果快取。
+    private var unigramCache = UnigramCache()
+    /// 該 LMI 自身的資料世代：設定或使用者資料有變動時遞增。
+    private var dataGeneration: UInt64 = 0
+
+    private var unigramCacheStamp: UnigramCache.Stamp {
+      .init(dataGeneration: dataGeneration, sharedGeneration: Self.mtxFactoryGeneration.value)
+    }
 
     nonisolated private let mtxLXPerceptor: NSMutex<LXPerceptor>
 
@@ -1032,21 +1119,18 @@ extension LMAssembly {
     private func unigramsForWithAlternatives(keyArray: [Homa.PossibleKey], partiallyMatch: Bool) -> [Homa.Gram] {
       let flatKeyArray = keyArray.map(\.first)
       let keyChain = flatKeyArray.joined(separator: "-")
-      let cacheKey = "ALT\t\(keyArray.hashValue)"
+      let cacheKey = UnigramCache.Key.alternatives(keyArray)
       let noEmptyKey = !flatKeyArray.isEmpty && flatKeyArray.allSatisfy { !$0.isEmpty }
       guard noEmptyKey else { return [] }
-      // 檢查 LRU 快取
-      var hasher = Hasher()
-      hasher.combine(config)
-      hasher.combine(Self.mtxFactoryGeneration.value)
-      let fingerprint = hasher.finalize()
-      if fingerprint != unigramCacheFingerprint {
-        unigramLRUCache.removeAll(keepingCapacity: true)
-        unigramCacheFingerprint = fingerprint
-      }
-      if let cached = unigramLRUCache[cacheKey] {
+      // 檢查快取：只比對資料世代，無須每次都雜湊整份設定。
+      let cacheStamp = unigramCacheStamp
+      if let cached = unigramCache.value(for: cacheKey, stamp: cacheStamp) {
+        PerfProbe.count("LMI.unigramsFor.cacheHit")
         return cached
       }
+      PerfProbe.count("LMI.unigramsFor.cacheMiss")
+      let probeTotal = PerfProbe.begin("LMI.unigramsFor.alternatives")
+      defer { PerfProbe.end(probeTotal) }
       // 展開替代讀音陣列（供非原廠辭典查詢使用）
       let expandedKeyArrays = Self.expandPossibleKeyArrays(keyArray)
       // 原廠辭典使用 chopped 路徑（"&" 連接，發生在這裡，一次查詢）
@@ -1058,10 +1142,13 @@ extension LMAssembly {
       if !config.isCassetteEnabled
         || config.isCassetteEnabled && (flatKeyArray.first?.hasPrefix("_") ?? false) {
         rawAllUnigrams += supplyNumPadUnigrams(key: keyChain, keyArray: flatKeyArray)
-        rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .zhuyinwen)
-        rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .nonKanji)
+        rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .zhuyinwen).tagged(.factory)
+        rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .nonKanji).tagged(.factory)
         if keyChain.hasPrefix("_"), keyChain.count > 1 {
-          rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .letterPunctuations)
+          rawAllUnigrams += factoryChoppedUnigramsFor(
+            keyArray: choppedKeyArray,
+            entryType: .letterPunctuations
+          ).tagged(.factory)
         }
         factoryCoreUnigramsResult = factoryChoppedCoreUnigramsFor(
           keyArray: choppedKeyArray,
@@ -1093,19 +1180,22 @@ extension LMAssembly {
             }
           }
         }
-        rawAllUnigrams += factoryCoreUnigramsResult
+        rawAllUnigrams += factoryCoreUnigramsResult.tagged(.factory)
         if config.isCNSEnabled {
-          rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .cns)
+          rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .cns).tagged(.factory)
         }
       }
 
       if !config.bypassUserPhrasesData, config.isSymbolEnabled {
         for subKeyArray in expandedKeyArrays {
           let subKeyChain = subKeyArray.joined(separator: "-")
-          rawAllUnigrams += lmUserSymbols.unigramsFor(key: subKeyChain, keyArray: subKeyArray)
+          rawAllUnigrams += lmUserSymbols.unigramsFor(key: subKeyChain, keyArray: subKeyArray).tagged([.user, .symbol])
         }
         if !config.isCassetteEnabled {
-          rawAllUnigrams += factoryChoppedUnigramsFor(keyArray: choppedKeyArray, entryType: .symbolPhrases)
+          rawAllUnigrams += factoryChoppedUnigramsFor(
+            keyArray: choppedKeyArray,
+            entryType: .symbolPhrases
+          ).tagged([.factory, .symbol])
         }
       }
 
@@ -1146,35 +1236,18 @@ extension LMAssembly {
               )
             }
           }
-          allUserPhraseUnigrams.append(contentsOf: userPhraseUnigrams)
+          allUserPhraseUnigrams.append(contentsOf: userPhraseUnigrams.tagged(.user))
         }
         rawAllUnigrams = allUserPhraseUnigrams + rawAllUnigrams
       }
 
-      cleanupInputTokenHashMapIfNeeded()
-
-      var expandedUnigrams: [Homa.Gram] = []
-      expandedUnigrams.reserveCapacity(rawAllUnigrams.count)
-      for unigram in rawAllUnigrams {
-        let convertedValues = unigram.current.parseAsInputToken(isCHS: isCHS)
-        if convertedValues.isEmpty {
-          expandedUnigrams.append(unigram)
-        } else {
-          for (absDelta, value) in convertedValues.enumerated() {
-            let newScore: Double = -80 - Double(absDelta) * 0.01
-            expandedUnigrams.append(.init(keyArray: flatKeyArray, value: value, score: newScore))
-            let hashKey = "\(keyChain)\t\(value)".hashValue
-            inputTokenHashesArray.insert(hashKey)
-          }
-        }
-      }
-      rawAllUnigrams = expandedUnigrams
+      expandInputTokens(in: &rawAllUnigrams, keyArray: flatKeyArray)
 
       if config.isCassetteEnabled {
         for subKeyArray in expandedKeyArrays {
           let subKeyChain = subKeyArray.joined(separator: "-")
           rawAllUnigrams.insert(
-            contentsOf: Self.lmCassette.unigramsFor(key: subKeyChain, keyArray: subKeyArray),
+            contentsOf: Self.lmCassette.unigramsFor(key: subKeyChain, keyArray: subKeyArray).tagged(.cassette),
             at: 0
           )
         }
@@ -1185,7 +1258,8 @@ extension LMAssembly {
             Homa.Gram(
               keyArray: flatKeyArray,
               value: $0,
-              score: config.isSCPCEnabled ? 0 : -9.5
+              score: config.isSCPCEnabled ? 0 : -9.5,
+              provenance: .factory
             )
           }
         }
@@ -1194,7 +1268,7 @@ extension LMAssembly {
           let subKeyChain = subKeyArray.joined(separator: "-")
           if Self.lmPlainBopomofo.hasValuesFor(key: subKeyChain) {
             rawAllUnigrams += Self.lmPlainBopomofo.valuesFor(key: subKeyChain, isCHS: isCHS).map {
-              Homa.Gram(keyArray: flatKeyArray, value: $0, score: -9.5)
+              Homa.Gram(keyArray: flatKeyArray, value: $0, score: -9.5, provenance: .factory)
             }
           }
         }
@@ -1206,47 +1280,91 @@ extension LMAssembly {
       }
 
       if keyChain == "_punctuation_list" {
-        rawAllUnigrams.append(contentsOf: getHaninSymbolMenuUnigrams())
-      }
-
-      if !config.bypassUserPhrasesData, config.isPhraseReplacementEnabled {
-        for i in 0 ..< rawAllUnigrams.count {
-          let oldUnigram = rawAllUnigrams[i]
-          let newValue = lmReplacements.valuesFor(key: oldUnigram.current)
-          guard !newValue.isEmpty else { continue }
-          let newUnigram = Homa.Gram(
-            keyArray: oldUnigram.keyArray,
-            value: newValue,
-            score: oldUnigram.probability
-          )
-          rawAllUnigrams[i] = newUnigram
-        }
+        rawAllUnigrams.append(contentsOf: getHaninSymbolMenuUnigrams().tagged(.symbol))
       }
 
       let dataAsFilter: Set<String> = config.bypassUserPhrasesData
         ? []
-        : Set(
-          expandedKeyArrays.flatMap { subKeyArray in
-            lmFiltered.unigramsFor(key: subKeyArray.joined(separator: "-"), keyArray: subKeyArray)
-          }.map(\.current)
-        )
-      rawAllUnigrams.consolidate(filter: dataAsFilter)
+        : expandedKeyArrays.reduce(into: []) { result, subKeyArray in
+          result.formUnion(lmFiltered.valueSet(forKey: subKeyArray.joined(separator: "-")))
+        }
+      applyReplacementsAndFilter(to: &rawAllUnigrams, filter: dataAsFilter)
       rawAllUnigrams.sort { $0.probability > $1.probability }
-      unigramLRUCache[cacheKey] = rawAllUnigrams
-      if unigramLRUCache.count > 1_024 {
-        let half = unigramLRUCache.count / 2
-        let keysToRemove = Array(unigramLRUCache.keys.prefix(half))
-        keysToRemove.forEach { unigramLRUCache.removeValue(forKey: $0) }
-      }
+      unigramCache.insert(rawAllUnigrams, for: cacheKey, stamp: cacheStamp)
       return rawAllUnigrams
     }
 
-    /// 當 HashMap 過大時自動清理
-    private func cleanupInputTokenHashMapIfNeeded() {
-      // 超過 3000 條目就直接清空（Set 無法保留插入順序，故不做部分截斷）。
-      if inputTokenHashesArray.count > 3_000 {
-        inputTokenHashesArray.removeAll(keepingCapacity: true)
+    /// 就地展開給定候選陣列當中的 InputToken，展開結果帶有 `.macro` 來源旗標。
+    ///
+    /// 只有以「MACRO@」開頭的候選才會被解析（僅比對 UTF-8 位元組）；
+    /// 陣列內若無任何 InputToken，則整個陣列原樣沿用、不另行複製。
+    private func expandInputTokens(in unigrams: inout [Homa.Gram], keyArray: [String]) {
+      guard unigrams.contains(where: { $0.current.isInputTokenCandidate }) else { return }
+      var expandedUnigrams: [Homa.Gram] = []
+      expandedUnigrams.reserveCapacity(unigrams.count)
+      for unigram in unigrams {
+        guard unigram.current.isInputTokenCandidate else {
+          expandedUnigrams.append(unigram)
+          continue
+        }
+        let convertedValues = unigram.current.parseAsInputToken(isCHS: isCHS)
+        if convertedValues.isEmpty {
+          expandedUnigrams.append(unigram)
+        } else {
+          for (absDelta, value) in convertedValues.enumerated() {
+            let newScore: Double = -80 - Double(absDelta) * 0.01
+            expandedUnigrams.append(
+              .init(
+                keyArray: keyArray,
+                value: value,
+                score: newScore,
+                provenance: unigram.provenance.union(.macro)
+              )
+            )
+          }
+        }
+      }
+      unigrams = expandedUnigrams
+    }
+
+    /// 以單趟掃描完成語彙置換、濾除、與去重（與先逐筆置換、再 `consolidate(filter:)` 的結果一致）。
+    ///
+    /// 語彙置換的對象判定先經由 `LMReplacements.mightHaveValuesFor(key:)` 的位元集篩過，
+    /// 故絕大多數候選只需雜湊一次、無須二分搜尋。
+    private func applyReplacementsAndFilter(to unigrams: inout [Homa.Gram], filter: Set<String>) {
+      let shouldReplace = !config.bypassUserPhrasesData
+        && config.isPhraseReplacementEnabled
+        && lmReplacements.isLoaded
+      var inserted = Set<String>(minimumCapacity: unigrams.count)
+      var result: [Homa.Gram] = []
+      result.reserveCapacity(unigrams.count)
+      for unigram in unigrams {
+        var unigram = unigram
+        if shouldReplace, lmReplacements.mightHaveValuesFor(key: unigram.current) {
+          let newValue = lmReplacements.valuesFor(key: unigram.current)
+          if !newValue.isEmpty {
+            unigram = .init(
+              keyArray: unigram.keyArray,
+              value: newValue,
+              score: unigram.probability,
+              provenance: unigram.provenance.union(.replacement)
+            )
+          }
+        }
+        guard !filter.contains(unigram.current) else { continue }
+        guard inserted.insert(unigram.current).inserted else { continue }
+        result.append(unigram)
       }
+      unigrams = result
     }
   }
 }
+
+// MARK: - Array<Homa.Gram> + Provenance
+
+extension Array where Element == Homa.Gram {
+  /// 給陣列內的每個元圖追加給定的來源旗標。
+  fileprivate func tagged(_ provenance: Homa.Gram.Provenance) -> [Homa.Gram] {
+    map { $0.withProvenance(provenance) }
+  }
+}
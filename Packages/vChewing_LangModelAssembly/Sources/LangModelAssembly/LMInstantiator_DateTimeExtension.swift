@@ -58,13 +58,9 @@ extension LMAssembly.LMInstantiator {
     }
     // 終末處理。
     let values = tokens.map { $0.parseAsInputToken(isCHS: isCHS) }.flatMap { $0 }.deduplicated
-    values.forEach { currentValue in
-      let hashKey = "\(key)\t\(currentValue)".hashValue
-      inputTokenHashesArray.insert(hashKey)
-    }
     var i: Double = -99
     for strValue in values.reversed() {
-      results.insert(.init(keyArray: keyArray, value: strValue, score: i), at: 0)
+      results.insert(.init(keyArray: keyArray, value: strValue, score: i, provenance: .macro), at: 0)
       i += 1
     }
     return results
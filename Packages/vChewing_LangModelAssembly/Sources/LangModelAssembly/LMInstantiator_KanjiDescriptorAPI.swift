@@ -6,6 +6,7 @@
 // marks, or product names of Contributor, except as required to fulfill notice
 // requirements defined in MIT License.
 
+import Homa
 import Shared
 
 extension LMAssembly.LMInstantiator {
@@ -15,14 +16,12 @@ extension LMAssembly.LMInstantiator {
     -> (display: String, readingToNarrate: String)? {
     ensureAssociatesLoaded()
     guard let candidate = state.currentCandidate else { return nil }
-    let keyChain = candidate.keyArray.joined(separator: "-")
-    let hashKey = "\(keyChain)\t\(candidate.value)".hashValue
     let justReturnValue = candidate.keyArray.isEmpty
-      // InputToken 結果一律唸讀 candidate value (display string)。
-      || inputTokenHashesArray.contains(hashKey)
       // 不是標準情形，value 大概率是表情符號。
       || candidate.value.count != candidate.keyArray.count
       || state.type == .ofSymbolTable
+      // InputToken 結果一律唸讀 candidate value (display string)。
+      || state.isMacroCandidate(candidate)
     guard !justReturnValue else {
       return (candidate.value, candidate.value)
     }
@@ -53,14 +52,7 @@ extension LMAssembly.LMInstantiator {
         )
       }
     case 2...:
-      let candidates = state.candidates.filter {
-        guard $0.value.count == $0.keyArray.count else { return false }
-        guard $0.keyArray.count == segLength else { return false }
-        let keyChain = $0.keyArray.joined(separator: "-")
-        let hashKey = "\(keyChain)\t\($0.value)".hashValue
-        let isTokenCandidate = inputTokenHashesArray.contains(hashKey)
-        return !isTokenCandidate && $0.value.count == $0.keyArray.count
-      }
+      let candidates = narratableCandidates(in: state, segLength: segLength)
       if candidates.count == 1 {
         if state.type == .ofAssociates {
           return (candidate.value, candidate.value)
@@ -105,14 +97,12 @@ extension LMAssembly.LMInstantiator {
     -> String? {
     ensureAssociatesLoaded()
     guard let candidate = state.currentCandidate else { return nil }
-    let keyChain = candidate.keyArray.joined(separator: "-")
-    let hashKey = "\(keyChain)\t\(candidate.value)".hashValue
     let justReturnValue = candidate.keyArray.isEmpty
-      // InputToken 結果一律唸讀 candidate value (display string)。
-      || inputTokenHashesArray.contains(hashKey)
       // 不是標準情形，value 大概率是表情符號。
       || candidate.value.count != candidate.keyArray.count
       || state.type == .ofSymbolTable
+      // InputToken 結果一律唸讀 candidate value (display string)。
+      || state.isMacroCandidate(candidate)
     guard !justReturnValue else {
       return candidate.value
     }
@@ -128,14 +118,7 @@ extension LMAssembly.LMInstantiator {
       }
       return "\(candidate.value)\(associatedSuffix) 的 \(candidate.value)"
     case 2...:
-      let candidates = state.candidates.filter {
-        guard $0.value.count == $0.keyArray.count else { return false }
-        guard $0.keyArray.count == segLength else { return false }
-        let keyChain = $0.keyArray.joined(separator: "-")
-        let hashKey = "\(keyChain)\t\($0.value)".hashValue
-        let isTokenCandidate = inputTokenHashesArray.contains(hashKey)
-        return !isTokenCandidate && $0.value.count == $0.keyArray.count
-      }
+      let candidates = narratableCandidates(in: state, segLength: segLength)
       if candidates.count == 1 {
         return candidate.value
       }
@@ -163,4 +146,18 @@ extension LMAssembly.LMInstantiator {
     default: return nil
     }
   }
+
+  /// 篩出可供逐字朗讀比對的候選：讀音與字數一致、幅長相符、且並非 InputToken 的展開結果。
+  /// 後者直接讀取狀態內由組字器候選謄入的來源標記。
+  private func narratableCandidates(
+    in state: some IMEStateProtocol,
+    segLength: Int
+  )
+    -> [CandidateInState] {
+    state.candidates.filter { candidate in
+      guard candidate.value.count == candidate.keyArray.count else { return false }
+      guard candidate.keyArray.count == segLength else { return false }
+      return !state.isMacroCandidate(candidate)
+    }
+  }
 }
@@ -35,6 +35,31 @@ extension LMAssembly.LMInstantiator {
     )
   }
 
+  /// 向漸退記憶模組索取選字建議（帶快取），詳見 `LXPerceptor.fetchSuggestion(assembler:cursor:timestamp:)`。
+  /// - Parameters:
+  ///   - assembler: 組字器。
+  ///   - cursor: 游標位置。
+  ///   - timestamp: 時間戳。
+  /// - Returns: 選字建議。
+  public func fetchPOMSuggestion(
+    assembler: Homa.Assembler,
+    cursor: Int,
+    timestamp: Double
+  )
+    -> LMAssembly.OverrideSuggestion {
+    lxPerceptor.fetchSuggestion(assembler: assembler, cursor: cursor, timestamp: timestamp)
+  }
+
+  /// 漸退記憶建議快取的命中統計，供效能剖析之用。
+  public var pomSuggestionCacheStats: (hits: Int, misses: Int) {
+    lxPerceptor.suggestionMemoStats
+  }
+
+  /// 清空漸退記憶建議快取（含命中統計）。
+  public func purgePOMSuggestionCache() {
+    lxPerceptor.purgeSuggestionMemo()
+  }
+
   /// 是否啟用急速遺忘模式（縮短 POM 壽命至 12 小時以內）。
   /// 由外部（如 `PrefMgr`）注入，轉發至底層 `lxPerceptor.reducedLifetime`。
   public var pomReducedLifetime: Bool {
@@ -0,0 +1,47 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+import Homa
+import SwiftExtension
+
+// MARK: - 熱路徑量測 (Hot-Path Perf Probes)
+
+/// 量測點一覽（皆僅在以 `-DVCHEWING_PERF_PROBES` 建置時生效）：
+/// - `LMI.unigramsFor*`：LRU 快取命中／未命中、原廠辭典、使用者片語、語彙置換、濾除等各階段耗時。
+/// - `TextMapTrie.getEntryGroups*`：原廠辭典 Trie 查詢及其查詢快取命中率。
+/// - `LXPerceptor.fetchSuggestion*`：漸退記憶建議的查詢耗時與命中率。
+/// - `Homa.Assembler.*`：`assignNodes` 的掃描窗數量與耗時、`assemble` 的動態規劃耗時。
+extension LMAssembly.LMInstantiator {
+  /// 取得目前累積的量測結果鏡照。未啟用量測的建置會回傳空鏡照。
+  public static func perfProbeSnapshot() -> PerfProbe.Snapshot {
+    PerfProbe.snapshot()
+  }
+
+  /// 以純文字報表輸出目前累積的量測結果。
+  /// - Parameter resetAfterDump: 輸出後是否清空累積資料。
+  /// - Returns: 報表內容。
+  @discardableResult
+  public static func dumpPerfProbes(resetAfterDump: Bool = false) -> String {
+    let result = PerfProbe.snapshot().dump()
+    if resetAfterDump { PerfProbe.reset() }
+    return result
+  }
+
+  /// 將 Homa 組字器的量測掛鉤接到 `PerfProbe`。Homa 本身沒有時鐘可用，故由 LMI 代為注入。
+  static func installPerfProbeSinkIfNeeded() {
+    #if VCHEWING_PERF_PROBES
+      guard Homa.PerfHooks.sink == nil else { return }
+      Homa.PerfHooks.sink = .init(
+        now: { DispatchTime.now().uptimeNanoseconds },
+        recordSpan: { PerfProbe.record(span: $0, nanoseconds: $1) },
+        recordCounter: { PerfProbe.record(counter: $0, delta: $1) }
+      )
+    #endif
+  }
+}
@@ -52,37 +52,28 @@ extension LMAssembly.LMInstantiator {
     }
 
     if !Self.asyncLoadingUserData {
-      do {
-        let textMapData = try Data(contentsOf: URL(fileURLWithPath: resolvedTextMapPath), options: [.mappedIfSafe])
-        factoryTrie = try VanguardTrie.TextMapTrie(data: textMapData)
-        vCLMLog("Factory TextMap loading complete: \(resolvedTextMapPath)")
-        completionHandler?(true)
-        return
-      } catch {
-        vCLMLog("Factory TextMap loading failed: \(error.localizedDescription)")
-        factoryTrie = nil
-        completionHandler?(false)
-        return
-      }
+      completionHandler?(loadFactoryTrie(resolvedTextMapPath: resolvedTextMapPath))
     } else {
       LMAssembly.fileHandleQueue.async {
-        do {
-          let textMapData = try Data(contentsOf: URL(fileURLWithPath: resolvedTextMapPath), options: [.mappedIfSafe])
-          let newTrie = try VanguardTrie.TextMapTrie(data: textMapData)
-          factoryTrie = newTrie
-          vCLMLog("Factory TextMap async loading complete: \(resolvedTextMapPath)")
-          completionHandler?(true)
-        } catch {
-          vCLMLog("Factory TextMap async loading failed: \(error.localizedDescription)")
-          factoryTrie = nil
-          completionHandler?(false)
-        }
+        completionHandler?(loadFactoryTrie(resolvedTextMapPath: resolvedTextMapPath))
       }
-      return
     }
   }
 
-  public static func disconnectFactoryDictionary() {
+  /// 在當前執行緒上同步載入原廠辭典（取代現有的連線），不論 `asyncLoadingUserData` 為何。
+  ///
+  /// 供本身已在背景佇列上執行的呼叫端（比如冷啟動流程）使用，以免還得轉手至主執行緒或其他佇列。
+  /// - Returns: 是否載入成功。
+  nonisolated public static func loadFactoryDictionary(textMapPath: String) -> Bool {
+    guard let resolvedTextMapPath = resolveTextMapPath(from: textMapPath) else {
+      vCLMLog("Factory TextMap path not found: \(textMapPath)")
+      disconnectFactoryDictionary()
+      return false
+    }
+    return loadFactoryTrie(resolvedTextMapPath: resolvedTextMapPath)
+  }
+
+  nonisolated public static func disconnectFactoryDictionary() {
     factoryTrie = nil
   }
 
@@ -133,11 +124,18 @@ extension LMAssembly.LMInstantiator {
     }
   }
 
+  /// 原廠辭典反查。反查索引尚未就緒時會阻塞等待其建立完畢，故不宜在主執行緒上呼叫；
+  /// UI 請改用 `getFactoryReverseLookupDataIfReady()`。
   public static func getFactoryReverseLookupData(with kanji: String) -> [String]? {
     guard let readings = factoryTrie?.reverseLookup(for: kanji) else { return nil }
     return readings
   }
 
+  /// 不阻塞的原廠辭典反查：反查索引尚未就緒時回傳 nil、並在背景開始建立索引。
+  public static func getFactoryReverseLookupDataIfReady(with kanji: String) -> [String]? {
+    factoryTrie?.reverseLookupIfReady(for: kanji)
+  }
+
   func getHaninSymbolMenuUnigrams() -> [Homa.Gram] {
     guard let trie = Self.factoryTrie else { return [] }
     let nodes = trie.getNodes(
@@ -150,7 +148,7 @@ extension LMAssembly.LMInstantiator {
     return makeFactoryUnigrams(
       entries: entries,
       keyArray: ["_punctuation_list"],
-      sourceKey: "_punctuation_list",
+      isPunctuationKey: true,
       entryType: .letterPunctuations,
       includeHalfWidthVariants: false
     )
@@ -173,7 +171,8 @@ extension LMAssembly.LMInstantiator {
       return factoryStrictSupersetUnigramsFor(
         subsetKey: key,
         subsetKeyArray: keyArray,
-        entryType: isCHS ? .chs : .cht
+        entryType: isCHS ? .chs : .cht,
+        limit: config.factorySupersetLookupLimit
       )
     }
   }
@@ -217,37 +216,24 @@ extension LMAssembly.LMInstantiator {
     return makeFactoryUnigrams(
       entries: entries,
       keyArray: keyArray,
-      sourceKey: key,
+      isPunctuationKey: key.contains("_punctuation"),
       entryType: entryType,
       includeHalfWidthVariants: true
     )
   }
 
+  /// - Parameter limit: 最多採用幾個鍵鏈、且最多產出幾個單元圖；nil 表示不設限。
   func factoryStrictSupersetUnigramsFor(
     subsetKey: String,
     subsetKeyArray: [String],
-    entryType: VanguardTrie.Trie.EntryType
+    entryType: VanguardTrie.Trie.EntryType,
+    limit: Int? = nil
   )
     -> [Homa.Gram] {
     if subsetKey == "_punctuation_list" { return [] }
     guard let trie = Self.factoryTrie else { return [] }
-    let nodes = trie.getNodes(
-      keyArray: subsetKeyArray,
-      filterType: [],
-      partiallyMatch: false,
-      longerSegment: true
-    )
-
-    return nodes.flatMap { node in
-      let nodeKeyArray = node.readingKey.split(separator: "-").map(String.init)
-      return makeFactoryUnigrams(
-        entries: node.entries,
-        keyArray: nodeKeyArray,
-        sourceKey: node.readingKey,
-        entryType: entryType,
-        includeHalfWidthVariants: true
-      )
-    }
+    let matches = trie.supersetKeyChainMatches(prefixing: subsetKeyArray, limit: limit)
+    return makeFactoryUnigrams(matches: matches, entryType: entryType, limit: limit)
   }
 
   func factoryPartiallyMatchedUnigramsFor(
@@ -274,21 +260,11 @@ extension LMAssembly.LMInstantiator {
   )
     -> [Homa.Gram] {
     guard let trie = Self.factoryTrie else { return [] }
-    let entryGroups = trie.getEntryGroups(
+    let matches = trie.choppedKeyChainMatches(
       keysChopped: keyArray,
-      filterType: entryType,
       partiallyMatch: config.partialMatchEnabled
     )
-    guard !entryGroups.isEmpty else { return [] }
-    return entryGroups.flatMap { group in
-      makeFactoryUnigrams(
-        entries: group.entries,
-        keyArray: group.keyArray,
-        sourceKey: group.keyArray.joined(separator: "-"),
-        entryType: entryType,
-        includeHalfWidthVariants: true
-      )
-    }
+    return makeFactoryUnigrams(matches: matches, entryType: entryType)
   }
 
   func factoryChoppedCoreUnigramsFor(
@@ -302,21 +278,14 @@ extension LMAssembly.LMInstantiator {
       return factoryChoppedUnigramsFor(keyArray: keyArray, entryType: entryType)
     case .strictSuperset:
       guard let trie = Self.factoryTrie else { return [] }
-      let entryGroups = trie.getEntryGroups(
+      let limit = config.factorySupersetLookupLimit
+      let matches = trie.choppedKeyChainMatches(
         keysChopped: keyArray,
-        filterType: [],
-        partiallyMatch: false
+        partiallyMatch: false,
+        longerSegment: true,
+        limit: limit
       )
-      return entryGroups.flatMap { group in
-        guard group.keyArray.count > keyArray.count else { return [] as [Homa.Gram] }
-        return makeFactoryUnigrams(
-          entries: group.entries,
-          keyArray: group.keyArray,
-          sourceKey: group.keyArray.joined(separator: "-"),
-          entryType: entryType,
-          includeHalfWidthVariants: true
-        )
-      }
+      return makeFactoryUnigrams(matches: matches, entryType: entryType, limit: limit)
     }
   }
 
@@ -401,10 +370,34 @@ extension LMAssembly.LMInstantiator {
     }
   }
 
+  /// 將原廠辭典的鍵鏈視圖轉為 Unigram。讀音陣列直接沿用視圖預先算好的結果，詞條則到此時才解析。
+  /// - Parameter limit: 單元圖數量上限；一旦達到就不再解析其餘鍵鏈的詞條。nil 表示不設限。
+  private func makeFactoryUnigrams(
+    matches: [VanguardTrie.TextMapTrie.KeyChainMatch],
+    entryType: VanguardTrie.Trie.EntryType,
+    limit: Int? = nil
+  )
+    -> [Homa.Gram] {
+    let limit = limit ?? .max
+    var grams: [Homa.Gram] = []
+    guard limit > 0 else { return grams }
+    for match in matches {
+      grams += makeFactoryUnigrams(
+        entries: match.entries(),
+        keyArray: match.keyArray,
+        isPunctuationKey: match.keyArray.contains(where: { $0.contains("_punctuation") }),
+        entryType: entryType,
+        includeHalfWidthVariants: true
+      )
+      guard grams.count < limit else { return Array(grams.prefix(limit)) }
+    }
+    return grams
+  }
+
   private func makeFactoryUnigrams(
     entries: [VanguardTrie.Trie.Entry],
     keyArray: [String],
-    sourceKey: String,
+    isPunctuationKey: Bool,
     entryType: VanguardTrie.Trie.EntryType,
     includeHalfWidthVariants: Bool
   )
@@ -425,7 +418,7 @@ extension LMAssembly.LMInstantiator {
 
       grams.append(.init(keyArray: keyArray, value: entry.value, score: score))
 
-      guard includeHalfWidthVariants, sourceKey.contains("_punctuation") else { continue }
+      guard includeHalfWidthVariants, isPunctuationKey else { continue }
       let halfWidthValue = entry.value.applyingTransformFW2HW(reverse: false)
       if halfWidthValue != entry.value {
         extraHalfWidthGrams.append(
@@ -464,8 +457,9 @@ extension LMAssembly.LMInstantiator {
 
       grams.append(.init(keyArray: queriedGram.keyArray, value: queriedGram.value, score: score))
 
-      let sourceKey = queriedGram.keyArray.joined(separator: "-")
-      guard includeHalfWidthVariants, sourceKey.contains("_punctuation") else { continue }
+      guard includeHalfWidthVariants,
+            queriedGram.keyArray.contains(where: { $0.contains("_punctuation") })
+      else { continue }
       let halfWidthValue = queriedGram.value.applyingTransformFW2HW(reverse: false)
       if halfWidthValue != queriedGram.value {
         extraHalfWidthGrams.append(
@@ -482,7 +476,20 @@ extension LMAssembly.LMInstantiator {
     return grams
   }
 
-  private static func resolveTextMapPath(from incomingPath: String) -> String? {
+  nonisolated private static func loadFactoryTrie(resolvedTextMapPath: String) -> Bool {
+    do {
+      let textMapData = try Data(contentsOf: URL(fileURLWithPath: resolvedTextMapPath), options: [.mappedIfSafe])
+      factoryTrie = try VanguardTrie.TextMapTrie(data: textMapData)
+      vCLMLog("Factory TextMap loading complete: \(resolvedTextMapPath)")
+      return true
+    } catch {
+      vCLMLog("Factory TextMap loading failed: \(error.localizedDescription)")
+      factoryTrie = nil
+      return false
+    }
+  }
+
+  nonisolated private static func resolveTextMapPath(from incomingPath: String) -> String? {
     let manager = FileManager.default
     let incomingURL = URL(fileURLWithPath: incomingPath)
 
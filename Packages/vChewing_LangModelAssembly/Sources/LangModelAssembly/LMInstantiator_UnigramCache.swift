@@ -0,0 +1,154 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Homa
+
+// MARK: - LMAssembly.UnigramCache
+
+extension LMAssembly {
+  /// `LMInstantiator.unigramsFor()` 的查詢結果快取。
+  ///
+  /// - 失效判定：每筆查詢只比對 `Stamp`（LMI 自身的資料世代、與原廠辭典等共用資料的世代）。
+  ///   任何會影響查詢結果的變動（設定、使用者資料載入或熱置換、原廠辭典重載）都只需遞增世代計數，
+  ///   快取會在下次存取時整池清空，不必在各處逐一清理。
+  /// - 淘汰策略：CLOCK（second-chance）。命中時僅標記「最近用過」，滿載時由時鐘指針掃過各槽位，
+  ///   略過（並清除標記）最近用過者、淘汰第一個未被標記者。其效果近似 LRU，且每次操作皆為 O(1) 攤銷。
+  public struct UnigramCache {
+    // MARK: Lifecycle
+
+    init(capacity: Int = 1_024) {
+      self.capacity = Swift.max(1, capacity)
+    }
+
+    // MARK: Public
+
+    /// 快取的命中統計。
+    public struct Metrics: Equatable, Sendable {
+      public internal(set) var hits = 0
+      public internal(set) var misses = 0
+      public internal(set) var evictions = 0
+      /// 因世代變更而整池清空的次數。
+      public internal(set) var invalidations = 0
+
+      public var hitRate: Double {
+        let total = hits + misses
+        return total == 0 ? 0 : Double(hits) / Double(total)
+      }
+    }
+
+    public private(set) var metrics = Metrics()
+
+    public var count: Int { indexMap.count }
+
+    // MARK: Internal
+
+    /// 快取內容所依據的資料世代。
+    struct Stamp: Equatable {
+      var dataGeneration: UInt64
+      var sharedGeneration: Int
+    }
+
+    enum Key: Hashable {
+      case exact(keyChain: String, partiallyMatch: Bool)
+      case alternatives([Homa.PossibleKey])
+    }
+
+    let capacity: Int
+
+    /// 查詢快取。若世代有變，則先整池清空。
+    mutating func value(for key: Key, stamp: Stamp) -> [Homa.Gram]? {
+      validate(stamp: stamp)
+      guard let slot = indexMap[key] else {
+        metrics.misses += 1
+        return nil
+      }
+      metrics.hits += 1
+      slotReferenced[slot] = true
+      return slotValues[slot]
+    }
+
+    /// 寫入快取。`stamp` 須為查詢結果在計算時所依據的世代。
+    mutating func insert(_ value: [Homa.Gram], for key: Key, stamp: Stamp) {
+      validate(stamp: stamp)
+      if let slot = indexMap[key] {
+        slotValues[slot] = value
+        slotReferenced[slot] = true
+        return
+      }
+      let slot: Int
+      if let freeSlot = freeSlots.popLast() {
+        slot = freeSlot
+      } else if slotKeys.count < capacity {
+        slot = slotKeys.count
+        slotKeys.append(nil)
+        slotValues.append([])
+        slotReferenced.append(false)
+      } else {
+        slot = evictSlot()
+      }
+      slotKeys[slot] = key
+      slotValues[slot] = value
+      slotReferenced[slot] = false
+      indexMap[key] = slot
+    }
+
+    mutating func removeValue(for key: Key) {
+      guard let slot = indexMap.removeValue(forKey: key) else { return }
+      slotKeys[slot] = nil
+      slotValues[slot] = []
+      slotReferenced[slot] = false
+      freeSlots.append(slot)
+    }
+
+    mutating func removeAll() {
+      indexMap.removeAll(keepingCapacity: true)
+      slotKeys.removeAll(keepingCapacity: true)
+      slotValues.removeAll(keepingCapacity: true)
+      slotReferenced.removeAll(keepingCapacity: true)
+      freeSlots.removeAll(keepingCapacity: true)
+      hand = 0
+    }
+
+    mutating func resetMetrics() {
+      metrics = .init()
+    }
+
+    // MARK: Private
+
+    private var stamp: Stamp?
+    private var indexMap: [Key: Int] = [:]
+    private var slotKeys: [Key?] = []
+    private var slotValues: [[Homa.Gram]] = []
+    private var slotReferenced: [Bool] = []
+    private var freeSlots: [Int] = []
+    private var hand = 0
+
+    private mutating func validate(stamp newStamp: Stamp) {
+      guard stamp != newStamp else { return }
+      if stamp != nil, !indexMap.isEmpty { metrics.invalidations += 1 }
+      removeAll()
+      stamp = newStamp
+    }
+
+    /// 轉動時鐘指針，淘汰第一個未被標記為「最近用過」的槽位，並回傳該槽位。
+    private mutating func evictSlot() -> Int {
+      while true {
+        let current = hand
+        hand = (hand + 1) % slotKeys.count
+        guard let key = slotKeys[current] else { return current }
+        if slotReferenced[current] {
+          slotReferenced[current] = false
+          continue
+        }
+        indexMap.removeValue(forKey: key)
+        metrics.evictions += 1
+        return current
+      }
+    }
+  }
+}
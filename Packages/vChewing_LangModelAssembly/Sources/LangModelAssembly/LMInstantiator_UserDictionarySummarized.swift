@@ -11,7 +11,7 @@ import Foundation
 // MARK: - LMAssembly.UserDictionarySummarized
 
 extension LMAssembly {
-  public struct UserDictionarySummarized: Codable {
+  public struct UserDictionarySummarized: Codable, Equatable {
     let isCHS: Bool
     let userPhrases: [String: [String]]
     let filter: [String: [String]]
@@ -32,4 +32,250 @@ extension LMAssembly.LMInstantiator {
       associates: all ? lmAssociates.dictRepresented : [:]
     )
   }
+
+  /// 以串流方式逐筆列出使用者辭典資料，內容與 `summarize(all:)` 一致，但不會一次物化整份辭典。
+  ///
+  /// 各筆資料是在迭代時才自各子語言模組的位元組範圍索引取出的。
+  /// 回傳的序列持有各子語言模組在呼叫當下的快照（僅為寫時複製的參照），之後的資料變動不影響該序列。
+  /// - Parameter all: 是否包含關聯詞語。
+  public func summaryRecords(all: Bool) -> LMAssembly.UserDictionarySummarized.Records {
+    .init(
+      isCHS: isCHS,
+      includesAssociates: all,
+      userPhrases: lmUserPhrases,
+      filter: lmFiltered,
+      userSymbols: lmUserSymbols,
+      replacements: lmReplacements,
+      associates: lmAssociates
+    )
+  }
+}
+
+// MARK: - LMAssembly.UserDictionarySummarized.Records
+
+extension LMAssembly.UserDictionarySummarized {
+  /// 使用者辭典資料的類別。原始值即 JSON 輸出時的欄位名稱，`allCases` 依欄位名稱的字典序排列。
+  public enum Category: String, CaseIterable, Sendable {
+    case associates
+    case filter
+    case replacements
+    case userPhrases
+    case userSymbols
+  }
+
+  /// 單筆摘要資料：某類別當中某個 key 的全部內容。
+  ///
+  /// 語彙置換表的 `values` 只會有一筆（該 key 的整行）。
+  public struct Record: Equatable, Sendable {
+    public let category: Category
+    public let key: String
+    public let values: [String]
+  }
+
+  /// 惰性的摘要資料序列，依 `Category.allCases` 的順序逐類別、逐 key 列出。
+  public struct Records: Sequence {
+    // MARK: Public
+
+    public struct Iterator: IteratorProtocol {
+      // MARK: Lifecycle
+
+      fileprivate init(records: Records, categories: [Category]) {
+        self.records = records
+        self.categories = categories
+      }
+
+      // MARK: Public
+
+      public mutating func next() -> Record? {
+        while categoryIndex < categories.count {
+          let category = categories[categoryIndex]
+          if let group = records.group(of: category, from: entryIndex) {
+            entryIndex = group.nextIndex
+            return .init(category: category, key: group.key, values: group.values)
+          }
+          categoryIndex += 1
+          entryIndex = 0
+        }
+        return nil
+      }
+
+      // MARK: Private
+
+      private let records: Records
+      private let categories: [Category]
+      private var categoryIndex = 0
+      private var entryIndex = 0
+    }
+
+    public let isCHS: Bool
+    public let includesAssociates: Bool
+
+    /// 此序列會列出的類別（未包含關聯詞語時不列出 `.associates`）。
+    public var categories: [Category] {
+      Category.allCases.filter { includesAssociates || $0 != .associates }
+    }
+
+    public func makeIterator() -> Iterator {
+      .init(records: self, categories: categories)
+    }
+
+    /// 僅列出給定類別的資料。
+    public func records(in category: Category) -> IteratorSequence<Iterator> {
+      let categories = categories.contains(category) ? [category] : []
+      return IteratorSequence(Iterator(records: self, categories: categories))
+    }
+
+    // MARK: Internal
+
+    let userPhrases: LMAssembly.LMCoreEX
+    let filter: LMAssembly.LMCoreEX
+    let userSymbols: LMAssembly.LMCoreEX
+    let replacements: LMAssembly.LMReplacements
+    let associates: LMAssembly.LMAssociates
+
+    // MARK: Fileprivate
+
+    fileprivate func group(
+      of category: Category,
+      from index: Int
+    )
+      -> (key: String, values: [String], nextIndex: Int)? {
+      switch category {
+      case .associates: return associates.summaryGroup(from: index)
+      case .filter: return filter.summaryGroup(from: index)
+      case .userPhrases: return userPhrases.summaryGroup(from: index)
+      case .userSymbols: return userSymbols.summaryGroup(from: index)
+      case .replacements:
+        guard let group = replacements.summaryGroup(from: index) else { return nil }
+        return (group.key, [group.line], group.nextIndex)
+      }
+    }
+  }
+}
+
+// MARK: - LMAssembly.UserDictionarySummarized.StreamWriter
+
+extension LMAssembly.UserDictionarySummarized {
+  /// 將摘要資料串流寫入給定輸出目標的寫出器。
+  ///
+  /// 寫出器只持有一段固定上限的緩衝：緩衝超過 `bufferLimit` 個 UTF-8 位元組時即整段交給輸出目標。
+  /// 故無論辭典多大，峰值記憶體用量都只取決於緩衝上限與單筆資料的大小，耗時則與資料量成正比。
+  public struct StreamWriter<Target: TextOutputStream> {
+    // MARK: Lifecycle
+
+    public init(target: Target, bufferLimit: Int = 64 * 1_024) {
+      self.target = target
+      self.bufferLimit = Swift.max(1, bufferLimit)
+      buffer.reserveCapacity(self.bufferLimit)
+    }
+
+    // MARK: Public
+
+    public private(set) var target: Target
+
+    /// 以 JSON 陣列寫出給定的多組摘要資料。解碼結果與 `[UserDictionarySummarized]` 的編碼結果一致。
+    public mutating func writeJSON(_ recordSets: some Sequence<Records>) {
+      append("[")
+      var isFirstSet = true
+      for records in recordSets {
+        append(isFirstSet ? "\n" : ",\n")
+        isFirstSet = false
+        writeJSONObject(of: records)
+      }
+      append(isFirstSet ? "]\n" : "\n]\n")
+      flush()
+    }
+
+    /// 以「類別、key、內容」三欄的 TSV 純文字格式寫出給定的摘要資料，每個內容各佔一行。
+    public mutating func writePlainText(_ records: Records) {
+      for record in records {
+        for value in record.values {
+          append(record.category.rawValue)
+          append("\t")
+          append(record.key)
+          append("\t")
+          append(value)
+          append("\n")
+        }
+      }
+      flush()
+    }
+
+    /// 將緩衝內容全數交給輸出目標。
+    public mutating func flush() {
+      guard !buffer.isEmpty else { return }
+      target.write(buffer)
+      buffer.removeAll(keepingCapacity: true)
+    }
+
+    // MARK: Private
+
+    private let bufferLimit: Int
+    private var buffer = ""
+
+    private mutating func append(_ text: String) {
+      buffer.append(text)
+      if buffer.utf8.count >= bufferLimit { flush() }
+    }
+
+    private mutating func appendJSONString(_ text: String) {
+      let needsEscaping = text.utf8.contains { $0 < 0x20 || $0 == 0x22 || $0 == 0x5C }
+      guard needsEscaping else {
+        append("\"\(text)\"")
+        return
+      }
+      var escaped = "\""
+      escaped.reserveCapacity(text.utf8.count + 8)
+      for scalar in text.unicodeScalars {
+        switch scalar {
+        case "\"": escaped.append("\\\"")
+        case "\\": escaped.append("\\\\")
+        case "\n": escaped.append("\\n")
+        case "\r": escaped.append("\\r")
+        case "\t": escaped.append("\\t")
+        case _ where scalar.value < 0x20:
+          let hex = String(scalar.value, radix: 16)
+          escaped.append("\\u" + String(repeating: "0", count: 4 - hex.count) + hex)
+        default: escaped.unicodeScalars.append(scalar)
+        }
+      }
+      escaped.append("\"")
+      append(escaped)
+    }
+
+    private mutating func writeJSONObject(of records: Records) {
+      append("  {")
+      // 欄位依名稱的字典序寫出；isCHS 夾在 filter 與 replacements 之間。
+      var isFirstField = true
+      for category in Category.allCases {
+        if category == .replacements {
+          append(isFirstField ? "\n" : ",\n")
+          isFirstField = false
+          append("    \"isCHS\" : \(records.isCHS)")
+        }
+        append(isFirstField ? "\n" : ",\n")
+        isFirstField = false
+        append("    \"\(category.rawValue)\" : {")
+        var isFirstRecord = true
+        for record in records.records(in: category) {
+          append(isFirstRecord ? "\n      " : ",\n      ")
+          isFirstRecord = false
+          appendJSONString(record.key)
+          append(" : ")
+          if category == .replacements {
+            appendJSONString(record.values.first ?? "")
+            continue
+          }
+          append("[")
+          for (index, value) in record.values.enumerated() {
+            append(index == 0 ? "\n        " : ",\n        ")
+            appendJSONString(value)
+          }
+          append(record.values.isEmpty ? "]" : "\n      ]")
+        }
+        append(isFirstRecord ? "}" : "\n    }")
+      }
+      append("\n  }")
+    }
+  }
 }
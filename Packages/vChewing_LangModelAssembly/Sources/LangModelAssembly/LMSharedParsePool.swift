@@ -0,0 +1,115 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+import SwiftExtension
+
+// MARK: - LMAssembly.SharedParseSnapshot
+
+extension LMAssembly {
+  /// 使用者資料子模組（LMCoreEX、LMReplacements、LMAssociates）的唯讀解析結果。
+  ///
+  /// 繁簡兩個 LMI 副本各自持有一份子模組。當兩者載入的檔案內容逐位元組相同時
+  /// （使用者符號、關聯詞語、語彙置換等資料常見此情形），後載入者會直接沿用先載入者的解析結果，
+  /// 各陣列經由 copy-on-write 共用同一塊緩衝區。快照本身不可變：重新載入時整份換新、不會就地修改。
+  nonisolated final class SharedParseSnapshot<Payload>: @unchecked Sendable {
+    // MARK: Lifecycle
+
+    init(kind: String, rawData: [UInt8], payload: Payload) {
+      self.kind = kind
+      self.rawData = rawData
+      self.payload = payload
+    }
+
+    // MARK: Internal
+
+    let kind: String
+    let rawData: [UInt8]
+    let payload: Payload
+  }
+
+  /// 以 weak 參照登記解析快照的共用池。已無任何子模組持有的快照會被自動釋放。
+  nonisolated enum SharedParsePool {
+    // MARK: Internal
+
+    /// 目前仍存活的快照數量（僅供單元測試與偵錯使用）。
+    static var liveSnapshotCount: Int {
+      mtxPool.withLock { pool in
+        pool = pool.filter { $0.value.object != nil }
+        return pool.count
+      }
+    }
+
+    /// 查詢與給定內容完全一致的既有快照。
+    /// - Parameters:
+    ///   - kind: 子模組種類（須涵蓋所有會影響解析結果的參數）。
+    ///   - rawData: 待解析的原始位元組。
+    /// - Returns: 既有快照；若無則為 nil。
+    static func lookup<Payload>(
+      kind: String,
+      rawData: [UInt8],
+      as _: Payload.Type = Payload.self
+    )
+      -> SharedParseSnapshot<Payload>? {
+      guard !rawData.isEmpty else { return nil }
+      let key = PoolKey(kind: kind, rawData: rawData)
+      let found = mtxPool.withLockRead { $0[key]?.object as? SharedParseSnapshot<Payload> }
+      // 雜湊相同仍須逐位元組比對，以免碰撞誤用他人資料。
+      guard let found, found.kind == kind, found.rawData == rawData else { return nil }
+      return found
+    }
+
+    /// 登記新的快照，供另一輸入模式的同類子模組沿用。
+    static func publish<Payload>(_ snapshot: SharedParseSnapshot<Payload>) {
+      guard !snapshot.rawData.isEmpty else { return }
+      let key = PoolKey(kind: snapshot.kind, rawData: snapshot.rawData)
+      mtxPool.withLock { pool in
+        pool = pool.filter { $0.value.object != nil }
+        pool[key] = WeakRef(snapshot)
+      }
+    }
+
+    static func purge() {
+      mtxPool.value.removeAll()
+    }
+
+    // MARK: Private
+
+    nonisolated private struct PoolKey: Hashable {
+      // MARK: Lifecycle
+
+      init(kind: String, rawData: [UInt8]) {
+        self.kind = kind
+        self.byteCount = rawData.count
+        var hasher = Hasher()
+        rawData.withUnsafeBytes { hasher.combine(bytes: $0) }
+        self.digest = hasher.finalize()
+      }
+
+      // MARK: Internal
+
+      let kind: String
+      let byteCount: Int
+      let digest: Int
+    }
+
+    nonisolated private final class WeakRef: @unchecked Sendable {
+      // MARK: Lifecycle
+
+      init(_ object: AnyObject) {
+        self.object = object
+      }
+
+      // MARK: Internal
+
+      weak var object: AnyObject?
+    }
+
+    private static let mtxPool: NSMutex<[PoolKey: WeakRef]> = .init([:])
+  }
+}
@@ -81,11 +81,40 @@ extension LMAssembly {
 
     /// 是否啟用急速遺忘模式（縮短 POM 壽命至 12 小時以內）。
     /// 由外部注入，取代 `calculateWeight` 內部直接讀取 `UserDefaults`。
-    var reducedLifetime: Bool = false
+    var reducedLifetime: Bool = false {
+      didSet {
+        guard oldValue != reducedLifetime else { return }
+        lock.withLock { mutStoreVersion &+= 1 }
+      }
+    }
 
     /// 僅供測試：注入的建議用於測試中以繞過內部評分邏輯。
     /// 設置後，`fetchSuggestion` 會立即返回此建議並將其清除。
-    var testInjectedSuggestion: LMAssembly.OverrideSuggestion?
+    var testInjectedSuggestion: LMAssembly.OverrideSuggestion? {
+      get { lock.withLock { mutTestInjectedSuggestion } }
+      set {
+        lock.withLock {
+          mutTestInjectedSuggestion = newValue
+          mutStoreVersion &+= 1
+        }
+      }
+    }
+
+    /// 測試注入的建議。須在持有 `lock` 的情況下存取。
+    var mutTestInjectedSuggestion: LMAssembly.OverrideSuggestion?
+
+    /// 記憶資料版本號：任何會影響建議結果的資料變動都會使其遞增。
+    /// 須在持有 `lock` 的情況下存取。
+    var mutStoreVersion: UInt64 = 0
+
+    /// 選字建議的查詢結果快取，詳見 `fetchSuggestion(assembler:cursor:timestamp:)`。
+    /// 須在持有 `lock` 的情況下存取。
+    var mutSuggestionMemo = SuggestionMemo()
+
+    /// 記憶資料版本號（唯讀）。供外部快取判斷記憶內容是否已有變動。
+    public var storeVersion: UInt64 {
+      lock.withLock { mutStoreVersion }
+    }
 
     var threshold: Double {
       let fallbackValue = Self.kDecayThreshold
@@ -277,6 +306,58 @@ extension LMAssembly.LXPerceptor {
   }
 }
 
+// MARK: - LMAssembly.LXPerceptor.SuggestionMemo
+
+extension LMAssembly.LXPerceptor {
+  /// 選字建議的小型查詢結果快取。
+  ///
+  /// 快取鍵當中的組句世代戳記在全域範圍內唯一，故即便多個輸入會話共用同一個漸退記憶模組，
+  /// 彼此的快取條目也不會互相誤命中。
+  nonisolated struct SuggestionMemo {
+    nonisolated struct Key: Hashable {
+      let assemblyGeneration: FIUUID
+      let cursor: Int
+      let storeVersion: UInt64
+    }
+
+    /// 最多保留的快取條目數量。
+    static let capacity = 8
+    /// 時間戳容許誤差（秒）。漸退記憶的衰減以「天」為單位，一秒內的分數差異可忽略不計。
+    static let timestampTolerance: Double = 1
+
+    private(set) var hits = 0
+    private(set) var misses = 0
+
+    mutating func lookup(_ key: Key, timestamp: Double) -> LMAssembly.OverrideSuggestion? {
+      let matched = entries.lastIndex {
+        $0.key == key && Swift.abs($0.timestamp - timestamp) < Self.timestampTolerance
+      }
+      guard let matched else {
+        misses += 1
+        return nil
+      }
+      hits += 1
+      return entries[matched].suggestion
+    }
+
+    mutating func store(
+      _ suggestion: LMAssembly.OverrideSuggestion,
+      for key: Key,
+      timestamp: Double
+    ) {
+      entries.removeAll { $0.key == key }
+      entries.append((key, timestamp, suggestion))
+      if entries.count > Self.capacity {
+        entries.removeFirst(entries.count - Self.capacity)
+      }
+    }
+
+    // MARK: Private
+
+    private var entries: [(key: Key, timestamp: Double, suggestion: LMAssembly.OverrideSuggestion)] = []
+  }
+}
+
 // MARK: - Internal Methods in LMAssembly.
 
 extension Array where Element == Homa.GramInPath {
@@ -286,12 +367,8 @@ extension Array where Element == Homa.GramInPath {
   ///   - outCursorPastNode: 找出的節點的前端位置。
   /// - Returns: 查找結果。
   nonisolated public func findGramWithRange(at cursor: Int) -> (node: Homa.GramInPath, range: Range<Int>)? {
-    guard !isEmpty else { return nil }
-    let cursor = Swift.max(0, Swift.min(cursor, totalKeyCount - 1)) // 防呆
-    let range = contextRange(ofGivenCursor: cursor)
-    guard let rearNodeID = cursorRegionMap[cursor] else { return nil }
-    guard count - 1 >= rearNodeID else { return nil }
-    return (self[rearNodeID], range)
+    // 與 Homa 的 findGram(at:) 等價，節點邊界表只建構一次。
+    findGram(at: cursor).map { (node: $0.gram, range: $0.range) }
   }
 }
 
@@ -302,6 +379,8 @@ extension LMAssembly.LXPerceptor {
     timestamp: Double
   )
     -> LMAssembly.OverrideSuggestion {
+    let probe = PerfProbe.begin("LXPerceptor.fetchSuggestion")
+    defer { PerfProbe.end(probe) }
     guard let currentNodeResult = assembledResult.findGramWithRange(at: cursor) else {
       return .init()
     }
@@ -314,8 +393,9 @@ extension LMAssembly.LXPerceptor {
     guard !activeKey.isEmpty else { return .init() }
 
     return lock.withLock {
-      if let injected = testInjectedSuggestion {
-        testInjectedSuggestion = nil
+      if let injected = mutTestInjectedSuggestion {
+        mutTestInjectedSuggestion = nil
+        mutStoreVersion &+= 1
         return injected
       }
       var suggestions = getSuggestion(
@@ -323,6 +403,7 @@ extension LMAssembly.LXPerceptor {
         timestamp: timestamp
       )
       if suggestions == nil {
+        PerfProbe.count("LXPerceptor.fetchSuggestion.fallbackKeyLookups")
         for fallbackKey in alternateKeys(for: activeKey) {
           if let fallbackSuggestion = getSuggestion(
             key: fallbackKey,
@@ -335,7 +416,11 @@ extension LMAssembly.LXPerceptor {
         }
       }
 
-      guard let suggestions else { return .init() }
+      guard let suggestions else {
+        PerfProbe.count("LXPerceptor.fetchSuggestion.miss")
+        return .init()
+      }
+      PerfProbe.count("LXPerceptor.fetchSuggestion.hit")
       let forceFlag = forceHighScoreOverrideFlag(for: activeKey)
       return .init(
         candidates: suggestions,
@@ -346,6 +431,57 @@ extension LMAssembly.LXPerceptor {
     }
   }
 
+  /// 向漸退記憶模組索取選字建議（帶快取）。
+  ///
+  /// 同一組句結果與游標位置在同一次按鍵處理過程中往往會被詢問兩三次
+  /// （候選字詞陣列生成、套用建議、上下文鞏固等）。這裡以組字器的組句世代戳記、
+  /// 游標位置、以及記憶資料版本號作為快取鍵；時間戳差距在容許範圍內時直接重用結果，
+  /// 省去重複的節點查找、記憶鍵生成、以及替代鍵回退掃描。
+  /// 快取與記憶資料共用同一把鎖，故版本號的比對與快取的存取不會與記憶資料的變動交錯。
+  /// - Parameters:
+  ///   - assembler: 組字器。
+  ///   - cursor: 游標位置。
+  ///   - timestamp: 時間戳。
+  /// - Returns: 選字建議。
+  nonisolated public func fetchSuggestion(
+    assembler: Homa.Assembler,
+    cursor: Int,
+    timestamp: Double
+  )
+    -> LMAssembly.OverrideSuggestion {
+    let assemblyGeneration = assembler.assemblyGeneration
+    let (memoKey, cached) = lock.withLock {
+      let memoKey = SuggestionMemo.Key(
+        assemblyGeneration: assemblyGeneration,
+        cursor: cursor,
+        storeVersion: mutStoreVersion
+      )
+      return (memoKey, mutSuggestionMemo.lookup(memoKey, timestamp: timestamp))
+    }
+    if let cached { return cached }
+    let suggestion = fetchSuggestion(
+      assembledResult: assembler.assembledSentence,
+      cursor: cursor,
+      timestamp: timestamp
+    )
+    lock.withLock {
+      // 查詢期間記憶資料若有變動（例如消耗掉測試注入的建議），則不予快取。
+      guard memoKey.storeVersion == mutStoreVersion else { return }
+      mutSuggestionMemo.store(suggestion, for: memoKey, timestamp: timestamp)
+    }
+    return suggestion
+  }
+
+  /// 選字建議快取的命中統計，供效能剖析之用。
+  nonisolated public var suggestionMemoStats: (hits: Int, misses: Int) {
+    lock.withLock { (mutSuggestionMemo.hits, mutSuggestionMemo.misses) }
+  }
+
+  /// 清空選字建議快取（含命中統計）。
+  nonisolated public func purgeSuggestionMemo() {
+    lock.withLock { mutSuggestionMemo = .init() }
+  }
+
   /// 獲取由洞察過的記憶內容生成的選字建議。
   nonisolated func getSuggestion(
     key: String,
@@ -434,6 +570,7 @@ extension LMAssembly.LXPerceptor {
     guard !shouldIgnoreKey(key) else { return }
 
     lock.withLock {
+      mutStoreVersion &+= 1
       // 更新現有的洞察
       if let theNeta = mutLRUMap[key] {
         theNeta.perception.update(candidate: candidate, timestamp: timestamp)
@@ -510,6 +647,7 @@ extension LMAssembly.LXPerceptor {
       }
 
       if hasChanges {
+        mutStoreVersion &+= 1
         resetLRUList()
         keysNeedingUpsert.subtract(keysToRemoveCompletely)
         keysNeedingUpsert.forEach { persistor.markKeyForUpsert($0) }
@@ -561,6 +699,7 @@ extension LMAssembly.LXPerceptor {
       }
 
       if hasChanges {
+        mutStoreVersion &+= 1
         resetLRUList()
         keysNeedingUpsert.subtract(keysToRemoveCompletely)
         keysNeedingUpsert.forEach { persistor.markKeyForUpsert($0) }
@@ -597,6 +736,7 @@ extension LMAssembly.LXPerceptor {
       }
 
       if hasChanges {
+        mutStoreVersion &+= 1
         keysToRemove.forEach { persistor.markKeyForRemoval($0) }
         resetLRUList()
       }
@@ -620,6 +760,7 @@ extension LMAssembly.LXPerceptor {
         }
       }
       if !keysToRemove.isEmpty {
+        mutStoreVersion &+= 1
         keysToRemove.forEach { mutLRUMap.removeValue(forKey: $0) }
         resetLRUList()
         keysToRemove.forEach { persistor.markKeyForRemoval($0) }
@@ -647,6 +788,7 @@ extension LMAssembly.LXPerceptor {
   /// 將記憶中的覆寫資料清空，並重置日誌追蹤狀態。
   nonisolated public func clearData() {
     lock.withLock {
+      mutStoreVersion &+= 1
       mutLRUMap = [:]
       mutLRUKeySeqList = []
     }
@@ -676,6 +818,7 @@ extension LMAssembly.LXPerceptor {
         newMap[currentPair.key] = currentPair
       }
       mutLRUMap = newMap
+      mutStoreVersion &+= 1
       resetLRUList()
     }
   }
@@ -704,6 +847,7 @@ extension LMAssembly.LXPerceptor {
             mutLRUMap[key] = pair
             mutated = true
           }
+          if mutated { mutStoreVersion &+= 1 }
         }
       },
       keyValidator: { [self] in !shouldIgnoreKey($0) },
@@ -37,6 +37,13 @@ extension LMAssembly {
       let valueCellCount: UInt32
     }
 
+    /// 可供繁簡模式共用的解析結果。
+    struct ParsedIndex {
+      let keyData: [UInt8]
+      let entries: [AssociatesEntry]
+      let lineRefs: [AssociatesLineRef]
+    }
+
     var filePath: String?
 
     /// 原始資料的 UTF-8 位元組（取代舊版 `strData: String` 的實體儲存）。
@@ -90,6 +97,18 @@ extension LMAssembly {
     mutating func replaceData(textData rawStrData: String) {
       let newBytes = Array(rawStrData.utf8)
       if rawData == newBytes { return }
+      // 另一輸入模式若已載入內容相同的資料，則直接沿用其解析結果。
+      if let shared = LMAssembly.SharedParsePool.lookup(
+        kind: Self.sharedParseKind, rawData: newBytes, as: ParsedIndex.self
+      ) {
+        rawData = shared.rawData
+        keyData = shared.payload.keyData
+        entries = shared.payload.entries
+        lineRefs = shared.payload.lineRefs
+        sharedSnapshot = shared
+        return
+      }
+      sharedSnapshot = nil
       rawData = newBytes
       // 載入期暫存：每個唯一轉換 key 對應的行引用（依行位置排列）。
       var protoKeys: [String] = []
@@ -151,10 +170,18 @@ extension LMAssembly {
       keyData = newKeyData
       entries = newEntries
       lineRefs = newLineRefs
+      let snapshot = LMAssembly.SharedParseSnapshot(
+        kind: Self.sharedParseKind,
+        rawData: rawData,
+        payload: ParsedIndex(keyData: keyData, entries: entries, lineRefs: lineRefs)
+      )
+      LMAssembly.SharedParsePool.publish(snapshot)
+      sharedSnapshot = snapshot
     }
 
     mutating func clear() {
       filePath = nil
+      sharedSnapshot = nil
       rawData.removeAll(keepingCapacity: false)
       keyData.removeAll(keepingCapacity: false)
       entries.removeAll(keepingCapacity: false)
@@ -190,6 +217,10 @@ extension LMAssembly {
 
     // MARK: Private
 
+    private static let sharedParseKind = "LMAssociates"
+
+    /// 持有目前資料所對應的共用解析快照，使其在另一輸入模式仍可被沿用。
+    private var sharedSnapshot: AnyObject?
     /// 轉換後 keys 的 UTF-8 位元組 blob（key 經 `cnvNGramKeyFromPinyinToPhona` 轉換，非原文子字串）。
     private var keyData: [UInt8] = []
     /// 按 key bytes 排序的索引；同 key 多行時 refs 依行位置排列。
@@ -239,4 +270,13 @@ extension LMAssembly.LMAssociates {
     }
     return result
   }
+
+  /// 取出給定 entry 序號的 key 與全部關聯詞語（內容與 `dictRepresented` 的單筆一致）。
+  /// - Returns: 該筆的 key 與關聯詞語、以及下一筆的序號。序號越界時回傳 nil。
+  func summaryGroup(from index: Int) -> (key: String, values: [String], nextIndex: Int)? {
+    guard entries.indices.contains(index) else { return nil }
+    let e = entries[index]
+    let key = String(decoding: keyData[Int(e.keyStart) ..< Int(e.keyEnd)], as: UTF8.self)
+    return (key, valuesAt(entryIndex: index), index + 1)
+  }
 }
@@ -45,6 +45,13 @@ extension LMAssembly {
       let lineEnd: UInt32
     }
 
+    /// 可供繁簡模式共用的解析結果。
+    struct ParsedIndex {
+      let keyData: [UInt8]
+      let entries: [CoreEXEntry]
+      let uniqueKeyCount: Int
+    }
+
     var filePath: String?
 
     /// 原始資料的 UTF-8 位元組（取代舊版 `strData: String` 的實體儲存）。
@@ -112,7 +119,16 @@ extension LMAssembly {
       let newBytes = Array(processed.utf8)
       if rawData == newBytes { return }
 
+      // 另一輸入模式若已載入內容相同的資料，則直接沿用其解析結果。
+      if let shared = LMAssembly.SharedParsePool.lookup(
+        kind: sharedParseKind, rawData: newBytes, as: ParsedIndex.self
+      ) {
+        adoptSharedSnapshot(shared)
+        return
+      }
+
       // 清理之前的資料以釋放記憶體
+      sharedSnapshot = nil
       rawData = newBytes
       keyData.removeAll(keepingCapacity: false)
       entries.removeAll(keepingCapacity: false)
@@ -168,11 +184,13 @@ extension LMAssembly {
       entries = newEntries
       // 明確釋放暫存辭典記憶體
       protoLineMap.removeAll(keepingCapacity: false)
+      publishSharedSnapshot()
     }
 
     /// 將當前語言模組的資料庫辭典自記憶體內卸除。
     mutating func clear() {
       filePath = nil
+      sharedSnapshot = nil
       rawData.removeAll(keepingCapacity: false)
       keyData.removeAll(keepingCapacity: false)
       entries.removeAll(keepingCapacity: false)
@@ -180,6 +198,122 @@ extension LMAssembly {
       temporaryMap.removeAll(keepingCapacity: false)
     }
 
+    // MARK: - Bulk merge
+
+    /// 批次併入用的單筆資料。
+    struct BulkRecord: Sendable {
+      let keyArray: [String]
+      let value: String
+      var weight: Double?
+      /// 附加於行尾的註記（須以 "#" 開頭）。
+      var annotation: String?
+    }
+
+    /// 將大量外部資料一次性併入資料庫辭典，並在單趟之內重建 entries 索引。
+    ///
+    /// 外部資料會先依「轉換後的 key、值」排序並去重，再與既有的（已按 key 排序的）entries 逐 key 歸併：
+    /// 既有資料（含 `temporaryMap`）內已有的 key-value 配對一律略過，新資料則逐行附加至 `rawData` 尾端。
+    /// 既有的行不會被重新解析；此處也不會存檔，呼叫方在併入之後呼叫一次 `saveData()` 即可。
+    /// - parameters:
+    ///   - records: 外部資料。
+    /// - Returns: 實際併入的資料筆數。
+    @discardableResult
+    mutating func mergeBulk(_ records: some Sequence<BulkRecord>) -> Int {
+      // 整理外部資料：轉換 key、組裝行內容，再依 (key, 值, 原始順序) 排序。
+      var incoming: [BulkLine] = []
+      incoming.reserveCapacity(records.underestimatedCount)
+      for record in records {
+        guard let line = BulkLine(record, ordinal: incoming.count, reverse: shouldReverse) else { continue }
+        incoming.append(line)
+      }
+      guard !incoming.isEmpty else { return 0 }
+      incoming.sort()
+
+      var newRawData = rawData
+      newRawData.reserveCapacity(rawData.count + incoming.reduce(0) { $0 + $1.line.count + 1 })
+      if let lastByte = newRawData.last, lastByte != 0x0A { newRawData.append(0x0A) }
+      var newKeyData = [UInt8]()
+      newKeyData.reserveCapacity(keyData.count)
+      var newEntries = [CoreEXEntry]()
+      newEntries.reserveCapacity(entries.count + incoming.count)
+      var newUniqueKeyCount = 0
+      var insertedCount = 0
+
+      var i = 0 // 既有 entries 的游標。
+      var j = 0 // 外部資料的游標。
+      while i < entries.count || j < incoming.count {
+        let order: Int
+        if i >= entries.count {
+          order = 1
+        } else if j >= incoming.count {
+          order = -1
+        } else {
+          let entry = entries[i]
+          order = keyData.compareByteRange(Int(entry.keyStart) ..< Int(entry.keyEnd), with: incoming[j].key)
+        }
+        let keyStart = UInt32(newKeyData.count)
+        var knownValues = Set<[UInt8]>()
+        if order <= 0 {
+          // 既有的 key：原樣搬移該 key 的所有行（同 key 的行共用同一段 keyData）。
+          let head = entries[i]
+          newKeyData.append(contentsOf: keyData[Int(head.keyStart) ..< Int(head.keyEnd)])
+          let keyEnd = UInt32(newKeyData.count)
+          while i < entries.count, entries[i].keyStart == head.keyStart {
+            let entry = entries[i]
+            if order == 0, let valueRange = valueRange(of: entry) {
+              knownValues.insert(Array(rawData[valueRange]))
+            }
+            newEntries.append(.init(
+              keyStart: keyStart, keyEnd: keyEnd, lineStart: entry.lineStart, lineEnd: entry.lineEnd
+            ))
+            i += 1
+          }
+          newUniqueKeyCount += 1
+          guard order == 0 else { continue }
+        } else {
+          newKeyData.append(contentsOf: incoming[j].key)
+        }
+        // 外部資料：同 key 者連續排列，同值者僅取第一筆。
+        let keyEnd = UInt32(newKeyData.count)
+        let currentKey = incoming[j].key
+        if !temporaryMap.isEmpty {
+          temporaryMap[String(decoding: currentKey, as: UTF8.self)]?.forEach {
+            knownValues.insert(Array($0.current.utf8))
+          }
+        }
+        var appendedLines = 0
+        while j < incoming.count, incoming[j].key == currentKey {
+          let record = incoming[j]
+          j += 1
+          guard knownValues.insert(record.value).inserted else { continue }
+          let lineStart = UInt32(newRawData.count)
+          newRawData.append(contentsOf: record.line)
+          newEntries.append(.init(
+            keyStart: keyStart, keyEnd: keyEnd, lineStart: lineStart, lineEnd: UInt32(newRawData.count)
+          ))
+          newRawData.append(0x0A)
+          appendedLines += 1
+        }
+        insertedCount += appendedLines
+        guard order > 0 else { continue }
+        if appendedLines > 0 {
+          newUniqueKeyCount += 1
+        } else {
+          // 該 key 的外部資料全數與 temporaryMap 重複，撤回剛寫入的 key。
+          newKeyData.removeLast(newKeyData.count - Int(keyStart))
+        }
+      }
+      guard insertedCount > 0 else { return 0 }
+
+      sharedSnapshot = nil
+      rawData = newRawData
+      keyData = newKeyData
+      entries = newEntries
+      uniqueKeyCount = newUniqueKeyCount
+      publishSharedSnapshot()
+      return insertedCount
+    }
+
     // MARK: - Advanced features
 
     func saveData() {
@@ -292,6 +426,28 @@ extension LMAssembly {
       return grams
     }
 
+    /// 根據給定的讀音索引鍵，僅取出資料庫辭典內的對應值（不解析權重、不生成單元圖）。
+    ///
+    /// 專供濾除表使用：查無資料時直接回傳空集合，不做任何記憶體配置。
+    /// - parameters:
+    ///   - key: 讀音索引鍵。
+    func valueSet(forKey key: String) -> Set<String> {
+      var result = Set<String>()
+      if let matchedRange = entryRange(forKey: key) {
+        result.reserveCapacity(matchedRange.count)
+        for entryIndex in matchedRange {
+          let entry = entries[entryIndex]
+          rawData.parseByteCells(in: Int(entry.lineStart) ..< Int(entry.lineEnd)) { currentRange, currentIndex in
+            guard currentIndex == (shouldReverse ? 0 : 1) else { return currentIndex < 1 }
+            result.insert(String(decoding: rawData[currentRange], as: UTF8.self))
+            return false
+          }
+        }
+      }
+      temporaryMap[key]?.forEach { result.insert($0.current) }
+      return result
+    }
+
     /// 根據給定的讀音索引鍵來確認資料庫辭典內是否存在對應的資料。
     /// - parameters:
     ///   - key: 讀音索引鍵。
@@ -384,6 +540,90 @@ extension LMAssembly {
     private var entries: [CoreEXEntry] = []
     /// 唯一 key 數量（entries 以行為單位，同 key 可能多行）。
     private var uniqueKeyCount = 0
+    /// 持有目前資料所對應的共用解析快照，使其在另一輸入模式仍可被沿用。
+    private var sharedSnapshot: AnyObject?
+
+    /// 解析結果僅取決於原始內容與 `shouldReverse`。
+    private var sharedParseKind: String {
+      shouldReverse ? "LMCoreEX.reversed" : "LMCoreEX"
+    }
+
+    /// 批次併入時的單筆待寫入行。
+    private struct BulkLine: Comparable {
+      // MARK: Lifecycle
+
+      init?(_ record: BulkRecord, ordinal: Int, reverse: Bool) {
+        let joinedKey = record.keyArray.joined(separator: "-")
+        // 行內的 cell 不得含有空白或換行，首格也不得被誤判為註解行。
+        let isCellSane: (String) -> Bool = { cell in
+          !cell.isEmpty && cell.first != "#" && !cell.utf8.contains { [0x20, 0x09, 0x0A, 0x0D].contains($0) }
+        }
+        guard record.keyArray.allSatisfy({ !$0.isEmpty }) else { return nil }
+        guard isCellSane(joinedKey), isCellSane(record.value) else { return nil }
+        var convertedKey = joinedKey
+        // 僅含注音等非 ASCII 字母的讀音無須（也不該逐筆）走一趟拼音轉換。
+        if joinedKey.utf8.contains(where: { (0x41 ... 0x5A).contains($0 & 0xDF) }) {
+          convertedKey.convertToPhonabets()
+        }
+        var cells = reverse ? [record.value, joinedKey] : [joinedKey, record.value]
+        if let weight = record.weight { cells.append(weight.description) }
+        if let annotation = record.annotation, annotation.first == "#" { cells.append(annotation) }
+        self.key = Array(convertedKey.utf8)
+        self.value = Array(record.value.utf8)
+        self.line = Array(cells.joined(separator: " ").utf8)
+        self.ordinal = ordinal
+      }
+
+      // MARK: Internal
+
+      let key: [UInt8]
+      let value: [UInt8]
+      let line: [UInt8]
+      let ordinal: Int
+
+      static func < (lhs: Self, rhs: Self) -> Bool {
+        if lhs.key != rhs.key { return lhs.key.lexicographicallyPrecedes(rhs.key) }
+        if lhs.value != rhs.value { return lhs.value.lexicographicallyPrecedes(rhs.value) }
+        return lhs.ordinal < rhs.ordinal
+      }
+
+      static func == (lhs: Self, rhs: Self) -> Bool {
+        lhs.ordinal == rhs.ordinal
+      }
+    }
+
+    /// 將目前的解析結果發佈至共用解析池，供另一輸入模式沿用。
+    private mutating func publishSharedSnapshot() {
+      let snapshot = LMAssembly.SharedParseSnapshot(
+        kind: sharedParseKind,
+        rawData: rawData,
+        payload: ParsedIndex(keyData: keyData, entries: entries, uniqueKeyCount: uniqueKeyCount)
+      )
+      LMAssembly.SharedParsePool.publish(snapshot)
+      sharedSnapshot = snapshot
+    }
+
+    /// 取得指定行的值所在的位元組範圍。
+    private func valueRange(of entry: CoreEXEntry) -> Range<Int>? {
+      var result: Range<Int>?
+      let valueIndex = shouldReverse ? 0 : 1
+      rawData.parseByteCells(in: Int(entry.lineStart) ..< Int(entry.lineEnd)) { currentRange, currentIndex in
+        guard currentIndex == valueIndex else { return currentIndex < valueIndex }
+        result = currentRange
+        return false
+      }
+      return result
+    }
+
+    /// 沿用共用解析快照。各陣列與快照共用同一塊緩衝區，不另行複製。
+    private mutating func adoptSharedSnapshot(_ snapshot: LMAssembly.SharedParseSnapshot<ParsedIndex>) {
+      temporaryMap.removeAll(keepingCapacity: false)
+      rawData = snapshot.rawData
+      keyData = snapshot.payload.keyData
+      entries = snapshot.payload.entries
+      uniqueKeyCount = snapshot.payload.uniqueKeyCount
+      sharedSnapshot = snapshot
+    }
 
     /// 二分搜尋 key，回傳對應 entries 的範圍（同 key 的行連續排列）。
     private func entryRange(forKey key: String) -> Range<Int>? {
@@ -422,4 +662,22 @@ extension LMAssembly.LMCoreEX {
     }
     return result
   }
+
+  /// 自給定的 entry 序號起，取出同一 key 的全部整行（內容與 `dictRepresented` 的單筆一致）。
+  /// - Parameter index: 起始 entry 序號，須為某組 key 的第一筆。
+  /// - Returns: 該組的 key 與整行、以及下一組的起始序號。序號越界時回傳 nil。
+  func summaryGroup(from index: Int) -> (key: String, values: [String], nextIndex: Int)? {
+    guard entries.indices.contains(index) else { return nil }
+    let first = entries[index]
+    let keyRange = Int(first.keyStart) ..< Int(first.keyEnd)
+    var values: [String] = []
+    var upper = index
+    while upper < entries.count {
+      let entry = entries[upper]
+      guard keyData.compareByteSlices(keyRange, Int(entry.keyStart) ..< Int(entry.keyEnd)) == 0 else { break }
+      values.append(String(decoding: rawData[Int(entry.lineStart) ..< Int(entry.lineEnd)], as: UTF8.self))
+      upper += 1
+    }
+    return (String(decoding: keyData[keyRange], as: UTF8.self), values, upper)
+  }
 }
@@ -11,36 +11,15 @@ import Foundation
 // MARK: - LMAssembly.LMPlainBopomofo
 
 extension LMAssembly {
+  /// 倚天中文 DOS 注音排序資料。
+  ///
+  /// 資料來源為 `jsnEtenDosSequence`，但執行時只會讀取事先編譯好的 `CompiledTable`，
+  /// 故首次存取時不會再有 JSON 解碼、排序、建立雜湊表等開銷。
   struct LMPlainBopomofo {
     // MARK: Lifecycle
 
     init() {
-      do {
-        let rawData = jsnEtenDosSequence.data(using: .utf8) ?? .init([])
-        let rawJSON = try JSONDecoder().decode([String: [String: String]].self, from: rawData)
-        var dataMapNew = rawJSON
-        if let fung4 = dataMapNew["ㄈㄨㄥˋ"] {
-          fung4.forEach { fKey, fValue in
-            if let existingValue = dataMapNew["ㄈㄥˋ"]?[fKey] {
-              dataMapNew["ㄈㄥˋ", default: [:]][fKey] = existingValue + fValue
-            }
-          }
-        }
-        self.dataMap = dataMapNew
-        self.sortedKeys = rawJSON.keys.sorted {
-          if $0.count == $1.count { return $0 < $1 }
-          return $0.count < $1.count
-        }
-        self.distinctionTables = Self.generateDistinctionHashTables(using: dataMap)
-      } catch {
-        vCLMLog("\(error)")
-        vCLMLog(
-          "↑ Exception happened when parsing raw JSON sequence data from vChewing LMAssembly."
-        )
-        self.dataMap = [:]
-        self.sortedKeys = []
-        self.distinctionTables = [:]
-      }
+      self.table = .shipped
     }
 
     // MARK: Internal
@@ -48,40 +27,53 @@ extension LMAssembly {
     @usableFromInline typealias DataMap = [String: [String: String]]
     @usableFromInline typealias KVHashMap = [String: [Bool: Set<Character>]]
 
-    let dataMap: DataMap
-    let sortedKeys: [String]
-    let distinctionTables: KVHashMap
+    var count: Int { table.count }
 
-    var count: Int { dataMap.count }
+    var isLoaded: Bool { table.count > 0 }
 
-    var isLoaded: Bool { !dataMap.isEmpty }
+    /// 解析原始 JSON 資料。僅供生成 `CompiledTable` 與單元測試使用。
+    static func parseRawJSON() -> DataMap? {
+      do {
+        let rawData = jsnEtenDosSequence.data(using: .utf8) ?? .init([])
+        return try JSONDecoder().decode(DataMap.self, from: rawData)
+      } catch {
+        vCLMLog("\(error)")
+        vCLMLog(
+          "↑ Exception happened when parsing raw JSON sequence data from vChewing LMAssembly."
+        )
+        return nil
+      }
+    }
 
     func valuesFor(key: String, isCHS: Bool) -> [String] {
-      var pairs: [String] = []
-      let subKey = isCHS ? "S" : "T"
-      if let arrRangeRecords: String = dataMap[key]?[subKey] {
-        pairs.append(contentsOf: arrRangeRecords.map(\.description))
-      }
+      guard let entryIndex = table.entryIndex(for: key) else { return [] }
       // 這裡不做去重複處理，因為倚天中文系統注音排序適應者們已經形成了肌肉記憶。
-      return pairs
+      return table.values(at: entryIndex, isCHS: isCHS).map(\.description)
     }
 
     func partiallyMatchedValuesFor(prefix: String, isCHS: Bool) -> [String] {
       guard !prefix.isEmpty else { return [] }
-      let subKey = isCHS ? "S" : "T"
       var seen = Set<String>()
       var results: [String] = []
-      for currentKey in sortedKeys where currentKey.hasPrefix(prefix) {
-        guard let records = dataMap[currentKey]?[subKey] else { continue }
-        for value in records.map(\.description) where !seen.contains(value) {
-          seen.insert(value)
-          results.append(value)
+      var prefix = prefix
+      prefix.withUTF8 { prefixBytes in
+        // 表格已經依「讀音字數、UTF-8 位元組順序」排序，直接依序掃描即可。
+        for entryIndex in 0 ..< table.count where table.key(at: entryIndex, hasPrefix: prefixBytes) {
+          for value in table.values(at: entryIndex, isCHS: isCHS).map(\.description)
+            where !seen.contains(value) {
+            seen.insert(value)
+            results.append(value)
+          }
         }
       }
       return results
     }
 
-    func hasValuesFor(key: String) -> Bool { dataMap.keys.contains(key) }
+    func hasValuesFor(key: String) -> Bool { table.entryIndex(for: key) != nil }
+
+    // MARK: Private
+
+    private let table: CompiledTable
   }
 }
 
@@ -128,7 +120,7 @@ extension LMAssembly.LMPlainBopomofo {
   ///   - `false`: 該字不是當前體系特有的（存在於另一體系中）
   ///   - `nil`: 讀音不存在，或該字不在任何體系中
   func isExclusive(isCHS: Bool, reading: String, target: Character?) -> Bool? {
-    guard let target else { return nil }
-    return distinctionTables[reading]?[isCHS]?.contains(target)
+    guard let target, let entryIndex = table.entryIndex(for: reading) else { return nil }
+    return table.isExclusive(isCHS: isCHS, at: entryIndex, target: target)
   }
 }
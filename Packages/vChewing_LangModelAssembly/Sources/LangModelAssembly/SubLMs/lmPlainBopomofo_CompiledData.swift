@@ -0,0 +1,2653 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+// 該檔案由 `LMAssembly.LMPlainBopomofo.CompiledTable.generateSwiftSource()` 自 `jsnEtenDosSequence` 生成，請勿手動修改。
+
+let etenDosCompiledIndex: StaticString = """
+0000000301000300030000
+00000A0301000300030000
+0000140301000300030000
+00001E0301000300030000
+0000280301000300030000
+0000320301000300030000
+00003C0301000300030000
+0000460301000300030000
+0000500301000300030000
+00005A0301000300030000
+0000640301000300030000
+00006E0301000300030000
+0000780301000300030000
+0000820301000300030000
+00008C0301006300630909
+0001680301004B004B0707
+0002100301005100510707
+0002C40301000300030000
+0002CE0301007500750A0A
+0003D00301001500150000
+0003FE0301006300630909
+0004DA0301000900090000
+0004F00301000600060000
+0005000301001500150202
+0005320301000300030000
+00053C0301001500150202
+00056E0301000300030000
+0005780301000C000C0000
+0005940301002400240303
+0005E60301003600360505
+0006600301000900090000
+0006760301000900090101
+00068E0301000600060000
+00069E0301000600060101
+0006B00301006600660909
+0007920301004200420606
+0008260301001E001E0303
+00086C0602002700270000
+0008C10602003300330505
+0009380602000300030000
+0009450602003300330505
+0009BC0602001800180000
+0009F30602002100210303
+000A420602000F000F0202
+000A6B0602001500150202
+000AA00602001800180202
+000ADB0602000F000F0202
+000B040602000F000F0000
+000B290602000F000F0000
+000B4E0602001500150202
+000B830602000600060000
+000B960602001800180000
+000BCD0602000600060101
+000BE20602000600060000
+000BF50602000900090000
+000C0E0602000600060101
+000C230602000900090000
+000C3C0602002400240303
+000C910602004500450606
+000D2E0602001B001B0303
+000D710602000900090101
+000D8C0602000300030000
+000D990602000300030101
+000DA80602000300030101
+000DB70602000600060101
+000DCC0602000900090101
+000DE70602002A002A0404
+000E4A0602002400240303
+000E9F0602003300330505
+000F160602001B001B0303
+000F590602004B004B0707
+0010040602005100510707
+0010BB0602001800180202
+0010F60602000900090101
+0011110602001500150000
+0011420602000900090000
+00115B0602003000300404
+0011CA0602002100210303
+0012190602001500150202
+00124E0602002400240303
+0012A30602000F000F0000
+0012C80602001800180202
+0013030602000600060000
+0013160602002D002D0404
+00137F0602000600060000
+0013920602001E001E0303
+0013DB0602000F000F0202
+0014040602000C000C0000
+0014230602000F000F0202
+00144C0602000300030000
+0014590602000300030000
+0014660602000600060000
+0014790602000300030000
+0014860602001500150202
+0014BB0602000300030000
+0014C80602000300030101
+0014D70602000300030101
+0014E60602000300030000
+0014F30602000300030000
+0015000602000300030101
+00150F0602000600060000
+0015220602002A002A0404
+0015850602002700270404
+0015E20602002700270404
+00163F0602002100210303
+00168E0602003900390505
+0017110602000600060000
+0017240602003900390505
+0017A70602002100210303
+0017F60602005100510707
+0018AD0602000C000C0101
+0018CE0602004200420606
+0019650602000C000C0101
+0019860602000300030000
+0019930602000F000F0202
+0019BC0602001500150202
+0019F10602001200120000
+001A1C0602002100210303
+001A6B0602002100210000
+001AB40602000300030000
+001AC10602000C000C0101
+001AE20602000900090000
+001AFB0602000900090000
+001B140602000900090000
+001B2D0602000300030000
+001B3A0602001E001E0303
+001B830602000300030000
+001B900602000C000C0000
+001BAF0602004B004B0707
+001C5A060200C900C91111
+001E150602006000600808
+001EEC0602006F006F0A0A
+001FE50602005100510707
+00209C0602010E010E1717
+0022ED0602006000600808
+0023C40502005100510707
+00247A0502006000600808
+002550050200DB00DB1313
+0027320602002400240303
+0027870602000C000C0000
+0027A60602000C000C0101
+0027C70602002700270404
+0028240602004200420606
+0028BB0602003C003C0505
+0029440602006900690909
+002A2F0602003300330505
+002AA60602004500450606
+002B430602004E004E0707
+002BF40502003300330505
+002C6A0502005400540707
+002D260502005100510707
+002DDC0602002100210303
+002E2B0602000900090101
+002E460602000C000C0101
+002E670602001B001B0303
+002EAA0602001200120202
+002ED90602001B001B0303
+002F1C0602001E001E0303
+002F650602002700270404
+002FC20602003300330505
+0030390602000C000C0101
+00305A0502001500150202
+00308E0502004500450606
+00312A050200B100B10F0F
+0032B00502000300030000
+0032BC0602003600360505
+0033390602000F000F0202
+0033620602000300030101
+0033710602002A002A0404
+0033D40602000600060000
+0033E70602004200420606
+00347E0602005400540707
+00353B0602001E001E0303
+0035840602003300330505
+0035FB0602004500450606
+0036980502000C000C0000
+0036B60602000300030000
+0036C30502003900390505
+0037450502002400240303
+0037990502000300030000
+0037A50602001500150202
+0037DA0602000F000F0202
+0038030602000C000C0101
+0038240602003600360505
+0038A10602000600060000
+0038B40602000F000F0202
+0038DD0602001E001E0303
+0039260602000600060101
+00393B0502001200120000
+0039650502003300330505
+0039DB0502002400240303
+003A2F0602000900090000
+003A480602000300030000
+003A550602000C000C0000
+003A740602000900090101
+003A8F0602000900090101
+003AAA0602001800180202
+003AE50602000300030000
+003AF20602000900090101
+003B0D0502000300030000
+003B190502004E004E0707
+003BC90502000300030000
+003BD50602000600060000
+003BE80602000F000F0202
+003C110602001B001B0303
+003C540602002400240303
+003CA90602000F000F0202
+003CD20602001200120000
+003CFD0602000600060101
+003D120602000600060000
+003D250602001200120202
+003D540502000300030000
+003D600502000600060000
+003D720502000300030000
+003D7E0502000300030101
+003D8C0502003C003C0505
+003E140502008400840B0B
+003F380502000300030101
+003F460502001500150202
+003F7A0502000C000C0101
+003F9A0502003900390505
+00401C0502000C000C0101
+00403C0502004500450606
+0040D80502002100210303
+0041260502001800180202
+0041600502000300030000
+00416C0502000900090101
+0041860502000C000C0000
+0041A40502000900090000
+0041BC0502003300330505
+0042320502000300030000
+00423E0502000300030000
+00424A0502000600060000
+00425C0502000600060000
+00426E0502002400240303
+0042C20502002D002D0404
+00432A0502001E001E0303
+0043720502005D005D0808
+004442050200C300C31111
+0045F00502018C018C2121
+0049500602001B001B0303
+0049930602000300030000
+0049A00602000900090000
+0049B90602002400240303
+004A0E0602003000300404
+004A7D0602004B004B0707
+004B280602005D005D0808
+004BF90602002A002A0404
+004C5C0602006300630909
+004D3B0502004500450606
+004DD70502005400540707
+004E930502007E007E0B0B
+004FAB0602002400240303
+0050000602001200120202
+00502F0602000300030000
+00503C0602004200420000
+0050C70602001800180202
+0051020602001800180202
+00513D0602000900090000
+0051560602000F000F0000
+00517B0502006000600808
+005251050200EA00EA1414
+0054530502010801081616
+0056950602000F000F0202
+0056BE0602003F003F0606
+00574F0602001200120202
+00577E0602004200420606
+0058150803000900090101
+0058320803002100210303
+0058830803001B001B0303
+0058C80803000C000C0101
+0058EB0803000900090000
+0059060803008D008D0C0C
+005A410803002100210303
+005A920803001800180202
+005ACF0803000300030000
+005ADE0803001800180202
+005B1B0803000300030000
+005B2A0803005100510707
+005BE30803002100210303
+005C340803000C000C0000
+005C550803003600360505
+005CD40803001B001B0303
+005D190803002700270404
+005D780803000900090000
+005D930803000900090000
+005DAE0803000F000F0202
+005DD90803001E001E0303
+005E240803000F000F0000
+005E4B0803000300030000
+005E5A0803001200120202
+005E8B0803002D002D0404
+005EF60803000300030000
+005F050803012601261919
+00618C0903000900090101
+0061AA0903005700570808
+0062720903002700270404
+0062D20903003900390505
+0063580903000C000C0101
+00637C0803001500150202
+0063B30803000300030000
+0063C20803002700270404
+0064210803001200120000
+00644E0803000C000C0000
+00646F0803000C000C0101
+0064920803000C000C0000
+0064B30803002100210303
+0065040803000600060000
+0065190803001200120202
+00654A0803000C000C0000
+00656B0803000600060000
+0065800803001B001B0303
+0065C50803002400240303
+00661C0803000300030000
+00662B0803002100210303
+00667C0803001500150202
+0066B30803000C000C0000
+0066D40803000C000C0000
+0066F50803000300030000
+0067040803003600360505
+0067830803002A002A0404
+0067E80803000900090000
+0068030803000900090000
+00681E0803000600060000
+0068330803002700270404
+0068920803000300030000
+0068A10803000600060101
+0068B80803004500450606
+0069570803000C000C0000
+0069780803002100210000
+0069C30803006900690909
+006AB00803003300330505
+006B290903000900090000
+006B450903001B001B0303
+006B8B0903001B001B0000
+006BCB0903000C000C0000
+006BED0903000F000F0000
+006C150803002100210303
+006C660803003C003C0505
+006CF10803000F000F0202
+006D1C0803001B001B0303
+006D610803001200120202
+006D920803000C000C0101
+006DB50803000900090101
+006DD20803000300030000
+006DE10803002700270404
+006E400803009000900C0C
+006F810803000300030101
+006F920803000300030101
+006FA30803000900090101
+006FC00803000900090101
+006FDD0803001200120202
+00700E0803001B001B0303
+0070530803004B004B0707
+0071000803002700270404
+00715F0803000C000C0000
+0071800803003900390505
+0072050803003900390505
+00728A0803000900090000
+0072A50803002A002A0404
+00730A0803000900090101
+0073270803002A002A0404
+00738C0803002700270404
+0073EB0803000300030000
+0073FA0803001800180202
+0074370803000900090101
+0074540803000300030101
+0074650803001800180000
+00749E0803003F003F0606
+0075310803001800180202
+00756E0803004B004B0707
+00761B0803000C000C0101
+00763E0803002100210303
+00768F0803003F003F0606
+0077220803004500450606
+0077C10903000900090101
+0077DF0903000300030000
+0077EF0903000300030000
+0077FF0803001E001E0303
+00784A0803000600060000
+00785F0803004500450606
+0078FE0803000600060101
+0079150803001E001E0303
+0079600803000600060101
+0079770803000600060000
+00798C0803002700270404
+0079EB0803000F000F0000
+007A120803004800480606
+007AB70803000F000F0000
+007ADE0803000C000C0000
+007AFF0803000900090000
+007B1A0803005700570808
+007BE10803003300330505
+007C5A0803000600060000
+007C6F0803003C003C0505
+007CFA0803002A002A0404
+007D5F0803001E001E0303
+007DAA0803001200120202
+007DDB0803000300030000
+007DEA0803000600060000
+007DFF0803001800180202
+007E3C0803001800180202
+007E790803004E004E0707
+007F2C080300CF00CF1212
+0080F70803007500750A0A
+0081FE0803000300030000
+00820D0803003900390505
+0082920803000300030000
+0082A10803000900090000
+0082BC0803000600060000
+0082D10803000600060000
+0082E60803005400540707
+0083A50803000300030000
+0083B40803001B001B0303
+0083F90803002700270404
+0084580803001500150000
+00848B0803002400240303
+0084E20803002400240303
+0085390803007800780A0A
+0086460803001500150202
+00867D0803002A002A0404
+0086E20803000600060000
+0086F70803001B001B0303
+00873C0803003300330505
+0087B50803004E004E0707
+0088680803006300630909
+0089490903000300030000
+0089590903000300030000
+0089690903003000300404
+0089DB0903000600060101
+0089F30903002400240303
+008A4B0903002100210303
+008A9D0803001800180202
+008ADA0803003900390505
+008B5F0803001B001B0303
+008BA40903000F000F0000
+008BCC0903000900090000
+008BE80903000F000F0202
+008C140903001B001B0303
+008C5A0903002700270404
+008CBA0803000900090101
+008CD70803005A005A0808
+008DA40803001500150202
+008DDB0803003300330505
+008E540803001B001B0303
+008E990803000300030101
+008EAA0803003C003C0505
+008F350803000300030000
+008F440803000F000F0202
+008F6F0803000C000C0101
+008F920803000600060000
+008FA70803000300030101
+008FB80803002700270404
+0090170803004800480606
+0090BC0803001B001B0303
+0091010803002400240303
+0091580803004E004E0707
+00920B0803000C000C0101
+00922E0803001800180202
+00926B0803000600060101
+0092820803005100510707
+00933B0803003900390505
+0093C00903000900090101
+0093DE0903000F000F0000
+0094060903001200120000
+0094340903001200120202
+0094660803000F000F0202
+0094910803006600660909
+0095780803000F000F0000
+00959F0903002A002A0404
+0096050903000900090000
+0096210903000900090000
+00963D0903000F000F0000
+0096650903001500150000
+0096990803000600060000
+0096AE0803000C000C0000
+0096CF0803002A002A0404
+0097340803001E001E0303
+00977F0803000600060000
+0097940803001B001B0000
+0097D30803000900090101
+0097F00803000300030101
+0098010803000900090101
+00981E0803002700270404
+00987D0803000600060101
+0098940803000600060000
+0098A90803000C000C0101
+0098CC0803001200120000
+0098F90803002100210303
+00994A0803000600060101
+0099610803000300030000
+0099700803000900090000
+00998B0803000300030000
+00999A0803000300030000
+0099A90803000300030000
+0099B80803000900090000
+0099D30803000300030101
+0099E40803003000300404
+009A550803004E004E0707
+009B080803002A002A0404
+009B6D0903000900090000
+009B890903000300030000
+009B990803000900090000
+009BB40803000F000F0202
+009BDF0803000300030000
+009BEE0803000900090101
+009C0B0803000C000C0000
+009C2C0803000600060000
+009C410803000900090000
+009C5C0803002100210303
+009CAD0803000300030000
+009CBC0803003000300404
+009D2D0803000300030000
+009D3C0803002A002A0404
+009DA10803001800180202
+009DDE0803004E004E0707
+009E910803003300330505
+009F0A0803001E001E0303
+009F550803002100210303
+009FA60803002100210303
+009FF70803001800180202
+00A0340803000C000C0101
+00A0570803003000300404
+00A0C80803000F000F0202
+00A0F30803002400240303
+00A14A0803003C003C0505
+00A1D50803001200120202
+00A2060803001800180202
+00A2430803003000300404
+00A2B40803000900090000
+00A2CF0803000300030000
+00A2DE0803001500150202
+00A3150803000900090000
+00A3300803003F003F0606
+00A3C30803009300930D0D
+00A50C0803011A011A1818
+00A7790903000300030000
+00A7890903000300030000
+00A7990903000600060101
+00A7B10903000300030000
+00A7C10803002700270404
+00A8200803003F003F0606
+00A8B30803009900990D0D
+00AA080903000300030101
+00AA1A0903000300030101
+00AA2C0803003600360505
+00AAAB0803001500150202
+00AAE20803002400240303
+00AB390803000900090101
+00AB560803000300030000
+00AB650803000300030101
+00AB760803001500150000
+00ABA90803005700570808
+00AC700803000F000F0202
+00AC9B0803000300030101
+00ACAC0803000300030000
+00ACBB0803001800180202
+00ACF80803000300030101
+00AD090803001B001B0303
+00AD4E0803001200120202
+00AD7F0803001B001B0000
+00ADBE0803003600360505
+00AE3D0803001E001E0303
+00AE880803002700270404
+00AEE70803000300030000
+00AEF60803000300030000
+00AF050803000900090101
+00AF220803000600060101
+00AF390803000300030101
+00AF4A0803001B001B0303
+00AF8F0803000900090101
+00AFAC0803006C006C0909
+00B09F0803000600060101
+00B0B60803003300330505
+00B12F0903003F003F0606
+00B1C30903001B001B0303
+00B2090903000300030000
+00B2190903003600360505
+00B2990903002700270404
+00B2F90903001E001E0000
+00B33F0903004200420606
+00B3D90803000900090000
+00B3F40803000600060000
+00B4090803001B001B0303
+00B44E0803000600060101
+00B4650803003600360505
+00B4E40803002700270404
+00B5430803001800180202
+00B5800803001500150202
+00B5B70803000900090101
+00B5D40803000300030000
+00B5E30803002400240303
+00B63A0803002700270404
+00B6990803001E001E0303
+00B6E40803001800180202
+00B7210803000900090101
+00B73E0803000300030000
+00B74D0803000300030000
+00B75C0803001E001E0303
+00B7A70803000300030000
+00B7B60803000600060000
+00B7CB0803001500150202
+00B8020903001500150202
+00B83A0903000600060101
+00B8520903002700270404
+00B8B20903000900090101
+00B8D00903002A002A0404
+00B9360903001500150202
+00B96E0903001800180000
+00B9A80803000300030000
+00B9B70803000300030000
+00B9C60803008700870C0C
+00BAF50803002D002D0404
+00BB600803000900090000
+00BB7B0803000C000C0101
+00BB9E0803001800180202
+00BBDB0803000300030000
+00BBEA0803000600060000
+00BBFF0803002D002D0404
+00BC6A0803004200420606
+00BD030803000300030000
+00BD120803002100210303
+00BD630803002400240303
+00BDBA0803001200120000
+00BDE70803002700270404
+00BE460803006F006F0A0A
+00BF410803000600060000
+00BF560803000900090000
+00BF710803000300030000
+00BF800803000300030000
+00BF8F0803002A002A0404
+00BFF40803000600060000
+00C0090803002A002A0404
+00C06E0803000C000C0101
+00C0910803001200120202
+00C0C20803006000600808
+00C19B0803005400540707
+00C25A0903000F000F0202
+00C2860903000300030000
+00C2960903004500450606
+00C3360903001800180202
+00C3740903002100210303
+00C3C60903001200120000
+00C3F40903002A002A0404
+00C45A0803003C003C0505
+00C4E5080300DB00DB1313
+00C6CA080300C000C01010
+00C8730903004E004E0707
+00C9270903003600360505
+00C9A70903006600660909
+00CA8F0903002D002D0404
+00CAFB090300A200A20E0E
+00CC650903003C003C0505
+00CCF10903003000300404
+00CD630903005100510707
+00CE1D0803003000300404
+00CE8E0803005D005D0808
+00CF610803008D008D0C0C
+00D09C0903000900090000
+00D0B80903002100210303
+00D10A0903002D002D0404
+00D1760903000900090000
+00D1920803003000300404
+00D203080300C000C01010
+00D3AC0803005A005A0808
+00D4790903000300030000
+00D4890903000600060000
+00D49F0903003C003C0505
+00D52B0903003C003C0505
+00D5B70903006F006F0A0A
+00D6B30903001B001B0303
+00D6F90903003C003C0505
+00D7850903002700270404
+00D7E50803001200120202
+00D8160803006000600808
+00D8EF0803001E001E0303
+00D93A0903000900090101
+00D9580903001200120000
+00D9860903000900090000
+00D9A20903000900090000
+00D9BE0803003F003F0606
+00DA510803006300630909
+00DB320803008400840B0B
+00DC590903000F000F0202
+00DC850903001500150202
+00DCBD0903009000900C0C
+00DDFF0903003600360505
+00DE7F0903006000600808
+00DF590903003F003F0606
+00DFED0903003000300404
+00E05F0903002A002A0404
+00E0C50803002700270404
+00E1240803000300030000
+00E1330803006900690909
+00E2200903000F000F0202
+00E24C0903005A005A0808
+00E31A0903002A002A0404
+00E3800903001B001B0303
+00E3C60803000F000F0000
+00E3ED0803002400240303
+00E4440803003000300404
+00E4B50803000900090101
+00E4D20803004800480606
+00E5770803001B001B0303
+00E5BC0803000C000C0101
+00E5DF0803000600060000
+00E5F40803000600060000
+00E6090803001200120202
+00E63A0803000F000F0000
+00E6610803000300030101
+00E6720803003900390505
+00E6F70803000C000C0000
+00E7180803000600060101
+00E72F0803003300330505
+00E7A80803003000300404
+00E8190803002D002D0404
+00E8840803003F003F0606
+00E9170803003900390505
+00E99C0803000F000F0202
+00E9C70803002D002D0404
+00EA320803000F000F0000
+00EA590803001800180202
+00EA960803003C003C0505
+00EB210803003C003C0505
+00EBAC0803006300630909
+00EC8D0903000C000C0101
+00ECB10903000F000F0000
+00ECD90903000300030000
+00ECE90903001800180202
+00ED270903002A002A0404
+00ED8D0903001500150202
+00EDC50903001500150202
+00EDFD0903003600360505
+00EE7D0803000300030000
+00EE8C0803001E001E0303
+00EED70803001E001E0303
+00EF220803000900090101
+00EF3F0803001B001B0303
+00EF840803000F000F0202
+00EFAF0803000900090101
+00EFCC0803000900090000
+00EFE70803001800180000
+00F0200803000300030000
+00F02F0803001500150202
+00F0660803004B004B0707
+00F1130803000F000F0000
+00F13A0803003900390505
+00F1BF0803005A005A0808
+00F28C0803000900090101
+00F2A90803001500150202
+00F2E00803004500450606
+00F37F0803001E001E0303
+00F3CA0803001200120202
+00F3FB0803002A002A0404
+00F4600803001200120202
+00F4910803000F000F0202
+00F4BC0803005D005D0808
+00F58F0803000C000C0101
+00F5B20803001B001B0303
+00F5F70803003F003F0606
+00F68A0803004200420606
+00F7230903000300030000
+00F7330903000300030000
+00F7430903000600060000
+00F7590903000F000F0000
+00F7810903001B001B0000
+00F7C10903001500150202
+00F7F90903002100210303
+00F84B0803000600060000
+00F8600803000300030000
+00F86F0803001B001B0303
+00F8B40803000600060101
+00F8CB0803001500150202
+00F9020803003900390505
+00F9870803000600060000
+00F99C0803000C000C0101
+00F9BF0803000300030101
+00F9D00803000300030000
+00F9DF0803001500150000
+00FA120803001E001E0303
+00FA5D0803000F000F0000
+00FA840803000300030000
+00FA930803001800180202
+00FAD00803000F000F0202
+00FAFB0803004B004B0707
+00FBA80803002400240303
+00FBFF0803000600060000
+00FC140803002400240303
+00FC6B0803000900090101
+00FC880803000F000F0000
+00FCAF0803000300030000
+00FCBE0803000F000F0000
+00FCE50803001200120202
+00FD160803001B001B0303
+00FD5B0803003000300404
+00FDCC0803002A002A0404
+00FE310803004800480606
+00FED60903000900090000
+00FEF20903000300030101
+00FF040903000C000C0000
+00FF260903000900090101
+00FF440903001800180202
+00FF820803000900090000
+00FF9D0803000600060101
+00FFB40803000300030101
+00FFC50803001200120202
+00FFF60803000900090101
+0100130803000C000C0000
+0100340803002D002D0000
+0100970803000300030000
+0100A60803001B001B0000
+0100E50803001200120000
+0101120803001500150000
+0101450803001800180000
+01017E0803003600360505
+0101FD0803000C000C0000
+01021E0803002400240000
+01026F0803000600060101
+0102860803000300030000
+0102950803000900090000
+0102B00803001200120202
+0102E10803003C003C0505
+01036C0803002400240303
+0103C30903000300030000
+0103D30803001200120202
+0104040803000300030000
+0104130803003600360505
+0104920803000F000F0202
+0104BD0803000F000F0202
+0104E80803000900090101
+0105050803000300030101
+0105160803001500150202
+01054D0803000300030101
+01055E0803002100210303
+0105AF0803000300030000
+0105BE0803000900090101
+0105DB0803001B001B0303
+0106200803000900090000
+01063B0803002100210303
+01068C0803000300030000
+01069B0803000300030101
+0106AC0803000300030101
+0106BD0803000C000C0101
+0106E00803000600060101
+0106F70803001500150202
+01072E0803001E001E0000
+0107730903000F000F0000
+01079B0903000600060101
+0107B30903001B001B0000
+0107F30903003600360505
+0108730803000300030000
+0108820803000300030000
+0108910803002A002A0404
+0108F60803001E001E0303
+0109410803000F000F0202
+01096C0803000F000F0000
+0109930803000C000C0101
+0109B60803001500150000
+0109E90803000C000C0000
+010A0A0803000C000C0101
+010A2D0803000F000F0202
+010A580803000C000C0101
+010A7B0803000F000F0202
+010AA60803000F000F0000
+010ACD0803000600060000
+010AE20803000F000F0202
+010B0D0803000300030000
+010B1C0803000600060000
+010B310803003900390505
+010BB60903001500150000
+010BEA0903001B001B0000
+010C2A0903000900090101
+010C480903000600060000
+010C5E0903003300330505
+010CD80803000C000C0101
+010CFB0803001500150202
+010D320803003000300404
+010DA30803000900090101
+010DC00803000900090101
+010DDD0803000C000C0101
+010E000803001500150202
+010E370803000300030000
+010E460803000F000F0202
+010E710803000600060000
+010E860803001200120202
+010EB70803000300030101
+010EC80803000300030000
+010ED70803007E007E0B0B
+010FF20903002D002D0404
+01105E0903002400240303
+0110B60903000900090101
+0110D40903001800180202
+0111120903002400240303
+01116A0803001B001B0303
+0111AF0803002100210303
+0112000803003000300404
+0112710803000F000F0000
+0112980803001200120202
+0112C90803004800480606
+01136E0803000C000C0000
+01138F0803003C003C0505
+01141A0803006600660909
+0115010803003600360505
+0115800803002D002D0404
+0115EB0803004B004B0707
+0116980803004500450606
+0117370803008A008A0C0C
+01186C0803006F006F0A0A
+0119670803009300930D0D
+011AB00803003900390505
+011B350803005400540707
+011BF40803002700270404
+011C530803002700270404
+011CB20803004800480606
+011D570803001800180202
+011D940803001E001E0303
+011DDF0803004500450606
+011E7E0803001800180202
+011EBB0803000600060000
+011ED00803000300030000
+011EDF0803000900090101
+011EFC0803000900090000
+011F170803002100210303
+011F680803000300030000
+011F770803000300030000
+011F860803008400840B0B
+0120AD0803006000600808
+0121860803007500750A0A
+01228D0803004B004B0707
+01233A0803002100210303
+01238B0803002700270404
+0123EA0803000F000F0202
+0124150803003000300404
+0124860803001E001E0303
+0124D10803002400240303
+0125280803000600060000
+01253D0803001800180202
+01257A0803001500150000
+0125AD0803000C000C0101
+0125D00803006900690909
+0126BD0803000600060101
+0126D40803007E007E0B0B
+0127EF0803002A002A0404
+0128540803002100210303
+0128A50803004800480606
+01294A0803003000300404
+0129BB0803003C003C0505
+012A460803001800180202
+012A830803000900090000
+012A9E0B04000600060101
+012AB80B04001200120202
+012AEC0B04000600060101
+012B060B04001800180202
+012B460B04000300030101
+012B5A0B04001800180202
+012B9A0B04003600360505
+012C1C0B04001500150202
+012C560B04003300330505
+012CD20B04001800180202
+012D120B04000300030000
+012D240B04001E001E0303
+012D720B04000900090000
+012D900B04001800180202
+012DD00B04001500150202
+012E0A0B04000900090101
+012E2A0B04000300030000
+012E3C0B04001500150202
+012E760B04000600060000
+012E8E0B04000300030000
+012EA00B04005100510707
+012F5C0B04002700270404
+012FBE0B04001E001E0303
+01300C0B04000C000C0000
+0130300B04000C000C0101
+0130560B04000300030101
+01306A0B04003000300404
+0130DE0B04001B001B0303
+0131260B04000600060101
+0131400B04003600360505
+0131C20B04003000300404
+0132360B04000900090000
+0132540B04003900390505
+0132DC0B04000600060000
+0132F40B04000300030000
+0133060B04000300030000
+0133180B04006300630909
+0133FC0B04000300030000
+01340E0B04001E001E0303
+01345C0B04001500150202
+0134960B04004500450606
+0135380B04001200120202
+01356C0B04002700270404
+0135CE0B04001800180202
+01360E0B04002D002D0404
+01367C0B04003600360505
+0136FE0B04002400240303
+0137580B04000300030000
+01376A0B04002100210303
+0137BE0B04000600060101
+0137D80B04003900390505
+0138600B04000C000C0000
+0138840B04001E001E0303
+0138D20B04000C000C0101
+0138F80B04000900090000
+0139160B04000F000F0000
+0139400B04003000300404
+0139B40B04001B001B0303
+0139FC0B04002400240303
+013A560B04002400240303
+013AB00B04000900090000
+013ACE0B04002100210303
+013B220B04003C003C0000
+013BA60B04000300030101
+013BBA0B04000F000F0202
+013BE80B04004200420606
+013C840B04001800180202
+013CC40B04000600060000
+013CDC0B04001800180202
+013D1C0B04000C000C0101
+013D420B04001B001B0303
+013D8A0B04000600060000
+013DA20B04000900090101
+013DC20B04002100210303
+013E160B04000600060000
+013E2E0B04001500150202
+013E680B04007200720A0A
+013F6C0B04000C000C0101
+013F920B04000300030000
+013FA40B04005100510707
+0140600B04001500150202
+01409A0B04000300030000
+0140AC0B04001500150202
+0140E60B04000300030000
+0140F80B04000300030000
+01410A0B04002400240303
+0141640B04000F000F0000
+01418E0B04001200120202
+0141C20B04000300030000
+0141D40B04000300030000
+0141E60B04000600060101
+0142000B04000300030101
+0142140B04000300030101
+0142280B04002400240303
+0142820B04000600060101
+01429C0B04000300030000
+0142AE0B04000F000F0202
+0142DC0B04001800180202
+01431C0B04000C000C0101
+0143420B04001E001E0303
+0143900B04000300030000
+0143A20B04000900090101
+0143C20B04000300030101
+0143D60B04000300030000
+0143E80B04004800480606
+0144900B04001800180202
+0144D00B04006000600808
+0145AC0B04001B001B0303
+0145F40B04001200120202
+0146280B04005100510707
+0146E40B04002100210303
+0147380B04001200120202
+01476C0B04005A005A0808
+01483C0B04003300330505
+0148B80B04001800180202
+0148F80B04006000600808
+0149D40B04001500150202
+014A0E0B04000F000F0202
+014A3C0B04002400240303
+014A960B04002100210303
+014AEA0B04000900090101
+014B0A0B0400A200A20E0E
+014C760B04000900090000
+014C940B04001200120202
+014CC80B04003300330505
+014D440B04003300330505
+014DC00B04000300030000
+014DD20B04001E001E0303
+014E200B04000600060101
+014E3A0B04000300030000
+014E4C0B04003300330505
+014EC80B04000600060101
+014EE20B04000900090101
+014F020B04005100510707
+014FBE0B04000C000C0101
+014FE40B04000F000F0202
+0150120B04000300030101
+0150260B04000600060101
+0150400B04000600060101
+01505A0B04001B001B0303
+0150A20B04002100210303
+0150F60B04001E001E0303
+0151440B04000300030101
+0151580B04000900090101
+0151780B04000F000F0000
+0151A20B04003600360505
+0152240B04002A002A0404
+01528C0B04001800180202
+0152CC0B04003C003C0505
+01535A0B04001500150202
+0153940B04000600060000
+0153AC0B04000600060101
+0153C60B04000F000F0000
+0153F00B04002100210303
+0154440B04000F000F0202
+0154720B04000900090000
+0154900B04000900090101
+0154B00B04000300030000
+0154C20B04001E001E0303
+0155100B04000300030000
+0155220B04003000300404
+0155960B04001200120202
+0155CA0B04003C003C0000
+01564E0B04003F003F0606
+0156E40B04000900090000
+0157020B04001E001E0303
+0157500B04000900090101
+0157700B04000300030000
+0157820B04000900090101
+0157A20B04002700270404
+0158040B04000900090000
+0158220B04000900090000
+0158400B04002A002A0404
+0158A80B04002D002D0404
+0159160B04000C000C0101
+01593C0B04000C000C0101
+0159620B04007200720A0A
+015A660B04000300030000
+015A780B04002100210303
+015ACC0B04001500150202
+015B060B04002400240303
+015B600B04001B001B0303
+015BA80B04009000900C0C
+015CEC0B04000F000F0202
+015D1A0B04004B004B0707
+015DCA0B04003C003C0505
+015E580B04000600060000
+015E700B04002400240303
+015ECA0B04001B001B0303
+015F120B04002100210303
+015F660B04006600660909
+0160500B04000600060000
+0160680B04000600060000
+0160800B04006900690909
+0161700B04000F000F0202
+01619E0B04002D002D0404
+01620C0B04004500450606
+0162AE0B04001800180202
+0162EE0B04000F000F0000
+0163180B0400A800A80E0E
+0164900B04004B004B0707
+0165400B04005700570808
+01660A0B04000300030000
+01661C0B04003F003F0606
+0166B20B04001800180202
+0166F20B04003000300404
+0167660B04005400540707
+0168280B04008400840B0B
+0169520B04002D002D0404
+0169C00B04006300630909
+016AA40B04001200120202
+016AD80B04002700270404
+016B3A0B04003000300404
+016BAE0B04004B004B0707
+016C5E0B04000300030000
+016C700B0400BD00BD1010
+016E160B04000300030000
+016E280B04000F000F0202
+016E560B04003600360505
+016ED80B04000600060000
+016EF00B04004200420606
+016F8C0B04002A002A0404
+016FF40B04000600060000
+01700C0B04000F000F0000
+0170360B04000300030000
+0170480B04000900090000
+0170660B04003000300404
+0170DA0B04001500150202
+0171140B04003600360505
+0171960B04002400240303
+0171F00B04000300030000
+0172020B04007800780A0A
+0173120B04001800180202
+0173520B04005A005A0808
+0174220B04003000300404
+0174960B04001500150202
+0174D00B04004200420606
+01756C0B04000C000C0101
+0175920B04001500150202
+0175CC0B04002400240303
+0176260B04000F000F0202
+0176540B04000900090101
+0176740B04001B001B0303
+0176BC0B04002A002A0404
+0177240B04000300030000
+0177360B04003F003F0606
+0177CC0B04001800180202
+01780C0B04006000600808
+0178E80B04000F000F0202
+0179160B04000900090000
+0179340B04003C003C0505
+0179C20B04006000600808
+017A9E0B04001E001E0303
+017AEC0B04000600060101
+017B060B04005700570808
+017BD00B04008D008D0C0C
+017D0E0B04000F000F0202
+017D3C0B04000C000C0101
+017D620B04002100210303
+017DB60B04000900090000
+017DD40B04003000300404
+017E480B04005100510707
+017F040B04005400540707
+017FC60B04005400540707
+0180880B04000300030000
+01809A0B04000F000F0202
+0180C80B04001E001E0303
+0181160B04001800180202
+0181560B04000F000F0202
+0181840B04003900390505
+01820C0B04000C000C0000
+0182300B04002D002D0404
+01829E0B04002400240303
+0182F80B04000600060101
+0183120B04001800180202
+0183520B04001B001B0000
+0183940B04000900090101
+0183B40B04002D002D0404
+0184220B04004200420606
+0184BE0B04005400540707
+0185800B04003000300404
+0185F40B04000900090000
+0186120B04000600060000
+01862A0B04000300030000
+01863C0B04007200720A0A
+0187400B04000300030000
+0187520B04000300030000
+0187640B04000300030000
+0187760B04001B001B0303
+0187BE0B04000600060101
+0187D80B04002100210303
+01882C0B04000F000F0202
+01885A0B04000300030000
+01886C0B04000300030000
+01887E0B04000F000F0202
+0188AC0B04000F000F0202
+0188DA0B04002400240303
+0189340B04003900390505
+0189BC0B04000300030000
+0189CE0B04000300030000
+0189E00B04000600060000
+0189F80B04003600360505
+018A7A0B04000900090000
+018A980B04000900090000
+018AB60B04001800180202
+018AF60B04001200120202
+018B2A0B04000F000F0202
+018B580B04002400240303
+018BB20B04000900090101
+018BD20B04000C000C0000
+018BF60B04000F000F0202
+018C240B04000300030101
+018C380B04001E001E0303
+018C860B04000900090101
+018CA60B04000300030000
+018CB80B04003900390505
+018D400B04000300030000
+018D520B04000F000F0202
+018D800B04000300030000
+018D920B04000600060101
+018DAC0B04001500150202
+018DE60B04000300030000
+018DF80B04000F000F0000
+018E220B04001200120202
+018E560B04001200120000
+018E860B04000300030000
+018E980B04001E001E0303
+018EE60B04000F000F0202
+018F140B04000900090000
+018F320B04001800180202
+018F720B04001B001B0303
+018FBA0B04000900090000
+018FD80B04000900090101
+018FF80B04000F000F0000
+0190220B04005700570808
+0190EC0B04000900090000
+01910A0B04001500150000
+0191400B04002700270404
+0191A20B04001200120000
+0191D20B04002400240000
+0192260B04000F000F0202
+0192540B04000C000C0101
+01927A0B04000F000F0000
+0192A40B04001200120202
+0192D80B04001200120202
+01930C0B04001200120202
+0193400B04000C000C0000
+0193640B04001500150202
+01939E0B04002400240303
+0193F80B04000900090000
+0194160B04000600060000
+01942E0B04003600360505
+0194B00B04000900090101
+0194D00B04000C000C0101
+0194F60B04000600060000
+01950E0B04000600060000
+0195260B04000900090101
+0195460B04002700270404
+0195A80B04000900090101
+0195C80B04001B001B0303
+0196100B04000300030000
+0196220B04000F000F0202
+0196500B04000900090101
+0196700B04004500450606
+0197120B04000300030000
+0197240B04000900090101
+0197440B04000F000F0202
+0197720B04000600060000
+01978A0B04001800180202
+0197CA0B04000F000F0202
+"""
+
+let etenDosCompiledPool: StaticString = """
+ㄅㄅㄅ
+ㄆㄆㄆ
+ㄇㄇㄇ
+ㄈㄈㄈ
+ㄉㄉㄉ
+ㄊㄊㄊ
+ㄋㄋㄋ
+ㄌㄌㄌ
+ㄍㄍㄍ
+ㄎㄎㄎ
+ㄏㄏㄏ
+ㄐㄐㄐ
+ㄑㄑㄑ
+ㄒㄒㄒ
+ㄓ之知只织支枝汁只吱芝脂肢蜘祇栀祗氏枳ㄓ胝鸱卮搘只跖泜鳷汥秪榰肢衼椥之知隻織支枝汁只吱芝脂肢蜘祇梔祗氏枳ㄓ胝鴟卮搘秖跖泜鳷汥秪榰胑衼椥800401000C00409040
+ㄔ吃蚩痴痴嗤吃ㄔ郗魑笞絺鸱媸摛瓻螭眵齝离貾誺瞝齹黐麶吃蚩癡痴嗤喫ㄔ郗魑笞絺鴟媸摛瓻螭眵齝离貾誺瞝齹黐麶00800004280000
+ㄕ失施师诗湿湿狮尸ㄕ虱嘘虱尸迉蓍葹鳲邿湤絁鰤溮鶳箷褷襹蛳失施師詩濕溼獅屍ㄕ蝨噓虱尸迉蓍葹鳲邿湤絁鰤溮鶳箷褷襹螄C740004CF60004
+ㄖㄖㄖ
+ㄗ资兹滋吱姿咨孜谘赀兹ㄗ辎淄龇缁孳粢髭嵫灾鎡鹚鼒孖澬甾鄑鲻锱趑椔鈭鶅齍栥紎岷秶蠀資茲滋吱姿咨孜諮貲玆ㄗ輜淄齜緇孳粢髭嵫菑鎡鶿鼒孖澬甾鄑鯔錙趑椔鈭鶅齍栥紎崰秶蠀38B682810138B6828101
+ㄘ疵庛雌ㄘ差趀骴疵庛雌ㄘ差趀骴
+ㄙ司思斯丝私撕厮鸶嘶ㄙ澌缌偲罳颸禠虒楒锶凘泀蕬鉰俬覗榹禗蜤磃謕蟴鷈鼶司思斯絲私撕廝鷥嘶ㄙ澌緦偲罳颸禠虒楒鍶凘泀蕬鉰俬覗榹禗蜤磃謕蟴鷈鼶8C80400008C8040000
+ㄚ阿啊ㄚ阿啊ㄚ
+ㄛ喔ㄛ喔ㄛ
+ㄜ阿婀疴ㄜ屙峉锕阿婀痾ㄜ屙峉錒4444
+ㄝㄝㄝ
+ㄞ挨哀埃唉哎ㄞ诶挨哀埃唉哎ㄞ誒0404
+ㄟㄟㄟ
+ㄠ凹ㄠ坳柪凹ㄠ坳柪
+ㄡ欧瓯殴呕讴鸥ㄡ怄区熰蓲櫙歐甌毆嘔謳鷗ㄡ慪區熰蓲櫙FB1FB1
+ㄢ安鞍庵谙氨铵胺ㄢ鹌媕侒盦峖痷腤萻韽埯安鞍庵諳氨銨胺ㄢ鵪媕侒盦峖痷腤萻韽垵8210282102
+ㄣ恩嗯ㄣ恩嗯ㄣ
+ㄤ肮腌ㄤ骯腌ㄤ11
+ㄥ鞥ㄥ鞥ㄥ
+ㄦㄦ儿ㄦ兒22
+ㄧ一壹衣依医伊揖噫漪猗咿ㄧ禕繄黟曀铱泆鷖欹郼圪皑稦燚洢陭蛜嫛瑿檹医黳嶬一壹衣依醫伊揖噫漪猗咿ㄧ禕繄黟曀銥泆鷖欹郼圪溰稦燚洢陭蛜嫛瑿檹毉黳嶬010014080010014080
+ㄨ屋乌污污圬诬呜巫钨邬洿歍ㄨ恶于圬陓剭窏腛鴮螐屋烏污汙圬誣嗚巫鎢鄔洿歍ㄨ惡於杇陓剭窏腛鴮螐263600A63E00
+ㄩ淤迂瘀纡ㄩ毹箊扜穻盓淤迂瘀紆ㄩ毹箊扜穻盓800800
+ㄅㄚ八捌巴疤芭笆粑叭扒豝吧仈朳八捌巴疤芭笆粑叭扒豝吧仈朳
+ㄅㄛ玻拨剥菠钵嶓砵播般碆袚襏鲅啵柭蹳坡玻撥剝菠缽嶓砵播般碆袚襏鱍啵柭蹳岥6101161011
+ㄅㄞ掰掰
+ㄅㄟ背杯悲卑碑俾背偝杯裨萆桮椑伓綼鹎藣背杯悲卑碑俾揹偝盃裨萆桮椑伓綼鵯藣0008004180
+ㄅㄠ包胞苞褒枹笣蕔孢包胞苞褒枹笣蕔孢
+ㄅㄢ班般搬斑颁扳瘢虨斑攽褩班般搬斑頒扳瘢虨斒攽褩010011
+ㄅㄣ奔贲锛泍渀奔賁錛泍渀6060
+ㄅㄤ帮邦傍梆鞤縍垹幫邦傍梆鞤縍垹1010
+ㄅㄥ崩绷伻弸祊閍堋絣崩繃伻弸祊閍塴絣2424
+ㄅㄧ逼屄逼稫豍逼屄偪稫豍0040
+ㄅㄨ逋晡餔峬鵏逋晡餔峬鵏
+ㄆㄚ趴葩啪蚆舥趴葩啪蚆舥
+ㄆㄛ波泼坡陂鏺癹翍波潑坡陂鏺癹翍2020
+ㄆㄞ拍啪拍啪
+ㄆㄟ胚呸坏醅柸岯垺衃胚呸坏醅柸岯垺衃
+ㄆㄠ抛脬拋脬11
+ㄆㄡ剖吥剖吥
+ㄆㄢ潘攀眅潘攀眅
+ㄆㄣ喷歕噴歕11
+ㄆㄤ乓磅滂乓磅滂
+ㄆㄥ砰烹抨怦漰澎砰閛恲軯駍磞砰烹抨怦漰澎匉閛恲軯駍磞000040
+ㄆㄧ批披匹劈霹砒被丕坯坏伾狉纰秠铍鴄怀翍釽憵銔駓髬批披匹劈霹砒被丕坯坏伾狉紕秠鈹鴄怌翍釽憵銔駓髬000510000510
+ㄆㄨ扑仆铺噗扑痡醭抪瞨撲仆鋪噗扑痡醭抪瞨400500
+ㄇㄚ妈吗嬷媽嗎嬤77
+ㄇㄛ摸摸
+ㄇㄠ猫貓11
+ㄇㄣ闷悶11
+ㄇㄧ咪眯咪瞇22
+ㄈㄚ发伐瞂發伐瞂11
+ㄈㄟ非飞菲扉啡妃绯霏馡騑鲱騛淫裶非飛菲扉啡妃緋霏馡騑鯡騛婓裶24412441
+ㄈㄢ番翻蕃翻幡帆旛籓僠嬏轓鱕番翻蕃繙幡帆旛籓僠嬏轓鱕000800
+ㄈㄣ分纷芬氛吩棻玢酚氛昐鈖砏翂衯饙梤鳻分紛芬氛吩棻玢酚雰昐鈖砏翂衯饙梤鳻2000020100
+ㄈㄤ方芳坊枋邡淓钫匚汸方芳坊枋邡淓鈁匚汸040040
+ㄈㄥ风蜂封丰疯峰锋丰烽枫讽酆葑沣犎捀桻妦檒偑崶蘴飌麷猦風蜂封豐瘋峰鋒丰烽楓諷酆葑灃犎捀桻妦檒偑崶蘴飌麷猦15620009562000
+ㄈㄨ夫肤敷孵夫麸跗趺柎砆鄜鈇箙罦衭稃邞泭怤尃荴綒鳺姇糐璷紨夫膚敷孵伕麩跗趺柎砆鄜鈇箙罦衭稃邞泭怤尃荴綒鳺姇糐璷紨22000002300000
+ㄉㄚ搭褡答搭瘩踏咑耷搭褡答撘瘩躂咑耷0282
+ㄉㄞ呆待呆呆待獃04
+ㄉㄠ刀叨忉舠氘幍魛刀叨忉舠氘幍魛
+ㄉㄡ都兜郖都兜郖
+ㄉㄢ单担丹耽箪郸眈聃酖砃甔襌匰聸勯啖單擔丹耽簞鄲眈聃酖砃甔襌匰聸勯嚪33083308
+ㄉㄤ当当铛裆璫簹当螳澢艡嵣當噹鐺襠璫簹儅蟷澢艡嵣FC0FC0
+ㄉㄥ登灯镫簦豋璒嬁登燈鐙簦豋璒嬁6060
+ㄉㄧ低滴氐羝鞮彽磾鍉袛菂墒熵低滴氐羝鞮彽磾鍉袛菂墑熵004004
+ㄉㄨ都督嘟闍醏都督嘟闍醏
+ㄊㄚ它他她它塌褟祂禢它他她牠塌褟祂禢0080
+ㄊㄞ胎苔胎苔
+ㄊㄠ掏涛滔饕韬弢绦绦搯慆槄幍翢嫍蜪掏濤滔饕韜弢絛縚搯慆槄幍翢嫍蜪2D002D00
+ㄊㄡ偷媮偷媮
+ㄊㄢ贪滩摊瘫坍怹抩舑緂探貪灘攤癱坍怹抩舑緂探F00F00
+ㄊㄤ汤镗冬趟蝪湯鏜鼞蹚蝪F0F0
+ㄊㄧ梯踢剔焍梯踢剔焍
+ㄊㄨ秃鵚涋捸嶀禿鵚涋捸嶀1010
+ㄋㄜ呢呢
+ㄋㄠ峱峱
+ㄋㄢ囝囡囝囡
+ㄋㄤ囔囔
+ㄌㄚ拉啦喇柆鼙翋菈拉啦喇柆鞡翋菈0101
+ㄌㄟ勒勒
+ㄌㄠ捞撈11
+ㄌㄡ搂摟11
+ㄌㄤ啷啷
+ㄌㄧ哩哩
+ㄌㄨ噜嚕11
+ㄍㄚ嘎旮嘎旮
+ㄍㄜ哥歌割鸽搁胳戈胳疙菏牁菏滒麧哥歌割鴿擱胳戈肐疙渮牁菏滒麧81008920
+ㄍㄞ该垓陔赅荄侅峐胲祴絯豥賌隑該垓陔賅荄侅峐胲祴絯豥賌隑90009000
+ㄍㄠ高糕膏篙羔皋櫜睾鼛槔睾滜韟高糕膏篙羔皋櫜睪鼛槔睾滜韟00000800
+ㄍㄡ句沟勾钩枸泃篝缑构芶耩句溝勾鉤枸泃篝緱构芶耩A80A80
+ㄍㄢ干甘干竿肝尴柑坩泔咁疳玕杆矸虷筸蜬鳱嵅乾甘干竿肝尷柑坩泔咁疳玕杆矸虷筸蜬鳱嵅0200012000
+ㄍㄣ跟根跟根
+ㄍㄤ刚钢缸岗纲冈肛扛杠罡肛舡釭冈碙棡笐堈犅剛鋼缸崗綱岡肛扛杠罡疘舡釭堽碙棡笐堈犅B3020B3420
+ㄍㄥ更耕庚粳羹赓浭緪鶊菮揯更耕庚粳羹賡浭緪鶊菮揯020020
+ㄍㄨ姑孤辜咕沽估菇菰呱蛄痼箍鸪觚酤泒罛箛钴鮕夃柧鈲軱家嫴橭姑孤辜咕沽估菇菰呱蛄痼箍鴣觚酤泒罛箛鈷鮕夃柧鈲軱家嫴橭00014000001400
+ㄎㄚ咖喀哈锎咖喀哈鉲88
+ㄎㄜ科柯刻棵颗苛瞌磕蚵蝌轲稞窠珂砢簻薖峇钶樖犐嵙科柯刻棵顆苛瞌磕蚵蝌軻稞窠珂砢簻薖峇鈳樖犐嵙014040014040
+ㄎㄞ开揩答侅開揩痎侅55
+ㄎㄠ尻尻
+ㄎㄡ抠彄芤袧鏂摳彄芤袧鏂1010
+ㄎㄢ刊堪勘戡看龛嵁刊堪勘戡看龕嵁0202
+ㄎㄤ康慷糠鏮漮嫝康慷糠鏮漮嫝
+ㄎㄥ坑硜铿牼吭坑硻铿娙挳鍞坑硜鏗牼吭阬硻銵娙挳鍞4804A0
+ㄎㄨ哭枯窟骷跍挎桍刳顝胐橭哭枯窟骷跍挎桍刳顝胐橭
+ㄏㄚ哈哈
+ㄏㄜ喝呵诃峆喝呵訶峆44
+ㄏㄞ咳嗨咍咳嗨咍
+ㄏㄟ黑嘿潶黑嘿潶
+ㄏㄠ蒿嚆薅蒿嚆薅
+ㄏㄡ齁齁
+ㄏㄢ酣鼾蚶憨顸魽含甝谽嫨酣鼾蚶憨頇魽唅甝谽嫨050050
+ㄏㄤ夯夯
+ㄏㄥ亨哼脝諻亨哼脝諻
+ㄏㄨ忽呼乎惚滹戏猢欻膴宓吰虍幠寣昒歑烼垀曶啒峘淴呼匢淲忽呼乎惚滹戲猢欻膴虖吰虍幠寣昒歑烼垀曶啒峘淴謼匢淲02200000220040
+ㄐㄧ机基积绩迹激迹姬鸡饥肌稽饥奇畸碁箕矶讥羁几机乩屐跻玑几叽畿嵇犄赍其期居唧绩禨欚疠羇虀觭霙鲒銈枅丌尐簊虮鐖櫅稘毄樍諅齍鞿鑇鰿齑笄剞跻鸄癪機基積績蹟激跡姬雞饑肌稽飢奇畸碁箕磯譏羈几机乩屐躋璣幾嘰畿嵇犄齎其期居唧勣禨欚癘羇虀觭霙蛣銈枅丌尐簊虮鐖櫅稘毄樍諅齍鞿鑇鰿齏笄剞隮鸄癪C531E0B8090100021D531E0F8090100021
+ㄐㄩ居拘驹沮疽蛆狙俱车据锯裾苴趄罝菹娵椐腒崌痀琚雎涺葅鮈鶋斪揟蜛踙輋居拘駒沮疽蛆狙俱車据鋸裾苴趄罝菹娵椐腒崌痀琚雎涺葅鮈鶋斪揟蜛踙輋4050000040500000
+ㄑㄧ七妻欺戚漆栖凄凄柒萋戚溪沏諆郪娸鸂嘁顣悊桤磎倛咠栖溪凄唭徛桼僛緀磩霋魌鶈攲七妻欺戚漆棲悽淒柒萋慼溪沏諆郪娸鸂嘁顣悊榿磎倛咠栖谿凄唭徛桼僛緀磩霋魌鶈攲00000100000E40012000
+ㄑㄩ区屈驱趋躯岖曲蛆瞿袪驱蛐佉砠胠岨祛呿凵抾阹镼鲈鶌鱋紶髷區屈驅趨軀嶇曲蛆瞿袪敺蛐佉砠胠岨祛呿凵抾阹镼魼鶌鱋紶髷D340040D340040
+ㄒㄧ西希吸携嘻牺稀悉溪析蟋熙禧膝栖厘嬉兮犀晰羲畦曦僖蜥扱熹奚盻觿嘻晞欷蹊樨巇淅皙唏烯徯徯恓窸粞豨醯鼷氥浠潝燨瓗疧酅媐巂悕睎硒蠵鑴榽歖爔琋螇俙徆怷娭屖溪莃菥僁橀螝豯貕鵗騱驨郋桸惁凞闟诶礂西希吸攜嘻犧稀悉溪析蟋熙禧膝棲釐嬉兮犀晰羲畦曦僖蜥扱熹奚盻觿譆晞欷蹊樨巇淅皙唏烯傒徯恓窸粞豨醯鼷氥浠潝燨瓗疧酅媐巂悕睎硒蠵鑴榽歖爔琋螇俙徆怷娭屖谿莃菥僁橀螝豯貕鵗騱驨郋桸惁凞闟誒礂820C0000000000000000001820C0004001000000010001
+ㄒㄩ须需虚须嘘墟戌胥吁吁歔盱嬃繻殈旴呴楈嬬鑐欨倠稰縃蝑蕦驉魖晇幁揟糈須需虛鬚噓墟戌胥訏吁歔盱嬃繻殈旴呴楈嬬鑐欨倠稰縃蝑蕦驉魖晇幁揟糈D1000000D1100000
+ㄓˇ只指纸止旨址徵祇趾祉咫枳酯旨沚址芷黹轵疻晊砥坁藢栺淽滍只指紙止旨址徵祇趾祉咫枳酯恉沚阯芷黹軹疻晊厎坁藢栺淽滍4000420400A420
+ㄓˊ直职质值植执殖掷侄侄跖蛰踯桎埴稙摭絷柣犆秷掷絷硗樴膱懫蟙褁瓡嬂蘵直職質值植執殖擲姪侄蹠蟄躑桎埴稙摭縶柣犆秷擿馽慹樴膱懫蟙褁瓡嬂蘵6AC12E006AD12E00
+ㄓˋ至制治志制致置智秩志稚质峙致帜滞挚窒炙痔雉识懥痣轾骘帙陟知置忮桎踬蛭贽鸷厔鑕豸庤彘猘畤疐绸觯郅銍偫跱递鋕櫍粗騺淛狾礩胵膣螲挃洷覟庢鴙迣翐臸駤祑觢鴩至制治志製致置智秩誌稚質峙緻幟滯摯窒炙痔雉識懥痣輊騭帙陟知寘忮桎躓蛭贄鷙厔鑕豸庤彘猘畤疐紩觶郅銍偫跱遰鋕櫍袟騺淛狾礩胵膣螲挃洷覟庢鴙迣翐臸駤祑觢鴩008C1230D003420000001AE1232D0034200000
+ㄓㄚ渣扎喳楂查齇柤齄抯挓樝诅渣扎喳楂查齇柤皻抯挓樝謯088088
+ㄓㄜ遮螫晢嫬遮螫晢嫬
+ㄓㄞ摘斋齐捚摘齋齊捚66
+ㄓㄠ朝招昭召着嘲钊駋鉊晁盄鍣妱朝招昭召著嘲釗駋鉊晁盄鍣妱05000500
+ㄓㄡ周周州洲舟粥賙啁盩譸輈喌騆鸼洀淍銂珘徟輖侜婤周週州洲舟粥賙啁盩譸輈喌騆鵃洀淍銂珘徟輖侜婤000200200200
+ㄓㄢ詹沾瞻毡沾旃谵鳝觇邅栴鸇驙占呫饘钻詀薝譠詹沾瞻氈霑旃譫鱣覘邅栴鸇驙占呫饘鉆詀薝譠8C1018D101
+ㄓㄣ真针珍贞侦祯斟箴砧甄臻桢榛诊蓁榛溱砧胗针鱵媜駗薽禛樼潧瑊侦寝蒧轃籈鷏堻真針珍貞偵禎斟箴砧甄臻楨榛診蓁獉溱碪胗鍼鱵媜駗薽禛樼潧瑊遉寊蒧轃籈鷏堻A38280030A38AA0030
+ㄓㄤ张章彰漳樟璋獐嫜暲鄣蟑鱆慞傽墇騿遧張章彰漳樟璋獐嫜暲鄣蟑鱆慞傽墇騿遧1000010000
+ㄓㄥ争征蒸睁徵挣筝正怔狰铮峥诤症钲烝篜姃炡埩聇丁眐爭征蒸睜徵掙箏正怔猙錚崢諍癥鉦烝篜姃炡埩聇丁眐96E70096E700
+ㄓㄨ珠朱诸株猪蛛茱朱诛铢侏洙潴邾橥槠祩藷絑袾觰鴸蠩蝫鮢藸珠朱諸株豬蛛茱硃誅銖侏洙瀦邾櫫櫧祩藷絑袾觰鴸蠩蝫鮢藸413D000493D000
+ㄔˇ尺齿耻尺侈褫欼搋蚇恀拸姼傂誃鉹伬鶒尺齒恥呎侈褫欼搋蚇恀拸姼傂誃鉹伬鶒60000E0000
+ㄔˊ持池迟驰匙弛墀坻踟篪茬蚳篪蚔茌痄忯汦荎栘歭耛貾趍箈徲謘徥持池遲馳匙弛墀坻踟箎茬蚳篪蚔茌痄忯汦荎栘歭耛貾趍箈徲謘徥C000000C020000
+ㄔˋ赤翅斥饬叱炽啻傺敕眙抶饎栻遫彳跮踅鷘乿瘛鉓哧淔痸懘戠摰赤翅斥飭叱熾啻傺敕眙抶饎栻遫彳跮踅鷘乿瘛鉓哧淔痸懘戠摰82000008200000
+ㄔㄚ差插叉喳艖嗏叉杈偛疀鎈差插叉喳艖嗏扠杈偛疀鎈000040
+ㄔㄜ车砗莗車硨莗33
+ㄔㄞ拆钗差偨拆釵差偨22
+ㄔㄠ抄钞超剿弨怊訬剿罺抄鈔超勦弨怊訬剿罺200A00
+ㄔㄡ抽瘳掏篘犨婤抽瘳搊篘犨婤4040
+ㄔㄢ掺搀梴襜辿鋓惉嬓欃摻攙梴襜辿鋓惉嬓欃300300
+ㄔㄣ嗔琛瞋郴琛棽謓諃搷堔嗔琛瞋郴賝棽謓諃搷堔000010
+ㄔㄤ昌倡猖娼阊菖鲳伥鼚錩淐琩裮昌倡猖娼閶菖鯧倀鼚錩淐琩裮0D000D00
+ㄔㄥ称撑瞠蛏偁柽赬琤撑鏿浾埥棦牚竀崝饓稱撐瞠蟶偁檉赬琤橕鏿浾埥棦牚竀崝饓B2100B2100
+ㄔㄨ出初出貙出初齣貙04
+ㄕˇ使始史驶矢屎豕使始史駛矢屎豕8080
+ㄕˊ十什石时实食拾蚀硕射提莳湜鲥埘祏鼫鉐榯湁溡鼭寔十什石時實食拾蝕碩射提蒔湜鰣塒祏鼫鉐榯湁溡鼭寔899600899600
+ㄕˋ市是事世士势识室示试视式氏适释饰侍誓逝嗜恃仕柿使螫弑噬拭豉媞筮舐轼諡贳奭戺澨諟襫铈揓鉽唑翅銴谥遾簭鯷齛跩烒崼徥詍戠褆衋市是事世士勢識室示試視式氏適釋飾侍誓逝嗜恃仕柿使螫弒噬拭豉媞筮舐軾諡貰奭戺澨諟襫鈰揓鉽唑翨銴謚遾簭鯷齛跩烒崼徥詍戠褆衋066E00205015000066E00205015000
+ㄕ˙匙匙
+ㄕㄚ杀沙纱砂莎煞鲨裟杉痧铩魦樧猀帴摋蔱硰殺沙紗砂莎煞鯊裟杉痧鎩魦樧猀帴摋蔱硰5440054400
+ㄕㄜ奢赊奓檨譇奢賒奓檨譇2020
+ㄕㄞ筛篩11
+ㄕㄠ烧稍梢艄捎弰蛸莦筲旓髾輎鮹蕱燒稍梢艄捎弰蛸莦筲旓髾輎鮹蕱10001000
+ㄕㄡ收荍收荍
+ㄕㄢ山扇衫杉删珊膻舢煽潸跚姗芟苫扇縿穇挻烻狦笘剼山扇衫杉刪珊羶舢煽潸跚姍芟苫搧縿穇挻烻狦笘剼058000058400
+ㄕㄣ身深伸申绅呻信参蔘娠莘甡侁籸参诜駪燊砷柛氠屾珅胂阠妽峷眒身深伸申紳呻信參蔘娠莘甡侁籸葠詵駪燊砷柛氠屾珅胂阠妽峷眒090C000090C000
+ㄕㄤ商伤殇觞汤漡蔏螪謪鬺商傷殤觴湯漡蔏螪謪鬺E10E10
+ㄕㄥ生声胜升牲升甥笙升泩鉎鼪呏猩湦焺鵿生聲勝升牲昇甥笙陞泩鉎鼪呏狌湦焺鵿6002062120
+ㄕㄨ书输殊舒梳疏蔬枢纾抒摅姝樗摴殳杸陎綀碰祋軗鵨藲書輸殊舒梳疏蔬樞紓抒攄姝樗摴殳杸陎綀橾祋軗鵨藲385040385040
+ㄖˋ日衵馹鈤日衵馹鈤
+ㄖㄥ扔扔
+ㄗˇ子仔紫梓籽滓耔訾笫秭胏茈吇杍芓呰矷釨訾子仔紫梓籽滓耔訾笫秭胏茈吇杍芓呰矷釨訿0000000004
+ㄗˋ自字恣渍眦孳剚胔胾扻倳牸自字恣漬眥孳剚胔胾扻倳牸810810
+ㄗ˙子子
+ㄗㄚ扎匝咂唼嘁抸鉔紮匝咂唼嘁抸鉔1010
+ㄗㄞ灾栽哉渽賳災栽哉渽賳1010
+ㄗㄠ遭糟糟傮遭糟蹧傮04
+ㄗㄡ邹诌鄹诹啁掫菆陬驺鲰棸緅棷郰媰黀齱齺鄒謅鄹諏啁掫菆陬騶鯫棸緅棷郰媰黀齱齺B0300B0300
+ㄗㄢ簪鐕簪鐕
+ㄗㄤ脏赃臜牂臧髒贓臢牂臧7070
+ㄗㄥ曾增憎罾缯矰橧磳驓璔曾增憎罾繒矰橧磳驓璔010010
+ㄗㄨ租菹租蒩22
+ㄘˇ此佌泚玼跐皉此佌泚玼跐皉
+ㄘˊ词辞慈磁瓷雌祠疵茨粢糍柌嬨濨呲飺薋詞辭慈磁瓷雌祠疵茨粢餈柌嬨濨呲飺薋3040030400
+ㄘˋ次刺赐厕伺佽蛓莿朿栨蚝絘次刺賜廁伺佽蛓莿朿栨蚝絘C00C00
+ㄘㄚ擦搽嚓擦搽嚓
+ㄘㄞ猜猜
+ㄘㄠ操糙鄵喿操糙鄵喿
+ㄘㄢ参餐骖參餐驂55
+ㄘㄣ参参梫參嵾梫33
+ㄘㄤ苍仓沧舱伧鶬凔嵢蒼倉滄艙傖鶬凔嵢F1F1
+ㄘㄥ噌噌
+ㄘㄨ粗粗觕粗麤觕02
+ㄙˇ死死
+ㄙˋ四似赐嗣饲寺肆祀食俟伺泗巳耜儩姒笥驷兕涘柶汜肂貄蕼洍四似賜嗣飼寺肆祀食俟伺泗巳耜儩姒笥駟兕涘柶汜肂貄蕼洍41002004100200
+ㄙ˙思思
+ㄙㄚ撒仨撒仨
+ㄙㄞ塞鳃腮毢揌塞鰓腮毢揌2020
+ㄙㄠ艘骚缫搔臊慅溞颾鱢艘騷繅搔臊慅溞颾鱢600600
+ㄙㄡ搜飕鄋蒐廋溲馊獀醙嗖锼騪搜颼鄋蒐廋溲餿獀醙嗖鎪騪244244
+ㄙㄢ三参毵攕鬖三參毿攕鬖6060
+ㄙㄣ森槮罧襂幓篸森槮罧襂幓篸
+ㄙㄤ丧桑喪桑11
+ㄙㄥ僧鬙僧鬙
+ㄙㄨ苏苏酥稣苏櫯蘇甦酥穌囌櫯B1B1
+ㄚˋ阿阿
+ㄚ˙啊阿啊阿
+ㄛˊ哦哦
+ㄜˇ恶噁11
+ㄜˊ额讹鹅娥哦蛾峨莪俄囮讹硪蚵锇迗珴涐皒睋魤額訛鵝娥哦蛾峨莪俄囮吪硪蚵鋨迗珴涐皒睋魤7042070420
+ㄜˋ恶饿俄鄂厄遏锷扼鳄颚呃愕噩轭厄鹗垩谔萼咢哑崿扼詻阏頞堨腭枙堮岋鑩櫮砐砨蚕豟轭圔扼蝁嶭餩蘁惡餓俄鄂厄遏鍔扼鱷顎呃愕噩軛阨鶚堊諤萼咢啞崿搤詻閼頞堨齶枙堮岋鑩櫮砐砨蚅豟軶圔搹蝁嶭餩蘁343A3190820343E35908A0
+ㄝˋ诶誒11
+ㄞˇ矮蔼霭欸毐昹佁矮藹靄欸毐昹佁6060
+ㄞˊ捱皑呆敳捱皚騃敳66
+ㄞˋ爱碍艾暧瑷隘嗳乂靉僾堨嫒锿賹濭鴱譪诶薆愛礙艾曖璦隘噯乂靉僾堨嬡鑀賹濭鴱譪誒薆B5812B5812
+ㄠˇ袄媪芺镺襖媼芺镺33
+ㄠˊ熬敖遨翱嗷螯鳌鳌鏖骜廒獒璈聱鏊滶磝隞摮蔜簢謷爊熬敖遨翱嗷螯鰲鼇鏖驁廒獒璈聱鏊滶磝隞摮蔜簢謷爊0C20000C2000
+ㄠˋ傲澳奥懊墺奡扷擙拗詏岙傲澳奧懊墺奡扷擙拗詏嶴404404
+ㄡˇ偶藕呕耦吘湡腢蕅偶藕嘔耦吘湡腢蕅4040
+ㄡˊ吽吽
+ㄡˋ呕沤噢嘔漚噢33
+ㄢˇ俺唵晻堷俺唵晻堷
+ㄢˊ雸玵啽雸玵啽
+ㄢˋ暗案岸按黯菴暗犴豻匼桉洝拣錌匎婩儑暗案岸按黯菴闇犴豻匼桉洝荌錌匎婩儑0001004010
+ㄣˋ摁摁
+ㄤˇ軮軮
+ㄤˊ昂卬昂卬
+ㄤˋ盎醠盎醠
+ㄦˇ尔耳洱饵迩珥駬薾铒峏尔栮爾耳洱餌邇珥駬薾鉺峏尒栮915915
+ㄦˊ儿而洏耏胹輀侕栭陑鲕檽聏荋唲鸸兒而洏耏胹輀侕栭陑鮞檽聏荋唲鴯10241024
+ㄦˋ二贰佴刵咡樲聏毦眲衈二貳佴刵咡樲聏毦眲衈200200
+ㄧˇ以已乙倚椅矣蚁尾舣迤苡偯扆旖蚁拖酏鳦钇齮顗舣鉯迤胣礒抻陭崺晲轙以已乙倚椅矣蟻尾艤迤苡偯扆旖螘扡酏鳦釔齮顗檥鉯迆胣礒掜陭崺晲轙041C4240041C4A40
+ㄧˊ遗疑移宜怡姨仪夷一谊胰贻饴咦诒沂颐彝迤椸痍蛇圯嶷笫桋匜宧洟簃訑犴迻杝柂袲酏峓眱羠鈶寲侇珆衪铁呲恞萓沶栘瓵瘗羡蛦暆跠歋熪箷螔顊謻觺鸃遺疑移宜怡姨儀夷一誼胰貽飴咦詒沂頤彝迤椸痍蛇圯嶷笫桋匜宧洟簃訑貤迻杝柂袲酏峓眱羠鈶寲侇珆衪銕呲恞萓沶栘瓵袘羡蛦暆跠歋熪箷螔顊謻觺鸃14A5100800020100014A51008000201000
+ㄧˋ意义易议亦益异艺亿忆译液役翼疫毅逸邑抑肄一谊绎溢缢轶诣屹佚翌羿驿掖懿裔臆曳奕蜴腋衣刈翳挹镒呓弈佾乂弋艾怿劓圛斁薏悒瘗仡勩埸峄帟曀杙枻殪浥熠艗襼饐黓亄唈燡藙豷呓屹熤劮檍嗌廙镱鞥醳醷翊臆异枍伿浂澺芅熼玴拽蘙俋焲燱晹垼焊捙欭埶羛隿殔跇裛嫕緆膉靾槷潩蓺墿瘱谥繶瀷帠槸霬鷾齸意義易議亦益異藝億憶譯液役翼疫毅逸邑抑肄一誼繹溢縊軼詣屹佚翌羿驛掖懿裔臆曳奕蜴腋衣刈翳挹鎰囈弈佾乂弋艾懌劓圛斁薏悒瘞仡勩埸嶧帟曀杙枻殪浥熠艗襼饐黓亄唈燡藙豷寱阣熤劮檍嗌廙鐿鞥醳醷翊肊异枍伿浂澺芅熼玴抴蘙俋焲燱晹垼釴捙欭埶羛隿殔跇裛嫕緆膉靾槷潩蓺墿瘱謚繶瀷帠槸霬鷾齸A87006780003802200040200804000010AC70067800038022000C0240804000010
+ㄧㄚ呀压鸦鸭押丫桠虾孲呀壓鴉鴨押丫椏煆孲EC0EC0
+ㄧㄛ唷唷
+ㄧㄝ耶噎蠮耶噎蠮
+ㄧㄠ要腰夭妖邀么吆哟喓袄葽訞要腰夭妖邀么吆喲喓祅葽訞082082
+ㄧㄡ优忧幽悠呦攸耰麀櫌鄾懮怮嚘瀀纋蚴優憂幽悠呦攸耰麀櫌鄾懮怮嚘瀀纋蚴30003000
+ㄧㄢ烟焉淹殷腌咽胭奄湮菸嫣燕蔫阉厌崦胭鄢漹猒珚偣嬮酀腌煙焉淹殷醃咽胭奄湮菸嫣燕蔫閹厭崦臙鄢漹猒珚偣嬮酀腌10060001106100
+ㄧㄣ因音阴姻殷茵殷氤喑喑堙湮愔禋絪裀闉駰铟蒑諲堙韾洇凐歅噾霠韽黫摿因音陰姻殷茵慇氤瘖喑堙湮愔禋絪裀闉駰銦蒑諲垔韾洇凐歅噾霠韽黫摿4000400044104200
+ㄧㄤ央秧殃鸯鞅泱坱胦柍佒姎紻鉠雵央秧殃鴦鞅泱坱胦柍佒姎紻鉠雵80008000
+ㄧㄥ应英鹰婴莺樱膺瑛鹦嘤罂缨撄璎嫈罂罃煐韺甇霙碤礯朠蝧渶褮偀阴蘡譻蠳鶧應英鷹嬰鶯櫻膺瑛鸚嚶罌纓攖瓔嫈甖罃煐韺甇霙碤礯朠蝧渶褮偀霒蘡譻蠳鶧D3FB00010D3FB00010
+ㄨˇ五午武舞侮伍鹉怃妩潕庑仵忤碔甒捂啎捂坞玝倵无躌五午武舞侮伍鵡憮嫵潕廡仵忤碔甒摀啎捂嵨玝倵橆躌0C50420C5842
+ㄨˊ无吴吾梧巫芜唔蜈诬毋亡牾膴麌鼯郚鋘鋙峿浯珸俉鯃莁鷡洖瞴譕無吳吾梧巫蕪唔蜈誣毋亡牾膴麌鼯郚鋘鋙峿浯珸俉鯃莁鷡洖瞴譕32100003210000
+ㄨˋ勿物务恶误悟晤雾戊钨坞兀兀骛寤軏杌婺鹜垩沕迕遻鋈屼扤煟卼焐靰阢粅矹芴垭逜痦齀蘁岉恶蓩勿物務惡誤悟晤霧戊鎢塢兀兀騖寤軏杌婺鶩堊沕迕遻鋈屼扤煟卼焐靰阢粅矹芴埡逜痦齀蘁岉噁蓩C962C000401C962C000401
+ㄨㄚ哇蛙挖洼呱娲洼挖溛窊窐漥哇蛙挖窪呱媧洼穵溛窊窐漥0208A0
+ㄨㄛ窝倭涡莴猧踒窩倭渦萵猧踒D0D0
+ㄨㄞ歪歪
+ㄨㄟ威崴偎煨葳隈萎委逶烓椳渨碨愄揋葨隇溾詴蝛覣燰威崴偎煨葳隈萎委逶烓椳渨碨愄揋葨隇溾詴蝛覣燰
+ㄨㄢ湾弯豌剜莞蜿刓潫灣彎豌剜莞蜿刓潫3030
+ㄨㄣ温瘟轀瘟馧瞃豱殟溫瘟轀塭馧瞃豱殟1090
+ㄨㄤ汪尪尢汪尪尢
+ㄨㄥ翁嗡螉鶲霐翁嗡螉鶲霐
+ㄩˇ与语雨予羽屿宇禹庾龉噢圄圉窳伛俣敔噳楀瑀与萭貐偊祤斞鄅寙篽蘌斔螤與語雨予羽嶼宇禹庾齬噢圄圉窳傴俁敔噳楀瑀与萭貐偊祤斞鄅寙篽蘌斔螤222C0000322C0000
+ㄩˊ于愉鱼娱馀于渔予愚余竽榆逾虞俞舆瑜渝隅臾腴盂谀逾舁圩欤觎畲萸嵎窬妤揄歈禺舆隃雩杅楰玗緰羭蝓褕瘐艅狳邘璵硢籅釪嵛湡鄃腧睮雓澞蕍螸謣鮽鵌蘛鸆鸒衧唹堣堬雽歶旟鰅齵於愉魚娛餘于漁予愚余竽榆逾虞俞輿瑜渝隅臾腴盂諛踰舁圩歟覦畬萸嵎窬妤揄歈禺轝隃雩杅楰玗緰羭蝓褕瘐艅狳邘璵硢籅釪崳湡鄃腧睮雓澞蕍螸謣鮽鵌蘛鸆鸒衧唹堣堬雽歶旟鰅齵C50804C1010004000000D5080CC1010004000000
+ㄩˋ育遇预玉欲域喻愈誉狱欲浴裕煜寓御与钰豫御郁吁谕愈郁驭昱毓芋尉熨俞峪聿妪彧饫鬻谷鹬燠蜮堉语愈棫滪矞禺罭蓣遹阈隩鹆棜淢燏獝繘蜮薁驈悆鴥鋊淯黦栯砡礜欥軉輍悇稢蒮噊鳿醧饫爩灪戫袬緎蓹錥育遇預玉欲域喻愈譽獄慾浴裕煜寓禦與鈺豫御鬱籲諭癒郁馭昱毓芋尉熨俞峪聿嫗彧飫鬻谷鷸燠蜮堉語瘉棫澦矞禺罭蕷遹閾隩鵒棜淢燏獝繘魊薁驈悆鴥鋊淯黦栯砡礜欥軉輍悇稢蒮噊鳿醧饇爩灪戫袬緎蓹錥403036204984450000001040783F2049854501000010
+ㄩㄝ约曰哕箹焥約曰噦箹焥5050
+ㄩㄢ冤渊鸳鸢宛眢蜎鵷肙鋺惌棩蒬裷鼘蔫蜵裫駌懒灁冤淵鴛鳶宛眢蜎鵷肙鋺惌棩蒬裷鼘葾蜵裫駌嬽灁E00880E00880
+ㄩㄣ晕氲縕贇奫蝹暈氳縕贇奫蝹3030
+ㄩㄥ佣庸雍拥壅痈臃墉镛慵饔邕廱雝嗈灉墉噰澭蕹滽郺傭庸雍擁壅癰臃墉鏞慵饔邕廱雝嗈灉鄘噰澭蕹滽郺921000921010
+ㄅㄚˇ把靶钯把靶鈀44
+ㄅㄚˊ拔跋钹魃茇鼥軷犮菝胈詙拔跋鈸魃茇鼥軷犮菝胈詙400400
+ㄅㄚˋ罢爸霸坝耙弝灞伯猈罷爸霸壩耙弝灞伯猈900900
+ㄅㄚ˙吧罢琶杷吧罷琶杷22
+ㄅㄛˇ跛簸蚾跛簸蚾
+ㄅㄛˊ伯博柏泊勃搏渤驳白薄脖帛舶箔荸卜膊钹饽铂欂鹁踣浡襮踄鎛驳僰餺膊桲謈檗馞胉拔猼葧鬻懪簙礴鑮郣鸔糪伯博柏泊勃搏渤駁白薄脖帛舶箔荸蔔膊鈸餑鉑欂鵓踣浡襮踄鎛駮僰餺髆桲謈檗馞胉挬猼葧鋍懪簙礡鑮郣鸔糪0808E28009400808E2840940
+ㄅㄛˋ播擘簸亳薜譒薄檗蘖繴挀播擘簸亳薜譒薄檗蘗繴挀001001
+ㄅㄞˇ百摆佰襬粨捭矲絔百擺佰襬粨捭矲絔2020
+ㄅㄞˊ白白
+ㄅㄞˋ败拜呗稗椑稗矲庍敗拜唄粺椑稗矲庍50D0
+ㄅㄟˇ北北
+ㄅㄟˋ被备背贝辈倍臂狈惫悖孛焙蓓褙邶琲悖钡哱糒梖珼邶牬郥犕奰被備背貝輩倍臂狽憊悖孛焙蓓褙邶琲誖鋇哱糒梖珼鄁牬郥犕奰A910200A910340
+ㄅㄠˇ保宝饱堡褓葆鸨怉駂鸨媬保寶飽堡褓葆鴇怉駂鳵媬642642
+ㄅㄠˊ雹薄窇瓝雹薄窇瓝
+ㄅㄠˋ报抱暴爆豹鲍刨趵刨虣刨儤抱煲袌嚗犦忁報抱暴爆豹鮑刨趵鉋虣鑤儤菢煲袌嚗犦忁1200012510
+ㄅㄢˇ板版板阪舨昄钣粄蝂板版闆阪舨昄鈑粄蝂040440
+ㄅㄢˋ半办伴扮拌绊姅瓣爿怑湴鉡绊半辦伴扮拌絆姅瓣爿怑湴鉡靽22012201
+ㄅㄣˇ本畚苯本畚苯
+ㄅㄣˋ笨体坌笨体坌
+ㄅㄤˇ榜绑榜膀氆榜綁牓膀氆2060
+ㄅㄤˋ棒磅谤蚌傍镑旁甏塝艕棒磅謗蚌傍鎊旁甏塝艕420420
+ㄅㄥˇ菶玤琫埲誁菶玤琫埲誁
+ㄅㄥˊ甭甭
+ㄅㄥˋ蹦榜洴迸胼泵蹦搒洴迸跰泵2121
+ㄅㄧˇ比笔彼鄙匕沘秕屄蚍妣疕滗柀朼貏比筆彼鄙匕沘秕屄蚍妣疕潷柀朼貏20802080
+ㄅㄧˊ鼻鼻
+ㄅㄧˋ必敝毕壁避璧闭鄙臂币弊婢毙碧泌秘俾蔽庇哔愎辟弼裨陛埤箄篦畀比嬖睥贲贔襞毖荜跸髀怭庳愊楅湢狴毙筚苾薜觱诐躄邲閟柲梐珌痹飶馝駜鎞鷩皕堛铋痹腷骳坒滭熚疪妼鏎鷝柫佖蜌彃箅蓖鄪毕鮅襒鵖襣驆鼊芘粊稗嫳獙廦鄨縪必敝畢壁避璧閉鄙臂幣弊婢斃碧泌祕俾蔽庇嗶愎辟弼裨陛埤箄篦畀比嬖睥賁贔襞毖蓽蹕髀怭庳愊楅湢狴獘篳苾薜觱詖躄邲閟柲梐珌痺飶馝駜鎞鷩皕堛鉍痹腷骳坒滭熚疪妼鏎鷝柫佖蜌彃箅蓖鄪罼鮅襒鵖襣驆鼊芘粊稗嫳獙廦鄨縪44298000130640002000800004429800013064020200080000
+ㄅㄧㄝ憋鳖虌憋鱉虌22
+ㄅㄧㄠ标彪镳镖飙膘熛洋罴嘌杓滮瀌飙瘭穮飑骉摽儦膘颩髟謤墂贆蔈爂藨標彪鑣鏢飆膘熛麃羆嘌杓滮瀌猋瘭穮颮驫摽儦臕颩髟謤墂贆蔈爂藨D9123000D9123100
+ㄅㄧㄢ边编鞭蝙砭笾箯稨猵甂柉楄煸邊編鞭蝙砭籩箯稨猵甂柉楄煸32003200
+ㄅㄧㄣ宾滨彬槟傧斌缤豳濒邠璸蠙镔豩汃椕霦频驞賓濱彬檳儐斌繽豳瀕邠璸蠙鑌豩汃椕霦矉驞B5112B5112
+ㄅㄧㄥ兵冰挪栟兵冰掤栟44
+ㄅㄨˇ补捕埔哺卜鳪獛補捕埔哺卜鳪獛1010
+ㄅㄨˊ不不
+ㄅㄨˋ不部布步怖布簿埠钸蔀篰捗咘不部布步怖佈簿埠鈽蔀篰捗咘00100210
+ㄆㄚˊ爬扒琶耙杷跁爬扒琶耙杷跁
+ㄆㄚˋ怕帕帊袙怕帕帊袙
+ㄆㄛˇ颇剖叵笸頗剖叵笸11
+ㄆㄛˊ婆鄱皤櫇婆鄱皤櫇
+ㄆㄛˋ破迫魄珀泊朴粕粕岶烞蒪破迫魄珀泊朴粕醱岶烞蒪000080
+ㄆㄞˇ矲俖矲俖
+ㄆㄞˊ排牌徘俳箅棑排牌徘俳簰棑0101
+ㄆㄞˋ派湃鎃蒎派湃鎃蒎
+ㄆㄟˇ琣昢琣昢
+ㄆㄟˊ培赔陪裴邳碚毰陫荖培賠陪裴邳碚毰陫荖200200
+ㄆㄟˋ配佩沛佩霈帔旆浿辔姵翇伂配佩沛珮霈帔旆浿轡姵翇伂001801
+ㄆㄠˇ跑跑
+ㄆㄠˊ袍咆刨匏庖洋炰龅鞄炮瓟袍咆刨匏庖麃炰齙鞄炮瓟0A00A0
+ㄆㄠˋ泡炮炮疱奅包ⅱ泡砲炮皰奅麭髱86A6
+ㄆㄡˇ剖瓿棓婄剖瓿棓婄
+ㄆㄡˊ掊裒抔捊掊裒抔捊
+ㄆㄢˇ坢坢
+ㄆㄢˊ盘磐蟠般胖盘蹒磻踫鞶幋縏柈瀊蒰媻搬跘盤磐蟠般胖槃蹣磻踫鞶幋縏柈瀊蒰媻搫跘1600116001
+ㄆㄢˋ判叛盼畔拚袢泮襻詊頄溿沜牉泮判叛盼畔拚袢泮襻詊頄溿沜牉頖00000002
+ㄆㄣˇ呠翸翉呠翸翉
+ㄆㄣˊ盆湓葐盆湓葐
+ㄆㄤˇ嗙耪嗙耪
+ㄆㄤˊ旁庞膀螃旁蒡厖尨雱逄庬篣舽旁龐膀螃徬蒡厖尨雱逄庬篣舽20002100
+ㄆㄤˋ胖胖
+ㄆㄥˇ捧蛔捧皏22
+ㄆㄥˊ朋彭澎蓬膨硼棚鹏篷蟛芃淜鬅痭錋倗輣傰韸髼憉樥鑝朋彭澎蓬膨硼棚鵬篷蟛芃淜鬅痭錋倗輣傰韸髼憉樥鑝080000080000
+ㄆㄥˋ碰堋掽椪碰堋掽椪
+ㄆㄧˇ否匹疋痞嚭苤仳庀圮崥諀否匹疋痞嚭苤仳庀圮崥諀
+ㄆㄧˊ皮疲脾琵枇裨啤毗埤沘貔陂罴罢纰郫陴鼙铍膍毗阰蚽蜱玭笓鈚錍魾螷犤纰猈藣蠯皮疲脾琵枇裨啤毗埤沘貔陂羆罷紕郫陴鼙鈹膍毘阰蚽蜱玭笓鈚錍魾螷犤毞猈藣蠯000740080000741080
+ㄆㄧˋ譬辟僻媲屁辟癖甓擗澼濞淠揊潎鷿髲霹譬闢僻媲屁辟癖甓擗澼濞淠揊潎鷿髲礔0000120001
+ㄆㄧㄝ瞥撇氕瞥撇氕
+ㄆㄧㄠ飘漂慓螵薸僄旚翲魒飄漂慓螵薸僄旚翲魒100100
+ㄆㄧㄢ篇偏扁翩萹媥貵頨鶣篇偏扁翩萹媥貵頨鶣
+ㄆㄧㄣ拼姘礗涄拼姘礗涄
+ㄆㄧㄥ乒娉砯頩覮乒娉砯頩覮
+ㄆㄨˇ普浦埔谱圃溥烳氆镨潽誧普浦埔譜圃溥烳氆鐠潽誧801801
+ㄆㄨˊ仆朴葡蒲菩朴蹼脯濮璞匍莆蒱幞酺钋镤轐纀墣僕樸葡蒲菩朴蹼脯濮璞匍莆蒱襆酺釙鏷轐纀墣100A1300A1
+ㄆㄨˋ暴铺瀑曝铺暴鋪瀑曝舖2121
+ㄇㄚˇ马蚂码玛溤吗鎷鷌唛馬螞碼瑪溤嗎鎷鷌嘜F21F21
+ㄇㄚˊ麻麻嘛么蟆犘麻痲嘛麼蟆犘80A0
+ㄇㄚˋ骂禡傌杩罵禡傌榪99
+ㄇㄚ˙嘛吗蟆嘛嗎蟆22
+ㄇㄛˇ抹抹
+ㄇㄛˊ模磨摩膜模魔摹谟蘑劘嫫藦髍模磨摩膜糢魔摹謨蘑劘嫫藦髍08000900
+ㄇㄛˋ末莫默漠没膜寞陌殁脉沫秣茉蓦墨貊磨瘼靺殁馍鄚纆霢嚜眽瞙藦暯枺爅妺万銆镆貘粖蛨袹嗼塻慔蟔鬕莈覛縸唛末莫默漠沒膜寞陌歿脈沫秣茉驀墨貊磨瘼靺歾饃鄚纆霢嚜眽瞙藦暯枺爅妺万銆鏌貘粖蛨袹嗼塻慔蟔鬕莈覛縸嘜013281004008013281004008
+ㄇㄛ˙么麼11
+ㄇㄜ˙么麼11
+ㄇㄞˇ买嘪鷶買嘪鷶11
+ㄇㄞˊ埋霾埋埋霾薶04
+ㄇㄞˋ卖麦迈脉劢蝐賣麥邁脈勱蝐F1F1
+ㄇㄟˇ美每镁浼媺渼媄挴燘美每鎂浼媺渼媄挴燘400400
+ㄇㄟˊ没煤眉枚梅媒莓霉玫霉楣湄嵋苺禖郿堳瑂脢镅呅腜塺徾捃沒煤眉枚梅媒莓霉玫黴楣湄嵋苺禖郿堳瑂脢鋂呅腜塺徾攗10008011020801
+ㄇㄟˋ妹媚寐昧眛魅瑁沬袂痗韎煝猸妹媚寐昧眛魅瑁沬袂痗韎煝蝞00010001
+ㄇㄠˇ卯昴泖茆卯昴泖茆
+ㄇㄠˊ毛茅矛髦锚旄蟊芼蝥髦媌堥罞酕嫹鶜枆軞渵毛茅矛髦錨旄蟊芼蝥髳媌堥罞酕嫹鶜枆軞渵0100001200
+ㄇㄠˋ帽冒貌贸茂瑁懋旄耄媢楙眊瞀芼袤毷艒萺鄮帽冒貌貿茂瑁懋旄耄媢楙眊瞀芼袤毷艒萺鄮8000080000
+ㄇㄡˇ某冇踇某冇踇
+ㄇㄡˊ谋眸缪牟侔蝥鍪蛑麰洠鉾鴾呣哞謀眸繆牟侔蝥鍪蛑麰洠鉾鴾呣哞50005000
+ㄇㄢˇ满屘矕滿屘矕11
+ㄇㄢˊ蛮馒瞒蹒漫颟谩鳗璊悗慲墁鬘鬗蠻饅瞞蹣漫顢謾鰻璊悗慲槾鬘鬗FE80FE80
+ㄇㄢˋ慢漫曼蔓幔嫚镘缦墁熳藕僈獌慢漫曼蔓幔嫚鏝縵墁熳澫僈獌0C400C40
+ㄇㄣˇ暪暪
+ㄇㄣˊ门们扪樠钔穈菛虋門們捫樠鍆穈菛虋7171
+ㄇㄣˋ闷焖懑悶燜懣77
+ㄇㄣ˙们們11
+ㄇㄤˇ莽蟒漭汒庬硥茻壾莽蟒漭汒庬硥茻壾
+ㄇㄤˊ忙芒茫盲氓尨硭邙哤奀杗盳鋩娏牻痝蛖駹砖鼆笀忙芒茫盲氓尨硭邙哤奀杗盳鋩娏牻痝蛖駹蘉鼆笀000040000040
+ㄇㄥˇ猛蜢艋锰懵蠓蒙瓾猛蜢艋錳懵蠓懞瓾8484
+ㄇㄥˊ蒙盟萌蒙朦蒙檬懵幪甍瞢艨虻曚氓礞氋雺莔儚蕄鄳鄸饛鸏蒙盟萌矇朦濛檬懵幪甍瞢艨虻曚甿礞氋雺莔儚蕄鄳鄸饛鸏00040008204000
+ㄇㄥˋ梦孟霿霥夢孟霿霥11
+ㄇㄧˇ米靡弭敉眯銤渳葞蔝弥灖米靡弭敉眯銤渳葞蔝濔灖002002
+ㄇㄧˊ迷弥谜弥靡糜麋縻猕蘼冞麛醚醾檷蘼攠弥爢麊鸍迷彌謎瀰靡糜麋縻獼蘼冞麛醚醾檷蘪攠瓕爢麊鸍E01020E01820
+ㄇㄧˋ密蜜秘秘觅泌汨谧宓幂塓幦鼏幂幂漞糸峚榓滵蔤蠠嘧密蜜秘祕覓泌汨謐宓冪塓幦鼏羃幎漞糸峚榓滵蔤蠠嘧092600892600
+ㄇㄧㄝ咩乜芈咩乜羋44
+ㄇㄧㄠ喵喵
+ㄇㄧㄡ唒唒
+ㄇㄨˇ母亩牡姆拇牳鉧姥峔砪母畝牡姆拇牳鉧姥峔砪200200
+ㄇㄨˊ模氁模氁
+ㄇㄨˋ木目幕牧慕墓募穆睦暮沐苜鹜楘霂钼炑坶毣蚞幕鞪莯木目幕牧慕墓募穆睦暮沐苜鶩楘霂鉬炑坶毣蚞幙鞪莯000900000901
+ㄈㄚˇ法发法髮22
+ㄈㄚˊ乏伐罚阀筏砝薅法疺藅乏伐罰閥筏砝茷法疺藅C40C40
+ㄈㄚˋ法珐法琺22
+ㄈㄛˊ佛坲佛坲
+ㄈㄟˇ匪翡斐蜚诽悱菲朏棐榧篚奜餥匪翡斐蜚誹悱菲朏棐榧篚奜餥01000100
+ㄈㄟˊ肥淝腓萉蜰肥淝腓萉蜰
+ㄈㄟˋ废费肺沸吠痱怫痱芾屝剕狒砩濷废昲胇俷厞曊鼣櫠蟦镄廢費肺沸吠痱怫疿芾屝剕狒砩濷癈昲胇俷厞曊鼣櫠蟦鐨300408380408
+ㄈㄡˇ否缶殕缹鴀否缶殕缹鴀
+ㄈㄡˊ罘芣紑剻罘芣紑剻
+ㄈㄢˇ反返魬反返魬
+ㄈㄢˊ凡烦繁帆蕃矾藩樊蘩璠籵墦燔膰蠜蹯帆笲钒瀿鐇勫橎薠羳鷭杋柉瀪凡煩繁帆蕃礬藩樊蘩璠籵墦燔膰蠜蹯颿笲釩瀿鐇勫橎薠羳鷭杋柉瀪2200400022005000
+ㄈㄢˋ范范犯泛泛饭贩泛梵畈笵鄤奿軓軬滼嬔範范犯氾汎飯販泛梵畈笵鄤奿軓軬滼嬔0600097000
+ㄈㄣˇ粉黺粉黺
+ㄈㄣˊ坟焚汾枌棼蚝豶鼖幩濆轒鼢妢炃羒蒶黂弅蕡鐼墳焚汾枌棼蚡豶鼖幩濆轒鼢妢炃羒蒶黂弅蕡鐼1200012000
+ㄈㄣˋ份忿奋愤分粪偾瀵坋秎魵橨膹羵份忿奮憤分糞僨瀵坋秎魵橨膹羵C600C600
+ㄈㄤˇ访彷仿纺仿舫昉瓬仿鶭訪彷仿紡倣舫昉瓬髣鶭900911
+ㄈㄤˊ房防妨肪坊鲂房防妨肪坊魴0202
+ㄈㄤˋ放放
+ㄈㄥˇ唪覂唪覂
+ㄈㄥˊ逢缝冯夆渢堸艂摓逢縫馮夆渢堸艂摓6060
+ㄈㄥˋ奉凤俸讽缝賵焨甮奉鳳俸諷縫賵焨甮A1A1
+ㄈㄨˇ府腐抚辅甫斧俯釜脯腑莆滏呒拊黼簠俯郙弣鯆暊冹蜅蛔軵父府腐撫輔甫斧俯釜脯腑莆滏嘸拊黼簠頫郙弣鯆暊冹蜅蚥軵父C001080C001180
+ㄈㄨˊ服福扶浮符伏佛缚幅俘拂苻弗孚袱芙辐蝠匐蜉罘涪夫郛莩怫蚨桴绋茯菔绂咈洑绋艴芾茀艀刜帗笰葍袚氟棴澓烰枹玸岪枎垘昲柫琈虙踾凫巿沷祓翇韍諨鴔黻鵩鶝服福扶浮符伏彿縛幅俘拂苻弗孚袱芙輻蝠匐蜉罘涪夫郛莩怫蚨桴紼茯菔紱咈洑綍艴芾茀艀刜帗笰葍袚氟棴澓烰枹玸岪枎垘昲柫琈虙踾鳧巿沷祓翇韍諨鴔黻鵩鶝0C00100940000040000C0010094000004000
+ㄈㄨˋ父负妇付附富复副傅覆复腹咐赴赋驸阜讣馥赙蝮鲋祔偩輹鳆鍑榑复胕蚹萯蝜褔姇峊蛗緮蕧父負婦付附富復副傅覆複腹咐赴賦駙阜訃馥賻蝮鮒祔偩輹鰒鍑榑复胕蚹萯蝜褔姇峊蛗緮蕧600CA22000644CA22000
+ㄉㄚˇ打打
+ㄉㄚˊ答达鞑靼瘩怛繨哒妲笪荅薘褟鐽匒呾畣炟锝答達韃靼瘩怛繨噠妲笪荅薘褟鐽匒呾畣炟鎝6800468004
+ㄉㄚˋ大大
+ㄉㄜˊ得德淂得德淂
+ㄉㄜ˙的得的得
+ㄉㄞˇ歹逮歹逮
+ㄉㄞˋ代带待袋戴怠殆黛贷迨大玳岱逮襶埭靆绐廗汏忕瀻軩跢艜蹛柋酨代帶待袋戴怠殆黛貸迨大玳岱逮襶埭靆紿廗汏忕瀻軩跢艜蹛柋酨20102002010200
+ㄉㄟˇ得得
+ㄉㄠˇ倒岛导祷捣擣捯壔禂倒島導禱搗擣捯壔禂E10E10
+ㄉㄠˋ到道倒稻盗蹈悼导纛翿檤菿瓙到道倒稻盜蹈悼導纛翿檤菿瓙09000900
+ㄉㄡˇ斗抖陡蚪枓唗敨斗抖陡蚪枓唗敨
+ㄉㄡˋ斗豆逗痘窦豆脰餖鋀梪浢读鬥豆逗痘竇荳脰餖鋀梪浢讀118138
+ㄉㄢˇ胆疸掸亶紞刐掸玬衴黵丼澸膽疸撢亶紞刐撣玬衴黵丼澸540540
+ㄉㄢˋ但旦淡蛋诞担弹惮氮啖澹憺儋啗啖石瘅凼僤幨霮髧萏钽暺柦帎滩沊狚觛啖舕蛋嘾鴠癚殚灗泹但旦淡蛋誕擔彈憚氮啖澹憺儋啗噉石癉窞僤幨霮髧萏鉭暺柦帎潬沊狚觛啿舕蜑嘾鴠癚殫灗泹0F003880020F04388822
+ㄉㄤˇ档党挡谠挡欓党檔黨擋讜攩欓党D1F1
+ㄉㄤˋ当荡挡荡砀宕菪逿璗愓瓽礑簜闣當蕩擋盪碭宕菪逿璗愓瓽礑簜闣F100F100
+ㄉㄥˇ等戥等戥
+ㄉㄥˋ邓瞪蹬凳嶝磴墱邆霯鄧瞪蹬凳嶝磴墱邆霯100100
+ㄉㄧˇ底抵邸诋抵砥氐坻柢弤抵诋阺聜菧軧扺底抵邸詆牴砥氐坻柢弤觝呧阺聜菧軧扺8080081C00
+ㄉㄧˊ的敌迪狄笛涤翟荻嫡嘀镝踯芽犒籴觌篴蔋靮梑潪苖嚁鸐藋藡的敵迪狄笛滌翟荻嫡嘀鏑蹢芽犒糴覿篴蔋靮梑潪苖嚁鸐藋藡22CC00022CC000
+ㄉㄧˋ地第弟帝递蒂的缔谛娣睇棣杕玓禘蒂螮踶楴渧碲虳釱樀旳軑梊焍馰墆嵽珶甋地第弟帝遞蒂的締諦娣睇棣杕玓禘蔕螮踶楴渧碲虳釱樀旳軑梊焍馰墆嵽珶甋091000000091800000
+ㄉㄧㄚ嗲嗲
+ㄉㄧㄝ爹爹
+ㄉㄧㄠ雕凋刁貂雕碉叼雕瞗雕鲷扚蛁鳭虭殦雕凋刁貂鵰碉叼彫瞗琱鯛扚蛁鳭虭殦00400960
+ㄉㄧㄡ丢铥丟銩33
+ㄉㄧㄢ颠巅癫滇掂傎癫敁蹎槙齻历顛巔癲滇掂傎瘨敁蹎槙齻厧748748
+ㄉㄧㄥ丁钉叮疔酊盯仃玎帄靪虰丁釘叮疔酊盯仃玎帄靪虰200200
+ㄉㄨˇ赌堵睹笃肚錖裻帾賭堵睹篤肚錖裻帾9090
+ㄉㄨˊ读独毒牍纛渎犊髑讟黩椟儥碡殰玳贕韇韥皾讀獨毒牘纛瀆犢髑讟黷櫝儥碡殰蝳贕韇韥皾B6640B6640
+ㄉㄨˋ度渡肚妒镀杜蠹离咤度渡肚妒鍍杜蠹秺喥091091
+ㄉㄨㄛ多朵哆柁茤多朵哆柁茤
+ㄉㄨㄟ堆頧痽堆頧痽
+ㄉㄨㄢ端专偳剬媏端耑偳剬媏2020
+ㄉㄨㄣ敦蹲墩敦礅驐蜳撉镦敦蹲墩惇礅驐蜳撉鐓001801
+ㄉㄨㄥ东冬咚鼕苳蝀埬岽氡炵洫菄鸫東冬咚鼕苳蝀埬崠氡炵涷菄鶇18411841
+ㄊㄚˇ塔榙锝塔榙鎝44
+ㄊㄚˋ踏榻蹋塌獭拓遢嚃踏沓嗒挞沓闼鎉闒錔绱鞳鳎羍涾傝毾誻鑉漯迖濌龘踏榻蹋塌獺搨遢嚃躂沓嗒撻遝闥鎉闒錔鞜鞳鰨羍涾傝毾誻鑉漯迖濌龘0382A0000393A000
+ㄊㄜˋ特慝忒忑铽貣蟘特慝忒忑鋱貣蟘0101
+ㄊㄞˊ台台抬台苔邰跆台薹炱骀鲐儓嬯笞旲秮台臺抬颱苔邰跆檯薹炱駘鮐儓嬯籉旲秮00C40A8C40
+ㄊㄞˋ太态泰汰钛燤溙呔傣太態泰汰鈦燤溙呔傣210210
+ㄊㄠˇ讨討11
+ㄊㄠˊ逃桃陶萄淘涛啕洮焘梼匋啕綯鼗醄騊錭駣祹鋾逃桃陶萄淘濤啕洮燾檮匋咷綯鞀醄騊錭駣祹鋾0232002B20
+ㄊㄠˋ套套
+ㄊㄡˇ黈妵紏钭蘣黈妵紏鈄蘣8080
+ㄊㄡˊ头投牏酘頭投牏酘11
+ㄊㄡˋ透斢透斢
+ㄊㄡ˙头頭11
+ㄊㄢˇ坦毯袒袒忐禫菼贉嗿膻憳醓裧坦毯袒襢忐禫菼贉嗿膻憳醓裧00008000
+ㄊㄢˊ谈弹痰潭谭檀坛昙坛覃郯锬餤驔镡倓醰貚婒憛藫橝黮鷤談彈痰潭譚檀壇曇罈覃郯錟餤驔鐔倓醰貚婒憛藫橝黮鷤3D94003D9400
+ㄊㄢˋ探叹叹碳炭赕埮湠羰探嘆歎碳炭賧埮湠羰620620
+ㄊㄤˇ倘躺傥淌帑惝镋鎲戃曭爣矘倘躺儻淌帑惝钂鎲戃曭爣矘440440
+ㄊㄤˊ堂糖唐塘膛螳棠醣搪镗溏螗瑭赯榶樘漟煻鎕闛橖蓎磄踼薚鶶堂糖唐塘膛螳棠醣搪鏜溏螗瑭赯榶樘漟煻鎕闛橖蓎磄踼薚鶶00200000020000
+ㄊㄤˋ趟烫铴摥趟燙鐋摥66
+ㄊㄥˊ疼腾藤藤誊滕螣縢疼騰藤籐謄滕螣縢21A1
+ㄊㄧˇ体绨體綈33
+ㄊㄧˊ题提啼堤蹄醍禔稊缇荑騠堤鶗惿厗鍗偍趧謕鶙崹睼蝭蕛鷤鯷鹈題提啼堤蹄醍禔稊緹荑騠隄鶗惿厗鍗偍趧謕鶙崹睼蝭蕛鷤鯷鵜10100041090004
+ㄊㄧˋ替惕涕屉悌剃锑嚏倜剃殢裼揥籊鬄哲褅逖鹈替惕涕屜悌剃銻嚏倜薙殢裼揥籊鬄悐褅逖鵜8408484284
+ㄊㄧㄝ贴帖怗貼帖怗11
+ㄊㄧㄠ挑祧恌庣鮡挑祧恌庣鮡
+ㄊㄧㄢ天添倎屇酟婖天添倎屇酟婖
+ㄊㄧㄥ听厅汀桯艼耵聽廳汀桯艼耵3030
+ㄊㄨˇ土吐钍芏唋土吐釷芏唋4040
+ㄊㄨˊ图途突徒涂屠凸荼涂余酴瘏稌腯峹葖鵚捈怢鍎跿梌湥筡蒤瑹駼鶟鷋鼵嵞廜潳鷵圖途突徒塗屠凸荼涂余酴瘏稌腯峹葖鵚捈怢鍎跿梌湥筡蒤瑹駼鶟鷋鼵嵞廜潳鷵100000000110000000
+ㄊㄨˋ兔吐菟鵵堍兔吐菟鵵堍
+ㄊㄨㄛ脱拖托托堶侂挩扥矺沰馲侻詑魠脫拖托託堶侂挩扥矺沰馲侻詑魠10009000
+ㄊㄨㄟ推蓷藬推蓷藬
+ㄊㄨㄢ湍煓貒湍煓貒
+ㄊㄨㄣ吞暾啍涒旽吞暾啍涒旽
+ㄊㄨㄥ通恫蓪痌炵熥狪通恫蓪痌炵熥狪
+ㄋㄚˇ那哪那哪
+ㄋㄚˊ拿挐拏誽拿挐拏誽
+ㄋㄚˋ那纳呐讷钠捺娜肭衲軜妠豽魶笝那納吶訥鈉捺娜肭衲軜妠豽魶笝E100E100
+ㄋㄞˇ乃奶乃氖奶奈氝釢艿尕乃奶迺氖嬭奈氝釢艿尕000410
+ㄋㄞˊ孻摨孻摨
+ㄋㄞˋ耐奈褦鼐柰倷螚渿錼耐奈褦鼐柰倷螚渿錼
+ㄋㄟˇ馁哪腇餒哪腇11
+ㄋㄟˋ内內11
+ㄋㄠˇ脑恼瑙腦惱瑙33
+ㄋㄠˊ挠铙桡呶猱怓譊髐嶩獶繷獿夒撓鐃橈呶猱怓譊髐嶩獶繷獿夒70007000
+ㄋㄠˋ闹淖鬧淖11
+ㄋㄡˊ羺獳羺獳
+ㄋㄡˋ耨耨嗕譨耨鎒嗕譨02
+ㄋㄢˇ赧戁蝻湳腩揇赧戁蝻湳腩揇
+ㄋㄢˊ南男难喃楠楠暔諵奻萳莮南男難喃楠柟暔諵奻萳莮400420
+ㄋㄢˋ难婻難婻11
+ㄋㄣˋ嫩嫩
+ㄋㄤˇ曩攮灢曩攮灢
+ㄋㄤˊ囊囊
+ㄋㄤˋ齉齉
+ㄋㄤ˙囔囔
+ㄋㄥˊ能薴儜能薴儜
+ㄋㄥˋ泞濘11
+ㄋㄧˇ你你拟祢儗旎昵坭柅薿檷抳苨馜隬譺你妳擬禰儗旎昵坭柅薿檷抳苨馜隬譺C000E000
+ㄋㄧˊ泥尼妮倪霓怩猊霓輗郳貌鯓鲵齯臡秜狋觬婗淣呢狔屔跜铌鶂泥尼妮倪霓怩猊蜺輗郳麑鯓鯢齯臡秜狋觬婗淣呢狔屔跜鈮鶂00410010841001
+ㄋㄧˋ逆溺匿腻泥睨昵惄鷁鷊嫟縌迡堄逆溺匿膩泥睨暱惄鷁鷊嫟縌迡堄84008400
+ㄋㄧㄝ捏踗鑈捏踗鑈
+ㄋㄧㄡ妞妞
+ㄋㄨˇ努弩砮努弩砮
+ㄋㄨˊ奴驽孥笯蒘奴駑孥笯蒘2020
+ㄋㄨˋ怒怒
+ㄋㄩˇ女妆钕女籹釹66
+ㄋㄩˋ忸恧衄朒忸恧衄朒
+ㄌㄚˇ喇藞喇藞
+ㄌㄚˊ剌邋旯剌邋旯
+ㄌㄚˋ腊蜡鑞辣剌腊落鬎瘌揧楋臘蠟鑞辣剌腊落鬎瘌揧楋200300
+ㄌㄚ˙啦啦
+ㄌㄜˋ乐垃勒肋泐埒叻仂捋扐阞砳鳓氻哷竻樂垃勒肋泐埒叻仂捋扐阞砳鰳氻哷竻10011001
+ㄌㄜ˙了了
+ㄌㄞˊ来莱徕涞騋箂崃郲铼鯠棶庲鶆唻來萊徠淶騋箂崍郲錸鯠棶庲鶆唻F410F410
+ㄌㄞˋ赖癞濑籁睐赉藾娕賴癩瀨籟睞賚藾娕F3F3
+ㄌㄟˇ累垒儡漯耒磊蕾诔藟樏癗磊絫磊鑸瘣櫑櫐礨灅讄鸓頛磊蘲虆累壘儡漯耒磊蕾誄藟樏癗礌絫磥鑸瘣櫑櫐礨灅讄鸓頛礧蘲虆28000002882080
+ㄌㄟˊ雷累累擂嫘镭羸缧罍檑畾櫑瓃蠝轠壨欙雷累纍擂嫘鐳羸縲罍檑畾櫑瓃蠝轠壨欙0A0004A000
+ㄌㄟˋ类泪累擂纇酹銇儽蘱禷類淚累擂纇酹銇儽蘱禷300300
+ㄌㄠˇ老姥佬栳狫轑咾橑铑恅荖老姥佬栳狫轑咾橑銠恅荖001001
+ㄌㄠˊ劳牢痨涝唠醪浶铹簩蟧崂勞牢癆澇嘮醪浶鐒簩蟧嶗D94D94
+ㄌㄠˋ劳络烙酪嫪軂橯僗勞絡烙酪嫪軂橯僗3030
+ㄌㄡˇ篓搂塿嵝簍摟塿嶁BB
+ㄌㄡˊ楼喽娄蝼髅偻蒌廔漊耧熡謱艛鞻鷜瞜樓嘍婁螻髏僂蔞廔漊耬熡謱艛鞻鷜瞜F720F720
+ㄌㄡˋ漏陋露镂瘘漏陋露鏤瘺8181
+ㄌㄢˇ览懒揽榄缆壈爦漤醂嬾顲浨覽懶攬欖纜壈爦灠醂嬾顲浨F90F90
+ㄌㄢˊ兰篮蓝栏拦澜褴婪岚阑襴谰斓籣欗糷灆灡谰躝蘭籃藍欄攔瀾襤婪嵐闌襴讕斕籣欗糷灆灡譋躝F7B14F7B14
+ㄌㄢˋ烂滥缆镧爁壏爛濫纜鑭爁壏F0F0
+ㄌㄤˇ朗阆硠峎悢誏烺塱朗閬硠峎悢誏烺塱2020
+ㄌㄤˊ郎狼廊螂琅琅榔稂莨螓桹筤锒俍崀欴郎狼廊螂瑯琅榔稂莨蜋桹筤鋃俍崀欴00210121
+ㄌㄤˋ浪埌蒗浪埌蒗
+ㄌㄥˇ冷冷
+ㄌㄥˊ棱峥棱薐菱倰楞稜崚棱薐蔆倰楞2131
+ㄌㄥˋ愣踜楞愣踜楞
+ㄌㄧˇ李里里理礼里哩里鲤娌俚澧逦醴蠡鳢锂粴豊峛欚李里裡理禮裏哩浬鯉娌俚澧邐醴蠡鱧鋰粴豊峛欚0119104B1910
+ㄌㄧˊ离璃黎梨篱厘牦罹狸骊犁漓漓狸藜蜊蠡鹂嫠缡黧梩漦缡蔾氂厘蓠剺喱篱醨鲡劙孋廲騹昵樆謧鯬鵹攡丽菞鑗黐粍麶離璃黎梨籬釐犛罹貍驪犁漓灕狸藜蜊蠡鸝嫠褵黧梩漦縭蔾氂厘蘺剺喱篱醨鱺劙孋廲騹孷樆謧鯬鵹攡麗菞鑗黐粍麶1420A880128001731A88012800
+ㄌㄧˋ力立利丽历坜例历莉厉励砺粒莅雳沥俪隶砾吏荔栗栗俐痢疠笠戾唳郦璃詈呖溧蛎枥溯粝栎轹瓅鬁猁盭篥苙唎屴跞钋鬲皪秝瑮轣岦朸欐禲赲鴗砅濿砬悷蚸厤筣綟蜧磿斄犡苈蠫鷅麜攦觻鷑攭鱳靋栵浰塛搮蝷儮曞讈瓥鱱娳力立利麗歷壢例曆莉厲勵礪粒蒞靂瀝儷隸礫吏荔栗慄俐痢癘笠戾唳酈琍詈嚦溧蠣櫪沴糲櫟轢瓅鬁猁盭篥苙唎屴躒釙鬲皪秝瑮轣岦朸欐禲赲鴗砅濿砬悷蚸厤筣綟蜧磿斄犡藶蠫鷅麜攦觻鷑攭鱳靋栵浰塛搮蝷儮曞讈瓥鱱娳8BEE7026DF003000002000008BEE7426DF00300000200000
+ㄌㄧㄝ咧咧
+ㄌㄧㄠ撩撩
+ㄌㄧㄡ溜遛溜蹓22
+ㄌㄧㄥ拎拎
+ㄌㄨˇ鲁虏掳卤卤橹艣磠鐪鏀蓾撸氇魯虜擄滷鹵櫓艣磠鐪鏀蓾擼氌F381F381
+ㄌㄨˊ卢芦庐胪炉颅泸鲈轳垆鸬玈垆舻炉籚栌嚧攎蠦纑盧蘆廬臚爐顱瀘鱸轤壚鸕玈罏艫鑪籚櫨嚧攎蠦纑FF7710FF7710
+ㄌㄨˋ路陆录鹿露赂禄碌氯麓鹭戮辘蓼逯漉辂僇潞籙璐甪稑穋簏醁騄渌琭盝碌录绿蔍錴垏鏕鯥摝硉睩廘熝踛蕗螰簬鵱淕塶蹗路陸錄鹿露賂祿碌氯麓鷺戮轆蓼逯漉輅僇潞籙璐甪稑穋簏醁騄淥琭盝磟彔菉蔍錴垏鏕鯥摝硉睩廘熝踛蕗螰簬鵱淕塶蹗66411088100006641108C10000
+ㄌㄨㄛ罗囉11
+ㄌㄨㄣ抡掄11
+ㄌㄩˇ吕旅履侣铝屡缕褛娄膂漊稆梠郘挔絽儢祣呂旅履侶鋁屢縷褸婁膂漊穭梠郘挔絽儢祣9F9009F900
+ㄌㄩˊ驴闾榈藘慺氀膢驢閭櫚藘慺氀膢7070
+ㄌㄩˋ律绿率虑滤氯嵂膟鑢绿葎勴律綠率慮濾氯嵂膟鑢菉葎勴A12A12
+ㄍㄚˊ轧噶钆軋噶釓55
+ㄍㄚˋ尬尬
+ㄍㄚ˙价價11
+ㄍㄜˇ葛哿舸擖魺騔笴葛哿舸擖魺騔笴
+ㄍㄜˊ格革隔阁葛骼蛤咯膈轕嗝搿合韐塥觡鬲阁挌佮輵鮯敆荞忱獦镉鞷齃格革隔閣葛骼蛤咯膈轕嗝搿郃韐塥觡鬲閤挌佮輵鮯敆茖愅獦鎘鞷齃8001285080012850
+ㄍㄜˋ个各铬虼个個各鉻虼箇5151
+ㄍㄜ˙个個11
+ㄍㄞˇ改改
+ㄍㄞˋ概盖丐钙溉戤摡瓂概蓋丐鈣溉戤摡瓂A0A0
+ㄍㄟˇ给給11
+ㄍㄠˇ稿搅搞槁缟杲暠檺筶稿攪搞槁縞杲暠檺筶210210
+ㄍㄠˋ告诰郜锆祰煰告誥郜鋯祰煰A0A0
+ㄍㄡˇ狗茍岣枸苟笱耇茩蚼狗茍岣枸苟笱耇茩蚼
+ㄍㄡˋ够购垢构媾彀构诟遘觏冓姤雊傋瞉簼鞲唦夠購垢構媾彀搆詬遘覯冓姤雊傋瞉簼韝唦BC201BC201
+ㄍㄢˇ敢感赶杆橄秆澉皯盰赶敢感趕桿橄稈澉皯盰赶820C20
+ㄍㄢˋ干赣凎淦绀旰骭詌干赣涻簳嵅幹贛凎淦紺旰骭詌榦灨涻簳嵅31303130
+ㄍㄣˇ艮艮
+ㄍㄣˊ哏哏
+ㄍㄣˋ亘艮茛亙艮茛11
+ㄍㄤˇ港岗港崗22
+ㄍㄤˋ杠槓11
+ㄍㄥˇ梗耿哽绠鲠埂鲠郠挭梗耿哽綆鯁埂骾郠挭850850
+ㄍㄥˋ更亘堩更亙堩22
+ㄍㄨˇ股古鼓骨谷谷贾凸蛊汩牯滑罟嘏诂毂鹄瞽臌盬羖蛌扢钴杚淈狜唃尳榖蓇濲瀔愲縎薣股古鼓骨谷穀賈凸蠱汩牯滑罟嘏詁轂鵠瞽臌盬羖蛌扢鈷杚淈狜唃尳榖蓇濲瀔愲縎薣041C18000061C18000
+ㄍㄨˊ骨鹘骨鶻22
+ㄍㄨˋ故固顾雇雇锢告估痼梏榾牿堌崮凅棝稒故固顧雇僱錮告估痼梏榾牿堌崮凅棝稒4200043000
+ㄍㄨㄚ瓜括刮蜗刮呱聒鸹栝适騧胍脶筈葀劀瘑緺懖趏膼瓜括刮蝸颳呱聒鴰栝适騧胍腡筈葀劀瘑緺懖趏膼880100890100
+ㄍㄨㄛ郭锅蝈埚嘓崞埻墎濄郭鍋蟈堝嘓崞埻墎濄E00E00
+ㄍㄨㄞ乖乖
+ㄍㄨㄟ归规龟瑰闺圭圭皈傀妫槻鲑规邽窐沩嫢摫歸規龜瑰閨圭珪皈傀媯槻鮭槼邽窐溈嫢摫71A9075A90
+ㄍㄨㄢ官关观冠棺矜鳏纶倌莞瘝毌鱞官關觀冠棺矜鰥綸倌莞瘝毌鱞6C006C00
+ㄍㄨㄤ光胱洸桄珖炚茪銧垙烡光胱洸桄珖炚茪銧垙烡
+ㄍㄨㄥ工公功供攻宫恭躬弓蚣红龚肱觥肛釭篢塨愩匑共幊工公功供攻宮恭躬弓蚣紅龔肱觥疘釭篢塨愩匑共幊02C40002C400
+ㄎㄚˇ卡咳佧卡咳佧
+ㄎㄚˋ喀髂喀髂
+ㄎㄜˇ可渴哿坷岢坝敤嶱閜可渴哿坷岢堁敤嶱閜020020
+ㄎㄜˊ咳壳咳殼22
+ㄎㄜˋ客课刻克克喀溘恪嗑可榼缂髁氪骒搕厒勀客課刻克剋喀溘恪嗑可榼緙髁氪騍搕厒勀2084021840
+ㄎㄞˇ凯慨楷恺剀岂铠垲闓锴颽暟輆凱慨楷愷剴豈鎧塏闓鍇颽暟輆9F209F20
+ㄎㄞˋ慨忾愒咳咳烗勓壒慨愾愒咳欬烗勓壒2021
+ㄎㄠˇ考烤拷栲考薧洘考烤拷栲攷薧洘0001
+ㄎㄠˋ靠铐犒靠銬犒22
+ㄎㄡˇ口口
+ㄎㄡˋ扣寇叩蔻扣鷇筘佝怐滱瞉簆扣寇叩蔻釦鷇筘佝怐滱瞉簆000010
+ㄎㄢˇ砍侃坎崁莰槛欿轗歁歞埳凵顑砍侃坎崁莰檻欿轗歁歞埳凵顑02000200
+ㄎㄢˋ看瞰勘阚瞰磡衎墈鬫竷看瞰勘闞矙磡衎墈鬫竷800810
+ㄎㄣˇ肯啃垦恳龈齗豤錹肯啃墾懇齦齗豤錹C1C1
+ㄎㄣˋ据硍裉掯硍裉11
+ㄎㄤˇ慷慷
+ㄎㄤˊ扛扛
+ㄎㄤˋ亢抗炕伉炕囥犺闶邟钪亢抗炕伉匟囥犺閌邟鈧082092
+ㄎㄥˇ挳挳
+ㄎㄨˇ苦楛苦楛
+ㄎㄨˋ库裤酷喾矻瘔趶庫褲酷嚳矻瘔趶B0B0
+ㄎㄨㄚ夸夸姱荂晇侉舿誇夸姱荂晇侉舿0010
+ㄎㄨㄞ呙喎咼喎11
+ㄎㄨㄟ亏窥盔闚刲悝鞹鍷茥藈噅岿蘬虧窺盔闚刲悝鞹鍷茥藈噅巋蘬30803080
+ㄎㄨㄢ宽髋臗寬髖臗33
+ㄎㄨㄣ昆昆坤琨锟焜褌晜鲲菎騉髡惃猑昆崑坤琨錕焜褌晜鯤菎騉髡惃猑01102110
+ㄎㄨㄤ匡框筐诓劻恇洭匡框筐誆劻恇洭8080
+ㄎㄨㄥ空崆倥箜悾硿涳錓空崆倥箜悾硿涳錓
+ㄏㄚˇ哈哈
+ㄏㄚˊ蛤蛤
+ㄏㄜˊ何合和河荷核盒禾褐劾阖阁曷和涸盍核盖貉阂纥滆翮蝎嗑齕合餲鶡鉌魺鞨菏姀毼熆蒚篕螛礉盉廅楁澕趷何合和河荷核盒禾褐劾闔閤曷龢涸盍覈蓋貉閡紇滆翮蝎嗑齕郃餲鶡鉌魺鞨菏姀毼熆蒚篕螛礉盉廅楁澕趷00C0A100000000C2B1400000
+ㄏㄜˋ贺和鹤喝荷吓赫郝暍嗃熇猲翯佫煂賀和鶴喝荷嚇赫郝暍嗃熇猲翯佫煂52005200
+ㄏㄞˇ海醢烸海醢烸
+ㄏㄞˊ还孩骸颏還孩骸頦99
+ㄏㄞˋ害亥骇嗨氦嗐絯餀害亥駭嗨氦嗐絯餀4040
+ㄏㄟˇ黑黑
+ㄏㄠˇ好郝好郝
+ㄏㄠˊ号毫豪壕濠蚝貉嚎鹤蚵嗥籇諕勂譹號毫豪壕濠蠔貉嚎鶴蚵嗥籇諕勂譹12101210
+ㄏㄠˋ号耗浩皓镐涸昊好灏浩颢颢鄗秏撑滈皞哠悎鰝昦薃號耗浩皓鎬涸昊好灝澔皜顥鄗秏淏滈皞哠悎鰝昦薃11D40011F400
+ㄏㄡˇ吼吼
+ㄏㄡˊ猴侯喉篌鍭糇瘊銗翭鯸葔猴侯喉篌鍭餱瘊銗翭鯸葔020020
+ㄏㄡˋ后候厚后逅鲎垕堠郈鄇缿洉後候厚后逅鱟垕堠郈鄇缿洉020120
+ㄏㄢˇ喊罕厂蔊豃嚂喊罕厂蔊豃嚂
+ㄏㄢˊ寒含函涵韩邯汗邗干琀梒鋡焓寒含函涵韓邯汗邗榦琀梒鋡焓01100110
+ㄏㄢˋ和汉汗旱焊憾翰撼悍颔捍瀚閈捍暵熯皖犴睅菡豻焊釬駻哻涆淊馯蜭颌螒顄雗攌譀鋎鶾和漢汗旱焊憾翰撼悍頷扞瀚閈捍暵熯晥犴睅菡豻銲釬駻哻涆淊馯蜭頜螒顄雗攌譀鋎鶾20201002002060120200
+ㄏㄣˇ很狠很狠
+ㄏㄣˊ痕拫鞎痕拫鞎
+ㄏㄣˋ恨恨
+ㄏㄤˇ酐酐
+ㄏㄤˊ行航杭吭颃桁迒苀肮蚢斻貥雽魧行航杭吭頏桁迒苀肮蚢斻貥雽魧01000100
+ㄏㄤˋ行沆行沆
+ㄏㄥˊ横恒衡恒珩蘅桁嫦鑅楻誙諻揘佷橫恆衡恒珩蘅桁姮鑅楻誙諻揘佷18003800
+ㄏㄥˋ横啈澋绗橫啈澋絎99
+ㄏㄨˇ虎琥浒唬许浒虎琥滸唬許汻4343
+ㄏㄨˊ胡湖壶蝴糊狐弧葫胡瑚糊斛鹄囫縠衚觳醐猢搰鹕槲媩抇鰗焀魱螜瀫楜嘝鶦胡湖壺蝴糊狐弧葫鬍瑚餬斛鵠囫縠衚觳醐猢搰鶘槲媩抇鰗焀魱螜瀫楜嘝鶦4001010040510100
+ㄏㄨˋ护户互沪扈瓠怙祜笏冱戽楛冱岵鄠臛頀枑槴昈嫭婀嫮熩豰綔謢蔰護戶互滬扈瓠怙祜笏冱戽楛沍岵鄠臛頀枑槴昈嫭婟嫮熩豰綔謢蔰B000020B001020
+ㄏㄨㄚ花华哗鷨錵花華嘩鷨錵6060
+ㄏㄨㄛ豁豁
+ㄏㄨㄟ灰挥辉恢诙晖麾徽堕褌撝隳辉翬豗褘洃隓顪鰴拻噅禈灰揮輝恢詼暉麾徽墮褌撝隳煇翬豗褘洃隓顪鰴拻噅禈631100631100
+ㄏㄨㄢ欢驩欢獾犿欢酄鴅歡驩讙獾犿懽酄鴅5252
+ㄏㄨㄣ婚昏荤阍惛睯殙棔淹敯睧婚昏葷閽惛睯殙棔涽敯睧C01C01
+ㄏㄨㄤ荒慌肓衁巟嚝荒慌肓衁巟嚝
+ㄏㄨㄥ轰哄烘薨訇吽揈渹哅轰谾鍧焢魟轟哄烘薨訇吽揈渹哅輷谾鍧焢魟10201020
+ㄐㄧˇ几给己挤脊戟济几麂庋虮剞掎泲踦魕丮穖妀撠幾給己擠脊戟濟几麂庋蟣剞掎泲踦魕丮穖妀撠A4400B4400
+ㄐㄧˊ及级极即集急击疾籍吉寂辑脊圾唧嫉汲亟吃棘藉瘠楫岌笈鶺戢殛蹐伋蒺耤芨蕺踖鈒佶堲姞濈襋墼潗鴶嶯洁急湒极銡狤鏶蝍衱偮庴莋塉槉漃膌艺橶蕀轚霵彶揤楖秸鞊螏觙及級極即集急擊疾籍吉寂輯脊圾唧嫉汲亟吃棘藉瘠楫岌笈鶺戢殛蹐伋蒺耤芨蕺踖鈒佶堲姞濈襋墼潗鴶嶯洁忣湒极銡狤鏶蝍衱偮庴莋塉槉漃膌蓻橶蕀轚霵彶揤楖秸鞊螏觙24800000000000020006480000000040002000
+ㄐㄧˋ计记既纪际继季寄技妓济剂系悸祭忌暨冀骑鲫稷跻荠骥霁蓟髻罽觊伎洎瘈跽哜塈惎漈穧芰蔇痵癠穄鲚鲚鯚鰶无刉臮裚穊誋鬾瞡檕璾鵋齌懻瀱鱀蘮蘻計記既紀際繼季寄技妓濟劑繫悸祭忌暨冀騎鯽稷躋薺驥霽薊髻罽覬伎洎瘈跽嚌塈惎漈穧芰蔇痵癠穄鮆鱭鯚鰶旡刉臮裚穊誋鬾瞡檕璾鵋齌懻瀱鱀蘮蘻B3C1CE3120890000B3C1CE3120890000
+ㄐㄧㄚ家加嘉佳家迦枷袈痂笳珈跏茄葭豭耞麚泇袈镓鴐猳幏犌貑夹家加嘉佳傢迦枷袈痂笳珈跏茄葭豭耞麚泇毠鎵鴐猳幏犌貑夾00008020100C02
+ㄐㄧㄝ街接皆阶揭偕嗟喈幯结湝薢夹啑椄菨蝔鶛街接皆階揭偕嗟喈幯結湝薢袺啑椄菨蝔鶛8021080210
+ㄐㄧㄠ教交胶骄焦娇郊跤浇蛟蕉礁椒茭姣鲛僬憍艽鹪燋詨鱎鐎鵁鷮嘄憿膲穚蟂鷍嶕蟭教交膠驕焦嬌郊跤澆蛟蕉礁椒茭姣鮫僬憍艽鷦燋詨鱎鐎鵁鷮嘄憿膲穚蟂鷍嶕蟭C21880000C21880000
+ㄐㄧㄡ纠揪啾鸠轇湫樛揪勼朻牞觓揂萛阄糾揪啾鳩轇湫樛揫勼朻牞觓揂萛鬮90049804
+ㄐㄧㄢ间监坚尖兼肩艰奸奸煎缄溅渐笺歼菅戋鞬笺缄缣湔熸蒹鹣廌犍籛豜鞯鬋鈃鑯鲣鰜櫼熞蕑揃搛幵菺靬葌鳽餰礛騝鵳瀸虃婪猏麉間監堅尖兼肩艱奸姦煎緘濺漸箋殲菅戔鞬牋椷縑湔熸蒹鶼廌犍籛豜韉鬋鈃鑯鰹鰜櫼熞蕑揃搛幵菺靬葌鳽餰礛騝鵳瀸虃惤猏麉74C7D11220008074D7D112200080
+ㄐㄧㄣ今金禁津斤巾筋襟矜浸筋衿祲瑧菳珒埐紟嶜惍今金禁津斤巾筋襟矜浸觔衿祲瑧菳珒埐紟嶜惍0000000400
+ㄐㄧㄤ将江疆僵浆姜姜豇僵缰螿橿茳礓瓨翞將江疆僵漿姜薑豇殭韁螿橿茳礓瓨翞11201530
+ㄐㄧㄥ经精京惊睛茎晶菁更兢泾鲸荆旌粳黥箐鶄巠婛旍鵛鶁鼱麠仱惊經精京驚睛莖晶菁更兢涇鯨荊旌粳黥箐鶄巠婛旍鵛鶁鼱麠仱惊12C100092C1000
+ㄐㄩˇ举矩咀莒沮龃榉筥踽蒟椇柜竘袍跙蝺舉矩咀莒沮齟櫸筥踽蒟椇柜竘袓跙蝺16021602
+ㄐㄩˊ局鞠菊橘掬局桔挶鞫局掬踘锔鵙鶪椈焗淗驧狊梮郹犑輂箤趜鵴菊鼳陱駶局鞠菊橘掬跼桔挶鞫侷匊踘鋦鵙鶪椈焗淗驧狊梮郹犑輂箤趜鵴蘜鼳陱駶0001000002610080
+ㄐㄩˋ据句具巨剧聚俱拒距锯惧钜炬讵遽倨瞿踞飓泃苣窭醵屦秬虡寠鐻佢据粔姖怚絇足耟岠埧蚷駏澽貗躆洰炒壉犋據句具巨劇聚俱拒距鋸懼鉅炬詎遽倨瞿踞颶泃苣窶醵屨秬虡寠鐻佢据粔姖怚絇足耟岠埧蚷駏澽貗躆洰焣壉犋01E24A00000111E24A000001
+ㄐㄩㄝ噘嗟撅噘嗟撅
+ㄐㄩㄢ捐娟鹃涓镌圈蠲朘身脧裐捐娟鵑涓鐫圈蠲朘身脧裐410410
+ㄐㄩㄣ军君均钧皲囷麇荇鮶桾蚐袀頵龟碅軍君均鈞皸囷麇莙鮶桾蚐袀頵龜碅99029902
+ㄐㄩㄥ扃坰駉扃坰駉
+ㄑㄧˇ起启岂乞绮杞稽綮屺棨敧芑婍邔芞呇起啟豈乞綺杞稽綮屺棨敧芑婍邔芞呇61006100
+ㄑㄧˊ其期齐奇旗骑祈棋祺碁祁崎琦岐歧琪麒鳍畦脐祇耆淇跂枝綦骐只蕲圻锜旗萁蜞埼墘蛴颀懠艩蚔軝藄鄿鯕鬐蚑錤掑岓碕翗釮亓蚧稘鬿踑鮨鶀鵸玂麡濝其期齊奇旗騎祈棋祺碁祁崎琦岐歧琪麒鰭畦臍祇耆淇跂枝綦騏衹蘄圻錡旂萁蜞埼墘蠐頎懠艩蚔軝藄鄿鯕鬐蚑錤掑岓碕翗釮亓蚚稘鬿踑鮨鶀鵸玂麡濝4200A0C5030004004200A0CD03000400
+ㄑㄧˋ企气器汽弃契砌泣迄讫汔憩缉亟葺碛契愒妻蠛鏚盵蚑忔湆气諿湇甈鼜企氣器汽棄契砌泣迄訖汔憩緝亟葺磧栔愒妻蟿鏚盵蚑忔湆气諿湇甈鼜0129800021299000
+ㄑㄧㄚ掐掐
+ㄑㄧㄝ切沏切沏
+ㄑㄧㄠ敲锹橇撬跷硗蹻墝幧繑髜鐰鏒确鄡墽骹庨郻頝敲鍬橇撬蹺磽蹻墝幧繑髜鐰鏒塙鄡墽骹庨郻頝2302023020
+ㄑㄧㄡ秋邱丘蚯秋鳅鶖楸丘萩踽緧媝蓲趥龟恘蝵蟗蠤秋邱丘蚯鞦鰍鶖楸坵萩偢緧媝蓲趥龜恘蝵蟗蠤0248003580
+ㄑㄧㄢ千铅迁签牵谦签嵌仟阡千骞愆佥悭搴褰粁岍汧纤芊掔扦檶剑婜羟攐搴验顩奷忏顅麉櫏千鉛遷簽牽謙籤嵌仟阡韆騫愆僉慳搴褰粁岍汧縴芊掔扦檶鐱婜羥攐攓譣顩奷忏顅麉櫏E78601A400E7C601A600
+ㄑㄧㄣ亲侵钦衾駸嵚綅瀙锓親侵欽衾駸嶔綅瀙鋟521521
+ㄑㄧㄤ枪腔枪羌呛抢锵镪蜣跄斨瑲椌蹡锖矼嶈将牄謒槍腔鎗羌嗆搶鏘鏹蜣蹌斨瑲椌蹡錆矼嶈將牄謒5F2425F242
+ㄑㄧㄥ清青轻倾卿氢蜻顷鲭圊氰狅郬清青輕傾卿氫蜻頃鯖圊氰狅郬CA10CA10
+ㄑㄩˇ取曲娶龋浀紶取曲娶齲浀紶8080
+ㄑㄩˊ渠劬麴衢蟝瞿籧璩氍蘧磲蕖朐軥鸲翑葋豦懅螶鼩匷灈棹臞蠷躣朐斪淭菃翵渠劬麴衢蟝瞿籧璩氍蘧磲蕖朐軥鴝翑葋豦懅螶鼩匷灈欋臞蠷躣胊斪淭菃翵0004080000040880
+ㄑㄩˋ去趣娶漆觑阒湨麮刞鼁去趣娶漆覷闃湨麮刞鼁030030
+ㄑㄩㄝ缺阙蒛缺闕蒛22
+ㄑㄩㄢ圈悛棬弮絟惓圈悛棬弮絟惓
+ㄑㄩㄣ逡踆峮逡踆峮
+ㄑㄩㄥ芎穹銎芎穹銎
+ㄒㄧˇ喜洗徙玺鳃屣蓰囍枲蟢縰纚屣酾匚狶諰簁葸漇敼喜洗徙璽鰓屣蓰囍枲蟢縰纚蹝釃匚狶諰簁葸漇敼810200810300
+ㄒㄧˊ习昔息席惜媳锡袭熄席褶檄觋隰裼嶍螅鳛腊槢焟謵鎴欯棤蒠瘜獥薂霫飁騽蝷習昔息席惜媳錫襲熄蓆褶檄覡隰裼嶍螅鰼腊槢焟謵鎴欯棤蒠瘜獥薂霫飁騽蝷1C01200001C2120000
+ㄒㄧˋ细戏系系系夕汐隙歙阋翕穸咥屭綌肸鄎醯饩滊褉酅舄舄矽鑴卌怬釸鎎釳赩郤熂覤蕮黖謑虩忥恄摡禊齂細戲係系繫夕汐隙歙鬩翕穸咥屭綌肸鄎醯餼滊褉酅潟舄矽鑴卌怬釸鎎釳赩郤熂覤蕮黖謑虩忥恄摡禊齂3020400000071204400000
+ㄒㄧㄚ瞎虾岈颬鍜瞎蝦岈颬鍜2020
+ㄒㄧㄝ些歇蝎蝎猲褉嗋些歇蠍蝎猲褉嗋0040
+ㄒㄧㄠ消销萧潇宵逍嚣箫削硝霄哮骁枭蠨枵魈鴞哓绡嘐歊潇烋獢茧蛸痚憢灱呺穘洨涍痟峭踃膮藃櫹髇毊虈庨啋窙顤呼消銷蕭瀟宵逍囂簫削硝霄哮驍梟蠨枵魈鴞嘵綃嘐歊潚烋獢虓蛸痚憢灱呺穘洨涍痟萷踃膮藃櫹髇毊虈庨啋窙顤謼EC03C4208008EC03C4208008
+ㄒㄧㄡ修休羞修咻庥貅髹馐鸺滫樇臹茠銝莜鎀潃修休羞脩咻庥貅髹饈鵂滫樇臹茠銝蓨鎀潃0038080380
+ㄒㄧㄢ先仙掀鲜纤暹姗孅憸跹銛籼韱枮氙馦嬐仚屳奾锨忺澖灦祆仙嘕蓒褼廯襳珗先仙掀鮮纖暹姍孅憸躚銛秈韱枮氙馦嬐仚屳奾杴忺澖灦祆僊嘕蓒褼廯襳珗85A0010085A00120
+ㄒㄧㄣ心新辛薪欣锌馨鑫莘炘歆芯昕欣鈊盺兟廞忻妡噷心新辛薪欣鋅馨鑫莘炘歆芯昕訢鈊盺兟廞忻妡噷020000020200
+ㄒㄧㄤ乡相香箱湘襄镶厢骧缃芗瓖纕欀葙忀鄉相香箱湘襄鑲廂驤緗薌瓖纕欀葙忀1C701C70
+ㄒㄧㄥ兴星猩腥馨惺騂煋瑆胜垶蛵觲馫興星猩腥馨惺騂煋瑆胜垶蛵觲馫10001000
+ㄒㄩˇ许栩煦咻诩冔姁湑諝醑许珝喣許栩煦咻詡冔姁湑諝醑鄦珝喣11401140
+ㄒㄩˊ徐徐
+ㄒㄩˋ序续蓄绪叙絮旭恤恤酗婿畜洫旮侐慉溆藚顼芧蓣魆勖勖訹鱮烅怴垿窢瞲銊沀煦瞁序續蓄緒敘絮旭恤卹酗婿畜洫旮侐慉漵藚頊芧藇魆勖勗訹鱮烅怴垿窢瞲銊沀昫瞁A10051002A11059002
+ㄒㄩㄝ薛靴噱岙吙薛靴噱嶨吙8080
+ㄒㄩㄢ宣轩喧瑄萱暄埙儇谖埙嬛揎翾喧愃晅鍹鶱梋暖萲愋佡昍鋗媗禤蝖蠉矎宣軒喧瑄萱暄壎儇諼塤嬛揎翾諠愃晅鍹鶱梋煖萲愋佡昍鋗媗禤蝖蠉矎2430800024328000
+ㄒㄩㄣ勋薰熏熏醺峋曛焄獯纁臐蔒勋矄勳薰燻熏醺峋曛焄獯纁臐蔒勛矄10015001
+ㄒㄩㄥ兄凶胸凶匈汹忷哅恟兄兇胸凶匈洶忷哅恟020220
+ㄓㄚˇ眨渣鮓厏苲眨渣鮓厏苲
+ㄓㄚˊ扎札扎闸炸霅铡哳札蚻譗蠿扎札紮閘炸霅鍘哳劄蚻譗蠿840C41
+ㄓㄚˋ榨栅炸诈乍榨蚱咋蜡吒溠砟醡鮓痄簎榨柵炸詐乍搾蚱咋蜡吒溠砟醡鮓痄簎A000A200
+ㄓㄜˇ者赭锗者赭鍺44
+ㄓㄜˊ折哲摺慑褶谪辄摘辙慑蜇磔乇讋晢鮿耴悊砓謺虴鸅讘瓋折哲摺懾褶謫輒摘轍慴蜇磔乇讋晢鮿耴悊砓謺虴鸅讘瓋863000863000
+ㄓㄜˋ这浙蔗鹧柘宅檡烢蟅這浙蔗鷓柘宅檡烢蟅900900
+ㄓㄜ˙着遮晢嫬著遮晢嫬11
+ㄓㄞˇ窄岝窄岝
+ㄓㄞˊ宅翟宅翟
+ㄓㄞˋ债寨祭责瘵砦債寨祭責瘵砦9090
+ㄓㄠˇ找沼爪菬瑵找沼爪菬瑵
+ㄓㄠˊ着著11
+ㄓㄠˋ照赵召罩兆肇诏晁笊棹照雿狣棹箌鵫垗旐曌照趙召罩兆肇詔晁笊櫂炤雿狣棹箌鵫垗旐曌2400024600
+ㄓㄡˇ帚肘睭鯞帚肘睭鯞
+ㄓㄡˊ轴妯軸妯11
+ㄓㄡˋ昼皱宙纣绉胄咒繇甃籀咮酎僽怞胄噣駎晝皺宙紂縐冑咒繇甃籀咮酎僽怞胄噣駎B1000B3000
+ㄓㄢˇ展斩盏辗搌崭盏魙盏颭樿皽蹍嫸榐橏展斬盞輾搌嶄琖魙醆颭樿皽蹍嫸榐橏E610E610
+ㄓㄢˋ占战站暂占栈颤湛绽蹔蘸虥轏輚逼佔戰站暫占棧顫湛綻蹔蘸虥轏輚偡A614B614
+ㄓㄣˇ诊枕疹轸畛袗缜稹紾缜眕缜辴抮抌笉絼祳晸縥黕診枕疹軫畛袗縝稹紾鬒眕黰辴抮抌笉絼祳晸縥黕94A00094A000
+ㄓㄣˋ镇阵振震赈朕枕鸩揕酖眹娠侲挋栚蜄桭誫阵鎮陣振震賑朕枕鴆揕酖眹娠侲挋栚蜄桭誫敶3900439004
+ㄓㄤˇ长掌涨仉鞝長掌漲仉鞝5050
+ㄓㄤˋ丈仗帐障账胀杖涨长幛瘴嶂扙瞕粀丈仗帳障賬脹杖漲長幛瘴嶂扙瞕粀4B104B10
+ㄓㄥˇ整拯氶撜糽整拯氶撜糽
+ㄓㄥˋ郑正证政证症挣帧鄭正證政証症掙幀5D5D
+ㄓㄨˇ主属煮嘱贮渚瞩著麈拄瘃斸砫陼孎壴罜欘泞眝主屬煮囑貯渚矚著麈拄瘃斸砫陼孎壴罜欘泞眝A5000A5000
+ㄓㄨˊ竹筑逐烛蠋筑竺术躅舳轴窋蓫笁趉鱁灟蠾茿篫竹築逐燭蠋筑竺朮躅舳軸窋蓫笁趉鱁灟蠾茿篫88400A8400
+ㄓㄨˋ住著助注祝驻注柱蛀铸炷苎伫箸杼紵翥宁柷羜馵疰莇鉒紸嵀跓軴樦麆櫡殶諔住著助注祝駐註柱蛀鑄炷苧佇箸杼紵翥宁柷羜馵疰莇鉒紸嵀跓軴樦麆櫡殶諔02A10000006A100000
+ㄓㄨㄚ抓挝髽檛抓撾髽檛22
+ㄓㄨㄛ捉桌涿棹穛捉桌涿棹穛
+ㄓㄨㄞ拽拽
+ㄓㄨㄟ追锥椎隹骓鵻腄鴭追錐椎隹騅鵻腄鴭2121
+ㄓㄨㄢ专砖专颛塼鄟鱄剸嫥瑼篿鷒膞蟤專磚耑顓塼鄟鱄剸嫥瑼篿鷒膞蟤F000F000
+ㄓㄨㄣ谆屯肫窀迍宒訰諄屯肫窀迍宒訰1010
+ㄓㄨㄤ装庄桩妆妆庄梉裝莊樁妝粧庄梉D1F1
+ㄓㄨㄥ中钟终忠锺衷忪盅螽忪妐蔠柊煄彸舯炂籦中鐘終忠鍾衷忪盅螽伀妐蔠柊煄彸舯炂籦6100061200
+ㄔㄚˇ蹅蹅
+ㄔㄚˊ查察茶搽槎锸碴臿垞秅查察茶搽槎鍤碴臿垞秅020020
+ㄔㄚˋ诧岔刹差汊衩蜡侘姹紁詫岔剎差汊衩蜡侘奼紁501501
+ㄔㄜˇ扯扯奲扯撦奲02
+ㄔㄜˋ彻澈辙撤掣坼屮迠硩徹澈轍撤掣坼屮迠硩500500
+ㄔㄞˊ柴豺侪夹喍柴豺儕祡喍C0C0
+ㄔㄞˋ虿袃囆蠆袃囆11
+ㄔㄠˇ吵炒眧吵炒眧
+ㄔㄠˊ朝潮巢嘲晁樔轈鄛朝潮巢嘲晁樔轈鄛
+ㄔㄠˋ耖耖
+ㄔㄡˇ丑丑瞅杻杽吜莥丑醜瞅杻杽吜莥0020
+ㄔㄡˊ愁仇筹绸酬稠紬踌畴惆裯俦雠帱鯈薵嬦椆絒菗懤詶雔燽栦愁仇籌綢酬稠紬躊疇惆裯儔讎幬鯈薵嬦椆絒菗懤詶雔燽栦C893000C893000
+ㄔㄡˋ臭簉溴殠憱臭簉溴殠憱
+ㄔㄢˇ产铲阐铲蒇嘽冁丳嵼燀谄骣幝繟滻簅灛旵譂產鏟闡剷蕆嘽囅丳嵼燀諂驏幝繟滻簅灛旵譂F5C00F5C00
+ㄔㄢˊ缠蝉禅馋谗潺蟾巉婵单澶廛孱劖毚瀍瀺躔鑱磛艬僝棎湹鋋煘獑繵嚵酁纏蟬禪饞讒潺蟾巉嬋單澶廛孱劖毚瀍瀺躔鑱磛艬僝棎湹鋋煘獑繵嚵酁F1300000F1300000
+ㄔㄢˋ忏羼馋懺羼儳55
+ㄔㄣˇ捵碜鍖裖墋踸贂捵磣鍖裖墋踸贂2020
+ㄔㄣˊ陈沉晨臣尘辰娠忱沈宸谌煁茞蔯樄莐愖鈂螴麎鷐伔阵陳沉晨臣塵辰娠忱沈宸諶煁茞蔯樄莐愖鈂螴麎鷐伔敶114004114004
+ㄔㄣˋ趁称衬榇谶疢龀嚫藽儭趁稱襯櫬讖疢齔嚫藽儭E50E50
+ㄔㄤˇ场厂敞氅昶鋹場廠敞氅昶鋹3030
+ㄔㄤˊ长常场尝裳偿肠嫦鱨徜尝苌鋿粻長常場嘗裳償腸嫦鱨徜嚐萇鋿粻D6C0D6C0
+ㄔㄤˋ唱倡畅怅鬯韔唱倡暢悵鬯韔C0C0
+ㄔㄥˇ逞骋悜庱塣逞騁悜庱塣2020
+ㄔㄥˊ成程承盛乘诚呈城惩澄橙丞澄枨酲宬晟裎郕埕掁浈珵荿騬脀脭揨峸铖塍成程承盛乘誠呈城懲澄橙丞澂棖酲宬晟裎郕埕掁湞珵荿騬脀脭揨峸鋮塍0212020202130202
+ㄔㄥˋ称秤偁牚稱秤偁牚11
+ㄔㄨˇ处楚储础杵褚楮濋檚處楚儲礎杵褚楮濋檚D00D00
+ㄔㄨˊ除储厨锄橱雏刍躇滁蹰篨锄蜍锄蒢跦鶵幮貙趎犓除儲廚鋤櫥雛芻躇滁躕篨耡蜍鉏蒢跦鶵幮貙趎犓E7A200E7A200
+ㄔㄨˋ处触畜绌矗黜倜怵搐歜诎鄐斶亍豖泏琡踀滀儊臅敊處觸畜絀矗黜俶怵搐歜詘鄐斶亍豖泏琡踀滀儊臅敊B44000B44000
+ㄔㄨㄚ欻欻
+ㄔㄨㄛ戳戳
+ㄔㄨㄟ吹炊吹炊
+ㄔㄨㄢ穿川鐉氚瑏穿川鐉氚瑏
+ㄔㄨㄣ春椿杶輴焞鰆媋暙鶞春椿杶輴焞鰆媋暙鶞
+ㄔㄨㄤ窗创疮囱樽戗摐窗創瘡囪憃戧摐E3E3
+ㄔㄨㄥ充冲冲舂忡憧珫茺浺蹖祌充衝沖舂忡憧珫茺浺蹖祌600600
+ㄕㄚˇ傻繌傻繌
+ㄕㄚˊ啥啥
+ㄕㄚˋ煞霎厦嗄歃箑翣萐喢煞霎廈嗄歃箑翣萐喢400400
+ㄕㄜˇ舍舍捨舍01
+ㄕㄜˊ蛇舌甚佘什揲铊蛇舌甚佘什揲鉈0404
+ㄕㄜˋ社设射涉舍摄赦歙麝厍猞滠蔎韘騇拾叶捑蠂社設射涉舍攝赦歙麝厙猞灄蔎韘騇拾葉捑蠂22A0122A01
+ㄕㄞˇ骰繺骰繺
+ㄕㄞˋ晒晒閷杀曬晒閷殺89
+ㄕㄟˊ谁誰11
+ㄕㄠˇ少少
+ㄕㄠˊ杓韶芍勺玿圴牊杓韶芍勺玿圴牊
+ㄕㄠˋ少绍哨邵召卲劭袑瞧潲少紹哨邵召卲劭袑睄潲201201
+ㄕㄡˇ手首守掱艏手首守掱艏
+ㄕㄡˊ熟熟
+ㄕㄡˋ受售寿兽授瘦狩绶受售壽獸授瘦狩綬C8C8
+ㄕㄢˇ闪陕睒晱覢閃陝睒晱覢3030
+ㄕㄢˋ善扇汕擅膳缮鄯煽讪单赡疝鳝骟禅墠嬗碰摲謆墡钐蟮赶儃善扇汕擅膳繕鄯煽訕單贍疝鱔騸禪墠嬗掞摲謆墡釤蟺赸儃02772E002772E0
+ㄕㄣˇ沈审婶渖谂审矧哂寀瞫邥覾沈審嬸瀋諗讅矧哂寀瞫邥覾E30E30
+ㄕㄣˊ神甚神甚
+ㄕㄣˋ慎肾渗甚蜃沁葚椹脤抻侺鋠慎腎滲甚蜃沁葚椹脤抻侺鋠600600
+ㄕㄤˇ赏晌上賞晌上11
+ㄕㄤˋ上尚爙姠仩上尚爙姠仩
+ㄕㄤ˙裳裳
+ㄕㄥˇ省眚冼箵偗省眚冼箵偗
+ㄕㄥˊ绳渑憴譝鱦溗繩澠憴譝鱦溗3030
+ㄕㄥˋ胜盛圣剩嵊乘剩圣貹勝盛聖剩嵊乘賸圣貹100540
+ㄕㄨˇ数鼠属暑署薯蜀黍癙潻藷钃婌襩糬韣數鼠屬暑署薯蜀黍癙潻藷钃婌襩糬韣50005000
+ㄕㄨˊ叔熟淑塾赎孰菽秫襡埱焂跾鸀虪叔熟淑塾贖孰菽秫襡埱焂跾鸀虪01000100
+ㄕㄨˋ术数树束述署竖疏恕庶曙墅漱倏戍澍翛沭裋鉥尌儵鏣鶐術數樹束述署豎疏恕庶曙墅漱倏戍澍翛沭裋鉥尌儵鏣鶐740000740000
+ㄕㄨㄚ刷唰鮛刷唰鮛
+ㄕㄨㄛ说說11
+ㄕㄨㄞ摔衰縗孈摔衰縗孈
+ㄕㄨㄢ栓闩拴栓閂拴22
+ㄕㄨㄤ双霜孀艭骦鷞孇礵雙霜孀艭驦鷞孇礵1111
+ㄖㄜˇ惹喏若惹喏若
+ㄖㄜˋ热渃熱渃11
+ㄖㄠˇ扰擾11
+ㄖㄠˊ饶荛娆桡蛲襓饒蕘嬈橈蟯襓F1F1
+ㄖㄠˋ绕绕隢繞遶隢33
+ㄖㄡˇ糅鍕粈煣糅鍕粈煣
+ㄖㄡˊ柔揉韖蹂輮楺禸葇鍒鞣騥鶔媃蝚鰇柔揉韖蹂輮楺禸葇鍒鞣騥鶔媃蝚鰇
+ㄖㄡˋ肉肉
+ㄖㄢˇ染冉髯苒珃橪呥姌嫨染冉髯苒珃橪呥姌嫨
+ㄖㄢˊ然燃髯蛅蚺袡然燃髯蛅蚺袡
+ㄖㄣˇ忍稔荏腍棯栠荵忍稔荏腍棯栠荵
+ㄖㄣˊ人任仁壬紝儿芢銋人任仁壬紝儿芢銋
+ㄖㄣˋ任认刃饪赁轫衽纫妊恁仞訒韧牣鵀屻肕軠任認刃飪賃軔衽紉妊恁仞訒韌牣鵀屻肕軠AB010AB010
+ㄖㄤˇ嚷壤攘爙嚷壤攘爙
+ㄖㄤˊ攘禳穰勷瀼瓤儴獽蘘躟鬤蠰攘禳穰勷瀼瓤儴獽蘘躟鬤蠰
+ㄖㄤˋ让懹讓懹11
+ㄖㄥˇ扔扔
+ㄖㄥˊ仍礽陾仍礽陾
+ㄖㄨˇ乳汝辱捣女侞乳汝辱擩女侞8080
+ㄖㄨˊ如儒孺茹蠕嚅濡袽襦鴽筎臑醹挐薷铷曘燸帤蕠如儒孺茹蠕嚅濡袽襦鴽筎臑醹挐薷銣曘燸帤蕠0008000080
+ㄖㄨˋ入辱褥孺茹洳缛蓐溽鄏媷嗕入辱褥孺茹洳縟蓐溽鄏媷嗕040040
+ㄖㄨㄣ犉犉
+ㄗㄚˊ杂咱砸偺雥磼雜咱砸偺雥磼1010
+ㄗㄜˇ怎怎
+ㄗㄜˊ则责择泽啧窄舴咋帻笮赜迮崱萴啧蠌贼蠈則責擇澤嘖窄舴咋幘笮賾迮崱萴謮蠌賊蠈F1541F1541
+ㄗㄜˋ仄侧昃庂稄仄側昃庂稄2020
+ㄗㄞˇ仔宰崽载縡仔宰崽載縡8080
+ㄗㄞˋ在再载在再載44
+ㄗㄟˊ贼賊11
+ㄗㄠˇ早枣澡藻蚤璪缲早棗澡藻蚤璪繰2424
+ㄗㄠˊ凿鑿11
+ㄗㄠˋ造皂燥噪慥噪灶躁皂躁矂造皂燥噪慥譟灶躁皁趮矂000023
+ㄗㄡˇ走走
+ㄗㄡˋ奏骤揍奏驟揍22
+ㄗㄢˇ拶攒寁昝禶喒攒揝礸拶攢寁昝禶喒儹揝礸240240
+ㄗㄢˊ咱偺糌咱偺糌
+ㄗㄢˋ赞暂赞錾瓒攒酇饡灒囋趱贊暫讚鏨瓚欑酇饡灒囋趲F34F34
+ㄗㄣˇ怎怎
+ㄗㄣˋ谮譖11
+ㄗㄤˇ驵駔11
+ㄗㄤˋ藏脏葬奘藏臟葬奘22
+ㄗㄥˋ赠甑贈甑11
+ㄗㄨˇ组祖阻俎诅珇靻組祖阻俎詛珇靻1111
+ㄗㄨˊ足族卒嗾捽崒踿哫傶踤足族卒嗾捽崒踿哫傶踤
+ㄗㄨㄟ堆厜羧嶉纗堆厜羧嶉纗
+ㄗㄨㄢ钻躜鑽躦33
+ㄗㄨㄣ尊遵樽墫鐏嶟繜鷷壿尊遵樽墫鐏嶟繜鷷壿
+ㄗㄨㄥ宗踪纵综棕鬃豵鬃鬷翪熧倧惾猣稯艐隅蝬宗蹤縱綜棕鬃豵騣鬷翪熧倧惾猣稯艐嵕蝬E0001E8001
+ㄘㄚˇ礤礤
+ㄘㄚˋ囃囃
+ㄘㄜˋ册策测侧厕恻厕畟茦粣拺矠憡蓛冊策測側廁惻筴畟茦粣拺矠憡蓛D700D700
+ㄘㄞˇ采彩采睬踩彩踩寀棌婇採彩采睬踩綵跴寀棌婇000160
+ㄘㄞˊ才财材裁才才財材裁纔2021
+ㄘㄞˋ蔡菜埰采縩蔡菜埰采縩
+ㄘㄠˇ草懆草草草懆騲艸0C
+ㄘㄠˊ曹槽嘈漕螬艚嶆曹槽嘈漕螬艚嶆
+ㄘㄠˋ糙操肏襙糙操肏襙
+ㄘㄡˋ凑辏腠楱湊輳腠楱33
+ㄘㄢˇ惨憯朁噆黪慘憯朁噆黲1111
+ㄘㄢˊ残蚕惭嬠殘蠶慚嬠77
+ㄘㄢˋ灿孱璨粲澯燦孱璨粲澯1010
+ㄘㄣˊ岑涔梣笒埁岑涔梣笒埁
+ㄘㄤˊ藏鑶藏鑶
+ㄘㄥˊ曾层嶒鄫碀曾層嶒鄫碀2020
+ㄘㄥˋ蹭蹭
+ㄘㄨˊ殂徂殂徂
+ㄘㄨˋ促醋簇蹴蔟蹙猝卒错趣趋镞瘯踧槭梀噈殧鼀促醋簇蹴蔟蹙猝卒錯趣趨鏃瘯踧槭梀噈殧鼀00D0000D00
+ㄘㄨㄛ搓撮磋蹉蒫遳髊搓撮磋蹉蒫遳髊
+ㄘㄨㄟ摧催崔嗺墔磪鏙榱衰摧催崔嗺墔磪鏙榱衰
+ㄘㄨㄢ撺蹿鋑攛躥鋑33
+ㄘㄨㄣ村皴村皴
+ㄘㄨㄥ匆聪从囱璁瑽枞骢苁鏦熜棇暰葱瞛蟌鍐匆聰從囪璁瑽樅驄蓯鏦熜棇暰蔥瞛蟌鍐EC120EC120
+ㄙㄚˇ洒撒靸洒灑撒靸洒01
+ㄙㄚˋ萨卅趿飒攃馺隡薩卅趿颯攃馺隡9090
+ㄙㄜˋ色塞瑟圾啬涩穑涩轖譅铯璱翜犞飋濏色塞瑟圾嗇澀穡濇轖譅銫璱翜犞飋濏0F400F40
+ㄙㄞˋ赛塞僿賽塞僿11
+ㄙㄠˇ扫嫂埽掃嫂埽11
+ㄙㄠˋ扫臊氉瘙掃臊氉瘙11
+ㄙㄡˇ叟嗾薮擞瞍謏籔叟嗾藪擻瞍謏籔C0C0
+ㄙㄡˋ嗽嗽
+ㄙㄢˇ散伞伞糁鏾散傘繖糝鏾E0E0
+ㄙㄢˋ散閐散閐
+ㄙㄤˇ嗓颡搡磉鎟褬嗓顙搡磉鎟褬2020
+ㄙㄤˋ丧喪11
+ㄙㄨˊ俗俗
+ㄙㄨˋ诉速素肃宿塑夙粟溯餗诉蓿缩觫愫膆谡嗉橚泝涑潇簌蔌樕遫驌鱐鷫嫊玊榡洬栜傃溯憟鋉縤藗僳窣訴速素肅宿塑夙粟溯餗愬蓿縮觫愫膆謖嗉橚泝涑潚簌蔌樕遫驌鱐鷫嫊玊榡洬栜傃溹憟鋉縤藗僳窣9041120000090411200800
+ㄙㄨㄛ缩梭莎唆娑蓑嗦傞挲蓑桫蹜莏趖摍縮梭莎唆娑簑嗦傞挲蓑桫蹜莏趖摍10001200
+ㄙㄨㄟ虽绥濉睢荽毸眭浽哸娞荾滖雖綏濉睢荽毸眭浽哸娞荾滖300300
+ㄙㄨㄢ酸酸狻酸痠狻02
+ㄙㄨㄣ孙飧荪狲搎槂薞蕵孫飧蓀猻搎槂薞蕵D0D0
+ㄙㄨㄥ松松淞嵩忪菘娀崧濍倯硹蜙松鬆淞嵩忪菘娀崧濍倯硹蜙000200
+ㄧㄚˇ亚哑雅掗厊庌蕥雃疋亞啞雅掗厊庌蕥雃疋300300
+ㄧㄚˊ牙芽涯衙蚜押丫犽齖伢堐牙芽涯衙蚜押枒犽齖伢堐040040
+ㄧㄚˋ亚讶迓砑氩娅揠錏聐轧圠襾琊猰窫齾亞訝迓砑氬婭揠錏聐軋圠襾玡猰窫齾33213321
+ㄧㄝˇ也野冶埜漜也野冶埜漜
+ㄧㄝˊ爷耶椰琊揶擨爺耶椰琊揶擨1010
+ㄧㄝˋ业叶页夜咽谒拽靥邺烨瞱擫射晔饁煠鍱鐷澲鎑偞殗嶪擛業葉頁夜咽謁拽靨鄴燁瞱擫射曄饁煠鍱鐷澲鎑偞殗嶪擛7A32007A3200
+ㄧㄞˊ崖睚啀娾崖睚啀娾
+ㄧㄠˇ咬窈舀夭夭杳窅窔鷕宎舀苭眑偠溔榚騕岆嫍蓔咬窈舀夭殀杳窅窔鷕宎抭苭眑偠溔榚騕岆嫍蓔0000001400
+ㄧㄠˊ摇谣尧遥姚洮瑶侥淆肴颻傜繇嶢徭淆猺轺爻垚崤铫珧柼猇鳐肴媱烑窑嗂愮榣顤搖謠堯遙姚洮瑤僥淆餚颻傜繇嶢徭殽猺軺爻垚崤銚珧柼猇鰩肴媱烑窯嗂愮榣顤FC0022220FC2822220
+ㄧㄠˋ要药耀曜钥乐鹞拗耀袎靿艞覞穾筄药獟趭要藥耀曜鑰樂鷂拗燿袎靿艞覞穾筄葯獟趭2708027180
+ㄧㄡˇ有友酉莠牖黝诱泑铕岰庮蒏茇聈槱有友酉莠牖黝羑泑銪岰庮蒏苃聈槱04110411
+ㄧㄡˊ由游游尤油邮犹猷铀輶疣蚰莸斿蝣訧逌楢鱿优沋浟偤秞豆由游遊尤油郵猶猷鈾輶疣蚰蕕斿蝣訧逌楢魷优沋浟偤秞莤06114014611401
+ㄧㄡˋ又右幼诱佑柚釉佑有莠宥侑囿鼬卣侑狖峟貁鴢扰牰迶又右幼誘佑柚釉祐有莠宥侑囿鼬卣姷狖峟貁鴢扰牰迶800000880800
+ㄧㄢˇ眼演掩衍郾偃兖甗俨魇剡弇罨沇巘扊揜渰蝘黶姶戭棪嬿鰋鼹琰匽厣椼抁龑酓嵃愝萒隒裺褗鶠黤曮惔躽馣黭眼演掩衍郾偃兗甗儼魘剡弇罨沇巘扊揜渰蝘黶姶戭棪嬿鰋鼴琰匽厴椼抁龑酓嵃愝萒隒裺褗鶠黤曮惔躽馣黭043000210000043000210000
+ㄧㄢˊ研言颜严延沿炎癌盐岩筵檐阎妍蜒檐埏喦揅碞綖郔岩孍楌礹閰娮铅狿虤顃壛麙壧莚嵒研言顏嚴延沿炎癌鹽岩筵簷閻妍蜒檐埏喦揅碞綖郔巖孍楌礹閰娮鈆狿虤顃壛麙壧莚嵒C011000100C091040100
+ㄧㄢˋ验燕厌晏雁宴淹艳焰彦堰砚咽咽唁餍研宴谚沿谳焱酽赝喭滟焰闫鷃嬿鴳醼焰牪姲燕椻曣恹婩傿雁噞騴觾艳驠莚敥驗燕厭晏雁宴淹豔燄彥堰硯咽嚥唁饜研讌諺沿讞焱釅贗喭灩爓閆鷃嬿鴳醼焰牪姲鷰椻曣懨婩傿鴈噞騴觾艷驠莚敥58A84DA00402058BA6DE084220
+ㄧㄣˇ引饮隐尹瘾蚓听靷紖演讔趛蚓馻鈏檃濦蘟粌引飲隱尹癮蚓听靷紖縯讔趛螾馻鈏檃濦蘟粌6120061210
+ㄧㄣˊ银吟寅淫鄞龈檐霪垠夤狺嚚崟誾蟫婬冘苂釿圁烎凐荶殥蔩檭鷣鏔銀吟寅淫鄞齦檐霪垠夤狺嚚崟誾蟫婬冘苂釿圁烎凐荶殥蔩檭鷣鏔12000001200000
+ㄧㄣˋ印饮隐荫胤荫窨憖湚垽猌朄酳印飲隱蔭胤廕窨憖湚垽猌朄酳E200E200
+ㄧㄤˇ养仰氧痒鞅卬攁岟炴抰痒痒蝆養仰氧癢鞅卬攁岟炴抰痒懩蝆10009080
+ㄧㄤˊ杨阳扬洋羊佯烊疡钖徉扬旸炀垟昜禓蛘瑒珜鐊崵鸉仅婸楊陽揚洋羊佯烊瘍鍚徉颺暘煬垟昜禓蛘瑒珜鐊崵鸉眻婸78D10478D104
+ㄧㄤˋ样养恙漾怏炀瀁挂樣養恙漾怏煬瀁羕3A3A
+ㄧㄥˇ影景颖颍瘿郢瀴矨梬浧影景穎潁癭郢瀴矨梬浧C10C10
+ㄧㄥˊ营迎蝇萤赢盈莹萦瀛荥嬴茔荧楹滢潆籯瀯謍攍巆廮藀營迎蠅螢贏盈瑩縈瀛滎嬴塋熒楹瀅瀠籯瀯謍攍巆廮藀DDAD00DDAD00
+ㄧㄥˋ应硬映媵滢鎣摬賏應硬映媵瀅鎣摬賏1111
+ㄨㄚˇ瓦佤瓦佤
+ㄨㄚˊ娃娃
+ㄨㄚˋ袜嗢腽襪嗢膃55
+ㄨㄛˇ我婐捰我婐捰
+ㄨㄛˋ握卧沃渥斡龌幄涴偓濣焥握臥沃渥斡齷幄涴偓濣焥220220
+ㄨㄞˇ舀舀
+ㄨㄞˋ外外
+ㄨㄟˇ委尾伟纬萎诿苇痿猥炜娓隗娓韪寪洧玮薳蘤韡鲔磈蒍頠暐痒骫椲浘艉芛鍡峗壝喡徫腲蜲儰蓶崣硊踓斖委尾偉緯萎諉葦痿猥煒亹隗娓韙寪洧瑋薳蘤韡鮪磈蒍頠暐痏骫椲浘艉芛鍡峗壝喡徫腲蜲儰蓶崣硊踓斖C6221120000C6621120000
+ㄨㄟˊ为围微危唯维惟违韦薇巍桅闱潍帷嵬帏囗湋溦鄬鍏鮠涠洈覹醀霺瀢濻癓欈為圍微危唯維惟違韋薇巍桅闈濰帷嵬幃囗湋溦鄬鍏鮠潿洈覹醀霺瀢濻癓欈3A1318003A131800
+ㄨㄟˋ为位未魏卫味伪谓胃喂慰喂尉渭畏蔚蘶猬犩遗娓霨磑罻褽秽媦蜼藯鏏菋犚喂贀讆躗稣鮇徻為位未魏衛味偽謂胃喂慰餵尉渭畏蔚蘶蝟犩遺亹霨磑罻褽薉媦蜼藯鏏菋犚餧贀讆躗穌鮇徻1D00A120011D80A12011
+ㄨㄢˇ晚碗挽宛婉娩皖挽莞浣蜿畹菀琬鞔绾晼綩鲩倇脘睕鋄睌葂晚碗挽宛婉娩皖輓莞浣蜿畹菀琬鞔綰晼綩鯇倇脕睕鋄睌葂00084100808410
+ㄨㄢˊ完玩顽丸汍纨芄烷婠岏抏完玩頑丸汍紈芄烷婠岏抏420420
+ㄨㄢˋ万玩腕惋卍玩忨仴綄万蟃捥踠萬玩腕惋卍翫忨仴綄万蟃捥踠00001200
+ㄨㄣˇ稳吻刎呡桽穩吻刎呡桽1010
+ㄨㄣˊ文闻纹蚊玟雯阌炆芠琝閺闅鼤駇魰鳼文聞紋蚊玟雯閿炆芠琝閺闅鼤駇魰鳼64006400
+ㄨㄣˋ问闻紊文汶抆免搵璺妏問聞紊文汶抆免搵璺妏300300
+ㄨㄤˇ往网枉罔惘魍辋瀇网暀菵臦往網枉罔惘魍輞瀇网暀菵臦040240
+ㄨㄤˊ王亡王亡
+ㄨㄤˋ忘妄望旺王望迋莣忘妄望旺王朢迋莣0002
+ㄨㄥˇ蓊滃暡浻瞈聬塕蓊滃暡浻瞈聬塕
+ㄨㄥˋ瓮瓮齆瓮甕瓮齆罋09
+ㄩㄝˋ月越乐悦阅粤跃岳岳耀钥曜药钺说刖瀹龠樾爚礿禴趯軏鸑龠狘玥钺泧钥抈蚎蘥鸙月越樂悅閱粵躍岳嶽耀鑰曜藥鉞說刖瀹籥樾爚礿禴趯軏鸑龠狘玥戉泧鈅抈蚎蘥鸙C74700050C75720050
+ㄩㄢˇ远妴遠妴11
+ㄩㄢˊ原元员园圆缘源援媛袁猿垣沅辕爰圜鼋嫄橼芫湲騵笎羱猿邧蝝妧萲螈螈杬榞溒媴猭獂榬蒝鎱邍鶢原元員園圓緣源援媛袁猿垣沅轅爰圜黿嫄櫞芫湲騵笎羱蝯邧蝝妧萲螈蚖杬榞溒媴猭獂榬蒝鎱邍鶢C3025000000C3025014000
+ㄩㄢˋ院愿怨苑远媛瑗愿掾褑夗謜禐噮院願怨苑遠媛瑗愿掾褑夗謜禐噮01002100
+ㄩㄣˇ允陨殒狁霣褞抎賱輑鈗阭允隕殞狁霣褞抎賱輑鈗阭600600
+ㄩㄣˊ云云匀昀耘芸纭熅筠溳澐畇篔沄熉鋆芸妘传縜荺郧枃眃雲云勻昀耘芸紜熅筠溳澐畇篔沄熉鋆蕓妘伝縜荺鄖枃眃440042540052
+ㄩㄣˋ运韵孕熨蕴愠酝恽晕韫郓蕴檀緷鶤员運韻孕熨蘊慍醞惲暈韞鄆薀枟緷鶤員3FF93FF9
+ㄩㄥˇ永泳咏勇拥踊涌蛹甬壅恿臃俑踊埇塎禜涌悀銢永泳詠勇擁踴湧蛹甬壅恿臃俑踊埇塎禜涌悀銢4100047000
+ㄩㄥˊ佣喁顒傛槦嫆嵱嫞傭喁顒傛槦嫆嵱嫞1010
+ㄩㄥˋ用佣醟用佣醟
+ㄅㄧㄝˇ瘪蛂癟蛂11
+ㄅㄧㄝˊ别蹩咇徶襒蟞別蹩咇徶襒蟞1010
+ㄅㄧㄝˋ别縪彆縪11
+ㄅㄧㄠˇ表表婊裱俵褾檦諘表錶婊裱俵褾檦諘0020
+ㄅㄧㄠˋ鳔鰾11
+ㄅㄧㄢˇ扁贬匾褊窆萹凿碥扁貶匾褊窆萹惼碥2424
+ㄅㄧㄢˋ便变遍辨辩汴辫忭弁采拚缏艑卞揙汳鴘閞便變遍辨辯汴辮忭弁釆抃緶艑卞揙汳鴘閞25E0025E00
+ㄅㄧㄣˋ殡鬓傧摈膑髌鶣殯鬢儐擯臏髕鶣F3F3
+ㄅㄧㄥˇ饼丙禀柄秉炳炳邴怲鞞鉼蛃陃苪窉屏庰餅丙稟柄秉炳昺邴怲鞞鉼蛃陃苪窉屏庰5000054000
+ㄅㄧㄥˋ并病并并摒寎鵧偋並病併并摒寎鵧偋0050
+ㄆㄧㄝˇ撇撇
+ㄆㄧㄠˇ漂莩缥瞟殍皫摽醥熬鷅漂莩縹瞟殍皫摽醥犥鷅401401
+ㄆㄧㄠˊ瓢嫖淲瓢嫖淲
+ㄆㄧㄠˋ票漂剽骠彯篻顠蔈票漂剽驃彯篻顠蔈8080
+ㄆㄧㄢˊ便胼骈谝蹁楩胼便胼駢諞蹁楩骿C0C4
+ㄆㄧㄢˋ片骗遍片騙遍22
+ㄆㄧㄣˇ品品
+ㄆㄧㄣˊ贫濒频颦嫔频频貧瀕頻顰嬪嚬矉F7F7
+ㄆㄧㄣˋ聘牝聘牝
+ㄆㄧㄥˇ絣絣
+ㄆㄧㄥˊ平瓶凭评屏苹萍坪枰泙帡洴瓶軿俜玶甹苹郱呯竮艵蛢冯荓贫炾平瓶憑評屏蘋萍坪枰泙帡洴缾軿俜玶甹苹郱呯竮艵蛢馮荓蓱炾C000082C201082
+ㄇㄧㄝˋ灭蔑蔑篾蠛幭ⅱ搣薎懱瀎礣鱴滅蔑衊篾蠛幭覕搣薎懱瀎礣鱴14005400
+ㄇㄧㄠˇ秒渺藐邈缈杳眇淼杪篎秒渺藐邈緲杳眇淼杪篎010010
+ㄇㄧㄠˊ苗描瞄鱙苗描瞄鱙
+ㄇㄧㄠˋ妙庙缪妙妙廟繆玅6E
+ㄇㄧㄡˋ谬謬11
+ㄇㄧㄢˇ免勉缅冕娩腆湎沔偭眄絻丏俯愐喕鮸免勉緬冕娩靦湎沔偭眄絻丏俛愐喕鮸42014201
+ㄇㄧㄢˊ棉绵眠媔婂蝒櫋矊矏棉綿眠媔婂蝒櫋矊矏200200
+ㄇㄧㄢˋ面面面麵02
+ㄇㄧㄣˇ敏悯闵闽抿泯皿泯愍黾渑笢敃刡僶簢敯潣敏憫閔閩抿泯皿湣愍黽澠笢敃刡僶簢敯潣E0600E8600
+ㄇㄧㄣˊ民岷玟缗痻苠忞旻鈱旼錉罠閺怋崏暋民岷玟緡痻苠忞旻鈱旼錉罠閺怋崏暋80008000
+ㄇㄧㄥˇ眳姳慏眳姳慏
+ㄇㄧㄥˊ明名鸣铭螟冥瞑暝茗酩溟蓂鄍洺榠嫇覭詺熐明名鳴銘螟冥瞑暝茗酩溟蓂鄍洺榠嫇覭詺熐C0000C0000
+ㄇㄧㄥˋ命暝命暝
+ㄈㄧㄠˋ覅覅
+ㄈㄨㄥˋ甮甮
+ㄉㄧㄝˊ跌蝶谍碟叠迭牒喋瓞耋绖咥垤堞蝶蹀鲽跕昳峌挕胅苵眣聑臷詄镻艓褋惵楪嶀跌蝶諜碟疊迭牒喋瓞耋絰咥垤堞蜨蹀鰈跕昳峌挕胅苵眣聑臷詄镻艓褋惵楪嶀414010000414410000
+ㄉㄧㄠˇ屌屌
+ㄉㄧㄠˋ调掉钓吊吊窵蓧誂伄魡調掉釣吊弔窵蓧誂伄魡500510
+ㄉㄧㄢˇ点典碘錪婰琠蕇點典碘錪婰琠蕇1010
+ㄉㄧㄢˋ电店殿甸奠垫淀惦靛佃淀玷钿簟坫痁癜磹阽扂婝踮壂電店殿甸奠墊澱惦靛佃淀玷鈿簟坫痁癜磹阽扂婝踮壂120100160100
+ㄉㄧㄥˇ顶鼎酊嵿濎薡頂鼎酊嵿濎薡1010
+ㄉㄧㄥˋ定订钉锭碇飣娗碇掟碠顁萣啶定訂釘錠碇飣娗椗掟碠顁萣啶E000E800
+ㄉㄨㄛˇ躲朵埵垛嚲鬌恫趓躲朵埵垛嚲鬌痑趓0404
+ㄉㄨㄛˊ夺铎多掇裰剟敪椯剫敓莌毲腏鮵襗奪鐸多掇裰剟敪椯剫敓莌毲腏鮵襗30003000
+ㄉㄨㄛˋ惰堕舵跺剁咄踱驮垛墯嶞柮陏陊度炫貀鵽惰墮舵跺剁咄踱馱垛墯嶞柮陏陊度袉貀鵽2808028080
+ㄉㄨㄟˋ对队兑碓怼憝濧薱轛濻瀩憝對隊兌碓懟譈濧薱轛濻瀩憝710730
+ㄉㄨㄢˇ短短
+ㄉㄨㄢˋ段断缎锻毈腶簖椴葭碫躖段斷緞鍛毈腶籪椴葮碫躖E41E41
+ㄉㄨㄣˇ盹趸盹躉22
+ㄉㄨㄣˋ顿吨盾钝遁盹炖沌囤遁炖坉扽伅庉潡崸鶨腞頓噸盾鈍遁盹燉沌囤遯炖坉扽伅庉潡崸鶨腞B0000B4200
+ㄉㄨㄥˇ懂董嬞墥懂董嬞墥
+ㄉㄨㄥˋ动洞冻栋恫胴挏戙駧霘動洞凍棟恫胴挏戙駧霘D00D00
+ㄊㄧㄝˇ铁帖驖僭鐵帖驖僣99
+ㄊㄧㄝˋ帖餮蛈帖餮蛈
+ㄊㄧㄠˇ挑窕誂宨嬥挑窕誂宨嬥
+ㄊㄧㄠˊ条调笤佻迢蜩髫岧苕龆鲦鞗芀鎥趒祒條調笤佻迢蜩髫岧苕齠鰷鞗芀鎥趒祒30603060
+ㄊㄧㄠˋ跳眺粜朓眺俯絩窱脁跳眺糶朓覜頫絩窱脁420430
+ㄊㄧㄢˇ舔忝殄腆腆淟餂賟惊蚕晪痶舔忝殄腆靦淟餂賟悿蚕晪痶001011
+ㄊㄧㄢˊ田甜填恬阗畋填沺盷湉菾磌田甜填恬闐畋窴沺盷湉菾磌010050
+ㄊㄧㄢˋ掭煔瑱掭煔瑱
+ㄊㄧㄥˇ挺艇町梃頲璇脡铤烶圢侹挺艇町梃頲珽脡鋌烶圢侹0A00A0
+ㄊㄧㄥˊ停庭廷亭蜓霆婷渟莛朾筳蝏聤葶鼮楟榳閮嵉綎停庭廷亭蜓霆婷渟莛朾筳蝏聤葶鼮楟榳閮嵉綎
+ㄊㄧㄥˋ听聽11
+ㄊㄨㄛˇ妥椭撱庹嫷妥橢撱庹嫷2020
+ㄊㄨㄛˊ驼陀驮沱佗鸵跎橐坨紽酡砣陀鮀岮砣鞴驒鼍铊炫飥駝陀馱沱佗鴕跎橐坨紽酡砣阤鮀岮碢鞁驒鼉鉈袉飥5200D15209D1
+ㄊㄨㄛˋ拓唾柝箨蘀跅毻毤拓唾柝籜蘀跅毻毤8080
+ㄊㄨㄟˇ腿俀腿俀
+ㄊㄨㄟˊ颓颓颓魋橔僓蹪弚頹穨隤魋橔僓蹪弚7070
+ㄊㄨㄟˋ退蜕駾螁退蛻駾螁22
+ㄊㄨㄢˊ团抟团漙剸慱鏄鷻槫團摶糰漙剸慱鏄鷻槫700700
+ㄊㄨㄢˋ彖褖彖褖
+ㄊㄨㄣˇ汆吨疃汆吨畽44
+ㄊㄨㄣˊ屯囤豚饨臀軘魨忳芚吨拵屯囤豚飩臀軘魨忳芚吨拵800800
+ㄊㄨㄣˋ褪螁褪螁
+ㄊㄨㄥˇ统筒桶捅垌筒姛統筒桶捅垌筩姛1012
+ㄊㄨㄥˊ同童铜桐潼瞳彤佟僮峒侗艟曈膧穜罿硐橦氃獞茼烔浵鉖餇仝酮迵粡絧朣犝蕫鮦鼨爞哃詷同童銅桐潼瞳彤佟僮峒侗艟曈膧穜罿硐橦氃獞茼烔浵鉖餇仝酮迵粡絧朣犝蕫鮦鼨爞哃詷40000000004000000000
+ㄊㄨㄥˋ痛同恸蘳痛衕慟蘳66
+ㄋㄧㄝˊ苶苶
+ㄋㄧㄝˋ孽镍蹑聂镊涅嗫啮臬乜啮臲闑陧啮敜颞糱蘖疌嵲踂篞櫱蠥钀巕孽鎳躡聶鑷涅囁囓臬乜嚙臲闑隉齧敜顳糱蘗疌嵲踂篞櫱蠥钀巕ED46500ED46500
+ㄋㄧㄠˇ鸟袅嬲袅袅茑袅鳥裊嬲嬝嫋蔦褭B7B7
+ㄋㄧㄠˋ尿尿
+ㄋㄧㄡˇ纽扭钮忸狃炄莥紐扭鈕忸狃炄莥5050
+ㄋㄧㄡˊ牛牛
+ㄋㄧㄡˋ拗拗
+ㄋㄧㄢˇ捻捻撵拈辇碾辗涊簐跈躎鲶捻撚攆拈輦碾輾涊簐跈躎鯰458658
+ㄋㄧㄢˊ年黏粘姩哖年黏粘姩哖
+ㄋㄧㄢˋ念念淰齞廿鼰念唸淰齞廿鼰0020
+ㄋㄧㄣˇ拰拰
+ㄋㄧㄣˊ您您
+ㄋㄧㄤˊ娘娘娘孃02
+ㄋㄧㄤˋ酿釀11
+ㄋㄧㄥˇ拧擰11
+ㄋㄧㄥˊ宁凝狞咛柠甯拧鸋鑏寍聍嬣寧凝獰嚀檸甯擰鸋鑏寍聹嬣D54D54
+ㄋㄧㄥˋ泞佞濘佞11
+ㄋㄨㄛˇ橠橠
+ㄋㄨㄛˊ挪娜傩捼梛挪娜儺捼梛4040
+ㄋㄨㄛˋ诺懦糯搦挪逽懧糑諾懦糯搦挼逽懧糑1111
+ㄋㄨㄢˇ暖餪暖渜暖餪煖渜04
+ㄋㄨㄥˊ农浓脓侬哝秾襛醲齈鬞農濃膿儂噥穠襛醲齈鬞F30F30
+ㄋㄨㄥˋ弄弄
+ㄋㄩㄝˋ虐疟谑虐瘧謔66
+ㄌㄧㄚˇ俩倆11
+ㄌㄧㄝˇ咧咧
+ㄌㄧㄝˋ列烈劣裂猎捩冽鬣躐洌茢睙擸趔姴迾脟蛚蛶颲儠鮤鴷犣列烈劣裂獵捩冽鬣躐洌茢睙擸趔姴迾脟蛚蛶颲儠鮤鴷犣010000010000
+ㄌㄧㄠˇ了了蓼樽钌暸鄝蟟了瞭蓼憭釕暸鄝蟟81A1
+ㄌㄧㄠˊ聊寮辽疗寥撩僚燎潦嘹缭镣嫽獠鹩屪鹨膋漻摎豂嵺憀嶚敹窷膫簝镽飂飉顟聊寮遼療寥撩僚燎潦嘹繚鐐嫽獠鷯屪鷚膋漻摎豂嵺憀嶚敹窷膫簝镽飂飉顟C0C41000C0C41000
+ㄌㄧㄠˋ廖料了燎尥撂炓蟉窲廖料瞭燎尥撂炓蟉窲400400
+ㄌㄧㄡˇ柳绺罶铆飹珋柳綹罶鉚飹珋A0A0
+ㄌㄧㄡˊ刘流留硫琉榴浏瘤遛旒骝鏐飀鶹懰鎏镏媹嬼嵧藰裗麍鷎蓅鰡巯劉流留硫琉榴瀏瘤遛旒騮鏐飀鶹懰鎏鎦媹嬼嵧藰裗麍鷎蓅鰡巰14401041440104
+ㄌㄧㄡˋ六陆溜馏溜坴翏雡廇塯遛六陸溜餾霤坴翏雡廇塯蹓A04A14
+ㄌㄧㄢˇ脸鄻膦摙僆羷臉鄻膦摙僆羷1010
+ㄌㄧㄢˊ连联怜廉莲涟帘镰鲢奁琏帘裢嗹镰鬑溓蠊槤縺謰覝磏濂翴薕蹥譧奱嬚連聯憐廉蓮漣簾鐮鰱奩璉帘褳嗹鎌鬑溓蠊槤縺謰覝磏濂翴薕蹥譧奱嬚7B7500007F750000
+ㄌㄧㄢˋ练鍊恋炼链殓敛潋楝裣湅澰蔹敛莶萰堜練鍊戀煉鏈殮斂瀲楝襝湅澰蘞歛薟萰堜DF270DF270
+ㄌㄧㄣˇ凛懔廪檩菻亃綝榃凜懍廩檁菻亃綝榃F0F0
+ㄌㄧㄣˊ林临邻淋鳞麟霖磷琳遴嶙磷璘粼辚潾麻疄瞵惏暽罧驎碄箖甐繗僯翷躏壣鏻林臨鄰淋鱗麟霖磷琳遴嶙燐璘粼轔潾痳疄瞵惏暽罧驎碄箖甐繗僯翷蹸壣鏻6104100261841002
+ㄌㄧㄣˋ吝躏蔺赁橉閵焛吝躪藺賃橉閵焛E0E0
+ㄌㄧㄤˇ两俩魉緉裲兩倆魎緉裲7070
+ㄌㄧㄤˊ良梁量粮凉粱梁椋綡輬踉駺良梁量糧涼粱樑椋綡輬踉駺810850
+ㄌㄧㄤˋ量亮谅辆喨晾凉唡踉湸悢量亮諒輛喨晾涼啢踉湸悢CC0CC0
+ㄌㄧㄥˇ领岭伶領嶺彾77
+ㄌㄧㄥˊ零玲灵铃龄陵凌菱聆羚苓伶绫淩翎令囹蛉瓴泠舲酃軨錂棂柃棂睖砱詅輘霝鲮醽岭昤澪呬坽夌姈狑皊呤琌笭裬蘦怜婈駖蕶爧堎零玲靈鈴齡陵凌菱聆羚苓伶綾淩翎鴒囹蛉瓴泠舲酃軨錂櫺柃欞睖砱詅輘霝鯪醽岭昤澪呬坽夌姈狑皊呤琌笭裬蘦怜婈駖蕶爧堎C1090050100000C1090050100000
+ㄌㄧㄥˋ令另炩令另炩
+ㄌㄨㄛˇ裸瘰裸蠃蓏鎯裸瘰臝蠃蓏鎯0040
+ㄌㄨㄛˊ罗螺萝锣逻箩骡罗猡罗覶摞椤蔂镙鸁剆羅螺蘿鑼邏籮騾囉玀儸覶摞欏蔂鏍鸁剆DF350DF350
+ㄌㄨㄛˋ落骆洛络雒烙酪泺荦咯珞纙袼硌鮥鵅峈落駱洛絡雒烙酪濼犖咯珞纙袼硌鮥鵅峈A8100A8100
+ㄌㄨㄢˇ卵卵
+ㄌㄨㄢˊ峦銮鸾滦脔栾栾曫羉癵巒鑾鸞灤臠圞欒曫羉癵F70F70
+ㄌㄨㄢˋ乱薍亂薍11
+ㄌㄨㄣˇ稐稐
+ㄌㄨㄣˊ伦论轮沦仑仑纶抡囵碖錀惀陯菕踚棆蜦倫論輪淪崙侖綸掄圇碖錀惀陯菕踚棆蜦FF100FF100
+ㄌㄨㄣˋ论溣論溣11
+ㄌㄨㄥˇ陇拢垄隴攏壟77
+ㄌㄨㄥˊ龙隆笼咙聋珑胧窿泷癃栊砻曨巃胧茏躘豅鏧鑨靇蠪襱鸗儱龒蠬龍隆籠嚨聾瓏朧窿瀧癃櫳礱曨巃矓蘢躘豅鏧鑨靇蠪襱鸗儱龒蠬D7DC000D7DC000
+ㄌㄨㄥˋ弄哢徿榔衖哢徿梇99
+ㄌㄩㄝˋ略掠锊撂擽略掠鋝撂擽4040
+ㄌㄩㄢˇ娈孌11
+ㄌㄩㄢˊ挛孪攣孿33
+ㄍㄨㄚˇ寡剐寡剮22
+ㄍㄨㄚˋ挂卦褂罫罣絓诖挂髺掛卦褂罫罣絓詿挂髺040140
+ㄍㄨㄛˇ果裹椁蜾锅粿猓淉惝鐹锞果裹槨蜾輠粿猓淉惈鐹錁415415
+ㄍㄨㄛˊ国帼虢馘掴馘膕漍慖簂國幗虢馘摑聝膕漍慖簂310330
+ㄍㄨㄛˋ过過11
+ㄍㄨㄞˇ拐柺拐拐柺枴04
+ㄍㄨㄞˋ怪旝夬廥癐怪旝夬廥癐
+ㄍㄨㄟˇ鬼轨诡癸匦晷宄簋佹垝氿姽蟡庪祪蛫觤厬鬼軌詭癸匭晷宄簋佹垝氿姽蟡庪祪蛫觤厬6100061000
+ㄍㄨㄟˋ贵桂柜跪刿溎鳜昋炔筀柜嶡襘暩貴桂櫃跪劌溎鱖昋炔筀柜嶡襘暩15005500
+ㄍㄨㄢˇ管馆莞琯管脘痯錧管館莞琯筦脘痯錧2021
+ㄍㄨㄢˋ惯贯灌罐掼盥鹳冠观丱欢瓘祼矔罐涫悺悹雚鱹慣貫灌罐摜盥鸛冠觀丱爟瓘祼矔鑵涫悺悹雚鱹3550035540
+ㄍㄨㄣˇ滚衮鲧绲辊掍蔉滾袞鯀緄輥掍蔉F1F1
+ㄍㄨㄣˋ棍璭棍璭
+ㄍㄨㄤˇ广犷廣獷33
+ㄍㄨㄤˋ逛桄臩臦矌逛桄臩臦矌
+ㄍㄨㄥˇ巩拱汞共珙矿栱廾拲蛬穬鞏拱汞共珙礦栱廾拲蛬穬120120
+ㄍㄨㄥˋ共供贡羾扛共供貢羾摃4141
+ㄎㄨㄚˇ垮侉銙垮侉銙
+ㄎㄨㄚˋ跨胯胯跨胯骻04
+ㄎㄨㄛˇ擃擃
+ㄎㄨㄛˋ括扩阔廓鞹漷蛞姡霩籗括擴闊廓鞹漷蛞姡霩籗600600
+ㄎㄨㄞˇ蒯蒯
+ㄎㄨㄞˋ快块会筷桧刽郐浍脍哙狯侩脍駃鬠欳快塊會筷檜劊鄶澮膾噲獪儈鱠駃鬠欳6FF16FF1
+ㄎㄨㄟˇ傀跬頍煃踯峞傀跬頍煃蹞峞0101
+ㄎㄨㄟˊ魁睽奎揆葵逵戣夔騤暌鄈頯聧楏櫆湀馗楑犪躨魁睽奎揆葵逵戣夔騤暌鄈頯聧楏櫆湀馗楑犪躨
+ㄎㄨㄟˋ愧溃匮馈馈喟篑愧聩愦箦蒉瞶槶樻柜嘳撌騩硊蔮愧潰匱饋餽喟簣媿聵憒簀蕢瞶槶樻鐀嘳撌騩硊蔮E5F800EDF800
+ㄎㄨㄢˇ款窾梡款窾梡
+ㄎㄨㄣˇ捆困悃捆阃壼稛硱裍齫捆綑悃梱閫壼稛硱裍齫210A10
+ㄎㄨㄣˋ困困涃困睏涃02
+ㄎㄨㄤˇ俇俇
+ㄎㄨㄤˊ狂诳鵟狂誑鵟22
+ㄎㄨㄤˋ况矿旷框眶邝贶圹纩纩懭爌彉況礦曠框眶鄺貺壙纊絖懭爌彉7E307E30
+ㄎㄨㄥˇ恐孔倥恐孔倥
+ㄎㄨㄥˋ空控鞚空控鞚
+ㄏㄨㄚˊ华滑划猾哗哗桦骅铧豁划崋釫螖華滑划猾譁嘩樺驊鏵豁劃崋釫螖1F101F50
+ㄏㄨㄚˋ话化画划桦华嫿摦崋嬅杹觟槬繣澅話化畫劃樺華嫿摦崋嬅杹觟槬繣澅D300D300
+ㄏㄨㄛˇ火伙夥钬火伙夥鈥88
+ㄏㄨㄛˊ活佸钬萿活佸鈥萿44
+ㄏㄨㄛˋ或获获和惑祸霍货豁壑蠖嚄藿镬矱檴濩砉雘硅擭湱騞謋捇沎眓掝嗀嗀瓁臒攉瀖曤矐韄霍或穫獲和惑禍霍貨豁壑蠖嚄藿鑊矱檴濩砉雘硅擭湱騞謋捇沎眓掝嗀嗀瓁臒攉瀖曤矐韄靃6A020000006A02000002
+ㄏㄨㄛ˙和和
+ㄏㄨㄞˊ怀淮徊槐踝徊怀褢褱槐瀤懷淮徊槐踝佪怀褢褱櫰瀤000122
+ㄏㄨㄞˋ坏坏諙孬咶蘹蘾壞坏諙孬咶蘹蘾0010
+ㄏㄨㄟˇ会悔诲毁毁贿虺虫烠毇檓毁會悔誨毀燬賄虺虫烠毇檓譭D38D38
+ㄏㄨㄟˊ回回蛔茴蚘洄痐恛藱回迴蛔茴蚘洄痐恛藱000200
+ㄏㄨㄟˋ会惠汇绘慧汇秽诲贿晦彗讳溃卉蕙豁烩喙恚荟翽闠嘒槥篲缋繐蟪璯嬇惠潓瞺譓譿鏸橞廆詴圚蔧獩餯鐬饖卉禬襘會惠匯繪慧彙穢誨賄晦彗諱潰卉蕙濊燴喙恚薈翽闠嘒槥篲繢繐蟪璯嬇憓潓瞺譓譿鏸橞廆詴圚蔧獩餯鐬饖芔禬襘DE9990200000DE9990240002
+ㄏㄨㄢˇ缓皖浣睆輐緩皖澣睆輐5050
+ㄏㄨㄢˊ还环桓圜缳鬟锾钚寰闤梡洹瓛貆澴荁萑肒捖羦懁豲嬛狟雈還環桓圜繯鬟鍰鐶寰闤梡洹瓛貆澴荁萑肒捖羦懁豲嬛狟雈3D000003D00000
+ㄏㄨㄢˋ换唤宦患幻焕奂涣痪豢梡逭擐漶垸轘瑍觨欢瞣換喚宦患幻煥奐渙瘓豢梡逭擐漶垸轘瑍觨嚾瞣3E1043E104
+ㄏㄨㄣˇ混睔混睔
+ㄏㄨㄣˊ魂浑馄混珲楎餫棞诨鼲繉轋魂渾餛混琿楎餫棞顐鼲繉轋611611
+ㄏㄨㄣˋ混浑溷诨圂慁辊倱梡混渾溷諢圂慁輥倱梡A40A40
+ㄏㄨㄤˇ谎恍晃幌洸恍榥熀鎤滉皝謊恍晃幌洸怳榥熀鎤滉皝100120
+ㄏㄨㄤˊ黄徨惶簧璜磺蝗煌皇凰湟遑隍潢篁喤艎鍠煌韹鳇堭蟥偟穔鷬媓騜崲葟餭撗獚趪黃徨惶簧璜磺蝗煌皇凰湟遑隍潢篁喤艎鍠熿韹鰉堭蟥偟穔鷬媓騜崲葟餭撗獚趪100001000100041000
+ㄏㄨㄤˋ晃軦晃軦
+ㄏㄨㄥˇ哄嗊哄嗊
+ㄏㄨㄥˊ红洪宏鸿虹弘泓讧鋐闳黉竑紘翃浤鞃灴荭耾仜汯竤鈜霟妅玒谹渱舼触谼篊彋瓨苰紅洪宏鴻虹弘泓訌鋐閎黌竑紘翃浤鞃灴葒耾仜汯竤鈜霟妅玒谹渱舼触谼篊彋瓨苰986020000986020000
+ㄏㄨㄥˋ哄汞澒蕻鍙鬨汞澒蕻鍙1010
+ㄐㄧㄚˇ假甲贾钾岬胛斝榎瘕檟婽玾徦椵夏假甲賈鉀岬胛斝榎瘕檟婽玾徦椵夏C000C000
+ㄐㄧㄚˊ夹挟颊蛱荚浃戛郏恝袷厕夹铗梜跲舺唊铪硈扴鞂鞈鵊夾挾頰蛺莢浹戛郟恝袷筴裌鋏梜跲舺唊鉿硈扴鞂鞈鵊FBC120FBC120
+ㄐㄧㄚˋ价假架驾嫁贾稼价價假架駕嫁賈稼价8292
+ㄐㄧㄝˇ姐解姊檞媎姐解姊檞媎
+ㄐㄧㄝˊ节洁杰捷竭劫截结杰颉诘桀睫讦咭拮羯栉桔孑疖洁偈撷倢劼婕楬碣鲒岜榤犵夹砀栨騔滐鉣锲衱迼崨嵥楶趌踕擳瀄鍻蠽昅揤緁巀緳節潔傑捷竭劫截結杰頡詰桀睫訐咭拮羯櫛桔孑癤絜偈擷倢劼婕楬碣鮚岊榤犵袺嵑栨騔滐鉣鐑衱迼崨嵥楶趌踕擳瀄鍻蠽昅揤緁巀緳38622B0668000078622B06680000
+ㄐㄧㄝˋ界借介戒藉届疥芥诫解唶喈玠蚧犗褯吤岕价砎悈紒祴躤繲界借介戒藉屆疥芥誡解唶喈玠蚧犗褯吤岕价砎悈紒祴躤繲02100000210000
+ㄐㄧㄠˇ脚角缴搅剿矫绞姣佼饺皎侥剿较铰狡皦侥筊蟜摷挢捁灚曒漅剿譑煍腳角繳攪勦矯絞姣佼餃皎僥剿較鉸狡皦儌筊蟜摷撟捁灚曒漅劋譑煍D6A62200D7A62240
+ㄐㄧㄠˊ嚼嚼
+ㄐㄧㄠˋ教叫校较觉轿窖皭醮徼噭峤挍斠珓釂滘窌嘂潐譥教叫校較覺轎窖皭醮徼噭嶠挍斠珓釂滘窌嘂潐譥838000838000
+ㄐㄧㄡˇ九久酒玖赳灸韭纠九久酒玖赳灸韭糾0808
+ㄐㄧㄡˋ就究救旧舅臼柩疚咎僦鹫厩救慦鯦麔就究救舊舅臼柩疚咎僦鷲廄捄慦鯦麔80C080C1
+ㄐㄧㄢˇ简捡剪减检拣茧俭硷柬笕翦謇戬蹇谫趼碱囝鰔挸湕睑寋藆襺暕瑐簡撿剪減檢揀繭儉鹼柬筧翦謇戩蹇譾趼堿囝鰔挸湕瞼寋藆襺暕瑐BF5A240BF5A240
+ㄐㄧㄢˋ见建健渐件间监键鉴箭剑舰鉴贱践谏毽荐饯腱溅僭槛闲洊俴牮栫楗珔瀳涧瞷荐諓榗糋鰎蔪鋻螹裥糮键見建健漸件間監鍵鑑箭劍艦鑒賤踐諫毽薦餞腱濺僭檻閒洊俴牮栫楗珔瀳澗瞷荐諓榗糋鰎蔪鋻螹襉糮鑳9EDF4D0800A9EDF6D0800A
+ㄐㄧㄣˇ紧仅锦谨尽觐瑾馑槿墐殣堇慬菫卺緊僅錦謹儘覲瑾饉槿墐殣堇慬菫巹FB04FB04
+ㄐㄧㄣˋ进近尽禁晋尽浸劲觐烬廑噤靳缙仅荩妗赆浸搢肵璡賮嬧榗僸蓳瘽嚍濜璶伒溍進近盡禁晉儘浸勁覲燼廑噤靳縉僅藎妗贐寖搢肵璡賮嬧榗僸蓳瘽嚍濜璶伒溍5B3E200005B3E60000
+ㄐㄧㄤˇ讲奖蒋桨顜膙講獎蔣槳顜膙F0F0
+ㄐㄧㄤˋ降匠酱强将绛糨洚謽嵹强弶袶降匠醬強將絳糨洚謽嵹彊弶袶C340C340
+ㄐㄧㄥˇ景警井颈阱儆璟憬刭璥丼烃憼暻蟼燛景警井頸阱儆璟憬剄璥丼烴憼暻蟼燛80908090
+ㄐㄧㄥˋ敬竟镜静境净竞迳径靖劲凊胫痉獍倞靓竫婧桱俓净葝擎弪敬竟鏡靜境淨競逕徑靖勁凊脛痙獍倞靚竫婧桱俓凈葝擏弳CE531A1CE531A1
+ㄐㄩㄝˇ蹶蹶
+ㄐㄩㄝˊ决觉绝爵掘嚼诀厥獗蹶蕨崛攫倔炔抉噱矍觖角孓珏劂橛爝谲屩觼玦脚臄蕝躩戄桷潏觖貜趹鳜傕砀瘚蠼鐍镢蠼捔芵焆鈌蚗谻赽僪憰蟨彏鱊鷢堀殌穱決覺絕爵掘嚼訣厥獗蹶蕨崛攫倔炔抉噱矍觖角孓玨劂橛爝譎屩觼玦腳臄蕝躩戄桷潏鴃貜趹鱖傕嵑瘚蠼鐍钁玃捔芵焆鈌蚗谻赽僪憰蟨彏鱊鷢堀殌穱74000222082200007400022209260000
+ㄐㄩㄝˋ倔倔
+ㄐㄩㄢˇ卷卷埢菤臇捲卷埢菤臇0010
+ㄐㄩㄢˋ倦卷眷绢隽悁狷圈狷睊眷罥鄄帣锩腃韏鬳倦卷眷絹雋悁狷圈獧睊睠罥鄄帣錈腃韏鬳8104081540
+ㄐㄩㄣˇ窘蜠窘蜠
+ㄐㄩㄣˋ俊菌郡峻竣隽浚骏蕈浚珺畯焌捃餕箘寯晙呁鵘葰蔨俊菌郡峻竣雋濬駿蕈浚珺畯焌捃餕箘寯晙呁鵘葰蔨0A00000E0000
+ㄐㄩㄥˇ窘迥煚泂炅絅褧冏熲囧睽炯幜顈窘迥煚泂炅絅褧冏熲囧皛炯幜顈00400040
+ㄑㄧㄚˇ卡酠卡酠
+ㄑㄧㄚˋ恰洽帢愘殎恰洽帢愘殎
+ㄑㄧㄝˇ且且
+ㄑㄧㄝˊ茄伽癿茄伽癿
+ㄑㄧㄝˋ切窃妾怯惬挈箧锲契朅踥鯜蛪緀藒洯切竊妾怯愜挈篋鍥契朅踥鯜蛪緀藒洯2D002D00
+ㄑㄧㄠˇ巧悄愀鹊雀燋頝巧悄愀鵲雀燋頝8080
+ㄑㄧㄠˊ桥瞧侨乔樵翘憔荞礄谯簥趫燆劁嘺嫶趬敿橋瞧僑喬樵翹憔蕎礄譙簥趫燆劁嘺嫶趬敿DA200DA200
+ㄑㄧㄠˋ翘窍俏峭鞘诮撬跷壳帩撽躈翹竅俏峭鞘誚撬蹺殼帩撽躈3A13A1
+ㄑㄧㄡˇ糗糗
+ㄑㄧㄡˊ求球囚仇酋裘遒球泅鰽逑俅厹球絿艽虬蝤觩赇盚銶頄鼽訄犰朹梂釚煪苬紌脙莍崷僋蛷鮂鯄殏求球囚仇酋裘遒毬泅鰽逑俅厹璆絿艽虯蝤觩賕盚銶頄鼽訄犰朹梂釚煪苬紌脙莍崷僋蛷鮂鯄殏00009000000802900000
+ㄑㄧㄢˇ遣浅谴缱槏撖忏蜸遣淺譴繾槏撖忏蜸E0E0
+ㄑㄧㄢˊ前钱乾潜黔钳虔箝钤掮媊揵燂钳鬵灊黚忴扲岒干葥鳹騚鰬仱姏蚙軡榩前錢乾潛黔鉗虔箝鈐掮媊揵燂拑鬵灊黚忴扲岒漧葥鳹騚鰬仱姏蚙軡榩A2120100A2120100
+ㄑㄧㄢˋ欠歉倩慊茜堑芡傔嗛椠纤篟綪棈茜輤欠歉倩慊茜塹芡傔嗛槧縴篟綪棈蒨輤02600264
+ㄑㄧㄣˇ寝昑实曋螼坅顉寢昑寑曋螼坅顉5050
+ㄑㄧㄣˊ勤琴秦禽擒芹檎勤噙芩螓鈙嫀斳耹靲澿庈肣蚙軡雂勤琴秦禽擒芹檎懃噙芩螓鈙嫀斳耹靲澿庈肣蚙軡雂000000080000
+ㄑㄧㄣˋ沁揿吣菣沁撳唚菣66
+ㄑㄧㄤˇ强抢襁磢傸墏襁強搶襁磢傸墏繈3034
+ㄑㄧㄤˊ强墙蔷戕墙嫱樯爿漒蔷廧强強牆薔戕墻嬙檣爿漒蘠廧彊77A77A
+ㄑㄧㄤˋ呛羻唴炝跄嗆羻唴熗蹌9191
+ㄑㄧㄥˇ请顷廎請頃廎33
+ㄑㄧㄥˊ情晴擎倾檠勍殑樈殌情晴擎傾檠勍殑樈殌800800
+ㄑㄧㄥˋ庆罄亲凊綮謦磬漀汫鑋靘掅碃罊慶罄親凊綮謦磬漀汫鑋靘掅碃罊50005000
+ㄑㄩㄝˊ瘸瘸
+ㄑㄩㄝˋ却确鹊雀怯阙榷搉恪壳阕悫埆确碏确礐硞皵毃礭卻確鵲雀怯闕榷搉恪殼闋愨埆确碏碻礐硞皵毃礭52E00072E800
+ㄑㄩㄢˇ犬绻甽畎琄虇汱圈犬綣甽畎琄虇汱圈2020
+ㄑㄩㄢˊ全权泉诠拳铨痊颧蜷筌卷荃鬈牷辁佺犬蜷醛恮婘犈觠駩巏齤蠸姾瑔跧縓灥全權泉詮拳銓痊顴蜷筌卷荃鬈牷輇佺犬踡醛恮婘犈觠駩巏齤蠸姾瑔跧縓灥AA040000AA042000
+ㄑㄩㄢˋ劝券牶烇絭勸券牶烇絭1010
+ㄑㄩㄣˊ群裙宭群裙宭
+ㄑㄩㄥˊ穷琼芎穹跫蛩惸邛琼藭瞏茕筇輁藑桏赹笻橩蒆窮瓊芎穹跫蛩惸邛璚藭瞏煢筇輁藑桏赹笻橩蒆3090030900
+ㄒㄧㄚˊ暇峡辖霞侠狭挟匣呷遐硖狎瑕斜黠柙祫洽舝碬騢搳烚冾笚縖珨陜磍赮魻蕸暇峽轄霞俠狹挾匣呷遐硤狎瑕斜黠柙祫洽舝碬騢搳烚冾笚縖珨陜磍赮魻蕸6740000067400000
+ㄒㄧㄚˋ下夏吓厦暇罅苄欱罅鶷下夏嚇廈暇罅芐欱鏬鶷C40C41
+ㄒㄧㄝˇ写血寫血11
+ㄒㄧㄝˊ协鞋斜胁谐邪偕颉挟洁携撷勰缬缬脘慀劦蝢垥拹籺奊谐愶搚瑎熁燲協鞋斜脅諧邪偕頡挾絜攜擷勰纈襭脥慀劦蝢垥拹籺奊龤愶搚瑎熁燲99FE080099FE0800
+ㄒㄧㄝˋ谢械泄屑泻懈卸泄蟹解屉亵榭契骇廨渫邂燮楔绁薤绁媟嶰澥瀣獬躞灺疶鞢骱駴偰檞齘伳妎祄榍韰屧焎揳齥躠謝械洩屑瀉懈卸泄蟹解屜褻榭契駭廨渫邂燮楔絏薤紲媟嶰澥瀣獬躞灺疶鞢骱駴偰檞齘伳妎祄榍韰屧焎揳齥躠11C40500000051C405000000
+ㄒㄧㄠˇ小晓筱筱謏小曉筱篠謏20A0
+ㄒㄧㄠˊ学洨笅郩學洨笅郩11
+ㄒㄧㄠˋ校笑孝效酵啸肖效恔熽踍校笑孝效酵嘯肖傚恔熽踍0200A0
+ㄒㄧㄡˇ朽宿糔朽宿糔
+ㄒㄧㄡˋ秀绣锈袖嗅宿臭锈琇溴岫珛玊殠袖螑秀繡鏽袖嗅宿臭銹琇溴岫珛玊殠褎螑68006804
+ㄒㄧㄢˇ险显鲜癣藓铣燹跣险蚬姺鲜幰猃獮猃筅韅毨烍鍌搟鼸齴赻攇禒險顯鮮癬蘚銑燹跣嶮蜆姺尟幰獫獮玁筅韅毨烍鍌搟鼸齴赻攇禒F3BA000F3BA000
+ㄒㄧㄢˊ贤闲嫌咸咸弦衔弦娴娴涎衔舷闲痫諴呼憪鷴娹葴胘蛝羬燅礥鹇唌賢閒嫌咸鹹弦銜絃嫻嫺涎啣舷閑癇諴蚿憪鷴娹葴胘蛝羬燅礥鷳唌34B61043DB6104
+ㄒㄧㄢˋ县现线限宪献羡陷腺馅蚬苋霰俔僩岘晛睍豏槛鋧涀瀗粯娊撊錎姭縣現線限憲獻羨陷腺餡蜆莧霰俔僩峴晛睍豏轞鋧涀瀗粯娊撊錎姭77E880077E8800
+ㄒㄧㄣˇ伈伈
+ㄒㄧㄣˊ寻鄩杺攳襑尋鄩杺攳襑1010
+ㄒㄧㄣˋ信衅芯焮舋膷囟妡煡阠信釁芯焮舋膷囟妡煡阠200200
+ㄒㄧㄤˇ想响享饷飨鲞饷晑想響享餉饗鯗饟晑A7A7
+ㄒㄧㄤˊ详祥降翔庠詳祥降翔庠1010
+ㄒㄧㄤˋ巷向相像项象橡向向蠁萫哄蟓襐鐌乡恦潒鱌巷向相像項象橡嚮曏蠁萫闀蟓襐鐌鄉恦潒鱌0188009980
+ㄒㄧㄥˇ省醒擤渻省醒擤渻
+ㄒㄧㄥˊ行形型刑邢陉硎鉶饧侀烆洐胻鋞濴行形型刑邢陘硎鉶餳侀烆洐胻鋞濴02100210
+ㄒㄧㄥˋ行兴性幸姓杏幸悻荇婞莕涬行興性幸姓杏倖悻荇婞莕涬200240
+ㄒㄩㄝˇ雪鳕雪鱈22
+ㄒㄩㄝˊ学穴鷽觷踅燢泶壆學穴鷽觷踅燢澩壆1414
+ㄒㄩㄝˋ血雪穴削趐泬謞岤袕血雪穴削趐泬謞岤袕
+ㄒㄩㄢˇ选咺烜選咺烜11
+ㄒㄩㄢˊ玄旋悬漩璇璇伭妶琁玹嫙誸还县蜁玄旋懸漩璇璿伭妶琁玹嫙誸還縣蜁40034203
+ㄒㄩㄢˋ炫绚漩眩泫渲旋眴楦敻铉衒蔙駽鞙镟昡楦袨縼讂贙炫絢漩眩泫渲旋眴楦敻鉉衒蔙駽鞙鏇昡楥袨縼讂贙204800204820
+ㄒㄩㄣˊ寻巡询循旬驯浔珣蟳洵荀徇恂峋栒燖璇紃郇鲟槆撏枔咰璕橁荨噚尋巡詢循旬馴潯珣蟳洵荀徇恂峋栒燖璿紃郇鱘槆撏枔咰璕橁蕁噚56009045600904
+ㄒㄩㄣˋ讯训迅逊殉驯徇巽汛蕈噀侚潠韗适鵔訊訓迅遜殉馴徇巽汛蕈噀侚潠韗迿鵔B204B204
+ㄒㄩㄥˊ雄熊赨雄熊赨
+ㄒㄩㄥˋ敻詗敻詗
+ㄓㄨㄚˇ爪爪
+ㄓㄨㄛˊ卓茁浊拙濯酌灼着啄镯擢琢诼倬斫斮梲椓焯蝃踔鷟彴汋斫禚篧浞棳謶錣啅罬斀蠗圴剢灂卓茁濁拙濯酌灼著啄鐲擢琢諑倬斲斮梲椓焯蝃踔鷟彴汋斫禚篧浞棳謶錣啅罬斀蠗圴剢灂48210000004825000000
+ㄓㄨㄞˇ跩跩
+ㄓㄨㄞˋ拽拽
+ㄓㄨㄟˇ沝沝
+ㄓㄨㄟˋ缀坠赘缒惴餟硾膇鑆綴墜贅縋惴餟硾膇鑆F00F00
+ㄓㄨㄢˇ转啭轉囀33
+ㄓㄨㄢˋ传赚篆撰撰馔转僎瑑縳腞傳賺篆撰譔饌轉僎瑑縳腞360370
+ㄓㄨㄣˇ准准隼埻綧準准隼埻綧0010
+ㄓㄨㄣˋ稕稕
+ㄓㄨㄤˇ奘奘
+ㄓㄨㄤˋ状壮撞戆焋狀壯撞戇焋B0B0
+ㄓㄨㄥˇ种肿冢踵冢種腫塚踵冢3070
+ㄓㄨㄥˋ中种重仲众尰湩狆衶偅堹緟中種重仲眾尰湩狆衶偅堹緟210210
+ㄔㄨㄛˋ绰辍龊婼啜惙歠醊婥畷逴娖吷珿磭腏趠擉嚽綽輟齪婼啜惙歠醊婥畷逴娖吷珿磭腏趠擉嚽7000070000
+ㄔㄨㄞˇ揣揣
+ㄔㄨㄞˊ膗膗
+ㄔㄨㄞˋ踹嘬踹嘬
+ㄔㄨㄟˊ垂锤槌捶椎陲锤捶棰棰呙湷倕菙缍偷腄甀垂鎚槌搥椎陲錘捶棰箠圌湷倕菙綞娷腄甀244C0A46C0
+ㄔㄨㄟˋ吹炊諈吹炊諈
+ㄔㄨㄢˇ喘舛荈喘舛荈
+ㄔㄨㄢˊ传船遄椽歂諯暷輲傳船遄椽歂諯暷輲1010
+ㄔㄨㄢˋ串钏钏汌夼賗串釧玔汌夼賗6060
+ㄔㄨㄣˇ蠢蠢踳偆萶蠢惷踳偆萶0020
+ㄔㄨㄣˊ纯唇醇淳莼鹑漘镦韕唇憌鯙純唇醇淳蓴鶉漘錞韕脣憌鯙1B01B2
+ㄔㄨㄤˇ闯抢漺闖搶漺33
+ㄔㄨㄤˊ床幢撞橦床幢撞橦
+ㄔㄨㄤˋ创闯怆创獊創闖愴刱獊F0F0
+ㄔㄨㄥˇ宠寵11
+ㄔㄨㄥˊ重崇虫虫种翀蝩隀茧痋重崇虫蟲种翀蝩隀茧痋000800
+ㄔㄨㄥˋ冲铳轰衝銃揰77
+ㄕㄨㄚˇ耍耍
+ㄕㄨㄛˋ朔硕烁数铄嗍率蟀帅搠妁槊箾蒴勺欶揱獡鎙朔碩爍數鑠嗍率蟀帥搠妁槊箾蒴勺欶揱獡鎙E1100E1100
+ㄕㄨㄞˇ甩甩
+ㄕㄨㄞˋ率帅蟀咰繂率帥蟀咰繂2020
+ㄕㄨㄟˇ水水
+ㄕㄨㄟˊ谁脽誰脽11
+ㄕㄨㄟˋ说睡税蜕帨涗裞說睡稅蛻帨涗裞D0D0
+ㄕㄨㄢˋ涮涮
+ㄕㄨㄣˇ盾楯吮揗賰盾楯吮揗賰
+ㄕㄨㄣˋ顺舜瞬蕣鬊瞚順舜瞬蕣鬊瞚1010
+ㄕㄨㄤˇ爽塽樉漺慡縔爽塽樉漺慡縔
+ㄕㄨㄤˋ灀灀
+ㄖㄨㄛˋ若弱箬偌爇鄀箬蒻楉弱若弱箬偌爇鄀篛蒻楉鶸000042
+ㄖㄨㄟˇ蕊蕊繠惢桵蕊橤繠惢桵0020
+ㄖㄨㄟˊ蕤緌婑蕤緌婑
+ㄖㄨㄟˋ瑞锐芮睿蚋睿枘汭瑞銳芮睿蚋叡枘汭2022
+ㄖㄨㄢˇ软阮蠕耎蠕瓀緛礝朊軟阮蠕耎蝡瓀緛礝朊100110
+ㄖㄨㄢˊ堧壖撋堧壖撋
+ㄖㄨㄣˋ润闰橍潤閏橍33
+ㄖㄨㄥˇ冗茸氄傇軵冗茸氄傇軵
+ㄖㄨㄥˊ容荣融溶绒熔戎蓉熔茸榕绒嵘瑢肜绒狨瀜茙烿蝾爃媶榵褣駥髶鰫鷛容榮融溶絨熔戎蓉鎔茸榕羢嶸瑢肜毧狨瀜茙烿蠑爃媶榵褣駥髶鰫鷛2189010021990100
+ㄗㄨㄛˇ左佐繓左佐繓
+ㄗㄨㄛˊ昨作砟椊筰稓葃昨作砟椊筰稓葃
+ㄗㄨㄛˋ做作坐座酢祚凿柞怍胙阼葄夎做作坐座酢祚鑿柞怍胙阼葄夎04000400
+ㄗㄨㄟˇ嘴璻觜嶊噿濢嘴璻觜嶊噿濢
+ㄗㄨㄟˋ最罪醉檇蕞晬檌絊祽鋷墬嶵最罪醉檇蕞晬檌絊祽鋷墬嶵
+ㄗㄨㄢˇ纂钻缵籫攒纂鑽纘籫儹6161
+ㄗㄨㄢˋ赚钻攥饡賺鑽攥饡33
+ㄗㄨㄣˇ撙噂墫僔譐撙噂墫僔譐
+ㄗㄨㄣˋ俊圳捘鳟銌燇俊圳捘鱒銌燇8080
+ㄗㄨㄥˇ总摠偬熜朡蓗總摠傯熜朡蓗5050
+ㄗㄨㄥˋ纵粽综从瘲昮縱粽綜從瘲昮D0D0
+ㄘㄨㄛˇ瑳脞縒硰瑳脞縒硰
+ㄘㄨㄛˊ瘥矬鹾痤醝嵯蔖瘥矬鹺痤醝嵯蔖4040
+ㄘㄨㄛˋ错措挫锉撮锉厝莝侳剒咋蓌錯措挫銼撮剉厝莝侳剒齰蓌924924
+ㄘㄨㄟˇ璀趡漼璀趡漼
+ㄘㄨㄟˊ凗慛凗慛
+ㄘㄨㄟˋ翠脆粹悴瘁萃啐淬倅毳橇焠竁脆綷膵脆濢翠脆粹悴瘁萃啐淬倅毳橇焠竁膬綷膵脺濢0000000021
+ㄘㄨㄢˊ攒巑劗攢巑劗11
+ㄘㄨㄢˋ窜篡爨篹竄篡爨篹11
+ㄘㄨㄣˇ忖刌忖刌
+ㄘㄨㄣˊ存袸存袸
+ㄘㄨㄣˋ寸寸籿寸吋籿02
+ㄘㄨㄥˊ从丛淙琮悰潀漎賨錝婃孮徖慒從叢淙琮悰潀漎賨錝婃孮徖慒30003000
+ㄘㄨㄥˋ欉丛謥欉藂謥22
+ㄙㄨㄛˇ所索锁琐琐唢摵鎍鏼所索鎖瑣璅嗩摵鎍鏼C30C30
+ㄙㄨㄛˋ逤逤
+ㄙㄨㄟˇ髓嶲瀡巂霍髓嶲瀡巂靃0101
+ㄙㄨㄟˊ随隋雟隨隋雟11
+ㄙㄨㄟˋ岁遂碎穗隧祟燧谇睟穟璲檖襚鐩邃埣賥檅繀禭旞繸鐆歲遂碎穗隧祟燧誶睟穟璲檖襚鐩邃埣賥檅繀禭旞繸鐆180000180000
+ㄙㄨㄢˇ匴匴
+ㄙㄨㄢˋ算蒜算算蒜筭04
+ㄙㄨㄣˇ损笋榫簨鎨損筍榫簨鎨3030
+ㄙㄨㄣˋ潠愻潠愻
+ㄙㄨㄥˇ耸怂悚竦傱愯嵷駷聳慫悚竦傱愯嵷駷3030
+ㄙㄨㄥˋ送宋颂讼诵送宋頌訟誦C1C1
+"""
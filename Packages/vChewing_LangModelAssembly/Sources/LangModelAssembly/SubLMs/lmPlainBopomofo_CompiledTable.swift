@@ -0,0 +1,284 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+
+// MARK: - LMAssembly.LMPlainBopomofo.CompiledTable
+
+extension LMAssembly.LMPlainBopomofo {
+  /// 倚天中文 DOS 注音排序資料的預編譯表格。
+  ///
+  /// 表格由 `compile(from:)` 事先自 `jsnEtenDosSequence` 生成、以 `StaticString` 的形式直接編入執行檔
+  /// （見 `lmPlainBopomofo_CompiledData.swift`），執行時只需取得其 UTF-8 指標、無須任何解碼。
+  ///
+  /// 表格由兩段資料構成：
+  /// - `index`：每個讀音一行定寬記錄（十六進位），依「讀音字數、UTF-8 位元組順序」排序，可直接二分搜尋。
+  ///   各欄位依序為：條目在 `pool` 內的起點（6 位）、讀音位元組長度（2 位）、讀音字數（2 位）、
+  ///   簡體候選字位元組長度（4 位）、繁體候選字位元組長度（4 位）、簡體特有字位元集長度（2 位）、繁體特有字位元集長度（2 位）。
+  /// - `pool`：每個讀音一行，依序為讀音、簡體候選字、繁體候選字、簡體特有字位元集、繁體特有字位元集。
+  ///   位元集以十六進位字元表示：第 i 個候選字對應第 `i / 4` 個字元的 `1 << (i % 4)` 位元。
+  ///   讀音下的簡繁候選字若無差異，則兩個位元集皆為空。
+  ///
+  /// - Remark: 位元集以 Unicode 純量為單位計數，故要求每個候選字皆為單一 Unicode 純量（編譯時會檢查）。
+  struct CompiledTable {
+    // MARK: Lifecycle
+
+    init(index: StaticString, pool: StaticString) {
+      self.index = UnsafeBufferPointer(start: index.utf8Start, count: index.utf8CodeUnitCount)
+      self.pool = UnsafeBufferPointer(start: pool.utf8Start, count: pool.utf8CodeUnitCount)
+      self.count = self.index.isEmpty ? 0 : (self.index.count + 1) / Self.recordWidth
+    }
+
+    // MARK: Internal
+
+    /// 已編入執行檔的表格。
+    static let shipped = Self(index: etenDosCompiledIndex, pool: etenDosCompiledPool)
+
+    /// 讀音數量。
+    let count: Int
+
+    /// 查詢給定讀音的記錄索引。
+    func entryIndex(for key: String) -> Int? {
+      guard count > 0 else { return nil }
+      let keyCharCount = key.count
+      var key = key
+      return key.withUTF8 { keyBytes in
+        var lowerBound = 0
+        var upperBound = count - 1
+        while lowerBound <= upperBound {
+          let middle = lowerBound + (upperBound - lowerBound) / 2
+          let entry = record(at: middle)
+          var comparison = entry.keyCharCount - keyCharCount
+          if comparison == 0 {
+            comparison = Self.compare(pool, entry.keyRange, with: keyBytes)
+          }
+          if comparison < 0 {
+            lowerBound = middle + 1
+          } else if comparison > 0 {
+            upperBound = middle - 1
+          } else {
+            return middle
+          }
+        }
+        return nil
+      }
+    }
+
+    /// 讀取給定記錄的讀音。
+    func key(at entryIndex: Int) -> String {
+      string(in: record(at: entryIndex).keyRange)
+    }
+
+    /// 讀取給定記錄的候選字（依倚天中文 DOS 注音排序，不去重複）。
+    func values(at entryIndex: Int, isCHS: Bool) -> String {
+      let entry = record(at: entryIndex)
+      return string(in: isCHS ? entry.simplifiedRange : entry.traditionalRange)
+    }
+
+    /// 讀音是否以給定前綴開頭（以 UTF-8 位元組比對）。
+    func key(at entryIndex: Int, hasPrefix prefixBytes: UnsafeBufferPointer<UInt8>) -> Bool {
+      let keyRange = record(at: entryIndex).keyRange
+      guard keyRange.count >= prefixBytes.count else { return false }
+      return Self.compare(pool, keyRange.lowerBound ..< keyRange.lowerBound + prefixBytes.count, with: prefixBytes) == 0
+    }
+
+    /// 檢查給定字在給定讀音下是否為簡體特有（`isCHS`）或繁體特有。語義同 `generateDistinctionHashTables()` 的查表結果。
+    func isExclusive(isCHS: Bool, at entryIndex: Int, target: Character) -> Bool? {
+      let entry = record(at: entryIndex)
+      let bitsRange = isCHS ? entry.simplifiedBitsRange : entry.traditionalBitsRange
+      guard !entry.simplifiedBitsRange.isEmpty || !entry.traditionalBitsRange.isEmpty else { return nil }
+      let scalars = target.unicodeScalars
+      guard scalars.count == 1, let targetScalar = scalars.first else { return false }
+      var position = 0
+      var iterator = pool[isCHS ? entry.simplifiedRange : entry.traditionalRange].makeIterator()
+      var decoder = UTF8()
+      while case let .scalarValue(scalar) = decoder.decode(&iterator) {
+        defer { position += 1 }
+        guard scalar == targetScalar else { continue }
+        let nibbleOffset = bitsRange.lowerBound + position / 4
+        guard nibbleOffset < bitsRange.upperBound, let nibble = Self.hexNibble(pool[nibbleOffset]) else {
+          return false
+        }
+        return nibble & (1 << (position % 4)) != 0
+      }
+      return false
+    }
+
+    // MARK: Private
+
+    private struct Record {
+      let keyRange: Range<Int>
+      let keyCharCount: Int
+      let simplifiedRange: Range<Int>
+      let traditionalRange: Range<Int>
+      let simplifiedBitsRange: Range<Int>
+      let traditionalBitsRange: Range<Int>
+    }
+
+    /// 各欄位的十六進位位數。
+    private static let fieldWidths = [6, 2, 2, 4, 4, 2, 2]
+    /// 各欄位在記錄內的起點（末元素為不含換行字元的記錄寬度）。
+    private static let fieldOffsets = fieldWidths.reduce(into: [0]) { $0.append($0[$0.count - 1] + $1) }
+    /// 每行記錄的寬度（含換行字元）。
+    private static let recordWidth = fieldWidths.reduce(1, +)
+
+    private let index: UnsafeBufferPointer<UInt8>
+    private let pool: UnsafeBufferPointer<UInt8>
+
+    private static func compare(
+      _ buffer: UnsafeBufferPointer<UInt8>,
+      _ range: Range<Int>,
+      with other: UnsafeBufferPointer<UInt8>
+    )
+      -> Int {
+      var lhsIndex = range.lowerBound
+      var rhsIndex = 0
+      while lhsIndex < range.upperBound, rhsIndex < other.count {
+        let lhs = buffer[lhsIndex]
+        let rhs = other[rhsIndex]
+        if lhs != rhs { return lhs < rhs ? -1 : 1 }
+        lhsIndex += 1
+        rhsIndex += 1
+      }
+      return range.count - other.count
+    }
+
+    private static func hexNibble(_ byte: UInt8) -> Int? {
+      switch byte {
+      case 48 ... 57: return Int(byte - 48)
+      case 65 ... 70: return Int(byte - 55)
+      default: return nil
+      }
+    }
+
+    private func record(at entryIndex: Int) -> Record {
+      let base = entryIndex * Self.recordWidth
+      let keyStart = field(0, ofRecordAt: base)
+      let simplifiedStart = keyStart + field(1, ofRecordAt: base)
+      let traditionalStart = simplifiedStart + field(3, ofRecordAt: base)
+      let simplifiedBitsStart = traditionalStart + field(4, ofRecordAt: base)
+      let traditionalBitsStart = simplifiedBitsStart + field(5, ofRecordAt: base)
+      return Record(
+        keyRange: keyStart ..< simplifiedStart,
+        keyCharCount: field(2, ofRecordAt: base),
+        simplifiedRange: simplifiedStart ..< traditionalStart,
+        traditionalRange: traditionalStart ..< simplifiedBitsStart,
+        simplifiedBitsRange: simplifiedBitsStart ..< traditionalBitsStart,
+        traditionalBitsRange: traditionalBitsStart ..< traditionalBitsStart + field(6, ofRecordAt: base)
+      )
+    }
+
+    private func field(_ fieldIndex: Int, ofRecordAt base: Int) -> Int {
+      var value = 0
+      for offset in (base + Self.fieldOffsets[fieldIndex]) ..< (base + Self.fieldOffsets[fieldIndex + 1]) {
+        value = (value << 4) | (Self.hexNibble(index[offset]) ?? 0)
+      }
+      return value
+    }
+
+    private func string(in range: Range<Int>) -> String {
+      String(decoding: UnsafeBufferPointer(rebasing: pool[range]), as: UTF8.self)
+    }
+  }
+}
+
+// MARK: - CompiledTable Compiler
+
+extension LMAssembly.LMPlainBopomofo.CompiledTable {
+  /// 自原始 JSON 資料生成 `lmPlainBopomofo_CompiledData.swift` 的兩段表格內容。
+  ///
+  /// 原始資料有變更時，可藉由單元測試 `LMPlainBopomofoTests` 取得重新生成的檔案內容。
+  /// 生成時會一併套用「ㄈㄨㄥˋ 的候選字追加至 ㄈㄥˋ」的處理。
+  /// - Parameter dataMap: 解析過的原始資料。
+  /// - Returns: 表格內容；若有候選字不是單一 Unicode 純量、或資料超出欄位寬度則為 nil。
+  static func compile(from dataMap: LMAssembly.LMPlainBopomofo.DataMap) -> (index: String, pool: String)? {
+    var dataMap = dataMap
+    if let fung4 = dataMap["ㄈㄨㄥˋ"] {
+      fung4.forEach { fKey, fValue in
+        if let existingValue = dataMap["ㄈㄥˋ"]?[fKey] {
+          dataMap["ㄈㄥˋ", default: [:]][fKey] = existingValue + fValue
+        }
+      }
+    }
+    let distinctionTables = LMAssembly.LMPlainBopomofo.generateDistinctionHashTables(using: dataMap)
+    let sortedKeys = dataMap.keys.sorted {
+      if $0.count == $1.count { return $0.utf8.lexicographicallyPrecedes($1.utf8) }
+      return $0.count < $1.count
+    }
+
+    var indexLines: [String] = []
+    var poolLines: [String] = []
+    indexLines.reserveCapacity(sortedKeys.count)
+    poolLines.reserveCapacity(sortedKeys.count)
+    var poolByteCount = 0
+    for key in sortedKeys {
+      let simplified = dataMap[key]?["S"] ?? ""
+      let traditional = dataMap[key]?["T"] ?? ""
+      guard simplified.count == simplified.unicodeScalars.count,
+            traditional.count == traditional.unicodeScalars.count
+      else {
+        return nil
+      }
+      var simplifiedBits = ""
+      var traditionalBits = ""
+      if let distinction = distinctionTables[key] {
+        simplifiedBits = bitsetString(of: simplified, marking: distinction[true] ?? [])
+        traditionalBits = bitsetString(of: traditional, marking: distinction[false] ?? [])
+      }
+      let fields = [
+        poolByteCount, key.utf8.count, key.count,
+        simplified.utf8.count, traditional.utf8.count,
+        simplifiedBits.utf8.count, traditionalBits.utf8.count,
+      ]
+      var indexLine = ""
+      for (value, width) in zip(fields, fieldWidths) {
+        let hexValue = String(value, radix: 16, uppercase: true)
+        guard hexValue.count <= width else { return nil }
+        indexLine += String(repeating: "0", count: width - hexValue.count) + hexValue
+      }
+      indexLines.append(indexLine)
+      let poolLine = key + simplified + traditional + simplifiedBits + traditionalBits
+      poolLines.append(poolLine)
+      poolByteCount += poolLine.utf8.count + 1 // 含換行字元。
+    }
+    return (indexLines.joined(separator: "\n"), poolLines.joined(separator: "\n"))
+  }
+
+  /// 生成 `lmPlainBopomofo_CompiledData.swift` 的完整檔案內容。
+  static func generateSwiftSource(from dataMap: LMAssembly.LMPlainBopomofo.DataMap) -> String? {
+    guard let compiled = compile(from: dataMap) else { return nil }
+    return """
+    // (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+    // ====================
+    // This code is released under the MIT license (SPDX-License-Identifier: MIT)
+    // ... with NTL restriction stating that:
+    // No trademark license is granted to use the trade names, trademarks, service
+    // marks, or product names of Contributor, except as required to fulfill notice
+    // requirements defined in MIT License.
+
+    // 該檔案由 `LMAssembly.LMPlainBopomofo.CompiledTable.generateSwiftSource()` 自 `jsnEtenDosSequence` 生成，請勿手動修改。
+
+    let etenDosCompiledIndex: StaticString = \"\"\"
+    \(compiled.index)
+    \"\"\"
+
+    let etenDosCompiledPool: StaticString = \"\"\"
+    \(compiled.pool)
+    \"\"\"
+
+    """
+  }
+
+  private static func bitsetString(of candidates: String, marking exclusives: Set<Character>) -> String {
+    var nibbles: [Int] = .init(repeating: 0, count: (candidates.count + 3) / 4)
+    for (position, char) in candidates.enumerated() where exclusives.contains(char) {
+      nibbles[position / 4] |= 1 << (position % 4)
+    }
+    return nibbles.map { String($0, radix: 16, uppercase: true) }.joined()
+  }
+}
@@ -66,6 +66,17 @@ extension LMAssembly {
     mutating func replaceData(textData rawStrData: String) {
       let newBytes = Array(rawStrData.utf8)
       if rawData == newBytes { return }
+      // 另一輸入模式若已載入內容相同的資料，則直接沿用其解析結果。
+      if let shared = LMAssembly.SharedParsePool.lookup(
+        kind: Self.sharedParseKind, rawData: newBytes, as: [ReplacementEntry].self
+      ) {
+        rawData = shared.rawData
+        entries = shared.payload
+        sharedSnapshot = shared
+        rebuildKeyBitset()
+        return
+      }
+      sharedSnapshot = nil
       rawData = newBytes
       var newEntries: [ReplacementEntry] = []
       rawData.parseByteLines { lineRange in
@@ -114,12 +125,20 @@ extension LMAssembly {
         }
       }
       entries = deduped
+      rebuildKeyBitset()
+      let snapshot = LMAssembly.SharedParseSnapshot(
+        kind: Self.sharedParseKind, rawData: rawData, payload: entries
+      )
+      LMAssembly.SharedParsePool.publish(snapshot)
+      sharedSnapshot = snapshot
     }
 
     mutating func clear() {
       filePath = nil
+      sharedSnapshot = nil
       rawData.removeAll(keepingCapacity: false)
       entries.removeAll(keepingCapacity: false)
+      keyBitset.removeAll(keepingCapacity: false)
     }
 
     func saveData() {
@@ -163,13 +182,67 @@ extension LMAssembly {
       entryIndex(for: key) != nil
     }
 
+    /// 以載入時建好的索引鍵位元集快速判斷給定的字串是否「可能」為置換對象。
+    ///
+    /// 回傳 `false` 時必定不是置換對象；回傳 `true` 時才需要真的去二分搜尋。
+    /// 每次查詢只需走一趟 UTF-8 位元組、不做任何記憶體配置。
+    /// 絕大多數候選字都不是置換對象，故 `unigramsFor` 的語彙置換階段可藉此跳過幾乎所有的二分搜尋。
+    func mightHaveValuesFor(key: String) -> Bool {
+      guard !keyBitset.isEmpty else { return false }
+      let (bitA, bitB) = Self.bitPositions(of: key.utf8, bitMask: keyBitset.count &* 64 &- 1)
+      return keyBitset[bitA >> 6] & (1 << (bitA & 63)) != 0
+        && keyBitset[bitB >> 6] & (1 << (bitB & 63)) != 0
+    }
+
     // MARK: Private
 
+    private static let sharedParseKind = "LMReplacements"
+
     /// 按 key UTF-8 位元組排序的索引；同 key 重複時僅保留檔案中較晚出現的行。
     private var entries: [ReplacementEntry] = []
+    /// 持有目前資料所對應的共用解析快照，使其在另一輸入模式仍可被沿用。
+    private var sharedSnapshot: AnyObject?
+    /// 索引鍵位元集（雙雜湊的 Bloom filter），詳見 `mightHaveValuesFor(key:)`。
+    private var keyBitset: [UInt64] = []
+
+    /// 以 FNV-1a 雜湊給定的 UTF-8 位元組，並自雜湊值的高低兩半各取一個位元位置。
+    private static func bitPositions<S: Sequence>(
+      of bytes: S,
+      bitMask: Int
+    )
+      -> (Int, Int) where S.Element == UInt8 {
+      var hash: UInt64 = 0xCBF2_9CE4_8422_2325
+      for byte in bytes {
+        hash ^= UInt64(byte)
+        hash &*= 0x0000_0100_0000_01B3
+      }
+      return (Int(truncatingIfNeeded: hash) & bitMask, Int(truncatingIfNeeded: hash >> 32) & bitMask)
+    }
+
+    /// 依當前的 entries 重建索引鍵位元集。每筆索引鍵約佔 16 個位元，誤判率約為 1.4%。
+    private mutating func rebuildKeyBitset() {
+      guard !entries.isEmpty else {
+        keyBitset.removeAll(keepingCapacity: false)
+        return
+      }
+      var wordCount = 1
+      while wordCount &* 64 < entries.count &* 16 {
+        wordCount &<<= 1
+      }
+      var newBitset = [UInt64](repeating: 0, count: wordCount)
+      let bitMask = wordCount &* 64 &- 1
+      for entry in entries {
+        let keyBytes = rawData[Int(entry.keyStart) ..< Int(entry.keyEnd)]
+        let (bitA, bitB) = Self.bitPositions(of: keyBytes, bitMask: bitMask)
+        newBitset[bitA >> 6] |= 1 << (bitA & 63)
+        newBitset[bitB >> 6] |= 1 << (bitB & 63)
+      }
+      keyBitset = newBitset
+    }
 
     /// 二分搜尋 key，回傳對應的 entry 索引。
     private func entryIndex(for key: String) -> Int? {
+      guard mightHaveValuesFor(key: key) else { return nil }
       let keyUTF8 = Array(key.utf8)
       var lo = 0, hi = entries.count - 1
       while lo <= hi {
@@ -192,4 +265,14 @@ extension LMAssembly.LMReplacements {
     }
     return result
   }
+
+  /// 取出給定 entry 序號的 key 與整行（內容與 `dictRepresented` 的單筆一致）。
+  /// - Returns: 該筆的 key 與整行、以及下一筆的序號。序號越界時回傳 nil。
+  func summaryGroup(from index: Int) -> (key: String, line: String, nextIndex: Int)? {
+    guard entries.indices.contains(index) else { return nil }
+    let entry = entries[index]
+    let key = String(decoding: rawData[Int(entry.keyStart) ..< Int(entry.keyEnd)], as: UTF8.self)
+    let line = String(decoding: rawData[Int(entry.lineStart) ..< Int(entry.lineEnd)], as: UTF8.self)
+    return (key, line, index + 1)
+  }
 }
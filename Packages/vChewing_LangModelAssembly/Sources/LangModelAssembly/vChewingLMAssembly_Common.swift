@@ -57,6 +57,16 @@ nonisolated public enum LMAssembly {
     fileHandleQueue.async(execute: execute)
   }
 
+  /// 在目前已排入 `fileHandleQueue` 的所有工作（含其交回主執行緒的後續處理）都完成之後，於主執行緒執行給定的工作。
+  ///
+  /// 非同步載入使用者資料時，各載入工作都是先在 `fileHandleQueue` 讀檔、再交回主執行緒套用，
+  /// 故可藉此得知「截至目前為止登記的非同步載入工作」何時全數完成。
+  nonisolated public static func afterPendingFileLoads(execute work: @MainActor @escaping @Sendable () -> ()) {
+    fileHandleQueue.async {
+      asyncOnMain { work() }
+    }
+  }
+
   /// 在 fileHandleQueue 上非同步讀取檔案內容（含可選的 consolidation），
   /// 完成後在 MainActor 上回呼結果。不阻塞呼叫方（通常是 MainActor）。
   nonisolated public static func readFileContentAsync(
@@ -3,6 +3,7 @@
 // This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
 
 import Foundation
+import SwiftExtension
 
 // MARK: - VanguardTrie.TextMapTrie
 
@@ -14,7 +15,7 @@ extension VanguardTrie {
   /// - raw `Data` 常駐
   /// - sorted key index + binary search
   /// - prefix-range scan for longer-segment queries
-  /// - lazy reverse lookup index（第一次反查時才建立）
+  /// - lazy reverse lookup index（第一次反查時才建立，亦可預先於背景佇列建立）
   /// - key initials prefilter for partial match
   public final class TextMapTrie {
     // MARK: Lifecycle
@@ -68,23 +69,100 @@ extension VanguardTrie {
       return readings.isEmpty ? nil : readings
     }
 
-    /// 清除所有 QueryBuffer 快取（node、nodeIDs、nodes、entryGroups）。
+    /// 清除所有 QueryBuffer 快取（node、nodeIDs、nodes、entryGroups、keyChainMatches）。
     /// 應在適當的時機呼叫，避免舊查詢結果污染新的查詢。
     public func flushCaches() {
       queryBuffer4Node.clear()
       queryBuffer4Nodes.clear()
       queryBuffer4NodeIDs.clear()
       queryBuffer4EntryGroups.clear()
+      queryBuffer4KeyChainMatches.clear()
     }
 
     /// 釋放反查索引佔用的記憶體。
     /// 關閉獨立 RevLookup 視窗後可呼叫；下次反查會自動重新建立。
+    /// 若此時背景仍在建立索引，則該次建立結果會被捨棄。
     public func flushReverseLookupIndex() {
+      reverseLookupBuildBox.invalidate()
       reverseLookupReady = false
       valueLineToKeyEntryIndex.removeAll(keepingCapacity: false)
       reverseLookupTable = .empty
     }
 
+    /// 反查索引是否已可供查詢（含已於背景建立完畢、但尚未被查詢執行緒收編的情形）。
+    public var isReverseLookupIndexReady: Bool {
+      reverseLookupReady || reverseLookupBuildBox.hasPendingResult
+    }
+
+    /// 背景建立反查索引的進度（0...1）。索引已就緒時恆為 1。
+    public var reverseLookupIndexBuildProgress: Double {
+      isReverseLookupIndexReady ? 1 : reverseLookupBuildBox.progress
+    }
+
+    /// 在背景佇列建立反查索引，不阻塞呼叫端執行緒。
+    ///
+    /// 背景工作僅讀取 Trie 的不可變資料，建立結果先放進交接區，
+    /// 待查詢執行緒下次反查（或呼叫 `ensureReverseLookupIndex()`）時才收編，
+    /// 故查詢執行緒以外的地方不會觸碰 Trie 的可變狀態。
+    /// - Parameters:
+    ///   - qos: 背景佇列的服務品質等級。
+    ///   - completion: 建立工作結束後於背景執行緒呼叫；索引已就緒時則立即呼叫。
+    ///   若已有建立工作進行中，則排在該工作之後、待其結束時才呼叫。
+    ///   該工作若已被 `flushReverseLookupIndex()` 作廢，則呼叫時索引仍未就緒，須由呼叫端自行再次登記。
+    public func prepareReverseLookupIndexInBackground(
+      qos: DispatchQoS.QoSClass = .utility,
+      completion: (@Sendable () -> ())? = nil
+    ) {
+      guard !reverseLookupReady else {
+        completion?()
+        return
+      }
+      let generation: UInt64
+      switch reverseLookupBuildBox.beginBuilding(completion: completion) {
+      case .alreadyBuilt:
+        completion?()
+        return
+      case .queued: return
+      case let .started(startedGeneration): generation = startedGeneration
+      }
+      let box = reverseLookupBuildBox
+      let rawData = rawData
+      let keyEntries = keyEntries
+      let valuesLineOffsets = valuesLineOffsets
+      let valuesEndOffset = valuesEndOffset
+      let isTyping = isTyping
+      let defaultProbs = defaultProbs
+      let separator = readingSeparator
+      DispatchQueue.global(qos: qos).async {
+        let owners = VanguardTrie.TextMapTrie.buildLineOwnerIndex(
+          keyEntries: keyEntries,
+          valueLineCount: valuesLineOffsets.count
+        )
+        let table = VanguardTrie.TextMapTrie.buildReverseLookupTable(
+          in: rawData,
+          keyEntries: keyEntries,
+          valueLineOffsets: valuesLineOffsets,
+          valuesEndOffset: valuesEndOffset,
+          valueLineToKeyEntryIndex: owners,
+          isTyping: isTyping,
+          defaultProbs: defaultProbs,
+          separator: separator,
+          progressHandler: { box.reportProgress($0, generation: generation) }
+        )
+        box.finishBuilding(owners: owners, table: table, generation: generation)
+      }
+    }
+
+    /// 不阻塞的反查：索引尚未就緒時直接回傳 nil，並在背景開始建立索引。
+    /// 適合在輸入執行緒上做候選字詞註解之類「查不到也無妨」的用途。
+    public func reverseLookupIfReady(for kanji: String) -> [String]? {
+      guard reverseLookupReady || adoptPendingReverseLookupIndex() else {
+        prepareReverseLookupIndexInBackground()
+        return nil
+      }
+      return reverseLookup(for: kanji)
+    }
+
     // MARK: Private
 
     private typealias Entry = VanguardTrie.Trie.Entry
@@ -112,6 +190,92 @@ extension VanguardTrie {
       let lineIndexValues: [UInt32]
     }
 
+    /// 背景建立反查索引用的交接區。
+    ///
+    /// 背景執行緒只會寫入此處；以世代號碼辨識過期的建立結果（例如建立期間索引被 flush）。
+    private final class ReverseLookupBuildBox: @unchecked Sendable {
+      // MARK: Internal
+
+      let group = DispatchGroup()
+
+      var hasPendingResult: Bool {
+        lock.withLock { pending != nil }
+      }
+
+      var progress: Double {
+        lock.withLock { isBuilding ? currentProgress : 0 }
+      }
+
+      /// `beginBuilding(completion:)` 的登記結果。
+      enum Admission {
+        /// 已有建立結果待收編，無須再建立。
+        case alreadyBuilt
+        /// 已有建立工作進行中，給定的回呼會在該工作結束時呼叫。
+        case queued
+        /// 已登記一次新的建立，由呼叫端以此世代號碼實際建立。
+        case started(generation: UInt64)
+      }
+
+      /// 登記一次建立工作。除非已有建立結果待收編，給定的回呼都會在建立工作結束時呼叫。
+      func beginBuilding(completion: (@Sendable () -> ())?) -> Admission {
+        lock.withLock {
+          guard pending == nil else { return .alreadyBuilt }
+          if let completion { waiters.append(completion) }
+          guard !isBuilding else { return .queued }
+          isBuilding = true
+          currentProgress = 0
+          group.enter()
+          return .started(generation: generation)
+        }
+      }
+
+      func reportProgress(_ value: Double, generation givenGeneration: UInt64) {
+        lock.withLock {
+          guard givenGeneration == generation else { return }
+          currentProgress = value
+        }
+      }
+
+      func finishBuilding(owners: [Int32], table: ReverseLookupIndex, generation givenGeneration: UInt64) {
+        let finishedWaiters: [@Sendable () -> ()] = lock.withLock {
+          if givenGeneration == generation {
+            pending = (owners, table)
+          }
+          isBuilding = false
+          currentProgress = 0
+          group.leave()
+          defer { waiters.removeAll() }
+          return waiters
+        }
+        finishedWaiters.forEach { $0() }
+      }
+
+      func takePendingResult() -> (owners: [Int32], table: ReverseLookupIndex)? {
+        lock.withLock {
+          defer { pending = nil }
+          return pending
+        }
+      }
+
+      /// 作廢進行中的建立工作與尚未收編的建立結果。
+      func invalidate() {
+        lock.withLock {
+          generation &+= 1
+          pending = nil
+        }
+      }
+
+      // MARK: Private
+
+      private let lock = NSLock()
+      private var generation: UInt64 = 0
+      private var isBuilding = false
+      private var currentProgress: Double = 0
+      private var pending: (owners: [Int32], table: ReverseLookupIndex)?
+      /// 等待進行中的建立工作結束的回呼。
+      private var waiters: [@Sendable () -> ()] = []
+    }
+
     private struct InitialsBucket {
       let initialsUTF8: ContiguousArray<UInt8>
       let nodeIDs: [UInt32]
@@ -156,6 +320,7 @@ extension VanguardTrie {
     private var valueLineToKeyEntryIndex: [Int32] = []
     private var reverseLookupTable: ReverseLookupIndex = .empty
     private var reverseLookupReady: Bool = false
+    private let reverseLookupBuildBox = ReverseLookupBuildBox()
 
     private var cachedEntries: [Int: [Entry]] = [:]
     private var cachedEntriesLRUOrder: [Int] = []
@@ -163,6 +328,7 @@ extension VanguardTrie {
     private let queryBuffer4Nodes: QueryBuffer<[VanguardTrie.Trie.TNode]> = .init(maxCount: 2_048)
     private let queryBuffer4NodeIDs: QueryBuffer<[Int]> = .init(maxCount: 2_048)
     private let queryBuffer4EntryGroups: QueryBuffer<[EntryGroup]> = .init(maxCount: 512)
+    private let queryBuffer4KeyChainMatches: QueryBuffer<[KeyChainMatch]> = .init(maxCount: 512)
     /// 供 `getNodeIDsForKeyArray` 複用的臨時緩衝區，避免每次 cache miss 時分配新陣列。
     /// 僅在呼叫者確保單一執行緒存取 Trie 時安全（TextMap 查詢在主執行緒或序列佇列上進行）。
     private var scratchNodeIDs: [Int] = []
@@ -488,13 +654,18 @@ extension VanguardTrie.TextMapTrie {
     valueLineToKeyEntryIndex: [Int32],
     isTyping: Bool,
     defaultProbs: [Int32: Double],
-    separator: Character
+    separator: Character,
+    progressHandler: ((Double) -> ())? = nil
   )
     -> ReverseLookupIndex {
     // UInt32 scalar values as dictionary keys to avoid per-character String allocations.
     var charToLineIndices: [UInt32: [UInt32]] = [:]
+    let lineCount = valueLineOffsets.count
 
-    for lineIndex in 0 ..< valueLineOffsets.count {
+    for lineIndex in 0 ..< lineCount {
+      if let progressHandler, lineIndex & 0xFFF == 0 {
+        progressHandler(Double(lineIndex) / Double(lineCount))
+      }
       let keyEntryIndex = Int(valueLineToKeyEntryIndex[lineIndex])
       guard keyEntryIndex >= 0, keyEntryIndex < keyEntries.count else { continue }
       let keyEntry = keyEntries[keyEntryIndex]
@@ -878,8 +1049,12 @@ extension VanguardTrie.TextMapTrie {
 
   /// 確保反查索引已建立；若尚未建立，則從 rawData 重建 `valueLineToKeyEntryIndex` 與 `reverseLookupTable`。
   /// 此函式為 public，讓上層（如 RevLookup 視窗）可在使用者開啟視窗前預先載入索引。
+  /// 若背景建立工作正在進行，則等待其完成並直接收編結果，不重複建立。
   public func ensureReverseLookupIndex() {
     guard !reverseLookupReady else { return }
+    if adoptPendingReverseLookupIndex() { return }
+    reverseLookupBuildBox.group.wait()
+    if adoptPendingReverseLookupIndex() { return }
     let owners = Self.buildLineOwnerIndex(
       keyEntries: keyEntries,
       valueLineCount: valuesLineOffsets.count
@@ -898,6 +1073,17 @@ extension VanguardTrie.TextMapTrie {
     reverseLookupReady = true
   }
 
+  /// 收編背景建立完畢的反查索引。
+  /// - Returns: 是否有收編到結果。
+  @discardableResult
+  private func adoptPendingReverseLookupIndex() -> Bool {
+    guard let pending = reverseLookupBuildBox.takePendingResult() else { return false }
+    valueLineToKeyEntryIndex = pending.owners
+    reverseLookupTable = pending.table
+    reverseLookupReady = true
+    return true
+  }
+
   private func resolveKey(for keyEntry: KeyEntry) -> String {
     TrieStringPool.shared.internKey(
       Self.extractString(from: rawData, start: Int(keyEntry.keyStart), end: Int(keyEntry.keyEnd))
@@ -965,13 +1151,13 @@ extension VanguardTrie.TextMapTrie {
     return result
   }
 
-  private func filteredEntryGroup(
+  private func filteredEntries(
     for keyEntryIndex: Int,
     filterType: VanguardTrie.Trie.EntryType
   )
-    -> EntryGroup? {
-    guard keyEntryIndex >= 0, keyEntryIndex < keyEntries.count else { return nil }
-    let filteredEntries = switch filterType.isEmpty {
+    -> [Entry] {
+    guard keyEntryIndex >= 0, keyEntryIndex < keyEntries.count else { return [] }
+    return switch filterType.isEmpty {
     case true: parsedEntries(for: keyEntryIndex)
     case false: parsedEntries(for: keyEntryIndex).filter {
         filterMatches(
@@ -980,6 +1166,14 @@ extension VanguardTrie.TextMapTrie {
         )
       }
     }
+  }
+
+  private func filteredEntryGroup(
+    for keyEntryIndex: Int,
+    filterType: VanguardTrie.Trie.EntryType
+  )
+    -> EntryGroup? {
+    let filteredEntries = filteredEntries(for: keyEntryIndex, filterType: filterType)
     guard !filteredEntries.isEmpty else { return nil }
     return (resolveKeyArray(for: keyEntries[keyEntryIndex]), filteredEntries)
   }
@@ -1184,6 +1378,246 @@ extension VanguardTrie.TextMapTrie {
   }
 }
 
+// MARK: - VanguardTrie.TextMapTrie.KeyChainMatch
+
+extension VanguardTrie.TextMapTrie {
+  /// 鍵鏈查詢結果的借用視圖。
+  ///
+  /// 視圖只記錄該鍵鏈在索引當中的序號、以及查詢時順便算好的讀音陣列；
+  /// 其詞條要等到呼叫 `entries(filterType:)` 時才會自原始資料解析。
+  /// 視圖不持有來源 Trie，僅在來源 Trie 存活期間有效。
+  public struct KeyChainMatch {
+    // MARK: Lifecycle
+
+    fileprivate init(keyChainID: Int, keyArray: [String], trie: VanguardTrie.TextMapTrie) {
+      self.keyChainID = keyChainID
+      self.keyArray = keyArray
+      self.trie = trie
+    }
+
+    // MARK: Public
+
+    /// 該鍵鏈在索引當中的序號，與 `getNode(_:)` 所用的節點序號一致。
+    public let keyChainID: Int
+    /// 該鍵鏈的讀音陣列。
+    public let keyArray: [String]
+
+    /// 自原始資料解析該鍵鏈的詞條。
+    /// - Parameter filterType: 詞條類型的篩選條件；留空則不篩選。
+    public func entries(
+      filterType: VanguardTrie.Trie.EntryType = []
+    )
+      -> [VanguardTrie.Trie.Entry] {
+      trie.filteredEntries(for: keyChainID, filterType: filterType)
+    }
+
+    // MARK: Private
+
+    private unowned let trie: VanguardTrie.TextMapTrie
+  }
+
+  /// 列出以給定讀音陣列為前綴、且幅長比其更長的所有鍵鏈（嚴格超集），依鍵鏈的位元組順序排列。
+  ///
+  /// 涵蓋的鍵鏈與不篩選詞條類型、不做模糊比對的 `getNodes(keyArray:filterType:partiallyMatch:longerSegment:)`
+  /// 在 `longerSegment` 為 true 時相同；但此處只在已排序的鍵鏈索引上做一次前綴範圍掃描、不解析任何詞條；
+  /// 各結果的讀音陣列直接沿用查詢用的讀音陣列作為前段，只有多出來的讀音才自原始資料解碼。
+  /// - Parameters:
+  ///   - keyArray: 作為前綴的讀音陣列。
+  ///   - limit: 結果數量上限；nil 表示不設限。
+  public func supersetKeyChainMatches(
+    prefixing keyArray: [String],
+    limit: Int? = nil
+  )
+    -> [KeyChainMatch] {
+    guard !keyArray.isEmpty, keyArray.allSatisfy({ !$0.isEmpty }) else { return [] }
+    let cacheKey: Int = {
+      var hasher = Hasher()
+      hasher.combine(keyArray)
+      hasher.combine(limit)
+      hasher.combine("SUPERSET")
+      return hasher.finalize()
+    }()
+    if let cached = queryBuffer4KeyChainMatches.get(hashKey: cacheKey) {
+      PerfProbe.count("TextMapTrie.keyChainMatches.cacheHit")
+      return cached
+    }
+    PerfProbe.count("TextMapTrie.keyChainMatches.cacheMiss")
+    let probe = PerfProbe.begin("TextMapTrie.supersetKeyChainMatches")
+    defer { PerfProbe.end(probe) }
+
+    let result = scanSupersetKeyChains(prefixing: keyArray, limit: limit ?? .max)
+    queryBuffer4KeyChainMatches.set(hashKey: cacheKey, value: result)
+    return result
+  }
+
+  /// 列出符合給定切片讀音的所有鍵鏈，依索引序號排列。
+  ///
+  /// 切片讀音的寫法與 `getEntryGroups(keysChopped:filterType:partiallyMatch:)` 相同：
+  /// 單個讀音位置的多個可能性以 `chopCaseSeparator` 區隔。與該函式不同的是，此處只比對鍵鏈本身、
+  /// 不解析任何詞條（詞條類型的篩選留待 `KeyChainMatch.entries(filterType:)` 處理），故 `limit` 計算的是鍵鏈數量。
+  /// - Parameters:
+  ///   - keysChopped: 切片讀音陣列。
+  ///   - partiallyMatch: 是否允許各讀音位置僅以前綴相符。
+  ///   - longerSegment: 是否改為列出幅長比切片讀音更長、且前段逐位完全相符的鍵鏈（嚴格超集）。
+  ///     此時不考慮 `partiallyMatch`。
+  ///   - limit: 結果數量上限；nil 表示不設限。
+  public func choppedKeyChainMatches(
+    keysChopped: [String],
+    partiallyMatch: Bool,
+    longerSegment: Bool = false,
+    limit: Int? = nil
+  )
+    -> [KeyChainMatch] {
+    guard !keysChopped.isEmpty, keysChopped.allSatisfy({ !$0.isEmpty }) else { return [] }
+    let cacheKey: Int = {
+      var hasher = Hasher()
+      hasher.combine(keysChopped)
+      hasher.combine(partiallyMatch)
+      hasher.combine(longerSegment)
+      hasher.combine(limit)
+      hasher.combine("CHOPPED")
+      return hasher.finalize()
+    }()
+    if let cached = queryBuffer4KeyChainMatches.get(hashKey: cacheKey) {
+      PerfProbe.count("TextMapTrie.keyChainMatches.cacheHit")
+      return cached
+    }
+    PerfProbe.count("TextMapTrie.keyChainMatches.cacheMiss")
+    let probe = PerfProbe.begin("TextMapTrie.choppedKeyChainMatches")
+    defer { PerfProbe.end(probe) }
+
+    let limit = limit ?? .max
+    let isChopped = keysChopped.contains { $0.contains(chopCaseSeparator) }
+    let result: [KeyChainMatch] = switch (longerSegment, isChopped, partiallyMatch) {
+    case (true, _, _): choppedSupersetKeyChains(keysChopped, limit: limit)
+    case (false, true, _):
+      choppedColumnKeyChains(keysChopped, partiallyMatch: partiallyMatch, limit: limit)
+    case (false, false, true): partiallyMatchedKeyChains(keysChopped, limit: limit)
+    case (false, false, false): exactKeyChains(keysChopped, limit: limit)
+    }
+    queryBuffer4KeyChainMatches.set(hashKey: cacheKey, value: result)
+    return result
+  }
+
+  private func exactKeyChains(_ keyArray: [String], limit: Int) -> [KeyChainMatch] {
+    guard limit > 0,
+          let index = binarySearchIndex(for: keyArray.joined(separator: String(readingSeparator)))
+    else { return [] }
+    return [.init(keyChainID: index, keyArray: keyArray, trie: self)]
+  }
+
+  private func partiallyMatchedKeyChains(_ keyArray: [String], limit: Int) -> [KeyChainMatch] {
+    var result: [KeyChainMatch] = []
+    guard limit > 0 else { return result }
+    for nodeID in getNodeIDsForKeyArray(keyArray, longerSegment: false) {
+      guard nodeID >= 0, nodeID < keyEntries.count else { continue }
+      let keyEntry = keyEntries[nodeID]
+      // segmentCount 含空白段落，故只能用來預先排除段落數不足者。
+      guard Int(keyEntry.segmentCount) >= keyArray.count else { continue }
+      let currentKeyArray = resolveKeyArray(for: keyEntry)
+      guard currentKeyArray.count == keyArray.count,
+            zip(currentKeyArray, keyArray).allSatisfy({ $0.hasPrefix($1) })
+      else { continue }
+      result.append(.init(keyChainID: nodeID, keyArray: currentKeyArray, trie: self))
+      if result.count >= limit { break }
+    }
+    return result
+  }
+
+  private func choppedColumnKeyChains(
+    _ keysChopped: [String],
+    partiallyMatch: Bool,
+    limit: Int
+  )
+    -> [KeyChainMatch] {
+    var result: [KeyChainMatch] = []
+    guard limit > 0 else { return result }
+    let choppedColumns = parseChoppedColumns(keysChopped)
+    guard !choppedColumns.isEmpty else { return result }
+    var previousNodeID = -1
+    for nodeID in candidateNodeIDsForChoppedColumns(choppedColumns) where nodeID != previousNodeID {
+      previousNodeID = nodeID
+      guard nodeID >= 0, nodeID < keyEntries.count else { continue }
+      let keyEntry = keyEntries[nodeID]
+      guard Int(keyEntry.segmentCount) >= choppedColumns.count else { continue }
+      let nodeKeyArray = resolveKeyArray(for: keyEntry)
+      guard nodeKeyArray.count == choppedColumns.count,
+            nodeMatchesChoppedColumns(
+              nodeKeyArray,
+              choppedColumns: choppedColumns,
+              partiallyMatch: partiallyMatch
+            )
+      else { continue }
+      result.append(.init(keyChainID: nodeID, keyArray: nodeKeyArray, trie: self))
+      if result.count >= limit { break }
+    }
+    return result
+  }
+
+  /// 逐一展開各讀音位置的可能性，再分別做前綴範圍掃描。
+  private func choppedSupersetKeyChains(_ keysChopped: [String], limit: Int) -> [KeyChainMatch] {
+    let columns = keysChopped.map { $0.split(separator: chopCaseSeparator).map(String.init) }
+    guard limit > 0, columns.allSatisfy({ !$0.isEmpty }) else { return [] }
+    var prefixes: [[String]] = [[]]
+    for column in columns {
+      prefixes = prefixes.flatMap { prefix in column.map { prefix + [$0] } }
+    }
+    var handledIDs = Set<Int>()
+    var result: [KeyChainMatch] = []
+    for prefix in prefixes {
+      for match in scanSupersetKeyChains(prefixing: prefix, limit: limit)
+        where handledIDs.insert(match.keyChainID).inserted {
+        result.append(match)
+      }
+    }
+    guard prefixes.count > 1 else { return result }
+    // 各前綴的掃描結果各自依序排列且已截在上限以內，合併後重新排序再截斷即可得到全域的前 limit 筆。
+    result.sort { $0.keyChainID < $1.keyChainID }
+    if result.count > limit { result.removeSubrange(limit...) }
+    return result
+  }
+
+  private func scanSupersetKeyChains(prefixing keyArray: [String], limit: Int) -> [KeyChainMatch] {
+    var result: [KeyChainMatch] = []
+    guard limit > 0, let separatorByte = readingSeparator.asciiValue else { return result }
+    var prefixBytes: [UInt8] = []
+    for key in keyArray {
+      prefixBytes.append(contentsOf: key.utf8)
+      prefixBytes.append(separatorByte)
+    }
+    let startIndex = lowerBoundIndex(for: prefixBytes)
+    guard startIndex < keyEntries.count else { return result }
+
+    rawData.withUnsafeBytes { rawBuffer in
+      let buffer = rawBuffer.bindMemory(to: UInt8.self)
+      for currentIndex in startIndex ..< keyEntries.count {
+        let keyEntry = keyEntries[currentIndex]
+        let keyStart = Int(keyEntry.keyStart)
+        let keyEnd = Int(keyEntry.keyEnd)
+        guard keyEnd - keyStart >= prefixBytes.count,
+              prefixBytes.indices.allSatisfy({ buffer[keyStart + $0] == prefixBytes[$0] })
+        else { break }
+        // 只解碼前綴以後的讀音；空白段落略過，與 `split` 的行為一致。
+        var currentKeyArray = keyArray
+        currentKeyArray.reserveCapacity(Int(keyEntry.segmentCount))
+        var segmentStart = keyStart + prefixBytes.count
+        for position in segmentStart ... keyEnd where position == keyEnd || buffer[position] == separatorByte {
+          if position > segmentStart {
+            currentKeyArray.append(
+              String(decoding: UnsafeBufferPointer(rebasing: buffer[segmentStart ..< position]), as: UTF8.self)
+            )
+          }
+          segmentStart = position + 1
+        }
+        guard currentKeyArray.count > keyArray.count else { continue }
+        result.append(.init(keyChainID: currentIndex, keyArray: currentKeyArray, trie: self))
+        if result.count >= limit { break }
+      }
+    }
+    return result
+  }
+}
+
 // MARK: - Initials Bucket Helpers
 
 extension VanguardTrie.TextMapTrie {
@@ -1312,8 +1746,12 @@ extension VanguardTrie.TextMapTrie: VanguardTrieProtocol {
       return hasher.finalize()
     }()
     if let cached = queryBuffer4EntryGroups.get(hashKey: cacheKey) {
+      PerfProbe.count("TextMapTrie.getEntryGroups.cacheHit")
       return cached
     }
+    PerfProbe.count("TextMapTrie.getEntryGroups.cacheMiss")
+    let probe = PerfProbe.begin("TextMapTrie.getEntryGroups.chopped")
+    defer { PerfProbe.end(probe) }
 
     let choppedColumns = parseChoppedColumns(keysChopped)
     guard !choppedColumns.isEmpty else {
@@ -1498,8 +1936,12 @@ extension VanguardTrie.TextMapTrie: VanguardTrieProtocol {
       return hasher.finalize()
     }()
     if let cached = queryBuffer4EntryGroups.get(hashKey: cacheKey) {
+      PerfProbe.count("TextMapTrie.getEntryGroups.cacheHit")
       return cached
     }
+    PerfProbe.count("TextMapTrie.getEntryGroups.cacheMiss")
+    let probe = PerfProbe.begin("TextMapTrie.getEntryGroups")
+    defer { PerfProbe.end(probe) }
 
     let result: [EntryGroup] = switch (partiallyMatch, longerSegment) {
     case (false, false):
@@ -8,6 +8,7 @@
 
 import Foundation
 import LMAssemblyMaterials4Tests
+import SwiftExtension
 import Testing
 
 @testable import LangModelAssembly
@@ -87,6 +88,41 @@ struct InputTokenTests {
     )
   }
 
+  @Test
+  func testExpanderWithInjectedClock() throws {
+    // 2024-06-01T04:34:56Z，亦即臺北時間 2024 年 6 月 1 日（星期六）12:34:56。
+    let mtxNow = NSMutex(Date(timeIntervalSince1970: 1_717_216_496))
+    guard let timeZone = TimeZone(identifier: "Asia/Taipei") else {
+      Issue.record("Failed to construct the time zone.")
+      return
+    }
+    let expander = LMAssembly.InputToken.Expander(clock: { mtxNow.value }, timeZone: { timeZone })
+
+    let dateResults = expander.expand("MACRO@DATE", isCHS: false)
+    #expect(dateResults.contains("2024-06-01"))
+    #expect(dateResults.contains("2024年6月1日"))
+    #expect(expander.expand("MACRO@DATE_DAYDELTA:1", isCHS: false).contains("2024-06-02"))
+    #expect(expander.expand("MACRO@YEAR_YEARDELTA:-1", isCHS: false).contains("2023年"))
+    #expect(expander.expand("MACRO@YEAR_GANZHI", isCHS: false).contains("甲辰年"))
+    #expect(expander.expand("MACRO@YEAR_ZODIAC", isCHS: false).contains("木龍年"))
+    #expect(expander.expand("MACRO@YEAR_ZODIAC", isCHS: true).contains("木龙年"))
+    #expect(expander.expand("MACRO@WEEK", isCHS: false) == ["星期六"])
+    #expect(expander.expand("MACRO@TIME_SHORTENED", isCHS: false).first == "12:34")
+
+    // 同一分鐘之內沿用記住的結果；跨過分鐘、或跨過日界之後則重新展開。
+    mtxNow.withLock { $0.addTimeInterval(3) }
+    #expect(expander.expand("MACRO@TIME_SHORTENED", isCHS: false).first == "12:34")
+    #expect(expander.expand("MACRO@TIME", isCHS: false).first == "12:34:59")
+    mtxNow.withLock { $0.addTimeInterval(60) }
+    #expect(expander.expand("MACRO@TIME_SHORTENED", isCHS: false).first == "12:35")
+    #expect(expander.expand("MACRO@DATE", isCHS: false).contains("2024-06-01"))
+    mtxNow.withLock { $0.addTimeInterval(12 * 60 * 60) }
+    #expect(expander.expand("MACRO@DATE", isCHS: false).contains("2024-06-02"))
+    #expect(expander.expand("MACRO@WEEK", isCHS: false) == ["星期日"])
+    // 非 Token 的字串不展開。
+    #expect(expander.expand("MACRO@UNKNOWN", isCHS: false).isEmpty)
+  }
+
   @Test
   func testGeneratedResultsFromLMInstantiator() throws {
     let instance = LMAssembly.LMInstantiator(isCHS: true)
@@ -8,6 +8,7 @@
 // requirements defined in MIT License.
 
 import Foundation
+import SwiftExtension
 import Testing
 
 @testable import LangModelAssembly
@@ -107,6 +108,30 @@ struct LMCoreEXTests {
     #expect(grams == ["篙", "糕", "膏", "高", "高興"])
   }
 
+  @Test
+  func testValueSetMatchesUnigramValues() throws {
+    var lmTest = LMAssembly.LMCoreEX(
+      reverse: false,
+      consolidate: false,
+      defaultScore: { _ in 0 },
+      forceDefaultScore: false
+    )
+    lmTest.replaceData(textData: sampleData)
+    lmTest.temporaryMap["ㄍㄠ"] = [.init(keyArray: ["ㄍㄠ"], value: "羔", score: -5.0)]
+    #expect(lmTest.valueSet(forKey: "ㄍㄠ") == Set(lmTest.unigramsFor(key: "ㄍㄠ").map(\.current)))
+    #expect(lmTest.valueSet(forKey: "ㄍㄠ").contains("羔"))
+    #expect(lmTest.valueSet(forKey: "ㄅㄧㄤ").isEmpty)
+
+    var lmReversed = LMAssembly.LMCoreEX(
+      reverse: true,
+      consolidate: false,
+      defaultScore: { _ in 0 },
+      forceDefaultScore: false
+    )
+    lmReversed.replaceData(textData: "高 ㄍㄠ\n糕 ㄍㄠ\n")
+    #expect(lmReversed.valueSet(forKey: "ㄍㄠ") == ["高", "糕"])
+  }
+
   @Test
   func testReplaceDataHandlesTabDelimitedInput() throws {
     var lmTest = LMAssembly.LMCoreEX(
@@ -183,4 +208,165 @@ struct LMCoreEXTests {
     #expect(saved.contains("高興 ㄍㄠ-ㄒㄧㄥ -5.0\n"))
     try? FileManager.default.removeItem(at: tempURL)
   }
+
+  /// 繁簡兩模式載入內容相同的資料時，應共用同一份解析結果（同一塊緩衝區）。
+  @Test
+  func testLMCoreEXSharesParsedSnapshotAcrossIdenticalLoads() throws {
+    func makeLM() -> LMAssembly.LMCoreEX {
+      .init(reverse: false, consolidate: false, defaultScore: { _ in 0 }, forceDefaultScore: false)
+    }
+    func bufferAddress(_ lm: LMAssembly.LMCoreEX) -> UnsafeRawPointer? {
+      lm.rawData.withUnsafeBytes { $0.baseAddress }
+    }
+    var lmCHT = makeLM()
+    var lmCHS = makeLM()
+    lmCHT.replaceData(textData: sampleData)
+    lmCHS.replaceData(textData: sampleData)
+    #expect(bufferAddress(lmCHT) == bufferAddress(lmCHS))
+    #expect(lmCHS.count == lmCHT.count)
+    #expect(lmCHS.unigramsFor(key: "ㄍㄠ").map(\.current) == ["篙", "糕", "膏", "高"])
+
+    // 反轉欄位的模組解析結果不同，不得共用。
+    var lmReversed = LMAssembly.LMCoreEX(reverse: true, consolidate: false)
+    lmReversed.replaceData(textData: sampleData)
+    #expect(bufferAddress(lmReversed) != bufferAddress(lmCHT))
+
+    // 其中一方改載其他內容後，另一方的資料不受影響。
+    lmCHS.replaceData(textData: "ㄍㄠ 高 -1.0\n")
+    #expect(lmCHS.count == 1)
+    #expect(lmCHT.count == 3)
+    #expect(lmCHT.unigramsFor(key: "ㄙ").count == 7)
+  }
+
+  /// 批次併入後的索引須與「直接載入合併後的原文」所得的索引一致，且既有配對不得重複寫入。
+  @Test
+  func testMergeBulkDeduplicatesAndRebuildsIndex() throws {
+    var lmTest = LMAssembly.LMCoreEX(reverse: true, consolidate: false)
+    lmTest.replaceData(textData: "高 ㄍㄠ\n科 ㄎㄜ -7.1\n")
+    lmTest.temporaryMap["ㄙ"] = [.init(keyArray: ["ㄙ"], value: "絲", score: -5.0)]
+    let inserted = lmTest.mergeBulk([
+      .init(keyArray: ["ㄍㄠ"], value: "高"), // 與既有資料重複。
+      .init(keyArray: ["ㄍㄠ"], value: "糕", weight: -3.5),
+      .init(keyArray: ["ㄍㄠ"], value: "糕", weight: -1.0), // 與前一筆重複，取先到者。
+      .init(keyArray: ["ㄙ"], value: "絲"), // 與 temporaryMap 重複。
+      .init(keyArray: ["ㄅㄧ"], value: "筆", annotation: "#𝙃𝙪𝙢𝙖𝙣𝘾𝙝𝙚𝙘𝙠𝙍𝙚𝙦𝙪𝙞𝙧𝙚𝙙"),
+      .init(keyArray: ["ㄎㄜ", "ㄒㄩㄝˊ"], value: "科學"),
+      .init(keyArray: ["ㄙ"], value: "絲 襪"), // 值內含空白，無效。
+      .init(keyArray: ["ㄙ", ""], value: "撕"), // 讀音有空缺，無效。
+    ])
+    #expect(inserted == 3)
+    #expect(lmTest.unigramsFor(key: "ㄍㄠ").map(\.current) == ["高", "糕"])
+    #expect(lmTest.unigramsFor(key: "ㄍㄠ").last?.probability == -3.5)
+    #expect(lmTest.unigramsFor(key: "ㄙ").map(\.current) == ["絲"])
+    #expect(lmTest.keys(matchingPrefix: "ㄎㄜ") == ["ㄎㄜ", "ㄎㄜ-ㄒㄩㄝˊ"])
+    // 新資料依 key 排序附加至原文尾端。
+    #expect(lmTest.strData.hasSuffix("筆 ㄅㄧ #𝙃𝙪𝙢𝙖𝙣𝘾𝙝𝙚𝙘𝙠𝙍𝙚𝙦𝙪𝙞𝙧𝙚𝙙\n糕 ㄍㄠ -3.5\n科學 ㄎㄜ-ㄒㄩㄝˊ\n"))
+
+    var lmReloaded = LMAssembly.LMCoreEX(reverse: true, consolidate: false)
+    lmReloaded.replaceData(textData: lmTest.strData + "\n")
+    #expect(lmTest.count == lmReloaded.count)
+    #expect(lmTest.dictRepresented == lmReloaded.dictRepresented)
+
+    // 再次併入相同資料時不會有任何變動。
+    let strDataBefore = lmTest.strData
+    #expect(lmTest.mergeBulk([.init(keyArray: ["ㄍㄠ"], value: "糕")]) == 0)
+    #expect(lmTest.strData == strDataBefore)
+  }
+
+  @Test
+  func testMergeBulkIntoEmptyStoreAndSave() throws {
+    var lmTest = LMAssembly.LMCoreEX(reverse: true, consolidate: false)
+    let tempURL = FileManager.default.temporaryDirectory
+      .appendingPathComponent("vChewingTest_coreex_bulk_\(UUID().uuidString).txt")
+    lmTest.filePath = tempURL.path
+    #expect(lmTest.mergeBulk([
+      .init(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"], value: "年終", weight: -2.0),
+      .init(keyArray: ["ㄍㄠ"], value: "高"),
+    ]) == 2)
+    #expect(lmTest.count == 2)
+    lmTest.saveData()
+    let saved = try String(contentsOf: tempURL, encoding: .utf8)
+    #expect(saved == "年終 ㄋㄧㄢˊ-ㄓㄨㄥ -2.0\n高 ㄍㄠ\n")
+    try? FileManager.default.removeItem(at: tempURL)
+  }
+
+  /// 十萬筆語彙的批次併入效能。
+  @Test
+  func testMergeBulkPerformance() throws {
+    let syllables = ["ㄅㄚ", "ㄆㄛ", "ㄇㄜ", "ㄈㄟ", "ㄉㄠ", "ㄊㄡ", "ㄋㄢ", "ㄌㄣ", "ㄍㄤ", "ㄎㄥ"]
+    var existingLines = [String]()
+    var records = [LMAssembly.LMCoreEX.BulkRecord]()
+    records.reserveCapacity(100_000)
+    for i in 0 ..< 100_000 {
+      let keyArray = [syllables[i % 10], syllables[(i / 10) % 10], syllables[(i / 100) % 10]]
+      let value = "詞\(i / 1_000)之\(i % 1_000)"
+      records.append(.init(keyArray: keyArray, value: value))
+      if i % 10 == 0 { existingLines.append("\(value) \(keyArray.joined(separator: "-"))") }
+    }
+    var lmTest = LMAssembly.LMCoreEX(reverse: true, consolidate: false)
+    lmTest.replaceData(textData: existingLines.joined(separator: "\n"))
+    let startTime = DispatchTime.now().uptimeNanoseconds
+    let inserted = lmTest.mergeBulk(records)
+    let elapsed = DispatchTime.now().uptimeNanoseconds - startTime
+    #expect(inserted == 90_000)
+    #expect(lmTest.count == 1_000)
+    print("// [BENCH] LMCoreEX.mergeBulk (100k records): \(Double(elapsed) / 1_000_000) ms")
+  }
+
+  /// 量測繁簡兩模式先後載入同一份大型資料時的常駐記憶體增量，以及行程的記憶體峰值。
+  ///
+  /// 記憶體數字受配置器與執行環境影響甚鉅，故只做報告、不做斷言；共用與否改以緩衝區位址判斷。
+  @Test
+  func testLMCoreEXSharedSnapshotMemoryFootprint() throws {
+    var textData = ""
+    for i in 0 ..< 200_000 {
+      textData += "ㄘˋ-\(i % 4_999) 詞\(i) -\(i % 10).5\n"
+    }
+    func makeLM() -> LMAssembly.LMCoreEX {
+      .init(reverse: false, consolidate: false, defaultScore: { _ in 0 }, forceDefaultScore: false)
+    }
+    let baseline = StartupOrchestrator.residentMemoryBytes()
+    var lmCHT = makeLM()
+    lmCHT.replaceData(textData: textData)
+    let afterFirstLoad = StartupOrchestrator.residentMemoryBytes()
+    var lmCHS = makeLM()
+    lmCHS.replaceData(textData: textData)
+    let afterSecondLoad = StartupOrchestrator.residentMemoryBytes()
+    #expect(lmCHT.count == lmCHS.count)
+    #expect(
+      lmCHT.rawData.withUnsafeBytes { $0.baseAddress } == lmCHS.rawData.withUnsafeBytes { $0.baseAddress }
+    )
+
+    let toMiB: (Int64) -> Double = { (Double($0) / 1_048_576 * 100).rounded() / 100 }
+    var peakDescription = "n/a"
+    if let peak = Self.peakResidentMemoryBytes() {
+      peakDescription = "\(toMiB(peak)) MiB"
+    }
+    print(
+      "// [BENCH] LMCoreEX shared snapshot (200k records): "
+        + "first load +\(toMiB(afterFirstLoad - baseline)) MiB, "
+        + "second identical load +\(toMiB(afterSecondLoad - afterFirstLoad)) MiB, "
+        + "peak RSS \(peakDescription)"
+    )
+  }
+
+  // MARK: Private
+
+  /// 行程自啟動以來的常駐記憶體峰值（位元組）；僅在 Darwin 上可取得。
+  private static func peakResidentMemoryBytes() -> Int64? {
+    #if canImport(Darwin)
+      var info = mach_task_basic_info()
+      var size = mach_msg_type_number_t(
+        MemoryLayout<mach_task_basic_info>.size / MemoryLayout<integer_t>.size
+      )
+      let kr = withUnsafeMutablePointer(to: &info) {
+        $0.withMemoryRebound(to: integer_t.self, capacity: Int(size)) {
+          task_info(mach_task_self_, task_flavor_t(MACH_TASK_BASIC_INFO), $0, &size)
+        }
+      }
+      return kr == KERN_SUCCESS ? Int64(info.resident_size_max) : nil
+    #else
+      return nil
+    #endif
+  }
 }
@@ -2,7 +2,10 @@
 // ====================
 // This code is released under the MIT license (SPDX-License-Identifier: MIT)
 
+import Foundation
 import Homa
+import Shared
+import SwiftExtension
 import Testing
 
 @testable import LangModelAssembly
@@ -61,16 +64,46 @@ struct LMInstantiatorTests {
   }
 
   @Test
-  func testCleanupInputTokenHashMapRemovesToTargetSize() {
+  func testGramProvenanceIsTaggedAtCreation() {
     defer {
       LMAssembly.LMInstantiator.disconnectFactoryDictionary()
     }
     let instance = LMAssembly.LMInstantiator()
-    // Create 3500 dummy hashes
-    instance.inputTokenHashesArray = Set((0 ..< 3_500).map { $0 })
-    // Trigger cleanup via a simple unigram query
-    _ = instance.unigramsFor(keyArray: ["ㄎㄜ"])
-    #expect(instance.inputTokenHashesArray.isEmpty)
+    LMAssembly.LMInstantiator.connectToTestFactoryDictionary(textMapData: LMATestsData.textMapTestCoreLMData)
+    _ = instance.setOptions { config in
+      config.isPhraseReplacementEnabled = true
+    }
+    instance.replaceData(
+      textData: "黏鐘 ㄋㄧㄢˊ-ㄓㄨㄥ -2.0\nMACRO@TIME_SHORTENED ㄒㄧㄢˋ-ㄗㄞˋ\n",
+      for: .thePhrases, save: false
+    )
+    instance.replaceData(textData: "黏鐘 粘終\n", for: .theReplacements, save: false)
+
+    // 原廠辭典。
+    let factoryGrams = instance.unigramsFor(keyArray: ["ㄎㄜ"])
+    #expect(factoryGrams.allSatisfy { $0.provenance.contains(.factory) })
+    // 使用者辭典詞條經過語彙置換之後，兩個旗標都會保留。
+    let replaced = instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).first { $0.current == "粘終" }
+    #expect(replaced?.provenance == [.user, .replacement])
+    // 使用者辭典裡的巨集、以及日期時間便捷輸入，其展開結果皆帶有 `.macro` 旗標。
+    let userMacros = instance.unigramsFor(keyArray: ["ㄒㄧㄢˋ", "ㄗㄞˋ"]).filter { $0.provenance.contains(.user) }
+    #expect(!userMacros.isEmpty)
+    #expect(userMacros.allSatisfy { $0.provenance == [.user, .macro] })
+    let timeGrams = instance.unigramsFor(keyArray: ["ㄕˊ", "ㄐㄧㄢ"]).filter { $0.provenance.contains(.macro) }
+    #expect(!timeGrams.isEmpty)
+    // 朗讀 API 直接讀取選字狀態內謄入的巨集標記，不會回頭查詢語言模型。
+    let keyArray = ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]
+    var state = IMEState.ofCandidates(
+      candidates: [(keyArray, "粘終"), (keyArray, "年終")],
+      displayTextSegments: ["粘終"],
+      cursor: 2
+    )
+    state.highlightedCandidateIndex = 0
+    #expect(instance.prepareCandidateNarrationSingle(state) != "粘終")
+    state.data.macroCandidates = [.init(keyArray: keyArray, value: "粘終")]
+    #expect(state.isMacroCandidate((keyArray, "粘終")))
+    #expect(!state.isMacroCandidate((keyArray, "年終")))
+    #expect(instance.prepareCandidateNarrationSingle(state) == "粘終")
   }
 
   @Test
@@ -326,4 +359,331 @@ struct LMInstantiatorTests {
     let exactAfterPartial = instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ"], partiallyMatch: false)
     #expect(!exactAfterPartial.map(\.current).contains("年終"))
   }
+
+  @Test
+  func testPerfProbeSnapshotReflectsBuildConfiguration() {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    PerfProbe.reset()
+    defer { PerfProbe.reset() }
+    let instance = LMAssembly.LMInstantiator()
+    instance.lmUserPhrases.replaceData(textData: "年 ㄋㄧㄢˊ -1.0\n")
+    _ = instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ"])
+    _ = instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ"])
+
+    let snapshot = LMAssembly.LMInstantiator.perfProbeSnapshot()
+    let dumped = LMAssembly.LMInstantiator.dumpPerfProbes(resetAfterDump: true)
+    #expect(snapshot.isEnabled == PerfProbe.isEnabled)
+    if PerfProbe.isEnabled {
+      #expect(snapshot.counter(named: "LMI.unigramsFor.cacheMiss") == 1)
+      #expect(snapshot.counter(named: "LMI.unigramsFor.cacheHit") == 1)
+      #expect(snapshot.span(named: "LMI.unigramsFor")?.calls == 1)
+      #expect(dumped.contains("LMI.unigramsFor"))
+      #expect(LMAssembly.LMInstantiator.perfProbeSnapshot().spans.isEmpty)
+    } else {
+      // 未啟用量測的建置不應留下任何資料。
+      #expect(snapshot.spans.isEmpty)
+      #expect(snapshot.counters.isEmpty)
+      #expect(dumped.contains("VCHEWING_PERF_PROBES"))
+    }
+  }
+
+  @Test
+  func testUnigramCacheEvictsUnreferencedEntriesFirst() {
+    typealias Cache = LMAssembly.UnigramCache
+    var cache = Cache(capacity: 3)
+    let stamp = Cache.Stamp(dataGeneration: 0, sharedGeneration: 0)
+    func key(_ str: String) -> Cache.Key { .exact(keyChain: str, partiallyMatch: false) }
+    func gram(_ str: String) -> [Homa.Gram] { [.init(keyArray: [str], value: str)] }
+    ["a", "b", "c"].forEach { cache.insert(gram($0), for: key($0), stamp: stamp) }
+    #expect(cache.value(for: key("a"), stamp: stamp)?.first?.current == "a")
+    // 「a」最近被用過，故滿載時應淘汰「b」。
+    cache.insert(gram("d"), for: key("d"), stamp: stamp)
+    #expect(cache.count == 3)
+    #expect(cache.value(for: key("b"), stamp: stamp) == nil)
+    #expect(cache.value(for: key("a"), stamp: stamp) != nil)
+    #expect(cache.value(for: key("d"), stamp: stamp) != nil)
+    #expect(cache.metrics.evictions == 1)
+    #expect(cache.metrics.hits == 3)
+    #expect(cache.metrics.misses == 1)
+    // 精確比對與部分比對、以及替代讀音查詢的索引鍵互不衝突。
+    #expect(cache.value(for: .exact(keyChain: "a", partiallyMatch: true), stamp: stamp) == nil)
+    #expect(cache.value(for: .alternatives([.singleKey("a")]), stamp: stamp) == nil)
+    // 世代一變，整池失效。
+    let newStamp = Cache.Stamp(dataGeneration: 1, sharedGeneration: 0)
+    #expect(cache.value(for: key("a"), stamp: newStamp) == nil)
+    #expect(cache.count == 0)
+    #expect(cache.metrics.invalidations == 1)
+  }
+
+  @Test
+  func testUnigramCacheInvalidatesOnDataAndConfigChanges() {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let instance = LMAssembly.LMInstantiator()
+    instance.replaceData(textData: "年終 ㄋㄧㄢˊ-ㄓㄨㄥ -1.0\n", for: .thePhrases, save: false)
+    let hitsBefore = instance.unigramCacheMetrics.hits
+    #expect(instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current).contains("年終"))
+    #expect(instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current).contains("年終"))
+    #expect(instance.unigramCacheMetrics.hits == hitsBefore + 1)
+
+    // 熱置換使用者資料之後，不得沿用舊快取。
+    instance.replaceData(textData: "黏鐘 ㄋㄧㄢˊ-ㄓㄨㄥ -1.0\n", for: .thePhrases, save: false)
+    let afterReplace = instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current)
+    #expect(afterReplace.contains("黏鐘"))
+    #expect(!afterReplace.contains("年終"))
+
+    // 設定有變之後，亦不得沿用舊快取。
+    _ = instance.setOptions { config in
+      config.bypassUserPhrasesData = true
+    }
+    #expect(!instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current).contains("黏鐘"))
+    #expect(instance.unigramCacheMetrics.invalidations >= 2)
+  }
+
+  @Test
+  func testSyncReplacementsReloadInvalidatesUnigramCache() throws {
+    let originalAsyncLoading = LMAssembly.LMInstantiator.asyncLoadingUserData
+    LMAssembly.LMInstantiator.asyncLoadingUserData = false
+    defer {
+      LMAssembly.LMInstantiator.asyncLoadingUserData = originalAsyncLoading
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let tempURL = FileManager.default.temporaryDirectory
+      .appendingPathComponent("vChewingTest_replacementsReload_\(UUID().uuidString).txt")
+    try "黏鐘 年終\n".write(to: tempURL, atomically: true, encoding: .utf8)
+    defer { try? FileManager.default.removeItem(at: tempURL) }
+    let instance = LMAssembly.LMInstantiator()
+    _ = instance.setOptions { config in
+      config.isPhraseReplacementEnabled = true
+    }
+    instance.replaceData(textData: "黏鐘 ㄋㄧㄢˊ-ㄓㄨㄥ -2.0\n", for: .thePhrases, save: false)
+    instance.loadReplacementsData(path: tempURL.path)
+    #expect(instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current) == ["年終"])
+
+    // 同步重新載入語彙置換表之後，不得沿用舊快取。
+    try "黏鐘 粘終\n".write(to: tempURL, atomically: true, encoding: .utf8)
+    instance.loadReplacementsData(path: tempURL.path)
+    #expect(instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current) == ["粘終"])
+  }
+
+  @Test
+  func testBulkImportUserPhrasesMergesOnceAndSaves() throws {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let tempURL = FileManager.default.temporaryDirectory
+      .appendingPathComponent("vChewingTest_bulkImport_\(UUID().uuidString).txt")
+    try "年終 ㄋㄧㄢˊ-ㄓㄨㄥ -1.0\n".write(to: tempURL, atomically: true, encoding: .utf8)
+    defer { try? FileManager.default.removeItem(at: tempURL) }
+    let instance = LMAssembly.LMInstantiator()
+    #expect(!instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current).contains("黏鐘"))
+    let phrases: [UserPhraseInsertable] = [
+      .init(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"], value: "年終", inputMode: .imeModeCHT),
+      .init(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"], value: "黏鐘", inputMode: .imeModeCHT),
+      .init(keyArray: ["ㄍㄠ", "ㄒㄧㄥˋ"], value: "高兴", inputMode: .imeModeCHS, isConverted: true),
+    ]
+    #expect(instance.bulkImportUserPhrases(phrases, path: tempURL.path) == 2)
+    // 使用者資料有變，不得沿用舊快取。
+    #expect(instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current) == ["年終", "黏鐘"])
+    let saved = try String(contentsOf: tempURL, encoding: .utf8)
+    // 載入時會整理格式（補上標頭），新資料則依讀音排序附加於既有內容之後。
+    #expect(saved.hasSuffix("年終 ㄋㄧㄢˊ-ㄓㄨㄥ -1.0\n黏鐘 ㄋㄧㄢˊ-ㄓㄨㄥ\n高兴 ㄍㄠ-ㄒㄧㄥˋ #𝙃𝙪𝙢𝙖𝙣𝘾𝙝𝙚𝙘𝙠𝙍𝙚𝙦𝙪𝙞𝙧𝙚𝙙\n"))
+    // 重複匯入時不會再寫入任何資料。
+    #expect(instance.bulkImportUserPhrases(phrases, path: tempURL.path) == 0)
+  }
+
+  @Test
+  func testBulkImportUserPhrasesLeavesUnreadableFileUntouched() throws {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let tempURL = FileManager.default.temporaryDirectory
+      .appendingPathComponent("vChewingTest_bulkImportUnreadable_\(UUID().uuidString).txt")
+    // 非法的 UTF-8 位元組序列，讀取必定失敗。
+    let corruptedData = Data([0x79, 0x65, 0x73, 0x20, 0xFF, 0xFE, 0x80, 0x0A])
+    try corruptedData.write(to: tempURL)
+    defer { try? FileManager.default.removeItem(at: tempURL) }
+    let instance = LMAssembly.LMInstantiator()
+    let phrases: [UserPhraseInsertable] = [
+      .init(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"], value: "黏鐘", inputMode: .imeModeCHT),
+    ]
+    #expect(instance.bulkImportUserPhrases(phrases, path: tempURL.path) == 0)
+    #expect(try Data(contentsOf: tempURL) == corruptedData)
+    #expect(!instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current).contains("黏鐘"))
+  }
+
+  @Test
+  func testBulkImportUserPhrasesSupersedesPendingAsyncLoad() async throws {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let tempURL = FileManager.default.temporaryDirectory
+      .appendingPathComponent("vChewingTest_bulkImportPending_\(UUID().uuidString).txt")
+    try "年終 ㄋㄧㄢˊ-ㄓㄨㄥ -1.0\n".write(to: tempURL, atomically: true, encoding: .utf8)
+    defer { try? FileManager.default.removeItem(at: tempURL) }
+    let instance = LMAssembly.LMInstantiator()
+    instance.loadUserPhrasesData(path: tempURL.path, filterPath: nil, async: true)
+    let phrases: [UserPhraseInsertable] = [
+      .init(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"], value: "黏鐘", inputMode: .imeModeCHT),
+    ]
+    #expect(instance.bulkImportUserPhrases(phrases, path: tempURL.path) == 1)
+    // 檔案讀取佇列是序列佇列，故這次讀取完成時，先前那次非同步載入的回呼也已執行完畢。
+    await withCheckedContinuation { continuation in
+      LMAssembly.readFileContentAsync(path: tempURL.path, shouldConsolidate: false) { _ in
+        continuation.resume()
+      }
+    }
+    let values = instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"]).map(\.current)
+    #expect(values.contains("年終"))
+    #expect(values.contains("黏鐘"))
+    let saved = try String(contentsOf: tempURL, encoding: .utf8)
+    #expect(saved.contains("年終 ㄋㄧㄢˊ-ㄓㄨㄥ -1.0\n"))
+    #expect(saved.contains("黏鐘 ㄋㄧㄢˊ-ㄓㄨㄥ\n"))
+  }
+
+  @Test
+  func testReplacementFilterAndDedupInSinglePass() {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let instance = LMAssembly.LMInstantiator()
+    _ = instance.setOptions { config in
+      config.isPhraseReplacementEnabled = true
+    }
+    instance.replaceData(
+      textData: "年終 ㄋㄧㄢˊ-ㄓㄨㄥ -1.0\n黏鐘 ㄋㄧㄢˊ-ㄓㄨㄥ -2.0\n粘鐘 ㄋㄧㄢˊ-ㄓㄨㄥ -3.0\n",
+      for: .thePhrases, save: false
+    )
+    instance.replaceData(textData: "粘鐘 ㄋㄧㄢˊ-ㄓㄨㄥ\n", for: .theFilter, save: false)
+    instance.replaceData(textData: "黏鐘 年終\n", for: .theReplacements, save: false)
+    // 「黏鐘」被置換成「年終」之後與既有的「年終」重複，僅留一筆；「粘鐘」被濾除。
+    let result = instance.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"])
+    #expect(result.map(\.current) == ["年終"])
+  }
+
+  /// 量測大型濾除表與語彙置換表對 `unigramsFor` 後處理階段的開銷。
+  @Test("[LMI] unigramsFor post-process benchmark with large user filter and replacements")
+  func testPostProcessBenchmarkWithLargeUserData() {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let instance = LMAssembly.LMInstantiator()
+    _ = instance.setOptions { config in
+      config.isPhraseReplacementEnabled = true
+    }
+    let syllables = ["ㄅㄚ", "ㄆㄚ", "ㄇㄚ", "ㄈㄚ", "ㄉㄚ", "ㄊㄚ", "ㄋㄚ", "ㄌㄚ"]
+    let keyArrays = syllables.flatMap { lhs in syllables.map { [lhs, $0] } }
+    var phrases = "", filter = "", replacements = ""
+    for (keyIndex, keyArray) in keyArrays.enumerated() {
+      let keyChain = keyArray.joined(separator: "-")
+      for phraseIndex in 0 ..< 24 {
+        phrases += "詞\(keyIndex)_\(phraseIndex) \(keyChain) -\(phraseIndex)\n"
+      }
+      filter += "詞\(keyIndex)_0 \(keyChain)\n"
+      replacements += "詞\(keyIndex)_1 換\(keyIndex)\n"
+    }
+    for i in 0 ..< 20_000 {
+      filter += "濾\(i) ㄅㄚ-ㄅㄚ-ㄅㄚ\n"
+      replacements += "替\(i) 換\(i)\n"
+    }
+    instance.replaceData(textData: phrases, for: .thePhrases, save: false)
+    instance.replaceData(textData: filter, for: .theFilter, save: false)
+    instance.replaceData(textData: replacements, for: .theReplacements, save: false)
+
+    let rounds = 20
+    var resultCount = 0
+    let elapsed = Self.nanosecondsElapsed {
+      for _ in 0 ..< rounds {
+        for keyArray in keyArrays {
+          instance.invalidateUnigramCache()
+          resultCount += instance.unigramsFor(keyArray: keyArray).count
+        }
+      }
+    }
+    // 每個讀音有一筆被濾除、一筆被置換。
+    #expect(resultCount == rounds * keyArrays.count * 23)
+    let queries = rounds * keyArrays.count
+    print("// [BENCH] LMI.unigramsFor with large filter/replacements: \(elapsed / UInt64(queries))ns per query")
+  }
+
+  /// 串流式摘要的內容須與 `summarize(all:)` 一致；寫出時每段交給輸出目標的資料量不超過緩衝上限（外加一筆記錄的餘裕）。
+  ///
+  /// 此處只檢查寫出器每次交出的分段大小，並不量測行程的記憶體峰值。
+  @Test("[LMI] Streaming user dictionary summary is equivalent and flushes in buffer-sized chunks")
+  func testStreamingUserDictionarySummaryFlushesBufferSizedChunks() throws {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    let instance = LMAssembly.LMInstantiator()
+    var phrases = ""
+    for i in 0 ..< 20_000 {
+      phrases += "詞\(i) ㄘˊ-ㄏㄨㄟˋ-\(i % 997) -\(i % 10).0\n"
+    }
+    phrases += "\"引\\號 ㄧㄣˇ-ㄏㄠˋ\n"
+    instance.replaceData(textData: phrases, for: .thePhrases, save: false)
+    instance.replaceData(textData: "粘鐘 ㄋㄧㄢˊ-ㄓㄨㄥ\n", for: .theFilter, save: false)
+    instance.replaceData(textData: "☆ ㄒㄧㄥ\n", for: .theSymbols, save: false)
+    instance.replaceData(textData: "黏鐘 年終\n", for: .theReplacements, save: false)
+    instance.replaceData(textData: "蛋糕 泡芙 布丁\n", for: .theAssociates, save: false)
+
+    let expected = instance.summarize(all: true)
+    var mismatchCount = 0
+    var userPhraseKeyCount = 0
+    for record in instance.summaryRecords(all: true).records(in: .userPhrases) {
+      userPhraseKeyCount += 1
+      if expected.userPhrases[record.key] != record.values { mismatchCount += 1 }
+    }
+    #expect(userPhraseKeyCount == expected.userPhrases.count)
+    #expect(mismatchCount == 0)
+    #expect(!instance.summaryRecords(all: false).contains { $0.category == .associates })
+
+    let bufferLimit = 4_096
+    var writer = LMAssembly.UserDictionarySummarized.StreamWriter(
+      target: ChunkRecorder(),
+      bufferLimit: bufferLimit
+    )
+    writer.writeJSON([instance.summaryRecords(all: true), instance.summaryRecords(all: false)])
+    let recorder = writer.target
+    #expect(recorder.chunkCount > 100)
+    // 緩衝一超過上限即整段交出，故每段至多比上限多出最後寫入的那一筆記錄。
+    #expect(recorder.maxChunkSize < bufferLimit + 512)
+    let decoded = try JSONDecoder().decode(
+      [LMAssembly.UserDictionarySummarized].self,
+      from: Data(recorder.output.utf8)
+    )
+    #expect(decoded == [expected, instance.summarize(all: false)])
+
+    var plainWriter = LMAssembly.UserDictionarySummarized.StreamWriter(target: "")
+    plainWriter.writePlainText(instance.summaryRecords(all: false))
+    let plainLines = plainWriter.target.split(separator: "\n")
+    let expectedLineCount = [expected.userPhrases, expected.filter, expected.userSymbols]
+      .reduce(expected.replacements.count) { $0 + $1.values.reduce(0) { $0 + $1.count } }
+    #expect(plainLines.count == expectedLineCount)
+  }
+
+  // MARK: Private
+
+  private static func nanosecondsElapsed(_ task: () -> ()) -> UInt64 {
+    let startTime = DispatchTime.now().uptimeNanoseconds
+    task()
+    return DispatchTime.now().uptimeNanoseconds - startTime
+  }
+}
+
+// MARK: - ChunkRecorder
+
+/// 記錄每次寫入的資料量的輸出目標。
+private struct ChunkRecorder: TextOutputStream {
+  var output = ""
+  var chunkCount = 0
+  var maxChunkSize = 0
+
+  mutating func write(_ string: String) {
+    chunkCount += 1
+    maxChunkSize = Swift.max(maxChunkSize, string.utf8.count)
+    output += string
+  }
 }
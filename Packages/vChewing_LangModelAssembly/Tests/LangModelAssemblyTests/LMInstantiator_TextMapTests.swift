@@ -465,6 +465,31 @@ struct LMInstantiatorTextMapTests {
     #expect(!gramsContainValue(strictSupersets, "exact"))
   }
 
+  @Test
+  func testChoppedStrictSupersetExpandsEachChoppedPossibility() throws {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+
+    let instance = LMAssembly.LMInstantiator(isCHS: true)
+    let textMap = makeTextMap([
+      ("A1-B2", [("exact", -9.9, 5)]),
+      ("A1-B2-C3", [("superset", -8.8, 5)]),
+      ("A1-B9-C3", [("otherChop", -8.7, 5)]),
+      ("A1-B7-C3", [("notChopped", -8.6, 5)]),
+    ])
+
+    #expect(LMAssembly.LMInstantiator.connectToTestFactoryDictionary(textMapData: textMap))
+
+    let strictSupersets = instance.factoryChoppedCoreUnigramsFor(
+      keyArray: ["A1", "B2&B9"],
+      strategy: .strictSuperset
+    )
+
+    #expect(strictSupersets.map(\.current) == ["superset", "otherChop"])
+    #expect(strictSupersets.first?.keyArray == ["A1", "B2", "C3"])
+  }
+
   @Test
   func testAssemblerFacadeMatchesLegacyUnigramSurface() throws {
     defer {
@@ -149,4 +149,99 @@ struct LMPlainBopomofoTests {
     // "ㄊㄚ": S==T，不應出現在表格中
     #expect(tables["ㄊㄚ"] == nil)
   }
+
+  /// 測試編入執行檔的預編譯表格與原始 JSON 資料一致。
+  ///
+  /// 若修改了 `jsnEtenDosSequence`，該測試會失敗，並將重新生成的 `lmPlainBopomofo_CompiledData.swift`
+  /// 寫入暫存目錄，屆時以之取代原檔即可。
+  @Test("[LMPlainBopomofo] compiled table is up to date with raw JSON data")
+  func testCompiledTableMatchesRawJSON() throws {
+    let dataMap = try #require(LMAssembly.LMPlainBopomofo.parseRawJSON())
+    let compiled = try #require(LMAssembly.LMPlainBopomofo.CompiledTable.compile(from: dataMap))
+    let isUpToDate = compiled.index == etenDosCompiledIndex.description
+      && compiled.pool == etenDosCompiledPool.description
+    if !isUpToDate,
+       let source = LMAssembly.LMPlainBopomofo.CompiledTable.generateSwiftSource(from: dataMap) {
+      let outputURL = FileManager.default.temporaryDirectory
+        .appendingPathComponent("lmPlainBopomofo_CompiledData.swift")
+      try source.write(to: outputURL, atomically: true, encoding: .utf8)
+      print("// Regenerated compiled ETen DOS table: \(outputURL.path)")
+    }
+    #expect(isUpToDate)
+  }
+
+  /// 測試預編譯表格的查詢結果與舊版（JSON 解碼後建立雜湊表）的結果逐一吻合。
+  @Test("[LMPlainBopomofo] compiled table matches legacy dictionary semantics")
+  func testCompiledTableMatchesLegacySemantics() throws {
+    let legacy = try #require(Self.makeLegacyTables())
+    let lm = LMAssembly.LMPlainBopomofo()
+    #expect(lm.count == legacy.dataMap.count)
+    for (reading, valueMap) in legacy.dataMap {
+      #expect(lm.hasValuesFor(key: reading))
+      for isCHS in [true, false] {
+        let candidates = valueMap[isCHS ? "S" : "T"] ?? ""
+        #expect(lm.valuesFor(key: reading, isCHS: isCHS) == candidates.map(\.description))
+        for target in Set((valueMap["S"] ?? "") + (valueMap["T"] ?? "")) {
+          let expected = legacy.distinctionTables[reading]?[isCHS]?.contains(target)
+          #expect(lm.isExclusive(isCHS: isCHS, reading: reading, target: target) == expected)
+        }
+      }
+    }
+    #expect(!lm.hasValuesFor(key: "ㄅㄧㄤ"))
+    #expect(lm.valuesFor(key: "ㄅㄧㄤ", isCHS: false).isEmpty)
+    for prefix in ["ㄅ", "ㄈㄥ", "ㄓㄨ", "ㄩㄥˇ"] {
+      var seen = Set<String>()
+      let expected = legacy.sortedKeys.filter { $0.hasPrefix(prefix) }.flatMap {
+        (legacy.dataMap[$0]?["T"] ?? "").map(\.description)
+      }.filter { seen.insert($0).inserted }
+      #expect(lm.partiallyMatchedValuesFor(prefix: prefix, isCHS: false) == expected)
+    }
+  }
+
+  /// 比較冷啟動開銷：舊版（JSON 解碼、排序、建立雜湊表）與預編譯表格。
+  @Test("[LMPlainBopomofo] cold-start benchmark")
+  func testColdStartBenchmark() throws {
+    var legacyResult: [String] = []
+    let legacyTime = Self.nanosecondsElapsed {
+      let legacy = Self.makeLegacyTables()
+      legacyResult = (legacy?.dataMap["ㄅㄚ˙"]?["T"] ?? "").map(\.description)
+    }
+    var compiledResult: [String] = []
+    let compiledTime = Self.nanosecondsElapsed {
+      let lm = LMAssembly.LMPlainBopomofo()
+      compiledResult = lm.valuesFor(key: "ㄅㄚ˙", isCHS: false)
+    }
+    #expect(legacyResult == compiledResult)
+    print("// [BENCH] LMPlainBopomofo cold start: legacy \(legacyTime / 1_000)µs, compiled \(compiledTime / 1_000)µs")
+  }
+
+  // MARK: Private
+
+  /// 重現舊版的初始化流程。
+  private static func makeLegacyTables() -> (
+    dataMap: LMAssembly.LMPlainBopomofo.DataMap,
+    sortedKeys: [String],
+    distinctionTables: LMAssembly.LMPlainBopomofo.KVHashMap
+  )? {
+    guard let rawJSON = LMAssembly.LMPlainBopomofo.parseRawJSON() else { return nil }
+    var dataMap = rawJSON
+    if let fung4 = dataMap["ㄈㄨㄥˋ"] {
+      fung4.forEach { fKey, fValue in
+        if let existingValue = dataMap["ㄈㄥˋ"]?[fKey] {
+          dataMap["ㄈㄥˋ", default: [:]][fKey] = existingValue + fValue
+        }
+      }
+    }
+    let sortedKeys = rawJSON.keys.sorted {
+      if $0.count == $1.count { return $0 < $1 }
+      return $0.count < $1.count
+    }
+    return (dataMap, sortedKeys, LMAssembly.LMPlainBopomofo.generateDistinctionHashTables(using: dataMap))
+  }
+
+  private static func nanosecondsElapsed(_ task: () -> ()) -> UInt64 {
+    let startTime = DispatchTime.now().uptimeNanoseconds
+    task()
+    return DispatchTime.now().uptimeNanoseconds - startTime
+  }
 }
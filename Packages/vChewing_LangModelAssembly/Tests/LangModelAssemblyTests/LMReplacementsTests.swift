@@ -83,6 +83,22 @@ struct LMReplacementsTests {
     #expect(lmTest.valuesFor(key: "芙寧娜").isEmpty)
   }
 
+  @Test
+  func testKeyBitsetHasNoFalseNegatives() throws {
+    var lmTest = LMAssembly.LMReplacements()
+    #expect(!lmTest.mightHaveValuesFor(key: "芙寧娜"))
+    let keys = (0 ..< 5_000).map { "置換\($0)" }
+    lmTest.replaceData(textData: keys.map { "\($0) 值" }.joined(separator: "\n"))
+    #expect(keys.allSatisfy { lmTest.mightHaveValuesFor(key: $0) })
+    #expect(keys.allSatisfy { lmTest.valuesFor(key: $0) == "值" })
+    // 誤判只會導致多做一次二分搜尋，不影響查詢結果。
+    let falsePositives = (0 ..< 5_000).filter { lmTest.mightHaveValuesFor(key: "其他\($0)") }.count
+    #expect(falsePositives < 250)
+    #expect(lmTest.valuesFor(key: "其他0").isEmpty)
+    lmTest.clear()
+    #expect(!lmTest.mightHaveValuesFor(key: "置換0"))
+  }
+
   @Test
   func testSaveDataRoundTrip() throws {
     var lmTest = LMAssembly.LMReplacements()
@@ -579,5 +579,65 @@ extension POMTestSuite {
         #expect(multiSegmentCandidate.value == "奇")
       }
     }
+
+    /// 驗證 LMI 對 POM 建議查詢結果的快取：同一組句世代與游標的重複查詢應命中快取，
+    /// 而記憶資料變動或重新組句後應重新查詢。
+    @Test
+    func testPOM_AC05_SuggestionMemoInvalidation() throws {
+      let lm = TestLM(rawData: LMATestsData.strDataCase4DuoQi)
+      let lmi = LMAssembly.LMInstantiator(isCHS: false, pomDataURL: nullURL)
+      let compositor = Homa.Assembler(gramQuerier: lm.asGramQuerier())
+      for key in ["ㄉㄨㄛ", "ㄑㄧˊ"] { try compositor.insertKey(key) }
+      compositor.assemble()
+      lmi.memorizePerception(("()&(ㄉㄨㄛ,多)&(ㄑㄧˊ,奇)", "奇"), timestamp: nowTimeStamp) {}
+
+      let first = lmi.fetchPOMSuggestion(
+        assembler: compositor, cursor: compositor.cursor, timestamp: nowTimeStamp
+      )
+      let second = lmi.fetchPOMSuggestion(
+        assembler: compositor, cursor: compositor.cursor, timestamp: nowTimeStamp + 0.1
+      )
+      #expect(lmi.pomSuggestionCacheStats.hits == 1)
+      #expect(lmi.pomSuggestionCacheStats.misses == 1)
+      #expect(first.candidates.map(\.value) == second.candidates.map(\.value))
+      #expect(first.overrideCursor == second.overrideCursor)
+
+      // 記憶資料變動 -> 快取失效。
+      lmi.memorizePerception(("()&(ㄉㄨㄛ,多)&(ㄑㄧˊ,期)", "期"), timestamp: nowTimeStamp) {}
+      _ = lmi.fetchPOMSuggestion(
+        assembler: compositor, cursor: compositor.cursor, timestamp: nowTimeStamp
+      )
+      #expect(lmi.pomSuggestionCacheStats.misses == 2)
+
+      // 重新組句 -> 快取失效。
+      compositor.assemble()
+      _ = lmi.fetchPOMSuggestion(
+        assembler: compositor, cursor: compositor.cursor, timestamp: nowTimeStamp
+      )
+      #expect(lmi.pomSuggestionCacheStats.misses == 3)
+
+      // 時間戳相差過大 -> 不得重用。
+      _ = lmi.fetchPOMSuggestion(
+        assembler: compositor, cursor: compositor.cursor, timestamp: nowTimeStamp + dayInSeconds
+      )
+      #expect(lmi.pomSuggestionCacheStats.misses == 4)
+      #expect(lmi.pomSuggestionCacheStats.hits == 1)
+
+      // 注入測試建議 -> 快取失效；消耗掉注入建議的查詢結果不予快取。
+      var injected = LMAssembly.OverrideSuggestion()
+      injected.candidates = [(keyArray: ["ㄑㄧˊ"], value: "騎", probability: -1, previous: nil)]
+      lmi.lxPerceptor.testInjectedSuggestion = injected
+      let consumed = lmi.fetchPOMSuggestion(
+        assembler: compositor, cursor: compositor.cursor, timestamp: nowTimeStamp + dayInSeconds
+      )
+      #expect(consumed.candidates.map(\.value) == ["騎"])
+      #expect(lmi.lxPerceptor.testInjectedSuggestion == nil)
+      let afterConsumption = lmi.fetchPOMSuggestion(
+        assembler: compositor, cursor: compositor.cursor, timestamp: nowTimeStamp + dayInSeconds
+      )
+      #expect(afterConsumption.candidates.map(\.value) != ["騎"])
+      #expect(lmi.pomSuggestionCacheStats.misses == 6)
+      #expect(lmi.pomSuggestionCacheStats.hits == 1)
+    }
   }
 }
@@ -101,6 +101,88 @@ extension TrieJoinedTestSuite {
     #expect(actualkeysJoined == "ㄧㄡ ㄉㄧㄝˊ ㄋㄥˊ ㄌㄧㄡˊ ㄧˋ ㄌㄩˇ ㄈㄤ")
   }
 
+  @Test(
+    "[LMA] TrieJoined_SupersetKeyChainMatchesBenchmark",
+  )
+  func testTrieJoinedSupersetKeyChainMatchesBenchmark() throws {
+    let textMapData = LMATestsData.textMapTestCoreLMData
+    let trie = try VanguardTrie.TextMapTrie(data: Data(textMapData.utf8))
+    // 收集辭典內所有多音節鍵鏈的一音節與二音節前綴。
+    let keyChains = textMapData
+      .components(separatedBy: "#PRAGMA:VANGUARD_HOMA_LEXICON_KEY_LINE_MAP").last?
+      .split(separator: "\n")
+      .compactMap { $0.split(separator: "\t").first?.split(separator: "-").map(String.init) } ?? []
+    var prefixes: [[String]] = []
+    var handledPrefixes = Set<[String]>()
+    for keyArray in keyChains where keyArray.count > 1 {
+      for length in 1 ... Swift.min(2, keyArray.count - 1) {
+        let prefix = Array(keyArray.prefix(length))
+        if handledPrefixes.insert(prefix).inserted { prefixes.append(prefix) }
+      }
+    }
+    #expect(!prefixes.isEmpty)
+
+    var viewResults: [[[String]]] = []
+    Self.measureTime("Superset views for \(prefixes.count) prefixes", tag: "(KeyChainMatch)") {
+      viewResults = prefixes.map { trie.supersetKeyChainMatches(prefixing: $0).map(\.keyArray) }
+    }
+    trie.flushCaches()
+    var nodeResults: [[[String]]] = []
+    Self.measureTime("Superset nodes for \(prefixes.count) prefixes", tag: "(getNodes)") {
+      nodeResults = prefixes.map { prefix in
+        trie.getNodes(
+          keyArray: prefix,
+          filterType: [],
+          partiallyMatch: false,
+          longerSegment: true
+        ).map { $0.readingKey.split(separator: "-").map(String.init) }
+      }
+    }
+    #expect(viewResults == nodeResults)
+    #expect(viewResults.allSatisfy { !$0.isEmpty })
+
+    // 結果上限只截斷鍵鏈，不影響既有順序。
+    for (prefix, fullResult) in zip(prefixes, viewResults) {
+      let capped = trie.supersetKeyChainMatches(prefixing: prefix, limit: 1).map(\.keyArray)
+      #expect(capped == Array(fullResult.prefix(1)))
+    }
+  }
+
+  @Test(
+    "[LMA] TrieJoined_SupersetLookupHonoursConfiguredCapOnLargeTrie",
+  )
+  func testTrieJoinedSupersetLookupHonoursConfiguredCapOnLargeTrie() throws {
+    defer {
+      LMAssembly.LMInstantiator.disconnectFactoryDictionary()
+    }
+    // 生成與完整原廠辭典同量級的鍵鏈（四萬餘個），使單音節前綴對應上千個嚴格超集。
+    let (textMapData, supersetCountPerInitial) = Self.makeLargeTextMap(columnWidth: 34)
+    #expect(supersetCountPerInitial > 1_000)
+    let trie = try VanguardTrie.TextMapTrie(data: Data(textMapData.utf8))
+    #expect(trie.supersetKeyChainMatches(prefixing: ["a00"]).count == supersetCountPerInitial)
+
+    #expect(LMAssembly.LMInstantiator.connectToTestFactoryDictionary(textMapData: textMapData))
+    let instance = LMAssembly.LMInstantiator(isCHS: false)
+    let cap = instance.config.factorySupersetLookupLimit
+    #expect(cap > 0 && cap < supersetCountPerInitial)
+
+    var grams: [Homa.Gram] = []
+    Self.measureTime("Capped superset grams for a single initial", tag: "(Large TextMap)") {
+      grams = instance.factoryCoreUnigramsFor(key: "a00", keyArray: ["a00"], strategy: .strictSuperset)
+    }
+    #expect(grams.count == cap)
+    #expect(grams.allSatisfy { $0.keyArray.count > 1 && $0.keyArray.first == "a00" })
+    let chopped = instance.factoryChoppedCoreUnigramsFor(keyArray: ["a00&a01"], strategy: .strictSuperset)
+    #expect(chopped.count == cap)
+
+    // 上限可經由設定調整，且只截斷結果、不影響既有順序。
+    instance.setOptions { config in
+      config.factorySupersetLookupLimit = 3
+    }
+    let narrowed = instance.factoryCoreUnigramsFor(key: "a00", keyArray: ["a00"], strategy: .strictSuperset)
+    #expect(narrowed.map(\.current) == Array(grams.prefix(3).map(\.current)))
+  }
+
   private static func measureTime(
     _ memo: String,
     tag: String,
@@ -118,6 +200,43 @@ extension TrieJoinedTestSuite {
     print("[Sitrep \(tag)] \(memo): \(timeCost)ms.")
   }
 
+  /// 生成三音節為主的合成 TextMap：每個鍵鏈各有一筆繁體中文詞條。
+  /// - Returns: TextMap 內容、以及每個單音節前綴所對應的嚴格超集鍵鏈數量。
+  private static func makeLargeTextMap(columnWidth: Int) -> (textMapData: String, supersetCountPerInitial: Int) {
+    let syllables: (Character) -> [String] = { initial in
+      (0 ..< columnWidth).map { "\(initial)\($0 < 10 ? "0" : "")\($0)" }
+    }
+    var keyChains: [String] = []
+    for first in syllables("a") {
+      keyChains.append(first)
+      for second in syllables("b") {
+        keyChains.append("\(first)-\(second)")
+        for third in syllables("c") {
+          keyChains.append("\(first)-\(second)-\(third)")
+        }
+      }
+    }
+    keyChains.sort()
+    var valueLines: [String] = []
+    var keyLines: [String] = []
+    for (lineID, keyChain) in keyChains.enumerated() {
+      valueLines.append("詞\(lineID)\t-\(5 + Double(lineID % 7) / 10)\t6")
+      keyLines.append("\(keyChain)\t\(lineID)\t1")
+    }
+    let header = [
+      "#PRAGMA:VANGUARD_HOMA_LEXICON_HEADER",
+      "VERSION\t1.1",
+      "TYPE\tTYPING",
+      "READING_SEPARATOR\t-",
+      "ENTRY_COUNT\t\(valueLines.count)",
+      "KEY_COUNT\t\(keyLines.count)",
+      "#PRAGMA:VANGUARD_HOMA_LEXICON_VALUES",
+    ]
+    let textMapData = (header + valueLines + ["#PRAGMA:VANGUARD_HOMA_LEXICON_KEY_LINE_MAP"] + keyLines)
+      .joined(separator: "\n") + "\n"
+    return (textMapData, columnWidth + columnWidth * columnWidth)
+  }
+
   private static func makeFactoryGramQuerier(
     trie: VanguardTrie.TextMapTrie,
     partiallyMatch: Bool
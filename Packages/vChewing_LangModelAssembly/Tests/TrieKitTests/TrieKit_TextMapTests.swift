@@ -272,6 +272,76 @@ struct TrieKitTextMapTests {
     #expect(longerValues == ["B", "C"])
   }
 
+  @Test("[TrieKit] TextMapTrie key chain match views cover superset and chopped queries")
+  func testTextMapTrieKeyChainMatchViews() throws {
+    let textMap = """
+    #PRAGMA:VANGUARD_HOMA_LEXICON_HEADER
+    VERSION\t1.1
+    TYPE\tTRIE_TEXTMAP
+    READING_SEPARATOR\t-
+    ENTRY_COUNT\t5
+    KEY_COUNT\t5
+    DEFAULT_PROB_1\t-1
+    #PRAGMA:VANGUARD_HOMA_LEXICON_VALUES
+    >1\tA
+    >1\tB
+    >1\tC
+    >1\tD
+    >1\tE
+    #PRAGMA:VANGUARD_HOMA_LEXICON_KEY_LINE_MAP
+    ab\t0\t1
+    ab-cd\t1\t1
+    ab-ce\t2\t1
+    ab-ce-fg\t3\t1
+    ax-cd\t4\t1
+    """
+
+    let lazyTrie = try VanguardTrie.TextMapTrie(data: Data(textMap.utf8))
+
+    // 嚴格超集：與 getNodes(longerSegment: true) 涵蓋相同的鍵鏈，且讀音陣列已預先算好。
+    let supersets = lazyTrie.supersetKeyChainMatches(prefixing: ["ab"])
+    let supersetNodes = lazyTrie.getNodes(
+      keyArray: ["ab"],
+      filterType: [],
+      partiallyMatch: false,
+      longerSegment: true
+    )
+    #expect(supersets.map(\.keyChainID) == supersetNodes.map(\.id))
+    #expect(supersets.map(\.keyArray) == [["ab", "cd"], ["ab", "ce"], ["ab", "ce", "fg"]])
+    #expect(supersets.flatMap { $0.entries() }.map(\.value) == ["B", "C", "D"])
+    #expect(lazyTrie.supersetKeyChainMatches(prefixing: ["ab", "ce"]).map(\.keyArray) == [["ab", "ce", "fg"]])
+    #expect(lazyTrie.supersetKeyChainMatches(prefixing: ["ab"], limit: 2).map(\.keyArray.count) == [2, 2])
+    #expect(lazyTrie.supersetKeyChainMatches(prefixing: ["a"]).isEmpty)
+
+    // 切片讀音：結果與 getEntryGroups(keysChopped:) 一致。
+    let chopped = lazyTrie.choppedKeyChainMatches(keysChopped: ["ab&ax", "cd"], partiallyMatch: false)
+    let choppedGroups = lazyTrie.getEntryGroups(
+      keysChopped: ["ab&ax", "cd"],
+      filterType: [],
+      partiallyMatch: false
+    )
+    #expect(chopped.map(\.keyArray) == choppedGroups.map(\.keyArray))
+    #expect(chopped.flatMap { $0.entries() }.map(\.value) == ["B", "E"])
+    let partial = lazyTrie.choppedKeyChainMatches(keysChopped: ["a", "c"], partiallyMatch: true)
+    #expect(partial.map(\.keyArray) == [["ab", "cd"], ["ab", "ce"], ["ax", "cd"]])
+    #expect(lazyTrie.choppedKeyChainMatches(keysChopped: ["ab"], partiallyMatch: false).map(\.keyChainID) == [0])
+
+    // 切片讀音的嚴格超集：逐一展開各讀音位置的可能性。
+    let choppedSupersets = lazyTrie.choppedKeyChainMatches(
+      keysChopped: ["ab&ax"],
+      partiallyMatch: false,
+      longerSegment: true,
+      limit: 3
+    )
+    #expect(choppedSupersets.map(\.keyArray) == [["ab", "cd"], ["ab", "ce"], ["ab", "ce", "fg"]])
+    let allChoppedSupersets = lazyTrie.choppedKeyChainMatches(
+      keysChopped: ["ab&ax"],
+      partiallyMatch: false,
+      longerSegment: true
+    )
+    #expect(allChoppedSupersets.last?.keyArray == ["ax", "cd"])
+  }
+
   @Test("[TrieKit] TextMap auto-generated RevLookup indexes single-segment @ lines and CNS entries")
   func testTextMapAutoGeneratedRevLookupIndexesSingleSegmentGroupedLinesAndCNSEntries() throws {
     let revLookupType = VanguardTrie.Trie.EntryType(rawValue: 3)
@@ -371,4 +441,51 @@ struct TrieKitTextMapTests {
     #expect(trie.reverseLookup(for: "宜") == ["i2"])
     #expect(trie.reverseLookup(for: "𡜅") == ["lv3"])
   }
+
+  @Test("[TrieKit] TextMapTrie builds reverse lookup index in background")
+  func testTextMapTrieBuildsReverseLookupIndexInBackground() throws {
+    let textMap = """
+    #PRAGMA:VANGUARD_HOMA_LEXICON_HEADER
+    VERSION\t1.1
+    TYPE\tTYPING
+    READING_SEPARATOR\t-
+    ENTRY_COUNT\t3
+    KEY_COUNT\t3
+    #PRAGMA:VANGUARD_HOMA_LEXICON_VALUES
+    @-9.9\t宜\t宜
+    @-8.8\t便宜\t便宜
+    𡜅\t-11\t7
+    #PRAGMA:VANGUARD_HOMA_LEXICON_KEY_LINE_MAP
+    i2\t0\t1
+    bi4-i2\t1\t1
+    lv3\t2\t1
+    """
+
+    let trie = try VanguardTrie.TextMapTrie(data: Data(textMap.utf8))
+    #expect(!trie.isReverseLookupIndexReady)
+    let semaphore = DispatchSemaphore(value: 0)
+    trie.prepareReverseLookupIndexInBackground { semaphore.signal() }
+    semaphore.wait()
+    #expect(trie.isReverseLookupIndexReady)
+    #expect(trie.reverseLookupIndexBuildProgress == 1)
+    #expect(trie.reverseLookupIfReady(for: "宜") == ["i2"])
+    #expect(trie.reverseLookup(for: "𡜅") == ["lv3"])
+
+    // Flush 之後，不阻塞的反查應先回傳 nil，並於背景重建索引。
+    trie.flushReverseLookupIndex()
+    #expect(trie.reverseLookupIfReady(for: "宜") == nil)
+    // 阻塞版反查會等待背景建立完畢並直接收編其結果。
+    #expect(trie.reverseLookup(for: "宜") == ["i2"])
+    #expect(trie.isReverseLookupIndexReady)
+
+    // 建立期間重複登記的回呼會排在進行中的建立工作之後，且各自只會被呼叫一次。
+    trie.flushReverseLookupIndex()
+    let group = DispatchGroup()
+    group.enter()
+    group.enter()
+    trie.prepareReverseLookupIndexInBackground { group.leave() }
+    trie.prepareReverseLookupIndexInBackground { group.leave() }
+    group.wait()
+    #expect(trie.isReverseLookupIndexReady)
+  }
 }
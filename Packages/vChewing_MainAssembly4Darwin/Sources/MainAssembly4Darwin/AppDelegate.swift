@@ -145,14 +145,13 @@ extension AppDelegate {
     }
 
     // 核心辭典連線、磁帶載入、使用者語模初期化：
-    // 延後至下一個 RunLoop 迭代以避免阻塞 applicationWillFinishLaunching。
-    asyncOnMain {
-      LMMgr.connectCoreDB()
-      LMMgr.loadCassetteData()
-      LMMgr.initUserLangModels()
-      Self.folderMonitor.withLock { lockedMonitor in
-        lockedMonitor.folderDidChange = { Self.reloadOnFolderChangeHappens() }
-        if LMMgr.userDataFolderExists { lockedMonitor.startMonitoring() }
+    // 交給冷啟動編排器依相依關係排程（皆不早於下一個 RunLoop 迭代），以避免阻塞 applicationWillFinishLaunching。
+    LMMgr.performColdStart { orchestrator in
+      orchestrator.addMainStage("folderMonitor", dependsOn: [ColdStartPlan.Stage.userLangModels.rawValue]) {
+        Self.folderMonitor.withLock { lockedMonitor in
+          lockedMonitor.folderDidChange = { Self.reloadOnFolderChangeHappens() }
+          if LMMgr.userDataFolderExists { lockedMonitor.startMonitoring() }
+        }
       }
     }
 
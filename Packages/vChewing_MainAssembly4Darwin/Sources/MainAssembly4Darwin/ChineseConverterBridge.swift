@@ -11,10 +11,20 @@ import Foundation
 extension ChineseConverter {
   // MARK: Public
 
-  private static let hotenkaSingleton: HotenkaChineseConverter? = {
-    guard let path = LMMgr.getBundleDataPath("convdict", ext: "stringmap") else { return nil }
-    return try? HotenkaChineseConverter(stringMapPath: path)
-  }()
+  /// 繁簡轉換辭典。冷啟動時會經由 `makePrewarmer()` 在背景佇列上載入，否則於首次使用時載入。
+  private static var hotenkaSingleton: HotenkaChineseConverter? {
+    if let loaded = mtxHotenka.value { return loaded }
+    return loadHotenka(stringMapPath: LMMgr.getBundleDataPath("convdict", ext: "stringmap"))
+  }
+
+  /// 預先載入繁簡轉換辭典，以免首次轉換時才承擔解析開銷。
+  ///
+  /// 辭典路徑須在主執行緒上解析（受偏好設定影響），故於此處先行取得；
+  /// 回傳的閉包則只負責解析辭典，可交給冷啟動流程在背景佇列上執行。
+  public static func makePrewarmer() -> @Sendable () -> () {
+    let path = LMMgr.getBundleDataPath("convdict", ext: "stringmap")
+    return { _ = loadHotenka(stringMapPath: path) }
+  }
 
   /// CrossConvert.
   ///
@@ -56,12 +66,22 @@ extension ChineseConverter {
     hotenkaSingleton?.convert(strObj, to: .zhHantKX) ?? strObj
   }
 
+  public static func cnvTradToKangXi(_ strObjs: [String]) -> [String] {
+    hotenkaSingleton?.convert(strObjs, to: .zhHantKX) ?? strObjs
+  }
+
   public static func cnvTradToJIS(_ strObj: String) -> String {
+    cnvTradToJIS([strObj])[0]
+  }
+
+  public static func cnvTradToJIS(_ strObjs: [String]) -> [String] {
     // 該轉換是由康熙繁體轉換至日語當用漢字的，所以需要先跑一遍康熙轉換。
-    let strObj = cnvTradToKangXi(strObj)
-    var result = hotenkaSingleton?.convert(strObj, to: .zhHansJP) ?? strObj
-    processKanjiRepeatSymbol(target: &result)
-    return result
+    // 兩趟轉換各自以批次處理，同一趟內的所有內容共用 Hotenka 的暫存緩衝區。
+    var results = hotenkaSingleton?.convert(strObjs, through: [.zhHantKX, .zhHansJP]) ?? strObjs
+    for index in results.indices {
+      processKanjiRepeatSymbol(target: &results[index])
+    }
+    return results
   }
 
   /// 影響繁簡轉換結果的 config 快照；任一項變動都會使對應快取條目失效。
@@ -88,35 +108,64 @@ extension ChineseConverter {
   private static var kanjiConversionCache: [String: (result: String, config: KanjiConversionConfig)] = [:]
   private static let kanjiConversionCacheLock = NSLock()
 
+  /// 繁簡轉換辭典的載入結果（外層為 nil 表示尚未載入；內層為 nil 表示載入失敗）。
+  nonisolated private static let mtxHotenka = NSMutex<HotenkaChineseConverter??>(nil)
+
+  /// 載入繁簡轉換辭典。已載入（或已載入失敗）時直接沿用先前的結果；同時只會有一個執行緒在載入。
+  nonisolated private static func loadHotenka(stringMapPath path: String?) -> HotenkaChineseConverter? {
+    mtxHotenka.withLock { loaded in
+      if let loaded { return loaded }
+      let converter = path.flatMap { try? HotenkaChineseConverter(stringMapPath: $0) }
+      loaded = .some(converter)
+      return converter
+    }
+  }
+
   public static func kanjiConversionIfRequired(_ text: String) -> String {
+    kanjiConversionIfRequired([text])[0]
+  }
+
+  /// 批次處理繁簡轉換（比如選字窗內的所有候選字），未命中快取的內容會一併交給 Hotenka 批次轉換。
+  public static func kanjiConversionIfRequired(_ texts: [String]) -> [String] {
     let config = KanjiConversionConfig.current
+    var results = texts
+    var missedIndices: [Int] = []
     kanjiConversionCacheLock.lock()
-    if let cached = kanjiConversionCache[text], cached.config == config {
-      kanjiConversionCacheLock.unlock()
-      return cached.result
+    for (index, text) in texts.enumerated() {
+      if let cached = kanjiConversionCache[text], cached.config == config {
+        results[index] = cached.result
+      } else {
+        missedIndices.append(index)
+      }
     }
     kanjiConversionCacheLock.unlock()
-    let result = performKanjiConversionIfRequired(text)
+    guard !missedIndices.isEmpty else { return results }
+    let converted = performKanjiConversionIfRequired(missedIndices.map { texts[$0] })
     kanjiConversionCacheLock.lock()
-    if kanjiConversionCache.count >= 4_096 { kanjiConversionCache.removeAll() }
-    kanjiConversionCache[text] = (result: result, config: config)
+    if kanjiConversionCache.count + missedIndices.count > 4_096 { kanjiConversionCache.removeAll() }
+    for (index, result) in zip(missedIndices, converted) {
+      results[index] = result
+      kanjiConversionCache[texts[index]] = (result: result, config: config)
+    }
     kanjiConversionCacheLock.unlock()
-    return result
+    return results
   }
 
-  private static func performKanjiConversionIfRequired(_ text: String) -> String {
-    var text = text
-    if PrefMgr.shared.cassetteEnabled { cassetteConvert(&text) }
-    guard IMEApp.currentInputMode == .imeModeCHT else { return text }
+  private static func performKanjiConversionIfRequired(_ texts: [String]) -> [String] {
+    var texts = texts
+    if PrefMgr.shared.cassetteEnabled {
+      for index in texts.indices { cassetteConvert(&texts[index]) }
+    }
+    guard IMEApp.currentInputMode == .imeModeCHT else { return texts }
     switch (
       PrefMgr.shared.chineseConversionEnabled,
       PrefMgr.shared.shiftJISShinjitaiOutputEnabled
     ) {
-    case (false, true): return Self.cnvTradToJIS(text)
-    case (true, false): return Self.cnvTradToKangXi(text)
+    case (false, true): return Self.cnvTradToJIS(texts)
+    case (true, false): return Self.cnvTradToKangXi(texts)
     // 本來這兩個開關不該同時開啟的，但萬一被同時開啟了的話就這樣處理：
-    case (true, true): return Self.cnvTradToJIS(text)
-    case (false, false): return text
+    case (true, true): return Self.cnvTradToJIS(texts)
+    case (false, false): return texts
     }
   }
 }
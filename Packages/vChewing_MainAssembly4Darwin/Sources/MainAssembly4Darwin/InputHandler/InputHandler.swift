@@ -70,6 +70,10 @@ public final class InputHandler: @MainActor InputHandlerProtocol {
 
   /// 用來記錄「叫出選字窗前」的游標位置的變數。
   public var backupCursor: Int?
+  /// 組字區索引的快取，由 `compositionBufferIndex()` 負責維護。
+  public var compositionBufferIndexCache: CompositionBufferIndex?
+  /// 中英混輸緩衝區索引的快取，由 `withMixedAlphanumericalBufferIndex()` 負責維護。
+  public var mixedAlphanumericalBufferIndexCache: MixedAlphanumericalBufferIndex?
   /// 當前的打字模式。
   public var currentTypingMethod: TypingMethod = .vChewingFactory
 
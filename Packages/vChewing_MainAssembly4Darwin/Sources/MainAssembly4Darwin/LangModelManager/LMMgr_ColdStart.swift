@@ -0,0 +1,69 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+
+// MARK: - LMMgr + ColdStart
+
+extension LMMgr {
+  /// 最近一次冷啟動所用的編排器，可用來查詢各元件的就緒狀態與載入報告。
+  public private(set) static var coldStart: StartupOrchestrator?
+
+  /// 依照 `ColdStartPlan` 載入原廠辭典、磁帶、使用者辭典等元件。
+  /// - Parameter additionalStages: 供呼叫端在啟動前追加自己的元件（比如資料夾監視器）。
+  public static func performColdStart(
+    additionalStages: ((StartupOrchestrator) -> ())? = nil
+  ) {
+    let prefs = PrefMgr.shared
+    // 原廠辭典的路徑受偏好設定影響，故先於主執行緒上解析；實際的載入則在背景佇列上進行。
+    let coreDBPath = getCoreDictionaryDBPath()
+    let loaders = ColdStartPlan.Loaders(
+      factoryDictionary: { done in
+        Self.loadCoreDB(dbPath: coreDBPath)
+        done()
+      },
+      cassette: { done in
+        Self.loadCassetteData { _ in done() }
+      },
+      isCassetteCritical: prefs.cassetteEnabled,
+      userLangModels: { done in
+        Self.initUserLangModels()
+        // 使用者辭典的讀取排在 fileHandleQueue 上，待其清空後才算載入完畢。
+        LMAssembly.afterPendingFileLoads { done() }
+      },
+      // 繁簡轉換辭典只在有啟用任何轉換功能時才需要預熱。
+      chineseConverter: Self.needsChineseConverter(prefs) ? ChineseConverter.makePrewarmer() : nil,
+      // 拼音排列的 rawValue 與 KeyboardParser 一致；注音排列不需要預熱，故無需對照。
+      parser: Tekkon.MandarinParser(rawValue: prefs.keyboardParser)
+    )
+    let orchestrator = ColdStartPlan.makeOrchestrator(loaders: loaders)
+    additionalStages?(orchestrator)
+    orchestrator.whenAllReady {
+      vCLog("ColdStart finished.\n\(orchestrator.dump())")
+    }
+    coldStart = orchestrator
+    orchestrator.start()
+  }
+
+  /// 首次按鍵時若原廠辭典正在載入，則短暫等待其完成。
+  ///
+  /// 原廠辭典整個在背景佇列上載入、不需要主執行緒參與，故此處不運轉 RunLoop，以免在處理按鍵事件的途中重入。
+  /// - Returns: 原廠辭典是否已可用。
+  public static func waitForFactoryDictionary(timeout: TimeInterval) -> Bool {
+    guard !isCoreDBConnected else { return true }
+    guard let coldStart, coldStart.phase(of: .factoryDictionary) != .ready else { return false }
+    coldStart.waitUntilReady([.factoryDictionary], timeout: timeout, spinsMainRunLoop: false)
+    return isCoreDBConnected
+  }
+
+  /// 是否有啟用任何會用到繁簡轉換辭典的功能。
+  private static func needsChineseConverter(_ prefs: PrefMgr) -> Bool {
+    if prefs.chineseConversionEnabled || prefs.shiftJISShinjitaiOutputEnabled { return true }
+    return prefs.cassetteEnabled && prefs.forceCassetteChineseConversion != 0
+  }
+}
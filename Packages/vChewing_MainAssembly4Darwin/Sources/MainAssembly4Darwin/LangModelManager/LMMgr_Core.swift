@@ -151,33 +151,47 @@ public final class LMMgr {
     Self.loadUserPhraseReplacement()
   }
 
-  // When asyncLoadingUserData is true, connectFactoryDictionary dispatches
-  // the heavy work to a background queue; callers must treat the load state as pending
-  // until the completion handler reports the final result. The FSM already guards against
-  // unloaded factory dictionaries
-  // (InputSession_HandleEvent shows "Factory dictionary not loaded yet." tooltip).
+  /// 連線原廠辭典。
+  ///
+  /// 實際載入交由 `loadCoreDB(dbPath:)` 處理：`asyncLoadingUserData` 為 true 時排在 fileHandleQueue 上、
+  /// 否則直接在當前執行緒上同步載入。非同步載入期間，既有的原廠辭典連線會保留到新的辭典載入完畢為止；
+  /// 若此前尚未連線，FSM 會以「Factory dictionary not loaded yet.」工具提示應對。
+  /// - Parameter dbPath: 原廠辭典的路徑；nil 則採用偏好設定所指定的路徑。
   public static func connectCoreDB(dbPath: String? = nil) {
-    guard let path: String = dbPath ?? Self.getCoreDictionaryDBPath() else {
+    let path = dbPath ?? Self.getCoreDictionaryDBPath()
+    guard LMAssembly.LMInstantiator.asyncLoadingUserData else {
+      Self.loadCoreDB(dbPath: path)
+      return
+    }
+    LMAssembly.fileHandleQueue.async {
+      Self.loadCoreDB(dbPath: path)
+    }
+  }
+
+  /// 在當前執行緒上同步載入原廠辭典，供冷啟動流程在背景佇列上呼叫。
+  /// - Parameter dbPath: 原廠辭典的路徑。該路徑受偏好設定影響，須由呼叫端事先於主執行緒上解析。
+  nonisolated static func loadCoreDB(dbPath: String?) {
+    guard let path = dbPath else {
       preconditionFailure("vChewing factory TextMap data not found.")
     }
-    Notifier.notify(
-      message: "i18n:LMMgr.notification.FactoryLexiconLoadingStarted".i18n
-    )
-    LMAssembly.LMInstantiator.connectFactoryDictionary(
-      textMapPath: path
-    ) { resultBool in
-      precondition(resultBool, "vChewing factory TextMap loading failed.")
-      asyncOnMain {
-        Notifier.notify(
-          message: "i18n:LMMgr.notification.FactoryLexiconLoadingComplete".i18n
-        )
-      }
+    asyncOnMain {
+      Notifier.notify(
+        message: "i18n:LMMgr.notification.FactoryLexiconLoadingStarted".i18n
+      )
+    }
+    let resultBool = LMAssembly.LMInstantiator.loadFactoryDictionary(textMapPath: path)
+    precondition(resultBool, "vChewing factory TextMap loading failed.")
+    asyncOnMain {
+      Notifier.notify(
+        message: "i18n:LMMgr.notification.FactoryLexiconLoadingComplete".i18n
+      )
     }
   }
 
   /// 載入磁帶資料。
   /// - Remark: cassettePath() 會在輸入法停用磁帶時直接返回
-  public static func loadCassetteData() {
+  /// - Parameter completionHandler: 載入結束時（無論成敗）於主執行緒呼叫。
+  public static func loadCassetteData(completionHandler: (@MainActor @Sendable (Bool) -> ())? = nil) {
     LMAssembly.LMInstantiator.setCassetCandidateKeyValidator {
       CandidateKey.validate(keys: $0) == nil
     }
@@ -191,7 +205,7 @@ public final class LMMgr {
         importCassetteFileToCache(from: URL(fileURLWithPath: rawPath))
       }
     }
-    LMAssembly.LMInstantiator.loadCassetteData(path: resolvedPath)
+    LMAssembly.LMInstantiator.loadCassetteData(path: resolvedPath, completionHandler: completionHandler)
   }
 
   public static func loadUserPhrasesData(
@@ -338,8 +352,8 @@ public final class LMMgr {
 
   /// 預先建立原廠辭典反查索引。
   /// 在 RevLookup 視窗顯示時呼叫，使首次查詢無需等待 lazy build。
-  public static func preloadFactoryReverseLookupIndex() {
-    LMAssembly.LMInstantiator.preloadFactoryReverseLookupIndex()
+  public static func preloadFactoryReverseLookupIndex(completion: (@Sendable () -> ())? = nil) {
+    LMAssembly.LMInstantiator.preloadFactoryReverseLookupIndex(completion: completion)
   }
 
   // MARK: POM
@@ -386,13 +400,6 @@ public final class LMMgr {
     mode.langModel.clearPOMData()
   }
 
-  /// 清理語言模型記憶體，防止記憶體洩漏
-  public static func performMemoryCleanup() {
-    Shared.InputMode.validCases.forEach { mode in
-      mode.langModel.purgeInputTokenHashMap()
-    }
-  }
-
   // MARK: Internal
 
   static var iCloudPathDetectionOverride: ((String) -> Bool)?
@@ -113,11 +113,13 @@ extension LMMgr {
             inputMode: .imeModeCHT,
             isConverted: false
           )
-          guard phraseCHT.isValid, !phraseCHT.isDuplicated else { return }
+          // 去重交給批次歸併處理，此處不再逐筆查詢語言模組。
+          // 單字單音的條目一律略過，`_` 開頭的讀音亦然（故不沿用 `isSingleCharReadingPair`）。
+          guard phraseCHT.isValid else { return }
           guard !(phraseCHT.value.count == 1 && phraseCHT.keyArray.count == 1) else { return }
           allPhrasesCHT.append(phraseCHT)
           let phraseCHS = phraseCHT.crossConverted
-          guard phraseCHS.isValid, !phraseCHS.isDuplicated else { return }
+          guard phraseCHS.isValid else { return }
           guard !(phraseCHS.value.count == 1 && phraseCHS.keyArray.count == 1) else { return }
           allPhrasesCHS.append(phraseCHS)
         }
@@ -130,66 +132,29 @@ extension LMMgr {
     }
     guard !allPhrasesCHT.isEmpty else { return (entriesDiscovered, 0) }
 
-    guard Self
-      .batchImportUserPhrasePairs(allPhrasesCHT: allPhrasesCHT, allPhrasesCHS: allPhrasesCHS)
-    else {
+    guard chkUserLMFilesExist(.imeModeCHT), chkUserLMFilesExist(.imeModeCHS) else {
       throw OtherIMEDataImportError.lexiconWritingFailure
     }
+    let result = batchImportUserPhrases(allPhrasesCHT, mode: .imeModeCHT)
+    batchImportUserPhrases(allPhrasesCHS, mode: .imeModeCHS)
 
-    let result = allPhrasesCHT.count
     if result > 0 {
       Broadcaster.shared.postEventForReloadingPhraseEditor()
     }
     return (entriesDiscovered, result)
   }
 
-  private static func batchImportUserPhrasePairs(
-    allPhrasesCHT: [UserPhraseInsertable],
-    allPhrasesCHS: [UserPhraseInsertable]
+  /// 將語彙一次性歸併至指定輸入模式的使用者語彙辭典，並僅存檔一次。
+  /// - Returns: 實際併入的筆數。
+  @discardableResult
+  private static func batchImportUserPhrases(
+    _ phrases: [UserPhraseInsertable],
+    mode: Shared.InputMode
   )
-    -> Bool {
-    LMAssembly.withFileHandleQueueSync {
-      let outputStrCHS = allPhrasesCHS.map(\.description).joined(separator: "\n")
-      let outputStrCHT = allPhrasesCHT.map(\.description).joined(separator: "\n")
-      var outputDataCHS = "\(outputStrCHS)\n".data(using: .utf8) ?? .init([])
-      var outputDataCHT = "\(outputStrCHT)\n".data(using: .utf8) ?? .init([])
-      let urlCHS = LMMgr.userDictDataURL(mode: .imeModeCHS, type: .thePhrases)
-      let urlCHT = LMMgr.userDictDataURL(mode: .imeModeCHT, type: .thePhrases)
-
-      let fileHandlerCHS = try? FileHandle(forUpdating: urlCHS)
-      let fileHandlerCHT = try? FileHandle(forUpdating: urlCHT)
-      guard let fileHandlerCHS = fileHandlerCHS,
-            let fileHandlerCHT = fileHandlerCHT else { return false }
-      defer {
-        try? fileHandlerCHS.close()
-        try? fileHandlerCHT.close()
-      }
-
-      if let sizeCHS = fileSize(for: urlCHS), sizeCHS > 0 {
-        try? fileHandlerCHS.seek(toOffset: sizeCHS)
-        if (try? fileHandlerCHS.readToEnd())?.first != 0x0A {
-          outputDataCHS.insert(0x0A, at: 0)
-        }
-      }
-      _ = try? fileHandlerCHS.seekToEnd()
-      try? fileHandlerCHS.write(contentsOf: outputDataCHS)
-
-      if let sizeCHT = fileSize(for: urlCHT), sizeCHT > 0 {
-        try? fileHandlerCHT.seek(toOffset: sizeCHT)
-        if (try? fileHandlerCHT.readToEnd())?.first != 0x0A {
-          outputDataCHT.insert(0x0A, at: 0)
-        }
-      }
-      _ = try? fileHandlerCHT.seekToEnd()
-      try? fileHandlerCHT.write(contentsOf: outputDataCHT)
-      return true
-    }
+    -> Int {
+    mode.langModel.bulkImportUserPhrases(
+      phrases,
+      path: userDictDataURL(mode: mode, type: .thePhrases).path
+    )
   }
 }
-
-private func fileSize(for theURL: URL) -> UInt64? {
-  (
-    try? FileManager.default
-      .attributesOfItem(atPath: theURL.path)
-  )?[FileAttributeKey.size] as? UInt64
-}
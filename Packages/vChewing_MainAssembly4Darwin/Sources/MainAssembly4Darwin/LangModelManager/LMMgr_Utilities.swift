@@ -570,25 +570,55 @@ extension LMMgr {
 // 唯音輸入法並非可永續的專案。用單個 JSON 檔案遷移資料的話，可方便其他程式開發者們實作相關功能。
 
 extension LMMgr {
-  @discardableResult
-  public static func dumpUserDictDataToJSON(
-    print: Bool = false,
-    all: Bool
+  /// 將當前輸入法的所有使用者片語辭典資料傾印成 JSON 字串。
+  ///
+  /// 整份 JSON 會在記憶體內物化，故僅供確實需要字串的場合使用；
+  /// 要輸出到檔案或標準輸出的話，請改用 `dumpUserDictDataToJSON(all:to:)`。
+  public static func dumpUserDictDataToJSON(all: Bool) -> String {
+    writeUserDictDataAsJSON(all: all, to: "")
+  }
+
+  /// 將當前輸入法的所有使用者片語辭典資料以 JSON 格式串流寫入給定的檔案控點（如標準輸出）。
+  public static func dumpUserDictDataToJSON(all: Bool, to fileHandle: FileHandle) {
+    _ = writeUserDictDataAsJSON(all: all, to: FileHandleOutputStream(fileHandle))
+  }
+
+  /// 將當前輸入法的所有使用者片語辭典資料以 JSON 格式串流寫入給定的輸出目標。
+  ///
+  /// 資料是逐筆自各語言模組的索引取出、再分段交給輸出目標的，不會在記憶體內物化整份辭典。
+  /// - Returns: 寫入完畢之後的輸出目標。
+  public static func writeUserDictDataAsJSON<Target: TextOutputStream>(
+    all: Bool,
+    to target: Target
   )
-    -> String? {
-    var summarizedDict = [LMAssembly.UserDictionarySummarized]()
-    Shared.InputMode.allCases.forEach { mode in
-      guard mode != .imeModeNULL else { return }
-      summarizedDict.append(mode.langModel.summarize(all: all))
+    -> Target {
+    let recordSets = Shared.InputMode.allCases.compactMap { mode in
+      mode == .imeModeNULL ? nil : mode.langModel.summaryRecords(all: all)
+    }
+    var writer = LMAssembly.UserDictionarySummarized.StreamWriter(target: target)
+    writer.writeJSON(recordSets)
+    return writer.target
+  }
+}
+
+// MARK: - LMMgr.FileHandleOutputStream
+
+extension LMMgr {
+  /// 將寫入的文字以 UTF-8 直接轉交給檔案控點的輸出目標，自身不做任何緩衝。
+  nonisolated public struct FileHandleOutputStream: TextOutputStream {
+    // MARK: Lifecycle
+
+    public init(_ fileHandle: FileHandle) {
+      self.fileHandle = fileHandle
     }
-    let encoder = JSONEncoder()
-    encoder.outputFormatting = .prettyPrinted
-    if #available(macOS 10.13, *) {
-      encoder.outputFormatting.insert(.sortedKeys)
+
+    // MARK: Public
+
+    public let fileHandle: FileHandle
+
+    public mutating func write(_ string: String) {
+      guard !string.isEmpty else { return }
+      try? fileHandle.write(contentsOf: Data(string.utf8))
     }
-    guard let data = try? encoder.encode(summarizedDict) else { return nil }
-    guard let outputStr = String(data: data, encoding: .utf8) else { return nil }
-    if print { Swift.print(outputStr) }
-    return outputStr
   }
 }
@@ -58,14 +58,14 @@ public final class MainSputnik4IME {
         LMAssembly.LMInstantiator.asyncLoadingUserData = false
         LMMgr.initUserLangModels()
         LMMgr.loadUserPhraseReplacement()
-        LMMgr.dumpUserDictDataToJSON(print: true, all: false)
+        LMMgr.dumpUserDictDataToJSON(all: false, to: .standardOutput)
         return 0
       case "--dump-user-dict-all":
         LMAssembly.LMInstantiator.asyncLoadingUserData = false
         LMMgr.initUserLangModels()
         LMMgr.loadUserPhraseReplacement()
         LMMgr.loadUserAssociatesData()
-        LMMgr.dumpUserDictDataToJSON(print: true, all: true)
+        LMMgr.dumpUserDictDataToJSON(all: true, to: .standardOutput)
         return 0
       case "--import-kimo":
         let maybeCount: (totalFound: Int, importedCount: Int)?
@@ -23,8 +23,8 @@ final class CtlRevLookupWindow: NSWindowController, NSWindowDelegate {
     }
   }
 
-  /// 顯示反查視窗；載入時即預先建立反查索引，避免首次查詢時的 lazy build 延遲。
-  /// 所有載入/卸除操作均經由 UI 行為在 MainActor 上完成，無需額外同步佇列。
+  /// 顯示反查視窗；載入時即於背景佇列預先建立反查索引，避免首次查詢時的 lazy build 延遲。
+  /// 背景建立結果由 MainActor 上的首次查詢收編；若屆時尚未建完，則先顯示提示、待建完後再自動重新查詢。
   static func show() {
     autoreleasepool {
       if shared == nil { Self.shared = .init(window: FrmRevLookupWindow()) }
@@ -166,6 +166,17 @@ final class FrmRevLookupWindow: NSWindow {
 
   private func updateResult(with input: String) {
     guard !input.isEmpty else { return }
+    // 反查索引尚未建好時不在主執行緒上等待，改為待背景建立完畢後再重新查詢。
+    if LMMgr.isCoreDBConnected, !LMAssembly.LMInstantiator.isFactoryReverseLookupIndexReady {
+      resultView.string = "i18n:RevLookup.PreparingIndex".i18n
+      LMMgr.preloadFactoryReverseLookupIndex { [weak self] in
+        asyncOnMain {
+          guard let self, self.isVisible else { return }
+          self.updateResult(with: input)
+        }
+      }
+      return
+    }
     button.isEnabled = false
     inputField.isEnabled = false
     var strBuilder = ContiguousArray<String>()
@@ -178,7 +189,7 @@ final class FrmRevLookupWindow: NSWindow {
         strBuilder.append("i18n:ErrorMessage.MaxResultsReturnable".i18n + "\n")
         break theLoop
       }
-      let arrResult = LMAssembly.LMInstantiator.getFactoryReverseLookupData(with: char)?
+      let arrResult = LMAssembly.LMInstantiator.getFactoryReverseLookupDataIfReady(with: char)?
         .deduplicated ?? []
       if !arrResult.isEmpty {
         strBuilder.append(char + "\t")
@@ -404,6 +404,24 @@ extension IMEMenuSputnik {
           }
         )
         .alternated()
+      #if VCHEWING_PERF_PROBES
+        // 僅在以 `-DVCHEWING_PERF_PROBES` 建置時出現，不需要本地化。
+        NSMenu.Item(verbatim: "Dump Hot-Path Perf Probes".withEllipsis)?
+          .act(
+            register {
+              let report = LMAssembly.LMInstantiator.dumpPerfProbes(resetAfterDump: self.optionKeyPressed)
+              let reportURL = FileManager.default.temporaryDirectory
+                .appendingPathComponent("vChewing-PerfProbes.txt")
+              do {
+                try report.write(to: reportURL, atomically: true, encoding: .utf8)
+                FileOpenMethod.textEdit.open(url: reportURL)
+              } catch {
+                vCLog(report)
+              }
+            }
+          )
+          .nulled(silentMode)
+      #endif
 
       NSMenu.Item.separator() // ---------------------
       NSMenu.Item("i18n:Menu.CheckForUpdates")?
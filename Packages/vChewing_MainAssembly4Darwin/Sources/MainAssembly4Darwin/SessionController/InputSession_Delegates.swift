@@ -167,10 +167,7 @@ extension SessionProtocol {
   public func checkIsMacroTokenResult(_ index: Int) -> Bool {
     guard state.isCandidateContainer else { return false }
     guard state.candidates.indices.contains(index) else { return false }
-    let target = state.candidates[index]
-    let keyChain = target.keyArray.joined(separator: "-")
-    let hashKey = "\(keyChain)\t\(target.value)".hashValue
-    let result = Set(inputMode.langModel.inputTokenHashesArray).contains(hashKey)
+    let result = state.isMacroCandidate(state.candidates[index])
     if result { NSSound.buzz() }
     return result
   }
@@ -213,16 +210,11 @@ extension SessionProtocol {
     if !conv || prefs.cns11643Enabled || punctuationKeyHeaderMatched {
       return state.candidates
     }
-    let convertedCandidates = state.candidates.map {
-      theCandidatePair -> (
-        keyArray: [String],
-        value: String
-      ) in
-      var theCandidatePair = theCandidatePair
-      theCandidatePair.value = ChineseConverter.kanjiConversionIfRequired(
-        theCandidatePair.value
-      )
-      return theCandidatePair
+    // 整窗候選字一併批次轉換，以便 Hotenka 重複利用同一組暫存緩衝區。
+    let convertedValues = ChineseConverter.kanjiConversionIfRequired(state.candidates.map(\.value))
+    var convertedCandidates = state.candidates
+    for (index, value) in convertedValues.enumerated() {
+      convertedCandidates[index].value = value
     }
     return convertedCandidates
   }
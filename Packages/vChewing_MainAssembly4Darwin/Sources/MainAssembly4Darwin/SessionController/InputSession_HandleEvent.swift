@@ -135,7 +135,8 @@ extension SessionProtocol {
     }
 
     /// 除非核心辭典有載入，否則一律蜂鳴。
-    if !LMMgr.isCoreDBConnected {
+    /// 冷啟動時若核心辭典正在載入，則僅就此短暫等待（其餘元件皆不阻塞首次按鍵）。
+    if !LMMgr.isCoreDBConnected, !LMMgr.waitForFactoryDictionary(timeout: 0.35) {
       if (event as InputSignalProtocol).isReservedKey { return false }
       var newState: State = .ofEmpty()
       newState.tooltip = "i18n:DictionaryStatus.FactoryDictNotLoaded".i18n
@@ -22,6 +22,12 @@ let package = Package(
         .product(name: "CSQLite3Lib", package: "CSQLite3Lib"),
       ]
     ),
+    .testTarget(
+      name: "KeyKeyUserDBKitTests",
+      dependencies: [
+        "KeyKeyUserDBKit",
+      ]
+    ),
     .target(
       name: "OtherIMEDataReader",
       dependencies: [
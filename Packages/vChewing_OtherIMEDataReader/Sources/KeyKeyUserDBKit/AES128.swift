@@ -0,0 +1,216 @@
+// (c) 2025 and onwards The vChewing Project (LGPL v3.0 License or later).
+// ====================
+// This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
+
+#if canImport(CommonCrypto)
+  import CommonCrypto
+#endif
+
+// MARK: - KeyKeyUserDBKit.AES128
+
+extension KeyKeyUserDBKit {
+  /// AES-128 區塊加密器（僅實作加密方向，供 CTR 模式產生 keystream 之用）
+  ///
+  /// - 有 CommonCrypto 的平台：多個區塊會一次交給 `CCCrypt` 以 ECB 模式批次處理，
+  ///   而非每個區塊各呼叫一次。
+  /// - 其餘平台（比如 Linux）：使用以 T-table 實作的可攜版本，輪密鑰僅在初期化時展開一次。
+  ///
+  /// 兩種實作的輸出完全一致（皆為 FIPS-197 AES-128）。
+  struct AES128: Sendable {
+    // MARK: Lifecycle
+
+    /// - Parameter key: 16 bytes AES-128 密鑰
+    init(key: [UInt8]) {
+      precondition(key.count == Self.keySize, "Key must be 16 bytes for AES-128")
+      self.key = key
+      self.roundKeys = Self.expandKey(key)
+    }
+
+    // MARK: Internal
+
+    static let keySize = 16
+    static let blockSize = 16
+
+    /// 以 ECB 模式加密多個連續的區塊。
+    /// - Parameters:
+    ///   - input: 明文，長度須為 16 的倍數。
+    ///   - output: 密文的寫入目標，長度須與 `input` 相同。
+    /// - Throws: `DecryptionError.cryptoError` 如果加密失敗
+    func encryptBlocks(
+      _ input: UnsafeRawBufferPointer,
+      into output: UnsafeMutableRawBufferPointer
+    ) throws {
+      precondition(input.count % Self.blockSize == 0 && output.count == input.count)
+      #if canImport(CommonCrypto)
+        var numBytesEncrypted: size_t = 0
+        let status = CCCrypt(
+          CCOperation(kCCEncrypt),
+          CCAlgorithm(kCCAlgorithmAES),
+          CCOptions(kCCOptionECBMode),
+          key, key.count,
+          nil, // No IV for ECB
+          input.baseAddress, input.count,
+          output.baseAddress, output.count,
+          &numBytesEncrypted
+        )
+        guard status == kCCSuccess else {
+          throw DecryptionError.cryptoError(status: Int32(status))
+        }
+      #else
+        encryptBlocksPortable(input, into: output)
+      #endif
+    }
+
+    /// 可攜版本的 ECB 批次加密（不依賴任何平台加密框架）。
+    func encryptBlocksPortable(
+      _ input: UnsafeRawBufferPointer,
+      into output: UnsafeMutableRawBufferPointer
+    ) {
+      precondition(input.count % Self.blockSize == 0 && output.count == input.count)
+      roundKeys.withUnsafeBufferPointer { rk in
+        Self.tables.withUnsafeBufferPointer { te in
+          Self.sbox.withUnsafeBufferPointer { sbox in
+            var offset = 0
+            while offset < input.count {
+              Self.encryptBlock(
+                input.baseAddress! + offset,
+                into: output.baseAddress! + offset,
+                rk: rk, te: te, sbox: sbox
+              )
+              offset += Self.blockSize
+            }
+          }
+        }
+      }
+    }
+
+    // MARK: Private
+
+    private let key: [UInt8]
+    /// 展開後的 44 個輪密鑰字組（big-endian）。
+    private let roundKeys: [UInt32]
+
+    /// AES S-box（以 GF(2^8) 乘法反元素與仿射變換推導而得）。
+    private static let sbox: [UInt8] = {
+      var result = [UInt8](repeating: 0, count: 256)
+      var p: UInt8 = 1
+      var q: UInt8 = 1
+      repeat {
+        // p 乘以 3。
+        p = p ^ (p << 1) ^ (p & 0x80 != 0 ? 0x1B : 0)
+        // q 除以 3。
+        q ^= q << 1
+        q ^= q << 2
+        q ^= q << 4
+        if q & 0x80 != 0 { q ^= 0x09 }
+        let transformed = q ^ rotateLeft(q, 1) ^ rotateLeft(q, 2) ^ rotateLeft(q, 3) ^ rotateLeft(q, 4)
+        result[Int(p)] = transformed ^ 0x63
+      } while p != 1
+      result[0] = 0x63
+      return result
+    }()
+
+    /// 四份 T-table 依序串接（Te0 ~ Te3，各 256 筆），將 SubBytes、ShiftRows、MixColumns 合併為查表。
+    private static let tables: [UInt32] = {
+      var result = [UInt32](repeating: 0, count: 1_024)
+      for index in 0 ..< 256 {
+        let s = UInt32(sbox[index])
+        let s2 = UInt32(xtime(sbox[index]))
+        let word = (s2 << 24) | (s << 16) | (s << 8) | (s2 ^ s)
+        result[index] = word
+        result[256 + index] = word.rotatedRight(by: 8)
+        result[512 + index] = word.rotatedRight(by: 16)
+        result[768 + index] = word.rotatedRight(by: 24)
+      }
+      return result
+    }()
+
+    private static let roundConstants: [UInt32] = [0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36]
+
+    private static func rotateLeft(_ value: UInt8, _ shift: UInt8) -> UInt8 {
+      (value << shift) | (value >> (8 - shift))
+    }
+
+    private static func xtime(_ value: UInt8) -> UInt8 {
+      (value << 1) ^ (value & 0x80 != 0 ? 0x1B : 0)
+    }
+
+    private static func subWord(_ word: UInt32) -> UInt32 {
+      UInt32(sbox[Int(word >> 24)]) << 24
+        | UInt32(sbox[Int((word >> 16) & 0xFF)]) << 16
+        | UInt32(sbox[Int((word >> 8) & 0xFF)]) << 8
+        | UInt32(sbox[Int(word & 0xFF)])
+    }
+
+    private static func expandKey(_ key: [UInt8]) -> [UInt32] {
+      var result = [UInt32]()
+      result.reserveCapacity(44)
+      for i in 0 ..< 4 {
+        result.append(
+          UInt32(key[4 * i]) << 24 | UInt32(key[4 * i + 1]) << 16
+            | UInt32(key[4 * i + 2]) << 8 | UInt32(key[4 * i + 3])
+        )
+      }
+      for i in 4 ..< 44 {
+        var temp = result[i - 1]
+        if i % 4 == 0 {
+          temp = subWord(temp.rotatedRight(by: 24)) ^ (roundConstants[i / 4 - 1] << 24)
+        }
+        result.append(result[i - 4] ^ temp)
+      }
+      return result
+    }
+
+    @inline(__always)
+    private static func loadWord(_ pointer: UnsafeRawPointer, _ index: Int) -> UInt32 {
+      UInt32(bigEndian: pointer.loadUnaligned(fromByteOffset: index * 4, as: UInt32.self))
+    }
+
+    @inline(__always)
+    private static func encryptBlock(
+      _ input: UnsafeRawPointer,
+      into output: UnsafeMutableRawPointer,
+      rk: UnsafeBufferPointer<UInt32>,
+      te: UnsafeBufferPointer<UInt32>,
+      sbox: UnsafeBufferPointer<UInt8>
+    ) {
+      var s0 = loadWord(input, 0) ^ rk[0]
+      var s1 = loadWord(input, 1) ^ rk[1]
+      var s2 = loadWord(input, 2) ^ rk[2]
+      var s3 = loadWord(input, 3) ^ rk[3]
+      @inline(__always)
+      func mix(_ a: UInt32, _ b: UInt32, _ c: UInt32, _ d: UInt32, _ k: UInt32) -> UInt32 {
+        te[Int(a >> 24)] ^ te[256 + Int((b >> 16) & 0xFF)]
+          ^ te[512 + Int((c >> 8) & 0xFF)] ^ te[768 + Int(d & 0xFF)] ^ k
+      }
+      for round in 1 ..< 10 {
+        let k = round * 4
+        let t0 = mix(s0, s1, s2, s3, rk[k])
+        let t1 = mix(s1, s2, s3, s0, rk[k + 1])
+        let t2 = mix(s2, s3, s0, s1, rk[k + 2])
+        let t3 = mix(s3, s0, s1, s2, rk[k + 3])
+        (s0, s1, s2, s3) = (t0, t1, t2, t3)
+      }
+      @inline(__always)
+      func last(_ a: UInt32, _ b: UInt32, _ c: UInt32, _ d: UInt32, _ k: UInt32) -> UInt32 {
+        (UInt32(sbox[Int(a >> 24)]) << 24 | UInt32(sbox[Int((b >> 16) & 0xFF)]) << 16
+          | UInt32(sbox[Int((c >> 8) & 0xFF)]) << 8 | UInt32(sbox[Int(d & 0xFF)])) ^ k
+      }
+      let words = (
+        last(s0, s1, s2, s3, rk[40]), last(s1, s2, s3, s0, rk[41]),
+        last(s2, s3, s0, s1, rk[42]), last(s3, s0, s1, s2, rk[43])
+      )
+      output.storeBytes(of: words.0.bigEndian, toByteOffset: 0, as: UInt32.self)
+      output.storeBytes(of: words.1.bigEndian, toByteOffset: 4, as: UInt32.self)
+      output.storeBytes(of: words.2.bigEndian, toByteOffset: 8, as: UInt32.self)
+      output.storeBytes(of: words.3.bigEndian, toByteOffset: 12, as: UInt32.self)
+    }
+  }
+}
+
+extension UInt32 {
+  @inline(__always)
+  fileprivate func rotatedRight(by shift: UInt32) -> UInt32 {
+    (self >> shift) | (self << (32 - shift))
+  }
+}
@@ -2,7 +2,6 @@
 // ====================
 // This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
 
-import CommonCrypto
 import Foundation
 
 // MARK: - KeyKeyUserDBKit.SEEDecryptor
@@ -23,6 +22,11 @@ extension KeyKeyUserDBKit {
   /// - AES-128-ECB(key, counter_block)
   /// - counter_block 結構：nonce 的副本，但 bytes 4-7 是 4-byte little-endian counter
   /// - Counter 從 nonce[4:8] 的原始值開始，每個 16-byte block 遞增 1
+  ///
+  /// ## 解密流程
+  /// - 各頁面彼此獨立，故頁數夠多時會分批交給多個 CPU 核心並行解密。
+  /// - 每頁的 62 個 counter block 會先一次排好、再整批交給 AES 產生 keystream。
+  /// - 解密結果直接寫入呼叫端給定的緩衝區（比如 SQLite 自己配置的記憶體），不另行複製。
   public struct SEEDecryptor: Sendable {
     // MARK: Lifecycle
 
@@ -32,12 +36,12 @@ extension KeyKeyUserDBKit {
     /// - Parameter key: 16 bytes AES-128 密鑰
     public init(key: [UInt8]) {
       precondition(key.count == Self.keySize, "Key must be 16 bytes for AES-128")
-      self.key = key
+      self.cipher = .init(key: key)
     }
 
     /// 使用預設密鑰初期化解密器
     public init() {
-      self.key = Self.defaultKey
+      self.cipher = .init(key: Self.defaultKey)
     }
 
     // MARK: Public
@@ -67,17 +71,18 @@ extension KeyKeyUserDBKit {
         return false
       }
 
-      do {
-        let data = try Data(contentsOf: url)
-        guard data.count >= sqliteMagic.count else {
-          return true // 檔案太小，可能是加密的
-        }
-
-        // 如果開頭不是 SQLite 魔術數字，則是加密的
-        return Array(data.prefix(sqliteMagic.count)) != sqliteMagic
-      } catch {
+      // 只需讀取檔案開頭的魔術數字，不必讀入整個檔案。
+      guard let handle = try? FileHandle(forReadingFrom: url) else {
         return true // 無法讀取，假設是加密的
       }
+      defer { handle.closeFile() }
+      let header = handle.readData(ofLength: sqliteMagic.count)
+      guard header.count >= sqliteMagic.count else {
+        return true // 檔案太小，可能是加密的
+      }
+
+      // 如果開頭不是 SQLite 魔術數字，則是加密的
+      return Array(header) != sqliteMagic
     }
 
     // MARK: - Public Methods
@@ -87,37 +92,54 @@ extension KeyKeyUserDBKit {
     /// - Returns: 解密後的資料庫二進位資料
     /// - Throws: `DecryptionError` 如果解密失敗
     public func decrypt(encryptedData: Data) throws -> Data {
-      guard encryptedData.count % Self.pageSize == 0 else {
-        throw DecryptionError.invalidSize(
-          expected: "multiple of \(Self.pageSize)",
-          actual: encryptedData.count
-        )
+      try Self.validateSize(encryptedData.count)
+      var output = Data(count: encryptedData.count)
+      try encryptedData.withUnsafeBytes { input in
+        try output.withUnsafeMutableBytes { outputBuffer in
+          try decryptPages(input, into: outputBuffer)
+        }
       }
+      return output
+    }
 
-      let numPages = encryptedData.count / Self.pageSize
-      var output = Data(capacity: encryptedData.count)
-
-      for pageNum in 0 ..< numPages {
-        let pageStart = pageNum * Self.pageSize
-        let pageEnd = pageStart + Self.pageSize
-        let pageData = encryptedData[pageStart ..< pageEnd]
+    /// 解密整個資料庫，並將結果直接寫入給定的緩衝區。
+    ///
+    /// 頁數夠多時，會將頁面分批交給多個 CPU 核心並行解密（各批次寫入的範圍互不重疊）。
+    /// - Parameters:
+    ///   - input: 加密的資料庫二進位資料，長度須為頁面大小的倍數。
+    ///   - output: 解密結果的寫入目標，長度須與 `input` 相同。
+    /// - Throws: `DecryptionError` 如果解密失敗
+    public func decryptPages(
+      _ input: UnsafeRawBufferPointer,
+      into output: UnsafeMutableRawBufferPointer
+    ) throws {
+      try Self.validateSize(input.count)
+      guard output.count == input.count else {
+        throw DecryptionError.invalidSize(expected: "\(input.count)", actual: output.count)
+      }
+      let numPages = input.count / Self.pageSize
+      guard numPages > 0 else { return }
 
-        let decryptedData = try decryptPage(Array(pageData), pageNumber: pageNum)
+      let batchCount = Swift.min(
+        ProcessInfo.processInfo.activeProcessorCount * 4,
+        numPages / Self.minimumPagesPerBatch
+      )
+      guard batchCount > 1 else {
+        try decryptPages(0 ..< numPages, of: input, into: output)
+        return
+      }
 
-        if pageNum == 0 {
-          // Page 0 特殊處理：bytes 16-23 是未加密的
-          output.append(contentsOf: decryptedData[0 ..< 16])
-          output.append(contentsOf: pageData[16 ..< 24])
-          output.append(contentsOf: decryptedData[24...])
-        } else {
-          output.append(contentsOf: decryptedData)
+      let failure = FailureBox()
+      DispatchQueue.concurrentPerform(iterations: batchCount) { batchIndex in
+        let lowerBound = numPages * batchIndex / batchCount
+        let upperBound = numPages * (batchIndex + 1) / batchCount
+        do {
+          try decryptPages(lowerBound ..< upperBound, of: input, into: output)
+        } catch {
+          failure.record(error)
         }
-
-        // Reserved area 填充零
-        output.append(contentsOf: [UInt8](repeating: 0, count: Self.reservedBytes))
       }
-
-      return output
+      if let error = failure.error { throw error }
     }
 
     /// 從檔案解密資料庫
@@ -126,92 +148,133 @@ extension KeyKeyUserDBKit {
     ///   - outputURL: 輸出解密資料庫檔案路徑
     /// - Throws: `DecryptionError` 如果解密失敗
     public func decryptFile(at inputURL: URL, to outputURL: URL) throws {
-      let encryptedData = try Data(contentsOf: inputURL)
+      let encryptedData = try Data(contentsOf: inputURL, options: .mappedIfSafe)
       let decryptedData = try decrypt(encryptedData: encryptedData)
       try decryptedData.write(to: outputURL)
     }
 
     // MARK: Private
 
+    /// 並行解密時，每個批次至少要處理的頁數（太小的資料庫不值得分派執行緒）。
+    private static let minimumPagesPerBatch = 64
+
+    /// 每頁的 counter block 數量
+    private static let blocksPerPage = dataAreaSize / AES128.blockSize // 62 blocks
+
     /// SQLite 資料庫魔術數字
     private static let sqliteMagic: [UInt8] = Array("SQLite format 3\0".utf8)
 
-    private let key: [UInt8]
+    private let cipher: AES128
+
+    private static func validateSize(_ size: Int) throws {
+      guard size % pageSize == 0 else {
+        throw DecryptionError.invalidSize(
+          expected: "multiple of \(pageSize)",
+          actual: size
+        )
+      }
+    }
 
     // MARK: - Private Methods
 
+    /// 依序解密給定範圍內的頁面。counter block 與 keystream 的暫存區在整個範圍內共用。
+    private func decryptPages(
+      _ pageRange: Range<Int>,
+      of input: UnsafeRawBufferPointer,
+      into output: UnsafeMutableRawBufferPointer
+    ) throws {
+      try withUnsafeTemporaryAllocation(byteCount: Self.dataAreaSize * 2, alignment: 16) { scratch in
+        let counterBlocks = UnsafeMutableRawBufferPointer(rebasing: scratch[0 ..< Self.dataAreaSize])
+        let keystream = UnsafeMutableRawBufferPointer(rebasing: scratch[Self.dataAreaSize...])
+        for pageNumber in pageRange {
+          let pageStart = pageNumber * Self.pageSize
+          try decryptPage(
+            UnsafeRawBufferPointer(rebasing: input[pageStart ..< pageStart + Self.pageSize]),
+            pageNumber: pageNumber,
+            into: UnsafeMutableRawBufferPointer(rebasing: output[pageStart ..< pageStart + Self.pageSize]),
+            counterBlocks: counterBlocks,
+            keystream: keystream
+          )
+        }
+      }
+    }
+
     /// 解密單一頁面
-    private func decryptPage(_ page: [UInt8], pageNumber _: Int) throws -> [UInt8] {
+    private func decryptPage(
+      _ page: UnsafeRawBufferPointer,
+      pageNumber: Int,
+      into output: UnsafeMutableRawBufferPointer,
+      counterBlocks: UnsafeMutableRawBufferPointer,
+      keystream: UnsafeMutableRawBufferPointer
+    ) throws {
       guard page.count == Self.pageSize else {
         throw DecryptionError.invalidPageSize(expected: Self.pageSize, actual: page.count)
       }
 
       // Nonce 是頁面的最後 16 bytes
-      let nonce = Array(page[(Self.pageSize - 16)...])
+      let nonceOffset = Self.pageSize - 16
 
       // Counter 是 4 bytes，little-endian，位於 nonce 的 bytes 4-7
       let baseCounter = UInt32(
-        littleEndian: nonce[4 ..< 8].withUnsafeBytes { $0.load(as: UInt32.self) }
+        littleEndian: page.loadUnaligned(fromByteOffset: nonceOffset + 4, as: UInt32.self)
       )
 
-      var decrypted = [UInt8]()
-      decrypted.reserveCapacity(Self.dataAreaSize)
+      // 一次排好整頁的 counter blocks，再整批產生 keystream。
+      for blockIdx in 0 ..< Self.blocksPerPage {
+        let blockStart = blockIdx * AES128.blockSize
+        counterBlocks.baseAddress!.advanced(by: blockStart)
+          .copyMemory(from: page.baseAddress!.advanced(by: nonceOffset), byteCount: AES128.blockSize)
+        counterBlocks.storeBytes(
+          of: (baseCounter &+ UInt32(blockIdx)).littleEndian,
+          toByteOffset: blockStart + 4,
+          as: UInt32.self
+        )
+      }
+      try cipher.encryptBlocks(UnsafeRawBufferPointer(counterBlocks), into: keystream)
 
-      let numBlocks = (Self.dataAreaSize + 15) / 16 // 62 blocks
+      // XOR 解密
+      for i in 0 ..< Self.dataAreaSize {
+        output[i] = page[i] ^ keystream[i]
+      }
 
-      for blockIdx in 0 ..< numBlocks {
-        // 建構 counter block
-        var counterBlock = nonce
-        let newCounter = baseCounter &+ UInt32(blockIdx)
-        withUnsafeBytes(of: newCounter.littleEndian) { bytes in
-          counterBlock[4] = bytes[0]
-          counterBlock[5] = bytes[1]
-          counterBlock[6] = bytes[2]
-          counterBlock[7] = bytes[3]
+      if pageNumber == 0 {
+        // Page 0 特殊處理：bytes 16-23 是未加密的
+        for i in 16 ..< 24 {
+          output[i] = page[i]
         }
+      }
 
-        // 產生 keystream (AES-ECB encrypt counter block)
-        let keystream = try aesECBEncrypt(block: counterBlock)
+      // Reserved area 填充零
+      for i in Self.dataAreaSize ..< Self.pageSize {
+        output[i] = 0
+      }
+    }
+  }
+}
 
-        // XOR 解密
-        let start = blockIdx * 16
-        let end = min(start + 16, Self.dataAreaSize)
+// MARK: - KeyKeyUserDBKit.SEEDecryptor.FailureBox
 
-        for i in start ..< end {
-          decrypted.append(page[i] ^ keystream[i - start])
-        }
-      }
+extension KeyKeyUserDBKit.SEEDecryptor {
+  /// 並行解密時用以記錄第一個錯誤。
+  private final class FailureBox: @unchecked Sendable {
+    // MARK: Internal
 
-      return decrypted
+    var error: Error? {
+      lock.lock()
+      defer { lock.unlock() }
+      return storedError
     }
 
-    /// AES-128-ECB 加密單一 block
-    private func aesECBEncrypt(block: [UInt8]) throws -> [UInt8] {
-      try aesECBEncryptCommonCrypto(block: block)
+    func record(_ error: Error) {
+      lock.lock()
+      defer { lock.unlock() }
+      if storedError == nil { storedError = error }
     }
 
-    /// 使用 CommonCrypto 進行 AES-ECB 加密
-    private func aesECBEncryptCommonCrypto(block: [UInt8]) throws -> [UInt8] {
-      var outBuffer = [UInt8](repeating: 0, count: kCCBlockSizeAES128)
-      var numBytesEncrypted: size_t = 0
-
-      let status = CCCrypt(
-        CCOperation(kCCEncrypt),
-        CCAlgorithm(kCCAlgorithmAES),
-        CCOptions(kCCOptionECBMode),
-        key, key.count,
-        nil, // No IV for ECB
-        block, block.count,
-        &outBuffer, outBuffer.count,
-        &numBytesEncrypted
-      )
-
-      guard status == kCCSuccess else {
-        throw DecryptionError.cryptoError(status: Int32(status))
-      }
+    // MARK: Private
 
-      return outBuffer
-    }
+    private let lock = NSLock()
+    private var storedError: Error?
   }
 }
 
@@ -42,7 +42,26 @@ extension KeyKeyUserDBKit {
     /// 從記憶體中的資料開啟資料庫（無需寫入臨時檔案）
     /// - Parameter data: 解密後的資料庫二進位資料
     /// - Throws: `DatabaseError` 如果開啟失敗
-    public init(data: Data) throws {
+    public convenience init(data: Data) throws {
+      // 複製 data 到可變的記憶體區塊（sqlite3_deserialize 需要）
+      // 使用 sqlite3_malloc64 分配記憶體，讓 SQLite 管理生命週期
+      let buffer = try Self.allocateDatabaseBuffer(size: data.count)
+
+      // 複製資料到緩衝區
+      data.withUnsafeBytes { bytes in
+        guard let baseAddress = bytes.baseAddress else { return }
+        memcpy(buffer, baseAddress, data.count)
+      }
+
+      try self.init(databaseBuffer: buffer, size: data.count)
+    }
+
+    /// 以 SQLite 配置的緩衝區開啟記憶體資料庫。無論成功與否，緩衝區的所有權皆移交給 SQLite。
+    /// - Parameters:
+    ///   - buffer: 以 `sqlite3_malloc64` 配置、且已填好資料庫內容的緩衝區
+    ///   - size: 資料庫大小
+    /// - Throws: `DatabaseError` 如果開啟失敗
+    private init(databaseBuffer buffer: UnsafeMutableRawPointer, size: Int) throws {
       self.path = nil
       self.actor = .init(label: "KeyKeyUserDBQueue.\(UUID().uuidString)")
 
@@ -60,26 +79,14 @@ extension KeyKeyUserDBKit {
         } else {
           errorMessage = "Unknown error"
         }
+        sqlite3_free(buffer)
         throw DatabaseError.openFailed(message: errorMessage)
       }
 
-      // 複製 data 到可變的記憶體區塊（sqlite3_deserialize 需要）
-      // 使用 sqlite3_malloc64 分配記憶體，讓 SQLite 管理生命週期
-      let dataSize = Int64(data.count)
-      guard let buffer = sqlite3_malloc64(UInt64(dataSize)) else {
-        sqlite3_close(dbPointer)
-        throw DatabaseError.openFailed(message: "Failed to allocate memory for database")
-      }
-
-      // 複製資料到緩衝區
-      data.withUnsafeBytes { bytes in
-        guard let baseAddress = bytes.baseAddress else { return }
-        memcpy(buffer, baseAddress, data.count)
-      }
-
       // 使用 sqlite3_deserialize 載入資料庫
-      // SQLITE_DESERIALIZE_FREEONCLOSE: 當資料庫關閉時，SQLite 會自動釋放緩衝區
+      // SQLITE_DESERIALIZE_FREEONCLOSE: 當資料庫關閉時，SQLite 會自動釋放緩衝區（即便載入失敗亦然）
       // SQLITE_DESERIALIZE_RESIZEABLE: 允許資料庫調整大小（雖然我們只讀取）
+      let dataSize = Int64(size)
       let result = sqlite3_deserialize(
         dbPointer,
         "main",
@@ -113,6 +120,9 @@ extension KeyKeyUserDBKit {
     public static let candidateOverrideProbability: Double = 114.514
 
     /// 從加密的資料庫檔案載入到記憶體資料庫（無需寫入臨時檔案）
+    ///
+    /// 加密檔案以記憶體映射的方式讀取；各頁面並行解密之後，直接寫入 SQLite 自己配置的緩衝區，
+    /// 不經過任何中間副本。資料列則由 `makeIterator()` / `async` 在迭代時逐行解碼。
     /// - Parameters:
     ///   - url: 加密資料庫檔案的 URL
     ///   - decryptor: 用於解密的 SEEDecryptor 實例（預設使用預設密鑰）
@@ -123,9 +133,34 @@ extension KeyKeyUserDBKit {
       decryptor: SEEDecryptor = .init()
     ) throws
       -> UserDatabase {
-      let encryptedData = try Data(contentsOf: url)
-      let decryptedData = try decryptor.decrypt(encryptedData: encryptedData)
-      return try UserDatabase(data: decryptedData)
+      let encryptedData = try Data(contentsOf: url, options: .mappedIfSafe)
+      return try openEncrypted(data: encryptedData, decryptor: decryptor)
+    }
+
+    /// 將加密的資料庫資料解密到記憶體資料庫（無需寫入臨時檔案）
+    /// - Parameters:
+    ///   - encryptedData: 加密的資料庫二進位資料
+    ///   - decryptor: 用於解密的 SEEDecryptor 實例（預設使用預設密鑰）
+    /// - Returns: 已開啟的記憶體資料庫
+    /// - Throws: `DecryptionError` 或 `DatabaseError`
+    public static func openEncrypted(
+      data encryptedData: Data,
+      decryptor: SEEDecryptor = .init()
+    ) throws
+      -> UserDatabase {
+      let buffer = try allocateDatabaseBuffer(size: encryptedData.count)
+      do {
+        try encryptedData.withUnsafeBytes { input in
+          try decryptor.decryptPages(
+            input,
+            into: UnsafeMutableRawBufferPointer(start: buffer, count: encryptedData.count)
+          )
+        }
+      } catch {
+        sqlite3_free(buffer)
+        throw error
+      }
+      return try UserDatabase(databaseBuffer: buffer, size: encryptedData.count)
     }
 
     // MARK: - Public Methods
@@ -286,6 +321,14 @@ extension KeyKeyUserDBKit {
 
     // MARK: Private
 
+    /// 以 `sqlite3_malloc64` 配置供 `sqlite3_deserialize` 使用的緩衝區。
+    private static func allocateDatabaseBuffer(size: Int) throws -> UnsafeMutableRawPointer {
+      guard let buffer = sqlite3_malloc64(UInt64(Swift.max(size, 1))) else {
+        throw DatabaseError.openFailed(message: "Failed to allocate memory for database")
+      }
+      return buffer
+    }
+
     private nonisolated(unsafe) let db: OpaquePointer?
     private let path: String?
     private let actor: DispatchQueue
@@ -2,7 +2,6 @@
 // ====================
 // This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
 
-import CommonCrypto
 import CSQLite3Lib
 import Foundation
 
@@ -177,19 +176,12 @@ extension KeyKeyUserDBKit {
         )
       }
 
-      let numPages = encryptedData.count / pageSize
-      var decrypted = Data()
-
-      for pageIdx in 0 ..< numPages {
-        let pageStart = pageIdx * pageSize
-        let pageData = encryptedData[pageStart ..< pageStart + pageSize]
-
-        let decryptedPage = try decryptPage(
-          pageData: pageData,
-          pageNumber: pageIdx,
-          key: exportKey
-        )
-        decrypted.append(decryptedPage)
+      // 匯出檔案內的資料庫與使用者資料庫的加密方式相同，僅密鑰不同。
+      var decrypted: Data
+      do {
+        decrypted = try SEEDecryptor(key: exportKey).decrypt(encryptedData: encryptedData)
+      } catch {
+        throw TextFileError.decryptionFailed(message: error.localizedDescription)
       }
 
       // 清除 SQLite header 中的 reserved bytes 設定 (offset 20)
@@ -200,97 +192,6 @@ extension KeyKeyUserDBKit {
       return decrypted
     }
 
-    private static func decryptPage(
-      pageData: Data,
-      pageNumber: Int,
-      key: [UInt8]
-    ) throws
-      -> Data {
-      let pageSize = SEEDecryptor.pageSize
-      let reservedBytes = SEEDecryptor.reservedBytes
-      let dataAreaSize = SEEDecryptor.dataAreaSize
-
-      guard pageData.count == pageSize else {
-        throw TextFileError.invalidDatabaseBlock(message: "Invalid page size")
-      }
-
-      let pageBytes = Array(pageData)
-      let nonce = Array(pageBytes[(pageSize - 16)...])
-
-      // 建立 AES cipher
-      var decrypted = [UInt8](repeating: 0, count: dataAreaSize)
-      let baseCounter = UInt32(
-        littleEndian: nonce[4 ..< 8].withUnsafeBytes { $0.load(as: UInt32.self) }
-      )
-
-      for blockIdx in 0 ..< (dataAreaSize / 16) {
-        let counter = baseCounter &+ UInt32(blockIdx)
-        var counterBytes = nonce
-        withUnsafeBytes(of: counter.littleEndian) { counterPtr in
-          for i in 0 ..< 4 {
-            counterBytes[4 + i] = counterPtr[i]
-          }
-        }
-
-        // AES-ECB 加密 counter block 產生 keystream
-        var keystream = [UInt8](repeating: 0, count: 16)
-
-        var numBytesEncrypted = 0
-        let status = counterBytes.withUnsafeBytes { counterPtr in
-          keystream.withUnsafeMutableBytes { keystreamPtr in
-            CCCrypt(
-              CCOperation(kCCEncrypt),
-              CCAlgorithm(kCCAlgorithmAES),
-              CCOptions(kCCOptionECBMode),
-              key, key.count,
-              nil,
-              counterPtr.baseAddress, 16,
-              keystreamPtr.baseAddress, 16,
-              &numBytesEncrypted
-            )
-          }
-        }
-        guard status == kCCSuccess else {
-          throw TextFileError.decryptionFailed(message: "AES encryption failed")
-        }
-
-        // XOR 解密
-        let blockStart = blockIdx * 16
-        if pageNumber == 0 {
-          // Page 1 特殊處理：bytes 16-23 是明文
-          if blockIdx == 0 {
-            // Block 0: 全部解密
-            for i in 0 ..< 16 {
-              decrypted[i] = pageBytes[i] ^ keystream[i]
-            }
-          } else if blockIdx == 1 {
-            // Block 1: bytes 16-23 保持明文，bytes 24-31 解密
-            for i in 0 ..< 8 {
-              decrypted[16 + i] = pageBytes[16 + i]
-            }
-            for i in 8 ..< 16 {
-              decrypted[16 + i] = pageBytes[16 + i] ^ keystream[i]
-            }
-          } else {
-            // 其他 blocks: 全部解密
-            for i in 0 ..< 16 {
-              decrypted[blockStart + i] = pageBytes[blockStart + i] ^ keystream[i]
-            }
-          }
-        } else {
-          // 其他頁面：全部解密
-          for i in 0 ..< 16 {
-            decrypted[blockStart + i] = pageBytes[blockStart + i] ^ keystream[i]
-          }
-        }
-      }
-
-      // 填充 reserved bytes 為零
-      var result = Data(decrypted)
-      result.append(Data(repeating: 0, count: reservedBytes))
-      return result
-    }
-
     private static func readGramsFromDecryptedDatabase(
       data: Data
     ) throws
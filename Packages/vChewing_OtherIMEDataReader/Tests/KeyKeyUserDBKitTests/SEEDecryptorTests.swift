@@ -0,0 +1,115 @@
+// (c) 2025 and onwards The vChewing Project (LGPL v3.0 License or later).
+// ====================
+// This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
+
+import Foundation
+import Testing
+
+@testable import KeyKeyUserDBKit
+
+// MARK: - SEEDecryptorTests
+
+@Suite(.serialized)
+struct SEEDecryptorTests {
+  /// FIPS-197 附錄 C.1 的測試向量。
+  @Test
+  func testAES128MatchesFIPS197Vector() throws {
+    let cipher = KeyKeyUserDBKit.AES128(key: Array(0 ..< 16))
+    let plainText = Self.bytes(fromHex: "00112233445566778899aabbccddeeff")
+    let expected = Self.bytes(fromHex: "69c4e0d86a7b0430d8cdb78070b4c55a")
+    var batched = [UInt8](repeating: 0, count: 16)
+    var portable = [UInt8](repeating: 0, count: 16)
+    try plainText.withUnsafeBytes { input in
+      try batched.withUnsafeMutableBytes { try cipher.encryptBlocks(input, into: $0) }
+      portable.withUnsafeMutableBytes { cipher.encryptBlocksPortable(input, into: $0) }
+    }
+    #expect(batched == expected)
+    #expect(portable == expected)
+  }
+
+  @Test
+  func testBatchedAndPortableBackendsAgreeOnManyBlocks() throws {
+    let cipher = KeyKeyUserDBKit.AES128(key: KeyKeyUserDBKit.SEEDecryptor.defaultKey)
+    let plainText = (0 ..< 16 * 62).map { UInt8(truncatingIfNeeded: $0 &* 31 &+ 7) }
+    var batched = [UInt8](repeating: 0, count: plainText.count)
+    var portable = [UInt8](repeating: 0, count: plainText.count)
+    try plainText.withUnsafeBytes { input in
+      try batched.withUnsafeMutableBytes { try cipher.encryptBlocks(input, into: $0) }
+      portable.withUnsafeMutableBytes { cipher.encryptBlocksPortable(input, into: $0) }
+    }
+    #expect(batched == portable)
+  }
+
+  /// 頁數夠多時會走並行解密，其結果須與逐區塊的參考實作一致。
+  @Test(arguments: [1, 3, 700])
+  func testDecryptMatchesReferenceImplementation(pageCount: Int) throws {
+    let encrypted = Self.makeEncryptedPages(count: pageCount)
+    let decryptor = KeyKeyUserDBKit.SEEDecryptor()
+    let decrypted = try decryptor.decrypt(encryptedData: Data(encrypted))
+    #expect(Array(decrypted) == Self.referenceDecrypt(encrypted, key: KeyKeyUserDBKit.SEEDecryptor.defaultKey))
+  }
+
+  @Test
+  func testDecryptRejectsInvalidSize() {
+    let decryptor = KeyKeyUserDBKit.SEEDecryptor()
+    #expect(throws: KeyKeyUserDBKit.DecryptionError.self) {
+      try decryptor.decrypt(encryptedData: Data(count: KeyKeyUserDBKit.SEEDecryptor.pageSize + 1))
+    }
+  }
+
+  // MARK: Private
+
+  private static func bytes(fromHex hex: String) -> [UInt8] {
+    var result: [UInt8] = []
+    var index = hex.startIndex
+    while index < hex.endIndex {
+      let next = hex.index(index, offsetBy: 2)
+      result.append(UInt8(hex[index ..< next], radix: 16)!)
+      index = next
+    }
+    return result
+  }
+
+  /// 產生具備各頁 nonce 的假資料（內容不必是合法的 SQLite 資料庫）。
+  private static func makeEncryptedPages(count: Int) -> [UInt8] {
+    var state: UInt32 = 0x1234_5678
+    return (0 ..< count * KeyKeyUserDBKit.SEEDecryptor.pageSize).map { _ in
+      state = state &* 1_664_525 &+ 1_013_904_223
+      return UInt8(truncatingIfNeeded: state >> 24)
+    }
+  }
+
+  /// 逐區塊建構 counter block 並逐一加密的參考實作（與舊版解密器的流程相同）。
+  private static func referenceDecrypt(_ data: [UInt8], key: [UInt8]) -> [UInt8] {
+    let pageSize = KeyKeyUserDBKit.SEEDecryptor.pageSize
+    let dataAreaSize = KeyKeyUserDBKit.SEEDecryptor.dataAreaSize
+    let cipher = KeyKeyUserDBKit.AES128(key: key)
+    var output: [UInt8] = []
+    for pageNum in 0 ..< data.count / pageSize {
+      let page = Array(data[pageNum * pageSize ..< (pageNum + 1) * pageSize])
+      let nonce = Array(page[(pageSize - 16)...])
+      let baseCounter = UInt32(nonce[4]) | UInt32(nonce[5]) << 8 | UInt32(nonce[6]) << 16 | UInt32(nonce[7]) << 24
+      var decrypted: [UInt8] = []
+      for blockIdx in 0 ..< dataAreaSize / 16 {
+        var counterBlock = nonce
+        let counter = baseCounter &+ UInt32(blockIdx)
+        for i in 0 ..< 4 {
+          counterBlock[4 + i] = UInt8(truncatingIfNeeded: counter >> (8 * i))
+        }
+        var keystream = [UInt8](repeating: 0, count: 16)
+        counterBlock.withUnsafeBytes { input in
+          keystream.withUnsafeMutableBytes { cipher.encryptBlocksPortable(input, into: $0) }
+        }
+        for i in 0 ..< 16 {
+          decrypted.append(page[blockIdx * 16 + i] ^ keystream[i])
+        }
+      }
+      if pageNum == 0 {
+        decrypted.replaceSubrange(16 ..< 24, with: page[16 ..< 24])
+      }
+      output.append(contentsOf: decrypted)
+      output.append(contentsOf: [UInt8](repeating: 0, count: pageSize - dataAreaSize))
+    }
+    return output
+  }
+}
@@ -16,9 +16,7 @@ public enum ChineseConverter {
   ///   - convert: 是否真的執行此操作。不填寫的話，該函式不執行。
   public static func hardenVerticalPunctuations(target: inout String, convert: Bool = false) {
     guard convert else { return }
-    for neta in Self.punctuationConversionTable {
-      target = target.replacingOccurrences(of: neta.0, with: neta.1)
-    }
+    Self.verticalPunctuationPipeline.apply(to: &target)
   }
 
   /// 將指定字串內的小寫漢字數字轉換為大寫，會對轉換對象進行直接修改操作。
@@ -26,37 +24,38 @@ public enum ChineseConverter {
   public static func ensureCurrencyNumerals(target: inout String) {
     let prefs = PrefMgr.sharedSansDidSetOps
     if !prefs.currencyNumeralsEnabled { return }
-    for key in currencyNumeralDictTable.keys {
-      guard let result = currencyNumeralDictTable[key] else { continue }
-      if IMEApp.currentInputMode == .imeModeCHS {
-        target = target.replacingOccurrences(of: key, with: result.3) // Simplified Chinese
-        continue
-      }
+    let column: CurrencyNumeralColumn = {
+      if IMEApp.currentInputMode == .imeModeCHS { return .simplified }
       switch (
         prefs.chineseConversionEnabled,
         prefs.shiftJISShinjitaiOutputEnabled
       ) {
-      case (false, true), (true, true): target = target.replacingOccurrences(
-          of: key,
-          with: result.2
-        ) // JIS
-      case (true, false): target = target.replacingOccurrences(of: key, with: result.0) // KangXi
-      default: target = target.replacingOccurrences(of: key, with: result.1) // Contemporary
+      case (false, true), (true, true): return .jis
+      case (true, false): return .kangXi
+      default: return .contemporary
       }
-    }
+    }()
+    currencyNumeralPipeline(for: column).apply(to: &target)
   }
 
   // 給 JIS 轉換模式新增疊字符號支援。
   public static func processKanjiRepeatSymbol(target: inout String) {
-    guard !target.isEmpty else { return }
-    var arr = target.map(\.description)
-    for (i, char) in arr.enumerated() {
-      if i == 0 { continue }
-      if char == target.map(\.description)[i - 1] {
-        arr[i] = "々"
-      }
-    }
-    target = arr.joined()
+    kanjiRepetitionPipeline.apply(to: &target)
+  }
+
+  // MARK: Internal
+
+  /// 大寫漢字數字的字形取向，對應 `currencyNumeralDictTable` 的各欄。
+  enum CurrencyNumeralColumn: Int, CaseIterable {
+    case kangXi = 0
+    case contemporary = 1
+    case jis = 2
+    case simplified = 3
+  }
+
+  /// 取得給定字形取向的大寫漢字數字轉換管線（已預先編譯）。
+  static func currencyNumeralPipeline(for column: CurrencyNumeralColumn) -> OutputPipeline {
+    currencyNumeralPipelines[column.rawValue]
   }
 
   // MARK: Private
@@ -67,6 +66,24 @@ public enum ChineseConverter {
     ("（", "︵"), ("）", "︶"), ("［", "﹇"), ("］", "﹈"), ("…", "⋮"),
   ]
 
+  private static let kanjiRepetitionPipeline = OutputPipeline(marksKanjiRepetition: true)
+
+  private static let verticalPunctuationPipeline = OutputPipeline(
+    substitutions: .init(uniqueKeysWithValues: punctuationConversionTable.map { (Character($0.0), $0.1) })
+  )
+
+  private static let currencyNumeralPipelines: [OutputPipeline] = CurrencyNumeralColumn.allCases.map { column in
+    OutputPipeline(substitutions: .init(uniqueKeysWithValues: currencyNumeralDictTable.map { key, values in
+      let value: String = switch column {
+      case .kangXi: values.0
+      case .contemporary: values.1
+      case .jis: values.2
+      case .simplified: values.3
+      }
+      return (Character(key), value)
+    }))
+  }
+
   /// 漢字數字大寫轉換專用辭典，順序為：康熙、當代繁體中文、日文、簡體中文。
   private static let currencyNumeralDictTable: [String: (String, String, String, String)] = [
     "一": ("壹", "壹", "壹", "壹"), "二": ("貳", "貳", "弐", "贰"), "三": ("叄", "參", "参", "叁"),
@@ -0,0 +1,87 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+// MARK: - ChineseConverter.OutputPipeline
+
+extension ChineseConverter {
+  /// 遞交文字的逐字元後處理。
+  ///
+  /// 各項後處理（縱排標點、大寫漢字數字、日文疊字符號）皆屬逐字元的轉換，
+  /// 故各自事先編譯成一份轉換表，對輸出內容只做一趟線性掃描，
+  /// 而不必每個辭典條目各跑一趟 `replacingOccurrences()`。
+  /// 這幾項後處理分別作用於不同的時機（遞交內容、組字區顯示內容、JIS 轉換結果），故各自獨立套用。
+  ///
+  /// 單趟掃描內依序執行下述兩段：
+  /// 1. `substitutions`：逐字元置換。
+  /// 2. `marksKanjiRepetition`：將「與前一個字元相同」的字元換成「々」（以第一段的輸出為準）。
+  ///
+  /// - Remark: 字元比對使用 Swift 的 `Character`（依 Unicode 標準等價比對、且以字位為單位），
+  /// 這與 `replacingOccurrences()` 的非字面比對結果一致。
+  public struct OutputPipeline: Equatable {
+    // MARK: Lifecycle
+
+    public init(
+      substitutions: [Character: String] = [:],
+      marksKanjiRepetition: Bool = false
+    ) {
+      self.substitutions = substitutions
+      self.marksKanjiRepetition = marksKanjiRepetition
+    }
+
+    // MARK: Public
+
+    /// 不做任何處理的管線。
+    public static let identity = Self()
+
+    public let substitutions: [Character: String]
+    public let marksKanjiRepetition: Bool
+
+    public var isIdentity: Bool {
+      substitutions.isEmpty && !marksKanjiRepetition
+    }
+
+    /// 以單趟線性掃描套用整條管線。
+    public func apply(to target: inout String) {
+      guard !isIdentity, !target.isEmpty else { return }
+      var result = String()
+      result.reserveCapacity(target.utf8.count)
+      var previous: Character?
+      for char in target {
+        guard let substituted = substitutions[char] else {
+          emit(char, previous: &previous, into: &result)
+          continue
+        }
+        for subChar in substituted {
+          emit(subChar, previous: &previous, into: &result)
+        }
+      }
+      target = result
+    }
+
+    /// 以單趟線性掃描套用整條管線。
+    public func applied(to target: String) -> String {
+      var result = target
+      apply(to: &result)
+      return result
+    }
+
+    // MARK: Private
+
+    private static let kanjiRepetitionMark: Character = "々"
+
+    @inline(__always)
+    private func emit(_ char: Character, previous: inout Character?, into result: inout String) {
+      guard marksKanjiRepetition else {
+        result.append(char)
+        return
+      }
+      result.append(char == previous ? Self.kanjiRepetitionMark : char)
+      previous = char
+    }
+  }
+}
@@ -0,0 +1,166 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+// MARK: - CompositionBufferLayout
+
+/// 組字區文字片段的版面索引：記錄每個片段的字位（Grapheme）數與 UTF-16 長度，以及兩者的累計偏移量。
+///
+/// 有了這份索引，「字位游標 → UTF-16 游標」的換算、以及「某游標落在哪個片段」的定位，
+/// 皆可藉由二分搜尋完成，無須每次都把整段組字區文字拆成字元陣列重數一遍。
+/// 片段有變動時，可經由 `replacingSegments()` 僅重新統計有變動的片段。
+nonisolated public struct CompositionBufferLayout: Equatable, Sendable {
+  // MARK: Lifecycle
+
+  /// 根據給定的片段建立索引。
+  public init(segments: [String]) {
+    self.init(
+      graphemeCounts: segments.map(\.count),
+      utf16Counts: segments.map(\.utf16.count),
+      isGraphemeAligned: Self.checkGraphemeAlignment(segments, boundaries: 1 ..< max(1, segments.count))
+    )
+  }
+
+  /// 根據給定的片段建立索引，並盡可能沿用上一份索引中內容相同的開頭與結尾片段的統計結果。
+  /// - Parameters:
+  ///   - segments: 新的片段。
+  ///   - previous: 上一份索引及其對應的片段。
+  public init(segments: [String], reusing previous: (segments: [String], layout: Self)?) {
+    guard let previous, previous.layout.segmentCount == previous.segments.count else {
+      self.init(segments: segments)
+      return
+    }
+    let oldSegments = previous.segments
+    let sharedBound = min(oldSegments.count, segments.count)
+    var prefixLength = 0
+    while prefixLength < sharedBound, oldSegments[prefixLength] == segments[prefixLength] {
+      prefixLength += 1
+    }
+    var suffixLength = 0
+    while suffixLength < sharedBound - prefixLength,
+          oldSegments[oldSegments.count - 1 - suffixLength] == segments[segments.count - 1 - suffixLength] {
+      suffixLength += 1
+    }
+    self = previous.layout.replacingSegments(
+      prefixLength ..< (oldSegments.count - suffixLength),
+      with: segments[prefixLength ..< (segments.count - suffixLength)],
+      resultingSegments: segments
+    )
+  }
+
+  /// 直接以各片段的統計資料建立索引。
+  private init(graphemeCounts: [Int], utf16Counts: [Int], isGraphemeAligned: Bool) {
+    self.graphemeCounts = graphemeCounts
+    self.utf16Counts = utf16Counts
+    self.graphemeOffsets = Self.prefixSums(of: graphemeCounts)
+    self.utf16Offsets = Self.prefixSums(of: utf16Counts)
+    self.isGraphemeAligned = isGraphemeAligned
+  }
+
+  // MARK: Public
+
+  /// 各片段的字位數。
+  public private(set) var graphemeCounts: [Int]
+  /// 各片段的 UTF-16 長度。
+  public private(set) var utf16Counts: [Int]
+  /// 各片段起點的累計字位偏移量（長度為片段數量 + 1，末元素為總字位數）。
+  public private(set) var graphemeOffsets: [Int]
+  /// 各片段起點的累計 UTF-16 偏移量（長度為片段數量 + 1，末元素為總 UTF-16 長度）。
+  public private(set) var utf16Offsets: [Int]
+  /// 相鄰片段銜接之後是否不會合併成同一個字位（比如被拆開的國旗 emoji）。
+  /// 若為 false，則各片段字位數之和不等於銜接後的字位數，此時索引不可用於游標換算。
+  public private(set) var isGraphemeAligned: Bool
+
+  public var segmentCount: Int { graphemeCounts.count }
+  public var graphemeCount: Int { graphemeOffsets.last ?? 0 }
+  public var utf16Count: Int { utf16Offsets.last ?? 0 }
+
+  /// 找出涵蓋給定字位位置的片段（空片段不會被選中）。
+  /// - Parameter position: 字位位置。
+  /// - Returns: 片段索引；若位置落在組字區範圍之外（含末端）則為 nil。
+  public func segmentIndex(containingGrapheme position: Int) -> Int? {
+    guard position >= 0, position < graphemeCount else { return nil }
+    // 找出最小的 i 使得 graphemeOffsets[i + 1] > position。
+    var lowerBound = 0
+    var upperBound = segmentCount - 1
+    while lowerBound < upperBound {
+      let middle = (lowerBound + upperBound) / 2
+      if graphemeOffsets[middle + 1] > position {
+        upperBound = middle
+      } else {
+        lowerBound = middle + 1
+      }
+    }
+    return lowerBound
+  }
+
+  /// 將字位游標換算成 UTF-16 游標。
+  /// - Parameters:
+  ///   - position: 字位游標，超出範圍者會被修正至範圍內。
+  ///   - segments: 該索引所對應的片段。
+  /// - Returns: UTF-16 游標。
+  public func utf16Offset(ofGrapheme position: Int, in segments: [String]) -> Int {
+    guard position > 0 else { return 0 }
+    guard let index = segmentIndex(containingGrapheme: position) else { return utf16Count }
+    let localOffset = position - graphemeOffsets[index]
+    guard localOffset > 0, segments.indices.contains(index) else { return utf16Offsets[index] }
+    return utf16Offsets[index] + segments[index].prefix(localOffset).utf16.count
+  }
+
+  /// 以新片段取代給定範圍內的片段，只統計新片段、其餘片段的統計結果原樣沿用。
+  /// - Parameters:
+  ///   - range: 要取代的片段範圍。
+  ///   - replacements: 新片段。
+  ///   - resultingSegments: 取代後的完整片段陣列，用來檢查新片段與相鄰片段的銜接處。
+  /// - Returns: 新的索引。
+  public func replacingSegments<C: Collection>(
+    _ range: Range<Int>,
+    with replacements: C,
+    resultingSegments: [String]
+  )
+    -> Self where C.Element == String {
+    var newGraphemeCounts = graphemeCounts
+    var newUTF16Counts = utf16Counts
+    newGraphemeCounts.replaceSubrange(range, with: replacements.map(\.count))
+    newUTF16Counts.replaceSubrange(range, with: replacements.map(\.utf16.count))
+    // 僅需檢查新片段前後的銜接處；其餘銜接處沿用舊結果。
+    let firstBoundary = max(1, range.lowerBound)
+    let changedBoundaries = firstBoundary ..< max(
+      firstBoundary,
+      min(resultingSegments.count, range.lowerBound + replacements.count + 1)
+    )
+    let aligned = isGraphemeAligned
+      ? Self.checkGraphemeAlignment(resultingSegments, boundaries: changedBoundaries)
+      : Self.checkGraphemeAlignment(resultingSegments, boundaries: 1 ..< max(1, resultingSegments.count))
+    return .init(graphemeCounts: newGraphemeCounts, utf16Counts: newUTF16Counts, isGraphemeAligned: aligned)
+  }
+
+  // MARK: Private
+
+  private static func prefixSums(of counts: [Int]) -> [Int] {
+    var result = [Int]()
+    result.reserveCapacity(counts.count + 1)
+    var sum = 0
+    result.append(0)
+    counts.forEach {
+      sum += $0
+      result.append(sum)
+    }
+    return result
+  }
+
+  /// 檢查給定的銜接處（第 i 個銜接處位於片段 i - 1 與片段 i 之間）是否不會讓字位合併。
+  /// 空片段會被略過，改拿前後最近的非空片段來比對。
+  private static func checkGraphemeAlignment(_ segments: [String], boundaries: Range<Int>) -> Bool {
+    for boundary in boundaries where boundary > 0 && boundary < segments.count {
+      guard let next = segments[boundary...].first(where: { !$0.isEmpty })?.first else { continue }
+      guard let previous = segments[..<boundary].last(where: { !$0.isEmpty })?.last else { continue }
+      if (String(previous) + String(next)).count != 2 { return false }
+    }
+    return true
+  }
+}
@@ -506,11 +506,9 @@ public enum EmacsKey {
 
 extension KBEvent {
   public func layoutTranslated(to layout: LatinKeyboardMappings = .qwerty) -> KBEvent {
-    let mapTable = layout.mapTable
     if isFlagChanged { return self }
     guard keyModifierFlags == .shift || keyModifierFlags.isEmpty else { return self }
-    if !mapTable.keys.contains(keyCode) { return self }
-    guard let dataTuplet = mapTable[keyCode] else { return self }
+    guard let dataTuplet = layout.compiledTable.glyphs(for: keyCode) else { return self }
     let result: KBEvent = reinitiate(
       characters: isShiftHeld ? dataTuplet.1 : dataTuplet.0,
       charactersIgnoringModifiers: dataTuplet.0
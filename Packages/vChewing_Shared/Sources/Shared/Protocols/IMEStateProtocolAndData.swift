@@ -12,6 +12,27 @@ import Foundation
 
 public typealias CandidateInState = (keyArray: [String], value: String)
 
+// MARK: - CandidateSignature
+
+/// CandidateInState 是 tuple、無法直接放入集合，故以此（讀音陣列 + 詞值）作為其可雜湊的簽名。
+nonisolated public struct CandidateSignature: Hashable, Sendable {
+  // MARK: Lifecycle
+
+  public init(keyArray: [String], value: String) {
+    self.keyArray = keyArray
+    self.value = value
+  }
+
+  public init(_ candidate: CandidateInState) {
+    self.init(keyArray: candidate.keyArray, value: candidate.value)
+  }
+
+  // MARK: Public
+
+  public let keyArray: [String]
+  public let value: String
+}
+
 // MARK: - IMEStateProtocol
 
 // 所有 IMEState 均遵守該協定：
@@ -145,6 +166,10 @@ extension IMEStateProtocol {
     data.currentCandidate
   }
 
+  public func isMacroCandidate(_ candidate: CandidateInState) -> Bool {
+    data.isMacroCandidate(candidate)
+  }
+
   public var textToCommit: String {
     get { data.textToCommit }
     set { data.textToCommit = newValue }
@@ -272,6 +297,9 @@ public struct IMEStateData {
   public var reading: String = ""
   public var markedReadings = [String]()
   public var candidates = [CandidateInState]()
+  /// 由 InputToken（巨集）展開而來的候選字詞。生成選字狀態時自組字器候選所帶的來源標記謄入，
+  /// 供朗讀與選字窗直接判斷，不必再回頭查詢語言模型（時間巨集等的展開結果每次查詢都會變）。
+  public var macroCandidates = Set<CandidateSignature>()
   public var textToCommit: String = ""
 
   public var tooltip: String = ""
@@ -300,36 +328,69 @@ public struct IMEStateData {
     return candidates[idxCandidate]
   }
 
+  public func isMacroCandidate(_ candidate: CandidateInState) -> Bool {
+    guard !macroCandidates.isEmpty else { return false }
+    return macroCandidates.contains(.init(candidate))
+  }
+
   public var cursor: Int = 0 {
     didSet {
-      cursor = min(max(cursor, 0), displayedText.count)
+      cursor = min(max(cursor, 0), displayedTextLength)
     }
   }
 
   public var marker: Int = 0 {
     didSet {
-      marker = min(max(marker, 0), displayedText.count)
+      marker = min(max(marker, 0), displayedTextLength)
     }
   }
 
-  public var displayTextSegments = [String]() {
-    didSet {
-      displayedText = displayTextSegments.joined()
+  public var displayTextSegments: [String] {
+    get { storedDisplayTextSegments }
+    set {
+      let joined = newValue.joined()
+      displayedText = joined // 此舉會清空 segmentLayout。
+      storedDisplayTextSegments = newValue
+      // 若銜接後的文字被修剪過，則片段與顯示文字不再一一對應，只能退回逐字計算。
+      guard displayedText.utf8.count == joined.utf8.count else { return }
+      let layout = CompositionBufferLayout(segments: newValue, reusing: Self.recentSegmentLayout)
+      Self.recentSegmentLayout = (newValue, layout)
+      guard layout.isGraphemeAligned else { return }
+      segmentLayout = layout
     }
   }
 
   public var displayedText: String = "" {
     didSet {
+      // 直接改寫顯示文字時，既有的片段索引即告失效。
+      segmentLayout = nil
       if displayedText.rangeOfCharacter(from: .newlines) != nil {
         displayedText = displayedText.trimmingCharacters(in: .newlines)
       }
     }
   }
 
+  /// 組字區文字片段的版面索引，用來在 O(log n) 內完成游標換算。
+  /// 若顯示文字曾被修剪或直接改寫而與片段對不上，則為 nil。
+  public private(set) var segmentLayout: CompositionBufferLayout?
+
   /// 保證回傳未經 BPMFVS 投影的原始文字。
   public var rawDisplayedText: String {
     rawDisplayTextSegments?.joined() ?? displayedText
   }
+
+  // MARK: Private
+
+  /// 最近一次建立的片段索引。相鄰兩次狀態的組字區通常只差在游標附近的幾個片段，
+  /// 故新狀態可沿用上一個狀態的統計結果、僅重新統計有變動的片段。
+  private static var recentSegmentLayout: (segments: [String], layout: CompositionBufferLayout)?
+
+  private var storedDisplayTextSegments = [String]()
+
+  /// 顯示文字的字位數。
+  private var displayedTextLength: Int {
+    segmentLayout?.graphemeCount ?? displayedText.count
+  }
 }
 
 extension IMEStateData {
@@ -345,13 +406,11 @@ extension IMEStateData {
   /// 所以在這裡必須做糾偏處理。因為在用 Swift，所以可以用「.utf16」取代「NSString.length()」。
   /// 這樣就可以免除不必要的類型轉換。
   public var u16Cursor: Int {
-    let upperBound = max(0, min(cursor, displayedText.count))
-    return displayedText.map(\.description)[0 ..< upperBound].joined().utf16.count
+    u16Offset(ofGrapheme: cursor)
   }
 
   public var u16Marker: Int {
-    let upperBound = max(0, min(marker, displayedText.count))
-    return displayedText.map(\.description)[0 ..< upperBound].joined().utf16.count
+    u16Offset(ofGrapheme: marker)
   }
 
   public var u16MarkedRange: Range<Int> {
@@ -375,4 +434,15 @@ extension IMEStateData {
   public static var minCandidateLength: Int {
     PrefMgr.sharedSansDidSetOps.allowRescoringSingleKanjiCandidates ? 1 : 2
   }
+
+  // MARK: Private
+
+  /// 將字位游標換算成 UTF-16 游標。有片段索引可用時僅需二分搜尋，否則退回逐字計算。
+  private func u16Offset(ofGrapheme position: Int) -> Int {
+    if let segmentLayout {
+      return segmentLayout.utf16Offset(ofGrapheme: position, in: storedDisplayTextSegments)
+    }
+    let upperBound = max(0, min(position, displayedText.count))
+    return displayedText.prefix(upperBound).utf16.count
+  }
 }
@@ -128,8 +128,141 @@ final class SharedTests {
     #expect(CandidateTextService(key: "file2", definedValue: def2, param: "a") == nil)
   }
 
+  /// 片段索引的游標換算結果須與逐字計算的結果一致，且沿用舊索引所得的結果須與重新建立者相同。
+  @Test
+  func testIMEStateDataSegmentLayoutMatchesPerCharacterCounting() throws {
+    func legacyU16Offset(_ text: String, _ position: Int) -> Int {
+      let upperBound = max(0, min(position, text.count))
+      return text.map(\.description)[0 ..< upperBound].joined().utf16.count
+    }
+    let segmentSets: [[String]] = [
+      ["這是", "🇹🇼", "一個", "", "測試"],
+      ["這是", "🇹🇼", "一個", "ㄘㄜˋ", "", "測試"],
+      ["", "ㄘ", "這是", "🇹🇼", "一個", "", "測試"],
+      ["A", "👩‍👩‍👧", "\u{8FBB}\u{E0100}", "試"],
+    ]
+    for segments in segmentSets {
+      var data = IMEStateData()
+      data.displayTextSegments = segments
+      #expect(data.segmentLayout != nil)
+      #expect(data.segmentLayout == CompositionBufferLayout(segments: segments))
+      let text = data.displayedText
+      for position in -1 ... (text.count + 1) {
+        data.cursor = position
+        data.marker = 0
+        #expect(data.u16Cursor == legacyU16Offset(text, data.cursor))
+        #expect(data.u16MarkedRange == 0 ..< legacyU16Offset(text, data.cursor))
+      }
+    }
+    // 銜接後會合併成同一個字位的片段（被拆開的國旗），不得使用片段索引。
+    var splitFlag = IMEStateData()
+    splitFlag.displayTextSegments = ["🇹", "🇼"]
+    #expect(splitFlag.segmentLayout == nil)
+    splitFlag.cursor = 1
+    #expect(splitFlag.u16Cursor == legacyU16Offset(splitFlag.displayedText, 1))
+    // 直接改寫顯示文字或首尾換行被修剪時，片段索引亦須失效。
+    var trimmed = IMEStateData()
+    trimmed.displayTextSegments = ["\n", "測試"]
+    #expect(trimmed.segmentLayout == nil)
+    #expect(trimmed.displayedText == "測試")
+  }
+
+  /// 單趟後處理管線的結果須與舊版逐階段 `replacingOccurrences()` 的結果完全一致。
+  @Test
+  func testOutputPipelineMatchesLegacyMultiPassProcessing() throws {
+    let corpus = Self.makeOutputPipelineCorpus(length: 200_000)
+    // 大寫漢字數字。
+    for column in ChineseConverter.CurrencyNumeralColumn.allCases {
+      var legacy = corpus
+      for (key, values) in Self.legacyCurrencyNumeralTable {
+        let value = [values.0, values.1, values.2, values.3][column.rawValue]
+        legacy = legacy.replacingOccurrences(of: key, with: value)
+      }
+      let fused = ChineseConverter.currencyNumeralPipeline(for: column).applied(to: corpus)
+      #expect(fused == legacy, "Currency numeral column mismatch: \(column)")
+    }
+    // 縱排標點。
+    var legacyVertical = corpus
+    for (key, value) in Self.legacyPunctuationTable {
+      legacyVertical = legacyVertical.replacingOccurrences(of: key, with: value)
+    }
+    var fusedVertical = corpus
+    ChineseConverter.hardenVerticalPunctuations(target: &fusedVertical, convert: true)
+    #expect(fusedVertical == legacyVertical)
+    // 疊字符號（舊版為 O(n²)，故只取前一段語料；此處的參考實作已將原文拆字的步驟提到迴圈外）。
+    let repeatCorpus = String(corpus.prefix(20_000))
+    let originalChars = repeatCorpus.map(\.description)
+    var legacyRepeat = originalChars
+    for i in legacyRepeat.indices.dropFirst() where originalChars[i - 1] == legacyRepeat[i] {
+      legacyRepeat[i] = "々"
+    }
+    var fusedRepeat = repeatCorpus
+    ChineseConverter.processKanjiRepeatSymbol(target: &fusedRepeat)
+    #expect(fusedRepeat == legacyRepeat.joined())
+  }
+
+  /// 長篇遞交與貼上文字的後處理耗時（僅供參考，不做效能斷言）。
+  @Test
+  func testOutputPipelineBenchmark() throws {
+    for length in [2_000, 200_000] {
+      let corpus = Self.makeOutputPipelineCorpus(length: length)
+      var legacy = corpus
+      let legacyTime = Self.nanosecondsElapsed {
+        for (key, values) in Self.legacyCurrencyNumeralTable {
+          legacy = legacy.replacingOccurrences(of: key, with: values.1)
+        }
+        for (key, value) in Self.legacyPunctuationTable {
+          legacy = legacy.replacingOccurrences(of: key, with: value)
+        }
+      }
+      let pipeline = ChineseConverter.currencyNumeralPipeline(for: .contemporary)
+      var fused = corpus
+      let fusedTime = Self.nanosecondsElapsed {
+        pipeline.apply(to: &fused)
+        ChineseConverter.hardenVerticalPunctuations(target: &fused, convert: true)
+      }
+      #expect(fused == legacy)
+      print("// [BENCH] OutputPipeline length=\(length): legacy \(legacyTime / 1_000)µs, fused \(fusedTime / 1_000)µs")
+    }
+  }
+
   // MARK: Private
 
+  private static let legacyPunctuationTable: [(String, String)] = [
+    ("【", "︻"), ("】", "︼"), ("〖", "︗"), ("〗", "︘"), ("〔", "︹"), ("〕", "︺"), ("《", "︽"), ("》", "︾"),
+    ("〈", "︿"), ("〉", "﹀"), ("「", "﹁"), ("」", "﹂"), ("『", "﹃"), ("』", "﹄"), ("｛", "︷"), ("｝", "︸"),
+    ("（", "︵"), ("）", "︶"), ("［", "﹇"), ("］", "﹈"), ("…", "⋮"),
+  ]
+
+  private static let legacyCurrencyNumeralTable: [String: (String, String, String, String)] = [
+    "一": ("壹", "壹", "壹", "壹"), "二": ("貳", "貳", "弐", "贰"), "三": ("叄", "參", "参", "叁"),
+    "四": ("肆", "肆", "肆", "肆"), "五": ("伍", "伍", "伍", "伍"), "六": ("陸", "陸", "陸", "陆"),
+    "七": ("柒", "柒", "柒", "柒"), "八": ("捌", "捌", "捌", "捌"), "九": ("玖", "玖", "玖", "玖"),
+    "十": ("拾", "拾", "拾", "拾"), "百": ("佰", "佰", "佰", "佰"), "千": ("仟", "仟", "仟", "仟"),
+    "万": ("萬", "萬", "萬", "万"), "〇": ("零", "零", "零", "零"),
+  ]
+
+  private static func nanosecondsElapsed(_ task: () -> ()) -> UInt64 {
+    let startTime = DispatchTime.now().uptimeNanoseconds
+    task()
+    return DispatchTime.now().uptimeNanoseconds - startTime
+  }
+
+  /// 以固定種子的線性同餘產生器生成測試語料，內含漢字數字、標點、疊字、ASCII、emoji 與換行。
+  private static func makeOutputPipelineCorpus(length: Int) -> String {
+    let alphabet: [String] = legacyCurrencyNumeralTable.keys.sorted() + legacyPunctuationTable.map(\.0) + [
+      "我", "們", "時", "時", "人", "人人", "々", "a", "b", " ", "1", "\n", "👩‍👩‍👧", "🇹🇼", "e\u{301}", "壹", "︻",
+    ]
+    var seed: UInt64 = 0x5EED_CAFE
+    var result = String()
+    result.reserveCapacity(length * 3)
+    for _ in 0 ..< length {
+      seed = seed &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+      result.append(alphabet[Int((seed >> 33) % UInt64(alphabet.count))])
+    }
+    return result
+  }
+
   // MARK: - CandidateTextService (Basic Tests)
 
   private let testDataMap: [String] = [
@@ -122,11 +122,9 @@ extension NSEvent {
 
 extension NSEvent {
   public func layoutTranslated(to layout: LatinKeyboardMappings = .qwerty) -> NSEvent {
-    let mapTable = layout.mapTable
     if isFlagChanged { return self }
     guard keyModifierFlagsNS == .shift || keyModifierFlagsNS.isEmpty else { return self }
-    if !mapTable.keys.contains(keyCode) { return self }
-    guard let dataTuplet = mapTable[keyCode] else { return self }
+    guard let dataTuplet = layout.compiledTable.glyphs(for: keyCode) else { return self }
     let result: NSEvent? = reinitiate(
       characters: isShiftHeld ? dataTuplet.1 : dataTuplet.0,
       charactersIgnoringModifiers: dataTuplet.0
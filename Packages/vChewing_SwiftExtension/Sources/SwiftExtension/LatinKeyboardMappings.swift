@@ -22,6 +22,72 @@ public enum LatinKeyboardMappings: String, CaseIterable {
 
   // MARK: Public
 
+  /// 以 keyCode 為索引攤平的字元對照表。
+  ///
+  /// `mapTable` 是辭典，逐鍵查詢時得先雜湊 keyCode 再複製整組 tuple。
+  /// 這裡改在首次存取時一次將每種排列編譯成陣列，之後每次擊鍵只需按 keyCode 取值。
+  /// 對照表內的字元皆已是半形，無須再做全形轉半形處理。
+  nonisolated public struct CompiledTable: Sendable {
+    // MARK: Lifecycle
+
+    fileprivate init(_ dict: [UInt16: (String, String)]) {
+      let slotCount = Int(dict.keys.max() ?? 0) + 1
+      var glyphs = [(base: String, shifted: String)?](repeating: nil, count: slotCount)
+      var printableFlags = [UInt8](repeating: 0, count: slotCount)
+      for (keyCode, tuple) in dict {
+        glyphs[Int(keyCode)] = (tuple.0, tuple.1)
+        var flags: UInt8 = 0
+        if Self.isPrintableASCII(tuple.0) { flags |= 1 }
+        if Self.isPrintableASCII(tuple.1) { flags |= 2 }
+        printableFlags[Int(keyCode)] = flags
+      }
+      self.glyphs = glyphs
+      self.printableFlags = printableFlags
+    }
+
+    // MARK: Public
+
+    /// 給定 keyCode 在該排列下的（基底字元, Shift 字元）。該排列未收錄此 keyCode 時回傳 nil。
+    public func glyphs(for keyCode: UInt16) -> (base: String, shifted: String)? {
+      let index = Int(keyCode)
+      guard index < glyphs.count else { return nil }
+      return glyphs[index]
+    }
+
+    /// 給定 keyCode 在該排列下的字元，僅在該字元為單個可列印 ASCII 字元時才回傳。
+    public func printableASCII(for keyCode: UInt16, shifted: Bool) -> String? {
+      let index = Int(keyCode)
+      guard index < glyphs.count, let tuple = glyphs[index] else { return nil }
+      guard printableFlags[index] & (shifted ? 2 : 1) != 0 else { return nil }
+      return shifted ? tuple.shifted : tuple.base
+    }
+
+    // MARK: Private
+
+    private let glyphs: [(base: String, shifted: String)?]
+    /// 第 0 位元：基底字元是否為可列印 ASCII；第 1 位元：Shift 字元是否為可列印 ASCII。
+    private let printableFlags: [UInt8]
+
+    private static func isPrintableASCII(_ text: String) -> Bool {
+      let scalars = text.unicodeScalars
+      guard scalars.count == 1, let scalar = scalars.first else { return false }
+      return (0x20 ... 0x7E).contains(scalar.value)
+    }
+  }
+
+  /// 該排列的編譯後對照表。同一組對照內容的各個排列共用同一張表。
+  public var compiledTable: CompiledTable {
+    switch self {
+    case .qwerty, .qwertyBritish, .qwertyUS: return Self.compiledQwerty
+    case .azerty, .azertyFrench: return Self.compiledAzerty
+    case .qwertz, .qwertzGerman: return Self.compiledQwertz
+    case .colemak: return Self.compiledColemak
+    case .dvorak, .dvorakQwertyCMD: return Self.compiledDvorak
+    case .dvorakLeft: return Self.compiledDvorakLeft
+    case .dvorakRight: return Self.compiledDvorakRight
+    }
+  }
+
   public var mapTable: [UInt16: (String, String)] {
     switch self {
     case .qwerty, .qwertyBritish, .qwertyUS: return Self.dictQwerty
@@ -36,6 +102,14 @@ public enum LatinKeyboardMappings: String, CaseIterable {
 
   // MARK: Private
 
+  private static let compiledQwerty = CompiledTable(dictQwerty)
+  private static let compiledAzerty = CompiledTable(dictAzerty)
+  private static let compiledQwertz = CompiledTable(dictQwertz)
+  private static let compiledColemak = CompiledTable(dictColemak)
+  private static let compiledDvorak = CompiledTable(dictDvorak)
+  private static let compiledDvorakLeft = CompiledTable(dictDvorakLeft)
+  private static let compiledDvorakRight = CompiledTable(dictDvorakRight)
+
   private static let dictQwerty: [UInt16: (String, String)] = [
     0: ("a", "A"), 1: ("s", "S"), 2: ("d", "D"), 3: ("f", "F"), 4: ("h", "H"), 5: ("g", "G"),
     6: ("z", "Z"), 7: ("x", "X"), 8: ("c", "C"), 9: ("v", "V"), 11: ("b", "B"), 12: ("q", "Q"),
@@ -0,0 +1,199 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+
+// MARK: - PerfProbe
+
+/// 熱路徑量測探針：類似 signpost 的計時區段（span）與累加計數器（counter）。
+///
+/// 只有在以 `-Xswiftc -DVCHEWING_PERF_PROBES` 建置時才會實際記錄資料；
+/// 未定義該旗標時，`begin()` / `end()` / `count()` 皆為空的 `@inline(__always)` 函式，
+/// 會在編譯期被完全消除，故可直接留在正式版的熱路徑內。
+///
+/// 用法：
+/// ```
+/// let probe = PerfProbe.begin("LMI.unigramsFor")
+/// defer { PerfProbe.end(probe) }
+/// PerfProbe.count("LMI.unigramsFor.cacheHit")
+/// ```
+/// 量測結果可經由 `PerfProbe.snapshot()` 取得，或以 `PerfProbe.snapshot().dump()` 輸出純文字報表。
+nonisolated public enum PerfProbe {
+  // MARK: Public
+
+  /// 計時區段的憑據。未啟用量測時不攜帶任何資料。
+  public struct Token: Sendable {
+    #if VCHEWING_PERF_PROBES
+      fileprivate let name: StaticString
+      fileprivate let startTime: UInt64
+    #endif
+  }
+
+  /// 單一計時區段的統計結果。
+  public struct SpanMetric: Sendable, Equatable {
+    public let name: String
+    public let calls: UInt64
+    public let totalNanoseconds: UInt64
+    public let maxNanoseconds: UInt64
+
+    public var meanNanoseconds: Double {
+      calls == 0 ? 0 : Double(totalNanoseconds) / Double(calls)
+    }
+  }
+
+  /// 某一時刻的量測結果鏡照。
+  public struct Snapshot: Sendable, Equatable {
+    /// 當前建置是否有啟用量測。
+    public let isEnabled: Bool
+    /// 以累計耗時遞減排序的計時區段。
+    public let spans: [SpanMetric]
+    /// 以名稱排序的計數器。
+    public let counters: [(name: String, value: Int)]
+
+    public static func == (lhs: Snapshot, rhs: Snapshot) -> Bool {
+      lhs.isEnabled == rhs.isEnabled && lhs.spans == rhs.spans
+        && lhs.counters.map(\.name) == rhs.counters.map(\.name)
+        && lhs.counters.map(\.value) == rhs.counters.map(\.value)
+    }
+
+    public func span(named name: String) -> SpanMetric? {
+      spans.first { $0.name == name }
+    }
+
+    public func counter(named name: String) -> Int {
+      counters.first { $0.name == name }?.value ?? 0
+    }
+
+    /// 輸出純文字報表，供除錯選單或日誌使用。
+    public func dump() -> String {
+      guard isEnabled else {
+        return "PerfProbe is disabled in this build (rebuild with -DVCHEWING_PERF_PROBES)."
+      }
+      var lines: [String] = ["# Spans (calls / total ms / mean µs / max µs)"]
+      spans.forEach { metric in
+        let totalMS = Double(metric.totalNanoseconds) / 1_000_000
+        let meanUS = metric.meanNanoseconds / 1_000
+        let maxUS = Double(metric.maxNanoseconds) / 1_000
+        lines.append(
+          "\(metric.name)\t\(metric.calls)\t\(totalMS.rounded(toPlaces: 3))"
+            + "\t\(meanUS.rounded(toPlaces: 2))\t\(maxUS.rounded(toPlaces: 2))"
+        )
+      }
+      lines.append("# Counters")
+      counters.forEach { lines.append("\($0.name)\t\($0.value)") }
+      return lines.joined(separator: "\n")
+    }
+  }
+
+  /// 當前建置是否有啟用量測。
+  public static var isEnabled: Bool {
+    #if VCHEWING_PERF_PROBES
+      return true
+    #else
+      return false
+    #endif
+  }
+
+  /// 開始一個計時區段。
+  @inline(__always)
+  public static func begin(_ name: StaticString) -> Token {
+    #if VCHEWING_PERF_PROBES
+      return Token(name: name, startTime: DispatchTime.now().uptimeNanoseconds)
+    #else
+      return Token()
+    #endif
+  }
+
+  /// 結束一個計時區段。
+  @inline(__always)
+  public static func end(_ token: Token) {
+    #if VCHEWING_PERF_PROBES
+      let elapsed = DispatchTime.now().uptimeNanoseconds &- token.startTime
+      record(span: token.name.description, nanoseconds: elapsed)
+    #endif
+  }
+
+  /// 以計時區段包覆給定的閉包。
+  @inline(__always)
+  public static func span<T>(_ name: StaticString, _ body: () throws -> T) rethrows -> T {
+    #if VCHEWING_PERF_PROBES
+      let token = begin(name)
+      defer { end(token) }
+    #endif
+    return try body()
+  }
+
+  /// 累加計數器。
+  @inline(__always)
+  public static func count(_ name: StaticString, by delta: Int = 1) {
+    #if VCHEWING_PERF_PROBES
+      record(counter: name.description, delta: delta)
+    #endif
+  }
+
+  /// 直接記錄一筆已量得的區段耗時。供無法自行取得時鐘的模組（如 Homa）轉呼叫。
+  public static func record(span name: String, nanoseconds: UInt64) {
+    #if VCHEWING_PERF_PROBES
+      mtxStore.withLock { store in
+        store.spans[name, default: .init()].add(nanoseconds)
+      }
+    #endif
+  }
+
+  /// 直接累加計數器。供無法使用 `StaticString` 的呼叫端使用。
+  public static func record(counter name: String, delta: Int) {
+    #if VCHEWING_PERF_PROBES
+      mtxStore.withLock { store in
+        store.counters[name, default: 0] &+= delta
+      }
+    #endif
+  }
+
+  /// 取得當前量測結果的鏡照。
+  public static func snapshot() -> Snapshot {
+    let store = mtxStore.value
+    let spans = store.spans.map { name, accumulator in
+      SpanMetric(
+        name: name,
+        calls: accumulator.calls,
+        totalNanoseconds: accumulator.totalNanoseconds,
+        maxNanoseconds: accumulator.maxNanoseconds
+      )
+    }.sorted {
+      ($0.totalNanoseconds, $1.name) > ($1.totalNanoseconds, $0.name)
+    }
+    let counters = store.counters.map { (name: $0.key, value: $0.value) }.sorted { $0.name < $1.name }
+    return Snapshot(isEnabled: isEnabled, spans: spans, counters: counters)
+  }
+
+  /// 清空所有量測結果。
+  public static func reset() {
+    mtxStore.value = .init()
+  }
+
+  // MARK: Private
+
+  private struct SpanAccumulator {
+    var calls: UInt64 = 0
+    var totalNanoseconds: UInt64 = 0
+    var maxNanoseconds: UInt64 = 0
+
+    mutating func add(_ nanoseconds: UInt64) {
+      calls &+= 1
+      totalNanoseconds &+= nanoseconds
+      maxNanoseconds = Swift.max(maxNanoseconds, nanoseconds)
+    }
+  }
+
+  private struct Store {
+    var spans: [String: SpanAccumulator] = [:]
+    var counters: [String: Int] = [:]
+  }
+
+  private static let mtxStore: NSMutex<Store> = .init(.init())
+}
@@ -0,0 +1,416 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+
+// MARK: - StartupOrchestrator
+
+/// 冷啟動編排器：依相依關係排程各元件（stage）的載入工作，並記錄各元件的載入耗時與記憶體變化。
+///
+/// - 每個元件都有名稱、相依元件、執行位置（主執行緒或背景佇列）、以及是否屬於關鍵路徑。
+/// - 相依元件必須先行登記，故登記順序本身即保證不會出現循環相依；
+///   關鍵元件也只能相依於其他關鍵元件。
+/// - 背景元件彼此之間會並行執行。非關鍵的主執行緒元件則會延後至關鍵路徑全數就緒之後才執行，
+///   以免佔用首次按鍵所需的主執行緒時間。
+/// - 載入工作本身若是非同步的，可改用 `asyncBody` 登記，並在真正完成時呼叫 `Completion`。
+///
+/// 用法：
+/// ```
+/// let orchestrator = StartupOrchestrator()
+/// orchestrator.addMainStage("factoryDictionary", critical: true) { done in
+///   connectFactoryDictionary { _ in done() }
+/// }
+/// orchestrator.addStage("pinyinTrie") { _ = PinyinTrie.shared(parser: .ofHanyuPinyin) }
+/// orchestrator.start()
+/// orchestrator.waitUntilReady(["factoryDictionary"], timeout: 0.5)
+/// print(orchestrator.dump())
+/// ```
+nonisolated public final class StartupOrchestrator: Sendable {
+  // MARK: Lifecycle
+
+  public init(label: String = "org.atelierInmu.vChewing.StartupOrchestrator") {
+    self.backgroundQueue = DispatchQueue(label: label, qos: .utility, attributes: .concurrent)
+  }
+
+  // MARK: Public
+
+  public typealias Completion = @Sendable () -> ()
+
+  /// 元件的執行位置。
+  public enum Executor: String, Sendable {
+    case main
+    case background
+  }
+
+  /// 元件的載入狀態。
+  public enum Phase: Sendable, Equatable {
+    case pending
+    case running
+    case ready
+  }
+
+  /// 單一元件的載入報告。
+  public struct Report: Sendable, Equatable {
+    public let name: String
+    public let executor: Executor
+    public let isCritical: Bool
+    /// 自 `start()` 起算、開始執行的時間點（奈秒）。
+    public let startOffset: UInt64
+    /// 自開始執行至完成的耗時（奈秒），含非同步完成的等待時間。
+    public let duration: UInt64
+    /// 執行前後的常駐記憶體差值（位元組）。多個元件並行時會彼此干擾，僅供參考。
+    public let residentMemoryDelta: Int64
+  }
+
+  /// 所有元件是否皆已就緒。
+  public var isAllReady: Bool {
+    mtxState.withLockRead(\.isAllReady)
+  }
+
+  /// 關鍵路徑上的元件是否皆已就緒。
+  public var isCriticalPathReady: Bool {
+    mtxState.withLockRead { $0.isCriticalPathReady }
+  }
+
+  /// 已完成的元件的載入報告（依完成順序排列）。
+  public var reports: [Report] {
+    mtxState.withLockRead(\.reports)
+  }
+
+  /// 自 `start()` 至所有元件就緒的總耗時（奈秒）；尚未全數就緒時為 nil。
+  public var totalDuration: UInt64? {
+    mtxState.withLockRead { state in
+      guard state.startTime != nil, state.isAllReady else { return nil }
+      return state.reports.map { $0.startOffset + $0.duration }.max() ?? 0
+    }
+  }
+
+  /// 取得當前行程的常駐記憶體用量（位元組）。無法取得時回傳 0。
+  public static func residentMemoryBytes() -> Int64 {
+    #if canImport(Darwin)
+      var info = task_vm_info_data_t()
+      var size = mach_msg_type_number_t(
+        MemoryLayout<task_vm_info_data_t>.size / MemoryLayout<integer_t>.size
+      )
+      let kr = withUnsafeMutablePointer(to: &info) {
+        $0.withMemoryRebound(to: integer_t.self, capacity: Int(size)) {
+          task_info(mach_task_self_, task_flavor_t(TASK_VM_INFO), $0, &size)
+        }
+      }
+      return kr == KERN_SUCCESS ? Int64(info.phys_footprint) : 0
+    #elseif os(Linux)
+      // statm 第二欄為常駐頁數。
+      guard let statm = try? String(contentsOfFile: "/proc/self/statm", encoding: .utf8) else { return 0 }
+      let fields = statm.split(separator: " ")
+      guard fields.count > 1, let pages = Int64(fields[1]) else { return 0 }
+      return pages * Int64(sysconf(Int32(_SC_PAGESIZE)))
+    #else
+      return 0
+    #endif
+  }
+
+  /// 登記在背景佇列執行的同步元件。
+  public func addStage(
+    _ name: String,
+    dependsOn dependencies: [String] = [],
+    critical: Bool = false,
+    body: @escaping @Sendable () -> ()
+  ) {
+    register(name, dependencies: dependencies, critical: critical, body: .background { done in
+      body()
+      done()
+    })
+  }
+
+  /// 登記在背景佇列啟動、並自行回報完成的非同步元件。
+  public func addStage(
+    _ name: String,
+    dependsOn dependencies: [String] = [],
+    critical: Bool = false,
+    asyncBody: @escaping @Sendable (_ done: @escaping Completion) -> ()
+  ) {
+    register(name, dependencies: dependencies, critical: critical, body: .background(asyncBody))
+  }
+
+  /// 登記在主執行緒執行的同步元件。
+  public func addMainStage(
+    _ name: String,
+    dependsOn dependencies: [String] = [],
+    critical: Bool = false,
+    body: @escaping @MainActor @Sendable () -> ()
+  ) {
+    register(name, dependencies: dependencies, critical: critical, body: .main { done in
+      body()
+      done()
+    })
+  }
+
+  /// 登記在主執行緒啟動、並自行回報完成的非同步元件。
+  public func addMainStage(
+    _ name: String,
+    dependsOn dependencies: [String] = [],
+    critical: Bool = false,
+    asyncBody: @escaping @MainActor @Sendable (_ done: @escaping Completion) -> ()
+  ) {
+    register(name, dependencies: dependencies, critical: critical, body: .main(asyncBody))
+  }
+
+  /// 開始排程。重複呼叫不會有任何作用。
+  public func start() {
+    let (didStart, idleWaiters): (Bool, [@Sendable () -> ()]) = mtxState.withLock { state in
+      guard state.startTime == nil else { return (false, []) }
+      state.startTime = DispatchTime.now().uptimeNanoseconds
+      // 沒有登記任何元件時，視同立即全數就緒。
+      guard state.order.isEmpty else { return (true, []) }
+      defer { state.allReadyWaiters.removeAll() }
+      return (true, state.allReadyWaiters)
+    }
+    guard didStart else { return }
+    idleWaiters.forEach { $0() }
+    scheduleRunnableStages()
+  }
+
+  /// 查詢指定元件的載入狀態。未登記的元件視為已就緒（沒有東西需要等）。
+  public func phase(of name: String) -> Phase {
+    mtxState.withLockRead { $0.stages[name] == nil ? .ready : $0.phases[name] ?? .pending }
+  }
+
+  /// 指定元件是否已就緒。未登記的元件視為已就緒。
+  public func isReady(_ name: String) -> Bool {
+    phase(of: name) == .ready
+  }
+
+  /// 在指定元件就緒時執行給定的閉包（若已就緒則立即於當前執行緒執行）。
+  public func whenReady(_ name: String, execute work: @escaping @Sendable () -> ()) {
+    let runNow: Bool = mtxState.withLock { state in
+      guard state.stages[name] != nil, state.phases[name] != .ready else { return true }
+      state.waiters[name, default: []].append(work)
+      return false
+    }
+    if runNow { work() }
+  }
+
+  /// 在所有元件皆就緒時執行給定的閉包（若已全數就緒則立即於當前執行緒執行）。
+  public func whenAllReady(execute work: @escaping @Sendable () -> ()) {
+    let runNow: Bool = mtxState.withLock { state in
+      guard state.startTime == nil || !state.isAllReady else { return true }
+      state.allReadyWaiters.append(work)
+      return false
+    }
+    if runNow { work() }
+  }
+
+  /// 阻塞等待指定元件就緒。
+  ///
+  /// 在主執行緒上等待時，預設會持續運轉 RunLoop，使主執行緒元件得以繼續執行、不致死結。
+  /// 若呼叫端不希望在等待期間處理其他事件（比如正在處理按鍵事件），可將 `spinsMainRunLoop` 設為 false，
+  /// 此時只適合等待不需要主執行緒即可完成的元件。
+  /// - Parameters:
+  ///   - names: 要等待的元件；給 nil 則等待所有元件。
+  ///   - timeout: 逾時秒數。
+  ///   - spinsMainRunLoop: 在主執行緒上等待時是否運轉 RunLoop。
+  /// - Returns: 是否在逾時前全數就緒。
+  @discardableResult
+  public func waitUntilReady(
+    _ names: [String]? = nil,
+    timeout: TimeInterval,
+    spinsMainRunLoop: Bool = true
+  )
+    -> Bool {
+    let deadline = Date(timeIntervalSinceNow: timeout)
+    let isSatisfied: () -> Bool = { [self] in
+      mtxState.withLockRead { state in
+        (names ?? state.order).allSatisfy { state.stages[$0] == nil || state.phases[$0] == .ready }
+      }
+    }
+    if Thread.isMainThread, spinsMainRunLoop {
+      while !isSatisfied() {
+        guard Date() < deadline else { return false }
+        RunLoop.current.run(mode: .default, before: min(deadline, Date(timeIntervalSinceNow: 0.005)))
+      }
+      return true
+    }
+    condition.lock()
+    defer { condition.unlock() }
+    while !isSatisfied() {
+      guard condition.wait(until: deadline) else { return isSatisfied() }
+    }
+    return true
+  }
+
+  /// 阻塞等待關鍵路徑就緒。
+  @discardableResult
+  public func waitForCriticalPath(timeout: TimeInterval, spinsMainRunLoop: Bool = true) -> Bool {
+    let criticalNames = mtxState.withLockRead { state in
+      state.order.filter { state.stages[$0]?.isCritical == true }
+    }
+    return waitUntilReady(criticalNames, timeout: timeout, spinsMainRunLoop: spinsMainRunLoop)
+  }
+
+  /// 輸出純文字報表，供除錯選單、日誌或命令列工具使用。
+  public func dump() -> String {
+    let (reports, pendingNames) = mtxState.withLockRead { state in
+      (state.reports, state.order.filter { state.phases[$0] != .ready })
+    }
+    var lines: [String] = ["# Stages (start ms / duration ms / resident delta KiB / executor / critical)"]
+    reports.sorted { $0.startOffset < $1.startOffset }.forEach { report in
+      let startMS = Double(report.startOffset) / 1_000_000
+      let durationMS = Double(report.duration) / 1_000_000
+      let deltaKiB = Double(report.residentMemoryDelta) / 1_024
+      lines.append(
+        "\(report.name)\t\(startMS.rounded(toPlaces: 3))\t\(durationMS.rounded(toPlaces: 3))"
+          + "\t\(deltaKiB.rounded(toPlaces: 1))\t\(report.executor.rawValue)\t\(report.isCritical)"
+      )
+    }
+    if !pendingNames.isEmpty {
+      lines.append("# Pending")
+      lines.append(contentsOf: pendingNames)
+    }
+    return lines.joined(separator: "\n")
+  }
+
+  // MARK: Private
+
+  private enum Body: Sendable {
+    case background(@Sendable (_ done: @escaping Completion) -> ())
+    case main(@MainActor @Sendable (_ done: @escaping Completion) -> ())
+
+    // MARK: Internal
+
+    var executor: Executor {
+      switch self {
+      case .background: return .background
+      case .main: return .main
+      }
+    }
+  }
+
+  private struct Stage: Sendable {
+    let name: String
+    let dependencies: [String]
+    let isCritical: Bool
+    let body: Body
+  }
+
+  private struct State: Sendable {
+    var stages: [String: Stage] = [:]
+    /// 登記順序，亦即一種合法的拓撲排序。
+    var order: [String] = []
+    var phases: [String: Phase] = [:]
+    var reports: [Report] = []
+    var waiters: [String: [@Sendable () -> ()]] = [:]
+    var allReadyWaiters: [@Sendable () -> ()] = []
+    var startTime: UInt64?
+
+    var isAllReady: Bool {
+      order.allSatisfy { phases[$0] == .ready }
+    }
+
+    var isCriticalPathReady: Bool {
+      order.allSatisfy { stages[$0]?.isCritical != true || phases[$0] == .ready }
+    }
+  }
+
+  private let mtxState = NSMutex(State())
+  /// 僅用來喚醒在非主執行緒上阻塞等待的呼叫端。
+  private let condition = NSCondition()
+  private let backgroundQueue: DispatchQueue
+
+  private func register(_ name: String, dependencies: [String], critical: Bool, body: Body) {
+    mtxState.withLock { state in
+      precondition(state.startTime == nil, "StartupOrchestrator: stages must be added before start().")
+      precondition(state.stages[name] == nil, "StartupOrchestrator: duplicated stage \(name).")
+      dependencies.forEach { dependency in
+        guard let registered = state.stages[dependency] else {
+          preconditionFailure("StartupOrchestrator: \(name) depends on unregistered stage \(dependency).")
+        }
+        precondition(
+          !critical || registered.isCritical,
+          "StartupOrchestrator: critical stage \(name) cannot depend on non-critical stage \(dependency)."
+        )
+      }
+      state.stages[name] = Stage(name: name, dependencies: dependencies, isCritical: critical, body: body)
+      state.order.append(name)
+      state.phases[name] = .pending
+    }
+  }
+
+  private func scheduleRunnableStages() {
+    let runnable: [Stage] = mtxState.withLock { state in
+      guard state.startTime != nil else { return [] }
+      let criticalPathReady = state.isCriticalPathReady
+      var result = [Stage]()
+      for name in state.order where state.phases[name] == .pending {
+        guard let stage = state.stages[name] else { continue }
+        guard stage.dependencies.allSatisfy({ state.phases[$0] == .ready }) else { continue }
+        if stage.body.executor == .main, !stage.isCritical, !criticalPathReady { continue }
+        state.phases[name] = .running
+        result.append(stage)
+      }
+      // 關鍵元件優先派發。
+      return result.filter(\.isCritical) + result.filter { !$0.isCritical }
+    }
+    runnable.forEach(dispatch)
+  }
+
+  private func dispatch(_ stage: Stage) {
+    switch stage.body {
+    case let .background(body):
+      backgroundQueue.async(qos: stage.isCritical ? .userInitiated : .utility) { [self] in
+        body(makeCompletion(for: stage))
+      }
+    case let .main(body):
+      DispatchQueue.main.async { [self] in
+        let done = makeCompletion(for: stage)
+        MainActor.assumeIsolated { body(done) }
+      }
+    }
+  }
+
+  /// 記下開始時間與記憶體用量，並回傳只會生效一次的完成回呼。
+  private func makeCompletion(for stage: Stage) -> Completion {
+    let startTime = DispatchTime.now().uptimeNanoseconds
+    let memoryBefore = Self.residentMemoryBytes()
+    let fired = NSMutex(false)
+    return { [self] in
+      let isFirstCall = fired.withLock { flag in
+        defer { flag = true }
+        return !flag
+      }
+      guard isFirstCall else { return }
+      finish(stage, startTime: startTime, memoryBefore: memoryBefore)
+    }
+  }
+
+  private func finish(_ stage: Stage, startTime: UInt64, memoryBefore: Int64) {
+    let endTime = DispatchTime.now().uptimeNanoseconds
+    let memoryDelta = Self.residentMemoryBytes() - memoryBefore
+    condition.lock()
+    let waiters: [@Sendable () -> ()] = mtxState.withLock { state in
+      state.phases[stage.name] = .ready
+      state.reports.append(.init(
+        name: stage.name,
+        executor: stage.body.executor,
+        isCritical: stage.isCritical,
+        startOffset: startTime &- (state.startTime ?? startTime),
+        duration: endTime &- startTime,
+        residentMemoryDelta: memoryDelta
+      ))
+      var result = state.waiters.removeValue(forKey: stage.name) ?? []
+      if state.isAllReady {
+        result.append(contentsOf: state.allReadyWaiters)
+        state.allReadyWaiters.removeAll()
+      }
+      return result
+    }
+    condition.broadcast()
+    condition.unlock()
+    waiters.forEach { $0() }
+    scheduleRunnableStages()
+  }
+}
@@ -0,0 +1,134 @@
+// (c) 2022 and onwards The vChewing Project (LGPL v3.0 License or later).
+// ====================
+// This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
+
+import Foundation
+
+// MARK: - Tekkon.KeystrokeTable
+
+extension Tekkon {
+  /// 注音排列的擊鍵狀態轉移表。
+  ///
+  /// 注拼槽在注音模式下只有聲、介、韻、調四格，整體狀態可以編成一個狀態碼（見 `Composer.phonabetStateCode`）。
+  /// 對同一種注音排列（以及同一組糾錯與聲介韻調順序選項）而言，某狀態下敲某個鍵之後的結果是固定的，
+  /// 所以可以把「狀態 × 按鍵」攤平成一張表：每格記錄轉移後的狀態碼、以及該次擊鍵是否被接受。
+  ///
+  /// 一次展開整張表得對數千個狀態逐鍵跑一遍注音排列的解析邏輯，耗時可達秒級。
+  /// 故此處採惰性編譯：每格在首次被查詢時才以既有的解析邏輯算出並記下，之後再遇到同一格就只是查表。
+  final class KeystrokeTable: @unchecked Sendable {
+    // MARK: Lifecycle
+
+    private init(keyMap: [Unicode.Scalar: Unicode.Scalar]) {
+      let keys = keyMap.keys.sorted()
+      self.columns = .init(uniqueKeysWithValues: keys.enumerated().map { ($1, $0) })
+      self.cells = .init(repeating: 0, count: Composer.phonabetStateCount * keys.count)
+    }
+
+    // MARK: Internal
+
+    /// 單次擊鍵的轉移結果。
+    struct Transition: Equatable {
+      /// 轉移後的狀態碼。
+      let stateCode: Int
+      /// 該次擊鍵是否被注拼槽接受（僅在啟用 `enforceCSVTOrdering` 時可能為 false）。
+      let isAccepted: Bool
+    }
+
+    /// 查詢給定注拼槽設定在給定狀態下敲下給定按鍵之後的轉移結果。
+    ///
+    /// 該注音排列不認得的按鍵一律視為「狀態不變、擊鍵被接受」，與解析邏輯的行為一致。
+    /// - Returns: 轉移結果。拼音排列、或轉移後的狀態無法編碼時回傳 nil，此時應改用解析邏輯處理。
+    static func transition(
+      from stateCode: Int,
+      key: Unicode.Scalar,
+      for composer: Composer
+    )
+      -> Transition? {
+      let parser = composer.parser
+      guard let keyMap = parser.keystrokeMap else { return nil }
+      let correction = composer.phonabetCombinationCorrectionEnabled
+      let enforceCSVTOrdering = composer.enforceCSVTOrdering
+      let tableKey = parser.rawValue << 2 | (correction ? 1 : 0) | (enforceCSVTOrdering ? 2 : 0)
+
+      sharedTablesLock.lock()
+      let table: KeystrokeTable
+      if let cached = sharedTables[tableKey] {
+        table = cached
+      } else {
+        table = KeystrokeTable(keyMap: keyMap)
+        sharedTables[tableKey] = table
+      }
+      guard let column = table.columns[key] else {
+        sharedTablesLock.unlock()
+        return .init(stateCode: stateCode, isAccepted: true)
+      }
+      let cellIndex = stateCode * table.columns.count + column
+      let cell = table.cells[cellIndex]
+      sharedTablesLock.unlock()
+      if cell != 0 {
+        let decoded = Int(cell) - 1
+        return .init(stateCode: decoded >> 1, isAccepted: decoded & 1 == 1)
+      }
+
+      // 該格尚未編譯：以解析邏輯算出結果之後記下。
+      var probe = Composer(arrange: parser, correction: correction)
+      probe.enforceCSVTOrdering = enforceCSVTOrdering
+      probe.restorePhonabetState(stateCode)
+      let isAccepted = probe.receiveKeyByParsing(key)
+      guard let nextStateCode = probe.phonabetStateCode else { return nil }
+      sharedTablesLock.lock()
+      table.cells[cellIndex] = UInt16((nextStateCode << 1 | (isAccepted ? 1 : 0)) + 1)
+      sharedTablesLock.unlock()
+      return .init(stateCode: nextStateCode, isAccepted: isAccepted)
+    }
+
+    // MARK: Private
+
+    private static let sharedTablesLock = NSLock()
+    nonisolated(unsafe) private static var sharedTables: [Int: KeystrokeTable] = [:]
+
+    /// 按鍵 → 表格欄位序號。
+    private let columns: [Unicode.Scalar: Int]
+    /// 以「狀態碼 × 欄位數 + 欄位序號」為索引的轉移表。
+    /// 每格存放「(轉移後的狀態碼 << 1 | 是否接受) + 1」，0 表示該格尚未編譯。
+    private var cells: [UInt16]
+  }
+}
+
+// MARK: - Tekkon.Composer + Phonabet State Code
+
+extension Tekkon.Composer {
+  /// 狀態碼的總數：聲（21+1）× 介（3+1）× 韻（13+1）× 調（5+1）。
+  static let phonabetStateCount = 22 * 4 * 14 * 6
+
+  /// 將聲介韻調四格編成單一狀態碼，供擊鍵狀態轉移表使用。任一格的內容不屬於該格的種類時回傳 nil。
+  var phonabetStateCode: Int? {
+    guard let consonantCode = Self.slotCode(of: consonant, in: Tekkon.allowedConsonants),
+          let semivowelCode = Self.slotCode(of: semivowel, in: Tekkon.allowedSemivowels),
+          let vowelCode = Self.slotCode(of: vowel, in: Tekkon.allowedVowels),
+          let intonationCode = Self.slotCode(of: intonation, in: Tekkon.allowedIntonations)
+    else { return nil }
+    return ((consonantCode * 4 + semivowelCode) * 14 + vowelCode) * 6 + intonationCode
+  }
+
+  /// 依照給定的狀態碼重設聲介韻調四格。
+  mutating func restorePhonabetState(_ stateCode: Int) {
+    let intonationCode = stateCode % 6
+    let vowelCode = stateCode / 6 % 14
+    let semivowelCode = stateCode / (6 * 14) % 4
+    let consonantCode = stateCode / (6 * 14 * 4)
+    consonant = Self.phonabet(ofSlotCode: consonantCode, in: Tekkon.allowedConsonants)
+    semivowel = Self.phonabet(ofSlotCode: semivowelCode, in: Tekkon.allowedSemivowels)
+    vowel = Self.phonabet(ofSlotCode: vowelCode, in: Tekkon.allowedVowels)
+    intonation = Self.phonabet(ofSlotCode: intonationCode, in: Tekkon.allowedIntonations)
+  }
+
+  private static func slotCode(of phonabet: Tekkon.Phonabet, in pool: [Unicode.Scalar]) -> Int? {
+    guard phonabet.isValid else { return 0 }
+    return pool.firstIndex(of: phonabet.scalarValue).map { $0 + 1 }
+  }
+
+  private static func phonabet(ofSlotCode code: Int, in pool: [Unicode.Scalar]) -> Tekkon.Phonabet {
+    code == 0 ? .init() : .init(pool[code - 1])
+  }
+}
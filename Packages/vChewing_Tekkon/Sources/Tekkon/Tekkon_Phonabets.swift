@@ -104,6 +104,24 @@ extension Tekkon {
 
     // MARK: Internal
 
+    /// 注音排列的按鍵對照表；動態注音排列給出的是其靜態部分。拼音排列回傳 nil。
+    var keystrokeMap: [Unicode.Scalar: Unicode.Scalar]? {
+      switch self {
+      case .ofDachen: Tekkon.mapQwertyDachen
+      case .ofDachen26: Tekkon.mapDachenCP26StaticKeys
+      case .ofETen: Tekkon.mapQwertyETenTraditional
+      case .ofHsu: Tekkon.mapHsuStaticKeys
+      case .ofETen26: Tekkon.mapETen26StaticKeys
+      case .ofIBM: Tekkon.mapQwertyIBM
+      case .ofMiTAC: Tekkon.mapQwertyMiTAC
+      case .ofSeigyou: Tekkon.mapSeigyou
+      case .ofFakeSeigyou: Tekkon.mapFakeSeigyou
+      case .ofStarlight: Tekkon.mapStarlightStaticKeys
+      case .ofAlvinLiu: Tekkon.mapAlvinLiuStaticKeys
+      default: nil
+      }
+    }
+
     var nameTag: String {
       switch self {
       case .ofDachen:
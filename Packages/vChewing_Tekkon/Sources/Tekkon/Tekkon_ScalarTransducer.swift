@@ -0,0 +1,96 @@
+// (c) 2022 and onwards The vChewing Project (LGPL v3.0 License or later).
+// ====================
+// This code is released under the SPDX-License-Identifier: `LGPL-3.0-or-later`.
+
+// MARK: - Tekkon.ScalarTransducer
+
+extension Tekkon {
+  /// 以 Unicode scalar 為單位的字首樹轉寫器，供注音與拼音之間的互轉使用。
+  ///
+  /// 所有「來源 → 轉寫結果」的對照都在建表時收進同一棵字首樹。轉換時由左至右只掃描一遍，
+  /// 在每個位置取最長的相符條目；沒有條目相符的字元則原樣輸出。查表過程不會建立任何中間字串。
+  struct ScalarTransducer: Sendable {
+    // MARK: Lifecycle
+
+    /// - Parameter pairs: 來源與轉寫結果的配對。同一來源重複出現時，以先出現者為準。
+    init(_ pairs: some Sequence<(String, String)>) {
+      for (source, output) in pairs {
+        insert(source, output: output)
+      }
+    }
+
+    // MARK: Internal
+
+    /// 轉換給定的字串。
+    /// - Parameters:
+    ///   - target: 要轉換的字串。
+    ///   - fallback: 在沒有任何條目相符時，用來決定該字元的替代輸出；回傳 nil 則原樣輸出該字元。
+    /// - Returns: 轉換結果。
+    func convert(
+      _ target: String,
+      fallback: (Unicode.Scalar) -> String? = { _ in nil }
+    )
+      -> String {
+      let scalars = target.unicodeScalars
+      var result = ""
+      result.reserveCapacity(target.utf8.count * 2)
+      var currentIndex = scalars.startIndex
+      let endIndex = scalars.endIndex
+      while currentIndex < endIndex {
+        var node = 0
+        var probeIndex = currentIndex
+        var matchedOutput: String?
+        var matchedEnd = currentIndex
+        while probeIndex < endIndex, let nextNode = edges[Self.edgeKey(node, scalars[probeIndex])] {
+          node = nextNode
+          probeIndex = scalars.index(after: probeIndex)
+          if let output = outputs[node] {
+            matchedOutput = output
+            matchedEnd = probeIndex
+          }
+        }
+        if let matchedOutput {
+          result.append(matchedOutput)
+          currentIndex = matchedEnd
+          continue
+        }
+        let scalar = scalars[currentIndex]
+        if let substitution = fallback(scalar) {
+          result.append(substitution)
+        } else {
+          result.unicodeScalars.append(scalar)
+        }
+        currentIndex = scalars.index(after: currentIndex)
+      }
+      return result
+    }
+
+    // MARK: Private
+
+    /// 邊的辭典：鍵為「父節點序號（高 32 位元）＋ scalar 值（低 32 位元）」，值為子節點序號。
+    private var edges: [UInt64: Int] = [:]
+    /// 各節點的轉寫結果，以節點序號為索引；第 0 號是根節點。
+    private var outputs: [String?] = [nil]
+
+    private static func edgeKey(_ node: Int, _ scalar: Unicode.Scalar) -> UInt64 {
+      UInt64(node) << 32 | UInt64(scalar.value)
+    }
+
+    private mutating func insert(_ source: String, output: String) {
+      guard !source.isEmpty else { return }
+      var node = 0
+      for scalar in source.unicodeScalars {
+        let key = Self.edgeKey(node, scalar)
+        if let nextNode = edges[key] {
+          node = nextNode
+        } else {
+          outputs.append(nil)
+          edges[key] = outputs.count - 1
+          node = outputs.count - 1
+        }
+      }
+      guard outputs[node] == nil else { return }
+      outputs[node] = output
+    }
+  }
+}
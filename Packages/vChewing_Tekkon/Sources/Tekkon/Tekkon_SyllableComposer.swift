@@ -234,7 +234,17 @@ extension Tekkon {
     public mutating func receiveKey(fromScalar input: Unicode.Scalar?) -> Bool {
       guard let input else { return false }
       guard isPinyinMode else {
-        return receiveKey(fromPhonabet: translate(key: input))
+        // 注音排列的擊鍵結果只取決於聲介韻調四格的狀態，故優先查擊鍵狀態轉移表。
+        guard let stateCode = phonabetStateCode,
+              let transition = KeystrokeTable.transition(from: stateCode, key: input, for: self)
+        else {
+          return receiveKeyByParsing(input)
+        }
+        if transition.stateCode != stateCode {
+          restorePhonabetState(transition.stateCode)
+          updateRomajiBuffer()
+        }
+        return transition.isAccepted
       }
       if let theTone = mapArayuruPinyinIntonation[input] {
         intonation = Phonabet(theTone)
@@ -527,6 +537,14 @@ extension Tekkon {
       }
     }
 
+    /// 不經擊鍵狀態轉移表、直接以注音排列的解析邏輯處理按鍵。擊鍵狀態轉移表的每一格也是藉此算出的。
+    /// - Parameter key: 傳入的按鍵。
+    /// - Returns: 該次擊鍵是否被接受。
+    @discardableResult
+    internal mutating func receiveKeyByParsing(_ key: Unicode.Scalar) -> Bool {
+      receiveKey(fromPhonabet: translate(key: key))
+    }
+
     /// 所有動態注音排列都會用到的共用糾錯處理步驟。
     /// - Parameter incomingPhonabet: 傳入的注音 Phonabet。
     internal mutating func commonFixWhenHandlingDynamicArrangeInputs(
@@ -5,64 +5,37 @@
 extension Tekkon {
   // MARK: - Phonabet to Hanyu-Pinyin Conversion Processing
 
-  // MARK: - Pre-built lookup for O(N) single-pass conversion.
-
-  /// 從 `arrPhonaToHanyuPinyin` 預建的字串→拼音對照表。
-  /// 因為原陣列已按長度降冪排列（多字元在前），建表後 longest-match-first 的語意由查表順序保證。
-  private static let _phonaToPinyinLUT: [String: String] = {
-    var lut: [String: String] = [:]
-    for (phona, pinyin) in arrPhonaToHanyuPinyin {
-      lut[phona] = pinyin
-    }
-    return lut
-  }()
+  // MARK: - Pre-built transducers for single-pass conversion.
+
+  /// 從 `arrPhonaToHanyuPinyin` 預建的注音→拼音轉寫器。
+  private static let _phonaToPinyinTransducer = ScalarTransducer(arrPhonaToHanyuPinyin)
 
-  /// 已知最長的注音符號組合的字元長度（以 Unicode scalar 計）。
-  private static let _maxPhonaPatternLength: Int = {
-    arrPhonaToHanyuPinyin.map(\.0.unicodeScalars.count).max() ?? 3
+  /// 從 `arrHanyuPinyinTextbookStyleConversionTable` 預建的數字標調→教科書格式轉寫器。
+  private static let _pinyinToTextbookStyleTransducer = ScalarTransducer(arrHanyuPinyinTextbookStyleConversionTable)
+
+  /// 從 `mapHanyuPinyin` 與聲調對照預建的拼音→注音轉寫器。
+  /// 陰平的「1」不收進表內，因為其轉寫結果由呼叫方透過 `newToneOne` 指定。
+  private static let _pinyinToPhonaTransducer: ScalarTransducer = {
+    let syllables = mapHanyuPinyin.map { ($0.key, $0.value) }
+    let intonations: [(String, String)] = mapArayuruPinyinIntonation.compactMap { key, value in
+      guard key != "1", key != value else { return nil }
+      return (String(key), String(value))
+    }
+    return ScalarTransducer(syllables + intonations)
   }()
 
   /// 注音轉拼音，要求陰平必須是空格。
   /// - Parameters:
   ///   - targetJoined: 傳入的 String 對象物件。
   public static func cnvPhonaToHanyuPinyin(targetJoined: String) -> String {
-    let scalars = targetJoined.unicodeScalars
-    var result = ""
-    result.reserveCapacity(targetJoined.count * 2) // pinyin output typically longer than zhuyin
-    var i = scalars.startIndex
-    let endIndex = scalars.endIndex
-    let maxLen = _maxPhonaPatternLength
-    while i < endIndex {
-      var matched = false
-      let remaining = scalars.distance(from: i, to: endIndex)
-      // Greedy longest-match first: try from max possible length down to 1.
-      for len in stride(from: min(maxLen, remaining), through: 1, by: -1) {
-        guard let targetIdx = scalars.index(i, offsetBy: len, limitedBy: endIndex) else { continue }
-        let key = String(scalars[i ..< targetIdx])
-        if let replacement = _phonaToPinyinLUT[key] {
-          result.append(replacement)
-          i = targetIdx
-          matched = true
-          break
-        }
-      }
-      if !matched {
-        result.append(String(scalars[i]))
-        i = scalars.index(after: i)
-      }
-    }
-    return result
+    _phonaToPinyinTransducer.convert(targetJoined)
   }
 
   /// 漢語拼音數字標調式轉漢語拼音教科書格式，要求陰平必須是數字 1。
   /// - Parameters:
   ///   - target: 傳入的 String 對象物件。
   public static func cnvHanyuPinyinToTextbookStyle(targetJoined: String) -> String {
-    var targetConverted = targetJoined
-    for pair in arrHanyuPinyinTextbookStyleConversionTable {
-      targetConverted = targetConverted.swapping(pair.0, with: pair.1)
-    }
-    return targetConverted
+    _pinyinToTextbookStyleTransducer.convert(targetJoined)
   }
 
   /// 該函式負責將注音轉為教科書印刷的方式（先寫輕聲）。
@@ -104,16 +77,7 @@ extension Tekkon {
     -> String {
     /// 如果當前內容含有底線或包含任何不在允許列表中的字元（英數、空白、Tab、連字號），則放棄轉換。
     if targetJoined.contains("_") || targetJoined.isNotAllowedCharOfPinyinChain { return targetJoined }
-    var result = targetJoined
-    for key in Tekkon.mapHanyuPinyin.keys.sorted(by: { $0.count > $1.count }) {
-      guard let value = Tekkon.mapHanyuPinyin[key] else { continue }
-      result = result.swapping(key, with: value)
-    }
-    for key in Tekkon.mapArayuruPinyinIntonation.keys {
-      guard let value = Tekkon.mapArayuruPinyinIntonation[key] else { continue }
-      result = result.swapping(String(key), with: (key == "1") ? newToneOne : String(value))
-    }
-    return result
+    return _pinyinToPhonaTransducer.convert(targetJoined) { $0 == "1" ? newToneOne : nil }
   }
 }
 
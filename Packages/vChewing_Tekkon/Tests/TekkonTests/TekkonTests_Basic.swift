@@ -369,4 +369,53 @@ struct TekkonTestsBasic {
       #expect(deductedZhuyin == expected)
     }
   }
+
+  @Test("[Tekkon] KeystrokeTable_MatchesParsingUpTo5Keystrokes")
+  func testKeystrokeTableAgainstParsing() async throws {
+    // 擊鍵的結果只取決於聲介韻調的狀態，故以廣度優先逐層展開「可在 5 鍵以內抵達的狀態」：
+    // 每個狀態只需展開一次，即可涵蓋所有長度不超過 5 的按鍵序列。
+    let maxSequenceLength = 5
+    for parser in Tekkon.MandarinParser.allDynamicZhuyinCases {
+      guard let keyMap = parser.keystrokeMap else { continue }
+      let keys = keyMap.keys.sorted() + ["幹"]
+      // 糾錯與聲介韻調順序限制這兩個選項各自對應不同的轉移表，故四種組合都得驗證。
+      let optionCombinations = [false, true].flatMap { correction in
+        [false, true].map { (correction: correction, enforceCSVTOrdering: $0) }
+      }
+      for (correction, enforceCSVTOrdering) in optionCombinations {
+        var initialComposer = Tekkon.Composer(arrange: parser, correction: correction)
+        initialComposer.enforceCSVTOrdering = enforceCSVTOrdering
+        guard let initialStateCode = initialComposer.phonabetStateCode else {
+          Issue.record("Failed to encode the initial state of \(parser.nameTag).")
+          continue
+        }
+        var visitedStateCodes: Set<Int> = [initialStateCode]
+        var frontier = [initialComposer]
+        var mismatches = [String]()
+        for _ in 0 ..< maxSequenceLength {
+          var nextFrontier = [Tekkon.Composer]()
+          for composer in frontier {
+            for key in keys {
+              var viaTable = composer
+              var viaParsing = composer
+              let acceptedViaTable = viaTable.receiveKey(fromScalar: key)
+              let acceptedViaParsing = viaParsing.receiveKeyByParsing(key)
+              if acceptedViaTable != acceptedViaParsing || viaTable.value != viaParsing.value {
+                mismatches.append("\(composer.value) + \(key): \(viaTable.value) vs \(viaParsing.value)")
+              }
+              guard let stateCode = viaParsing.phonabetStateCode else { continue }
+              if visitedStateCodes.insert(stateCode).inserted {
+                nextFrontier.append(viaParsing)
+              }
+            }
+          }
+          frontier = nextFrontier
+        }
+        #expect(
+          mismatches.isEmpty,
+          "\(parser.nameTag) (correction: \(correction), CSVT: \(enforceCSVTOrdering)): \(mismatches.prefix(10))"
+        )
+      }
+    }
+  }
 }
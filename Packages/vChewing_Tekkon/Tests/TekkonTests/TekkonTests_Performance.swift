@@ -51,6 +51,52 @@ struct TekkonPerformanceTests {
     }
   }
 
+  /// 效能基準測試 - 擊鍵狀態轉移表與解析邏輯的比較
+  @Test("[Tekkon] KeystrokeTablePerformance")
+  func testKeystrokeTablePerformance() async throws {
+    let testSequences = ["e", "r", "d", "y", "qu", "quu", "quur", "q", "qj", "qjo", "l", "lr", "jp3", "ji3", "fu;4"]
+    let iterations = 200
+
+    for parser in Tekkon.MandarinParser.allDynamicZhuyinCases {
+      // 先讓轉移表編譯好這些序列會走到的格子。
+      var composer = Tekkon.Composer(arrange: parser)
+      for sequence in testSequences {
+        composer.clear()
+        sequence.unicodeScalars.forEach { composer.receiveKey(fromScalar: $0) }
+      }
+
+      let tableStartTime = Date.now
+      for _ in 0 ..< iterations {
+        for sequence in testSequences {
+          composer.clear()
+          sequence.unicodeScalars.forEach { composer.receiveKey(fromScalar: $0) }
+        }
+      }
+      let tableTime = Date.now.timeIntervalSince1970 - tableStartTime.timeIntervalSince1970
+
+      let parsingStartTime = Date.now
+      for _ in 0 ..< iterations {
+        for sequence in testSequences {
+          composer.clear()
+          sequence.unicodeScalars.forEach { composer.receiveKeyByParsing($0) }
+        }
+      }
+      let parsingTime = Date.now.timeIntervalSince1970 - parsingStartTime.timeIntervalSince1970
+
+      let tableTimeStr = String(format: "%.4f", tableTime)
+      let parsingTimeStr = String(format: "%.4f", parsingTime)
+      print(
+        " -> [Tekkon][(\(parser.nameTag))] keystroke table: \(tableTimeStr)s vs parsing: \(parsingTimeStr)s"
+      )
+
+      // 效能期望：查表不應比逐鍵解析慢（保留 1.5 倍的量測誤差空間）。
+      #expect(
+        tableTime <= parsingTime * 1.5,
+        "Keystroke table regression: \(parser.nameTag) took \(tableTimeStr)s vs parsing \(parsingTimeStr)s"
+      )
+    }
+  }
+
   /// 記憶體效能測試 - 測試物件重用效能
   @Test("[Tekkon] MemoryOptimizationTest")
   func testMemoryOptimization() async throws {
@@ -120,6 +166,35 @@ struct TekkonPerformanceTests {
     #expect(processingTime < 0.1, "String processing performance regression")
   }
 
+  /// 拼音與注音互轉的吞吐量測試
+  @Test("[Tekkon] PinyinPhonaConversionThroughput")
+  func testPinyinPhonaConversionThroughput() async throws {
+    let sentence = "jiu4-shi4-yan2-zhe5-qian2-ren2-wei4-jin4-de5-dao4-lu4-zhuang4-xiong1-chuang2-lve4"
+    let iterations = 2_000
+
+    let startTime = Date.now
+    for _ in 0 ..< iterations {
+      let phona = Tekkon.cnvHanyuPinyinToPhona(targetJoined: sentence, newToneOne: " ")
+      let pinyin = Tekkon.cnvPhonaToHanyuPinyin(targetJoined: phona)
+      _ = Tekkon.cnvHanyuPinyinToTextbookStyle(targetJoined: pinyin)
+    }
+    let timeDelta = Date.now.timeIntervalSince1970 - startTime.timeIntervalSince1970
+
+    let syllableCount = sentence.split(separator: "-").count * iterations
+    let syllablesPerSecond = Double(syllableCount) / Swift.max(timeDelta, .ulpOfOne)
+    let timeDeltaStr = String(format: "%.4f", timeDelta)
+    let throughputStr = String(format: "%.0f", syllablesPerSecond)
+    print(
+      " -> [Tekkon] Pinyin-phona round trips (\(syllableCount) syllables): \(timeDeltaStr)s (\(throughputStr) syllables/s)"
+    )
+
+    // 效能期望：每個音節的完整往返（拼音→注音→拼音→教科書格式）應在 20µs 以內完成。
+    #expect(
+      timeDelta / Double(syllableCount) < 0.000_02,
+      "Pinyin-phona conversion throughput regression: \(throughputStr) syllables/s"
+    )
+  }
+
   /// 整體測試套件效能摘要
   @Test("[Tekkon] PerformanceSummary")
   func testPerformanceSummary() async throws {
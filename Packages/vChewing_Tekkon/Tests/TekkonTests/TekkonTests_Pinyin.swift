@@ -318,4 +318,67 @@ struct TekkonTestsPinyin {
     toneMarkerIndicator = composer.hasIntonation(withNothingElse: true)
     #expect(toneMarkerIndicator)
   }
+
+  @Test("[Tekkon] Utils_PinyinPhonaRoundTrip_AllSyllables")
+  func testPinyinPhonaRoundTripOverAllSyllables() async throws {
+    let toneMarks: [Character: String] = ["1": " ", "2": "ˊ", "3": "ˇ", "4": "ˋ", "5": "˙"]
+    var mismatches = [String]()
+    var numberedSyllables = [String]()
+    for (pinyin, phona) in Tekkon.mapHanyuPinyin.sorted(by: { $0.key < $1.key }) {
+      for tone in "12345" {
+        let numbered = "\(pinyin)\(tone)"
+        numberedSyllables.append(numbered)
+        let converted = Tekkon.cnvHanyuPinyinToPhona(targetJoined: numbered, newToneOne: " ")
+        // 與舊版的逐條目整串替換的結果逐一比對。
+        let legacyConverted = Self.legacyHanyuPinyinToPhona(numbered, newToneOne: " ")
+        let textbookStyle = Tekkon.cnvHanyuPinyinToTextbookStyle(targetJoined: numbered)
+        let legacyTextbookStyle = Self.legacyHanyuPinyinToTextbookStyle(numbered)
+        let restored = Tekkon.cnvPhonaToHanyuPinyin(targetJoined: converted)
+        guard converted == phona + (toneMarks[tone] ?? ""),
+              converted == legacyConverted,
+              textbookStyle == legacyTextbookStyle,
+              restored == numbered
+        else {
+          mismatches.append("\(numbered) -> \(converted) -> \(restored) / \(textbookStyle)")
+          continue
+        }
+      }
+    }
+    #expect(mismatches.isEmpty, "\(mismatches.prefix(10))")
+
+    // 串接多個音節時，結果應等同於逐個音節轉換之後再串接。
+    let sentence = numberedSyllables.prefix(64).joined(separator: "-")
+    let sentencePhona = Tekkon.cnvHanyuPinyinToPhona(targetJoined: sentence)
+    let expectedPhona = numberedSyllables.prefix(64).map {
+      Tekkon.cnvHanyuPinyinToPhona(targetJoined: $0)
+    }.joined(separator: "-")
+    #expect(sentencePhona == expectedPhona)
+    #expect(sentencePhona == Self.legacyHanyuPinyinToPhona(sentence, newToneOne: ""))
+    // 含有不允許的字元時，應原樣返回。
+    #expect(Tekkon.cnvHanyuPinyinToPhona(targetJoined: "bian4_le5") == "bian4_le5")
+  }
+
+  // MARK: Private
+
+  /// 舊版的漢語拼音轉注音實作：依長度降冪，逐個條目對整串字串做替換。僅用來比對結果。
+  private static func legacyHanyuPinyinToPhona(_ target: String, newToneOne: String) -> String {
+    var result = target
+    for key in Tekkon.mapHanyuPinyin.keys.sorted(by: { $0.count > $1.count }) {
+      guard let value = Tekkon.mapHanyuPinyin[key] else { continue }
+      result = result.swapping(key, with: value)
+    }
+    for (key, value) in Tekkon.mapArayuruPinyinIntonation {
+      result = result.swapping(String(key), with: (key == "1") ? newToneOne : String(value))
+    }
+    return result
+  }
+
+  /// 舊版的教科書格式轉換實作：依對照表順序逐條替換。僅用來比對結果。
+  private static func legacyHanyuPinyinToTextbookStyle(_ target: String) -> String {
+    var result = target
+    for pair in Tekkon.arrHanyuPinyinTextbookStyleConversionTable {
+      result = result.swapping(pair.0, with: pair.1)
+    }
+    return result
+  }
 }
@@ -11,12 +11,17 @@ let package = Package(
       name: "Typewriter",
       targets: ["Typewriter"]
     ),
+    .executable(
+      name: "vChewingColdStartProfiler",
+      targets: ["vChewingColdStartProfiler"]
+    ),
   ],
   dependencies: [
     .package(path: "../ButKo_BPMFVS"),
     .package(path: "../vChewing_BrailleSputnik"),
     .package(path: "../vChewing_LangModelAssembly"),
     .package(path: "../vChewing_Homa"),
+    .package(path: "../vChewing_Hotenka"),
     .package(path: "../vChewing_Shared"),
     .package(path: "../vChewing_SwiftExtension"),
     .package(path: "../vChewing_Tekkon"),
@@ -42,6 +47,20 @@ let package = Package(
         .linkedLibrary("iconv", .when(platforms: [.macOS])),
       ]
     ),
+    .executableTarget(
+      name: "vChewingColdStartProfiler",
+      dependencies: [
+        "Typewriter",
+        .product(name: "Hotenka", package: "vChewing_Hotenka"),
+        .product(name: "LMAssemblyMaterials4Tests", package: "vChewing_LangModelAssembly"),
+      ],
+      swiftSettings: [
+        .defaultIsolation(MainActor.self), // set Default Actor Isolation
+      ],
+      linkerSettings: [
+        .linkedLibrary("iconv", .when(platforms: [.macOS])),
+      ]
+    ),
     .testTarget(
       name: "TypewriterTests",
       dependencies: [
@@ -0,0 +1,147 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+
+// MARK: - ColdStartPlan
+
+/// 輸入法冷啟動時的元件載入計畫。
+///
+/// 首次按鍵真正需要的只有原廠辭典（以及啟用磁帶模式時的磁帶資料）；
+/// 其餘元件皆不在關鍵路徑上：使用者辭典會在關鍵路徑就緒後載入；
+/// BPMFVS 異體字表、拼音 Trie、繁簡轉換辭典則在背景佇列上並行載入，不佔用主執行緒。
+///
+/// 與平台有關的載入動作（比如原廠辭典的檔案路徑、使用者辭典目錄）由呼叫端以 `Loaders` 注入，
+/// 故 macOS 主程式與 Linux 上的命令列工具可共用同一份計畫。
+public enum ColdStartPlan {
+  /// 冷啟動元件。
+  public enum Stage: String, CaseIterable, Sendable {
+    case factoryDictionary
+    case cassette
+    case userLangModels
+    case bpmfvs
+    case pinyinTrie
+    case chineseConverter
+  }
+
+  /// 由呼叫端注入的載入動作。`asyncBody` 類的閉包須在載入真正完成時呼叫 `done`。
+  public struct Loaders {
+    // MARK: Lifecycle
+
+    public init(
+      factoryDictionary: @escaping @Sendable (_ done: @escaping StartupOrchestrator.Completion) -> (),
+      cassette: (@MainActor @Sendable (_ done: @escaping StartupOrchestrator.Completion) -> ())? = nil,
+      isCassetteCritical: Bool = false,
+      userLangModels: @escaping @MainActor @Sendable (_ done: @escaping StartupOrchestrator.Completion) -> (),
+      chineseConverter: (@Sendable () -> ())? = nil,
+      parser: Tekkon.MandarinParser? = nil
+    ) {
+      self.factoryDictionary = factoryDictionary
+      self.cassette = cassette
+      self.isCassetteCritical = isCassetteCritical
+      self.userLangModels = userLangModels
+      self.chineseConverter = chineseConverter
+      self.parser = parser
+    }
+
+    // MARK: Public
+
+    /// 載入原廠辭典。會在背景佇列上執行，好讓首次按鍵時在主執行緒上等待它的呼叫端不致死結。
+    public var factoryDictionary: @Sendable (_ done: @escaping StartupOrchestrator.Completion) -> ()
+    public var cassette: (@MainActor @Sendable (_ done: @escaping StartupOrchestrator.Completion) -> ())?
+    /// 磁帶模式啟用時，磁帶資料也屬於首次按鍵所需。
+    public var isCassetteCritical: Bool
+    public var userLangModels: @MainActor @Sendable (_ done: @escaping StartupOrchestrator.Completion) -> ()
+    /// 預熱繁簡轉換辭典。會在背景佇列上執行；給 nil 則不預熱（比如未啟用任何繁簡轉換功能時）。
+    public var chineseConverter: (@Sendable () -> ())?
+    /// 目前的注音排列。僅在拼音排列時才需要預熱拼音 Trie。
+    public var parser: Tekkon.MandarinParser?
+  }
+
+  /// 依照給定的載入動作建立（尚未啟動的）編排器。呼叫端可再追加自己的元件，然後呼叫 `start()`。
+  public static func makeOrchestrator(loaders: Loaders) -> StartupOrchestrator {
+    let orchestrator = StartupOrchestrator(label: "org.atelierInmu.vChewing.ColdStart")
+    orchestrator.addStage(.factoryDictionary, critical: true, asyncBody: loaders.factoryDictionary)
+    if let cassette = loaders.cassette {
+      orchestrator.addMainStage(.cassette, critical: loaders.isCassetteCritical, asyncBody: cassette)
+    }
+    // 使用者辭典的檔案讀取本來就在 LMAssembly.fileHandleQueue 上進行，
+    // 排在原廠辭典之後可避免兩者爭搶磁碟讀取而拖慢關鍵路徑。
+    orchestrator.addMainStage(.userLangModels, dependsOn: [.factoryDictionary], asyncBody: loaders.userLangModels)
+    orchestrator.addStage(.bpmfvs) {
+      BPMFVS.prewarm()
+    }
+    if let parser = loaders.parser, parser.isPinyin {
+      orchestrator.addStage(.pinyinTrie) {
+        _ = Tekkon.PinyinTrie.shared(parser: parser)
+      }
+    }
+    if let chineseConverter = loaders.chineseConverter {
+      orchestrator.addStage(.chineseConverter, body: chineseConverter)
+    }
+    return orchestrator
+  }
+}
+
+// MARK: - StartupOrchestrator + ColdStartPlan.Stage
+
+extension StartupOrchestrator {
+  public func addStage(
+    _ stage: ColdStartPlan.Stage,
+    dependsOn dependencies: [ColdStartPlan.Stage] = [],
+    critical: Bool = false,
+    body: @escaping @Sendable () -> ()
+  ) {
+    addStage(stage.rawValue, dependsOn: dependencies.map(\.rawValue), critical: critical, body: body)
+  }
+
+  public func addStage(
+    _ stage: ColdStartPlan.Stage,
+    dependsOn dependencies: [ColdStartPlan.Stage] = [],
+    critical: Bool = false,
+    asyncBody: @escaping @Sendable (_ done: @escaping Completion) -> ()
+  ) {
+    addStage(stage.rawValue, dependsOn: dependencies.map(\.rawValue), critical: critical, asyncBody: asyncBody)
+  }
+
+  public func addMainStage(
+    _ stage: ColdStartPlan.Stage,
+    dependsOn dependencies: [ColdStartPlan.Stage] = [],
+    critical: Bool = false,
+    body: @escaping @MainActor @Sendable () -> ()
+  ) {
+    addMainStage(stage.rawValue, dependsOn: dependencies.map(\.rawValue), critical: critical, body: body)
+  }
+
+  public func addMainStage(
+    _ stage: ColdStartPlan.Stage,
+    dependsOn dependencies: [ColdStartPlan.Stage] = [],
+    critical: Bool = false,
+    asyncBody: @escaping @MainActor @Sendable (_ done: @escaping Completion) -> ()
+  ) {
+    addMainStage(stage.rawValue, dependsOn: dependencies.map(\.rawValue), critical: critical, asyncBody: asyncBody)
+  }
+
+  public func phase(of stage: ColdStartPlan.Stage) -> Phase {
+    phase(of: stage.rawValue)
+  }
+
+  public func isReady(_ stage: ColdStartPlan.Stage) -> Bool {
+    isReady(stage.rawValue)
+  }
+
+  @discardableResult
+  public func waitUntilReady(
+    _ stages: [ColdStartPlan.Stage],
+    timeout: TimeInterval,
+    spinsMainRunLoop: Bool = true
+  )
+    -> Bool {
+    waitUntilReady(stages.map(\.rawValue), timeout: timeout, spinsMainRunLoop: spinsMainRunLoop)
+  }
+}
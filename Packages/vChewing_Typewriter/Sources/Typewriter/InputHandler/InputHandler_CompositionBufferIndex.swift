@@ -0,0 +1,234 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+/// 該檔案乃輸入調度模組的用以承載「組字區索引」的部分。
+
+import Foundation
+
+// MARK: - CompositionBufferIndex
+
+/// 組字區索引：依組字器的組句結果（`assembledSentence`）預先算好的各節點文字片段、
+/// 讀音累計偏移量、以及字位累計偏移量。
+///
+/// 每次按鍵都要生成「正在輸入」狀態，而組句結果在相鄰兩次按鍵之間通常只有游標附近的幾個節點會變。
+/// 故此處以 `assemblyGeneration` 作為快取依據：組句結果未變時直接沿用；有變時則沿用開頭與結尾
+/// 內容相同的節點，僅重建中間有變動的節點（含 BPMFVS 投影與換行修剪）。
+/// 游標換算與讀音插入位置的定位皆藉由二分搜尋完成。
+public struct CompositionBufferIndex {
+  // MARK: Lifecycle
+
+  /// 根據給定的組句結果建立索引。
+  /// - Parameters:
+  ///   - sentence: 組句結果。
+  ///   - generation: 該組句結果的世代戳記。
+  ///   - reflectBPMFVS: 顯示用的文字片段是否要套用 BPMFVS 投影。
+  ///   - previous: 上一份索引。若有給出，則與其內容相同的開頭與結尾節點不會重建。
+  init(
+    sentence: [Homa.GramInPath],
+    generation: FIUUID,
+    reflectBPMFVS: Bool,
+    reusing previous: Self? = nil
+  ) {
+    self.generation = generation
+    self.reflectsBPMFVS = reflectBPMFVS
+    guard let previous, previous.reflectsBPMFVS == reflectBPMFVS else {
+      let rawSegments = sentence.map(\.value)
+      let trimmedRawSegments = rawSegments.map(Self.trimmingNewlines)
+      let rawLayout = CompositionBufferLayout(segments: rawSegments)
+      self.nodes = sentence
+      self.rawSegments = rawSegments
+      self.trimmedRawSegments = trimmedRawSegments
+      self.rawLayout = rawLayout
+      if reflectBPMFVS {
+        let displaySegments = sentence.map(Self.projectedValue)
+        self.displaySegments = displaySegments
+        self.trimmedDisplaySegments = displaySegments.map(Self.trimmingNewlines)
+        self.displayLayout = .init(segments: displaySegments)
+      } else {
+        self.displaySegments = rawSegments
+        self.trimmedDisplaySegments = trimmedRawSegments
+        self.displayLayout = rawLayout
+      }
+      self.readingOffsets = Self.readingOffsets(of: sentence)
+      return
+    }
+    self = previous
+    self.generation = generation
+    applyChanges(toMatch: sentence)
+  }
+
+  // MARK: Public
+
+  /// 該索引所對應的組句世代戳記。
+  public private(set) var generation: FIUUID
+  /// 顯示用的文字片段是否有套用 BPMFVS 投影。
+  public let reflectsBPMFVS: Bool
+
+  /// 各節點的顯示用文字片段（若 `reflectsBPMFVS` 則已套用 BPMFVS 投影）。
+  public private(set) var displaySegments: [String]
+  /// 各節點的原始文字片段（即各節點的值）。
+  public private(set) var rawSegments: [String]
+  /// 修剪過換行的 `displaySegments`。
+  public private(set) var trimmedDisplaySegments: [String]
+  /// 修剪過換行的 `rawSegments`。
+  public private(set) var trimmedRawSegments: [String]
+
+  /// 將組字器內的游標位置換算成組字區內的字位游標。
+  /// - Remark: 讀音數與字長不一致的節點只要被游標切入，就會被視為整段已被游標越過。
+  /// - Parameter rawCursor: 組字器內的游標位置。
+  /// - Returns: 用以顯示的游標。
+  public func displayCursor(forRawCursor rawCursor: Int) -> Int {
+    let nodeCount = nodes.count
+    guard rawCursor > 0, nodeCount > 0 else { return 0 }
+    guard rawCursor < readingOffsets[nodeCount] else { return rawLayout.graphemeCount }
+    // 找出最小的 i 使得 readingOffsets[i + 1] > rawCursor。
+    var lowerBound = 0
+    var upperBound = nodeCount - 1
+    while lowerBound < upperBound {
+      let middle = (lowerBound + upperBound) / 2
+      if readingOffsets[middle + 1] > rawCursor {
+        upperBound = middle
+      } else {
+        lowerBound = middle + 1
+      }
+    }
+    let base = rawLayout.graphemeOffsets[lowerBound]
+    let stepsIntoNode = rawCursor - readingOffsets[lowerBound]
+    guard stepsIntoNode > 0 else { return base }
+    let valueLength = rawLayout.graphemeCounts[lowerBound]
+    let isReadingMismatched = valueLength != readingOffsets[lowerBound + 1] - readingOffsets[lowerBound]
+    return base + (isReadingMismatched ? valueLength : min(stepsIntoNode, valueLength))
+  }
+
+  /// 在給定的字位游標處插入讀音，回傳修剪過換行的文字片段。
+  ///
+  /// 游標所在的片段會被拆成「前半、讀音、後半」三個片段（前半可能為空字串）；
+  /// 游標位於組字區末端時，讀音會被追加為最後一個片段。
+  /// - Parameters:
+  ///   - reading: 讀音。
+  ///   - cursor: 字位游標（以未修剪的片段計）。
+  ///   - projected: 是否針對顯示用（可能有套用 BPMFVS 投影）的文字片段處理。
+  /// - Returns: 處理後的文字片段、以及讀音所在的片段索引。
+  public func segmentsInsertingReading(
+    _ reading: String,
+    at cursor: Int,
+    projected: Bool
+  )
+    -> (segments: [String], readingAt: Int) {
+    let segments = projected ? displaySegments : rawSegments
+    let layout = projected ? displayLayout : rawLayout
+    var result = projected ? trimmedDisplaySegments : trimmedRawSegments
+    guard let index = layout.segmentIndex(containingGrapheme: cursor) else {
+      result.append(Self.trimmingNewlines(reading))
+      return (result, result.count - 1)
+    }
+    let segment = segments[index]
+    let splitPoint = segment.index(segment.startIndex, offsetBy: cursor - layout.graphemeOffsets[index])
+    result.replaceSubrange(index ... index, with: [
+      Self.trimmingNewlines(String(segment[..<splitPoint])),
+      Self.trimmingNewlines(reading),
+      Self.trimmingNewlines(String(segment[splitPoint...])),
+    ])
+    return (result, index + 1)
+  }
+
+  // MARK: Private
+
+  private var nodes: [Homa.GramInPath]
+  private var displayLayout: CompositionBufferLayout
+  private var rawLayout: CompositionBufferLayout
+  /// 各節點起點的累計讀音數（長度為節點數量 + 1）。
+  private var readingOffsets: [Int]
+
+  private static func projectedValue(_ node: Homa.GramInPath) -> String {
+    guard !node.isReadingMismatched else { return node.value }
+    return BPMFVS.convert(value: node.value, readings: node.keyArray)
+  }
+
+  private static func trimmingNewlines(_ segment: String) -> String {
+    guard segment.rangeOfCharacter(from: .newlines) != nil else { return segment }
+    return segment.trimmingCharacters(in: .newlines)
+  }
+
+  private static func readingOffsets(of sentence: [Homa.GramInPath]) -> [Int] {
+    var result = [Int]()
+    result.reserveCapacity(sentence.count + 1)
+    var sum = 0
+    result.append(0)
+    sentence.forEach {
+      sum += $0.keyArray.count
+      result.append(sum)
+    }
+    return result
+  }
+
+  /// 沿用開頭與結尾內容相同的節點，僅重建中間有變動的節點。
+  private mutating func applyChanges(toMatch sentence: [Homa.GramInPath]) {
+    let sharedBound = min(nodes.count, sentence.count)
+    var prefixLength = 0
+    while prefixLength < sharedBound, nodes[prefixLength] == sentence[prefixLength] {
+      prefixLength += 1
+    }
+    var suffixLength = 0
+    while suffixLength < sharedBound - prefixLength,
+          nodes[nodes.count - 1 - suffixLength] == sentence[sentence.count - 1 - suffixLength] {
+      suffixLength += 1
+    }
+    let oldRange = prefixLength ..< (nodes.count - suffixLength)
+    let changedNodes = sentence[prefixLength ..< (sentence.count - suffixLength)]
+    guard !oldRange.isEmpty || !changedNodes.isEmpty else { return }
+
+    let newRawSegments = changedNodes.map(\.value)
+    rawSegments.replaceSubrange(oldRange, with: newRawSegments)
+    trimmedRawSegments.replaceSubrange(oldRange, with: newRawSegments.map(Self.trimmingNewlines))
+    rawLayout = rawLayout.replacingSegments(oldRange, with: newRawSegments, resultingSegments: rawSegments)
+    if reflectsBPMFVS {
+      let newDisplaySegments = changedNodes.map(Self.projectedValue)
+      displaySegments.replaceSubrange(oldRange, with: newDisplaySegments)
+      trimmedDisplaySegments.replaceSubrange(oldRange, with: newDisplaySegments.map(Self.trimmingNewlines))
+      displayLayout = displayLayout.replacingSegments(
+        oldRange, with: newDisplaySegments, resultingSegments: displaySegments
+      )
+    } else {
+      displaySegments = rawSegments
+      trimmedDisplaySegments = trimmedRawSegments
+      displayLayout = rawLayout
+    }
+    nodes = sentence
+    readingOffsets = Self.readingOffsets(of: sentence)
+  }
+}
+
+// MARK: - InputHandlerProtocol Extension
+
+extension InputHandlerProtocol {
+  /// 取得與當前組句結果對應的組字區索引。組句結果有變時，會沿用上一份索引、僅重建有變動的節點。
+  /// - Parameter reflectBPMFVS: 顯示用的文字片段是否要套用 BPMFVS 投影。
+  func compositionBufferIndex(reflectBPMFVS: Bool) -> CompositionBufferIndex {
+    let generation = assembler.assemblyGeneration
+    if let cached = compositionBufferIndexCache,
+       cached.generation == generation,
+       cached.reflectsBPMFVS == reflectBPMFVS {
+      return cached
+    }
+    let result = CompositionBufferIndex(
+      sentence: assembler.assembledSentence,
+      generation: generation,
+      reflectBPMFVS: reflectBPMFVS,
+      reusing: compositionBufferIndexCache
+    )
+    compositionBufferIndexCache = result
+    return result
+  }
+
+  /// 取得與當前組句結果對應的組字區索引，僅用來存取與 BPMFVS 投影無關的內容（原始文字片段、游標換算）。
+  /// 此時會沿用快取當中的 BPMFVS 投影設定，以免來回切換投影設定而導致索引被整個重建。
+  func compositionBufferIndexForRawContent() -> CompositionBufferIndex {
+    compositionBufferIndex(reflectBPMFVS: compositionBufferIndexCache?.reflectsBPMFVS ?? false)
+  }
+}
@@ -46,6 +46,12 @@ public protocol InputHandlerProtocol: AnyObject {
   /// 用來記錄「叫出選字窗前」的游標位置的變數。
   var backupCursor: Int? { get set }
 
+  /// 組字區索引的快取，由 `compositionBufferIndex()` 負責維護。
+  var compositionBufferIndexCache: CompositionBufferIndex? { get set }
+
+  /// 中英混輸緩衝區索引的快取，由 `withMixedAlphanumericalBufferIndex()` 負責維護。
+  var mixedAlphanumericalBufferIndexCache: MixedAlphanumericalBufferIndex? { get set }
+
   /// 當前的打字模式。
   var currentTypingMethod: TypingMethod { get set }
 
@@ -109,19 +115,21 @@ private struct KeyDropContext {
     guard inputHandler.assembler.keys.count > 1 else { return nil }
     guard !inputHandler.assembler.isCursorAtAssemblerEdge(direction: direction) else { return nil }
     let currentAssembly = inputHandler.assembler.assembledSentence
+    let borderMap = inputHandler.assembler.assembledSentenceBorderMap
     let cursorAfterTask = switch direction {
     case .front: inputHandler.assembler.cursor + 1
     case .rear: inputHandler.assembler.cursor - 1
     }
     guard currentAssembly.isCursorCuttingRegion(
-      cursor: cursorAfterTask
+      cursor: cursorAfterTask,
+      using: borderMap
     ) else { return nil }
-    let affectedRegionID = currentAssembly.cursorRegionMap[cursorAfterTask]
+    let affectedRegionID = borderMap.regionIndex(ofCursor: cursorAfterTask)
     guard let affectedRegionID else { return nil }
     let affectedRegion = currentAssembly[affectedRegionID]
     guard affectedRegion.isExplicit else { return nil }
     guard !affectedRegion.isReadingMismatched else { return nil }
-    let nodeRange = currentAssembly.contextRange(ofGivenCursor: cursorAfterTask)
+    let nodeRange = currentAssembly.contextRange(ofGivenCursor: cursorAfterTask, using: borderMap)
     let nodeStart = nodeRange.lowerBound
     let nodeLength = nodeRange.count
     guard nodeLength > 0 else { return nil }
@@ -202,7 +210,6 @@ extension InputHandlerProtocol {
   public func clear() {
     clearComposerAndCalligrapher()
     assembler.clear()
-    currentLM.purgeInputTokenHashMap()
     currentTypingMethod = .vChewingFactory
     backupCursor = nil
   }
@@ -602,6 +609,11 @@ extension InputHandlerProtocol {
 
   /// 獲取候選字詞（包含讀音）陣列資料內容。
   func generateArrayOfCandidates(fixOrder: Bool = true) -> [CandidateInState] {
+    generateCandidatePairs(fixOrder: fixOrder).map { ($0.keyArray, $0.value) }
+  }
+
+  /// 獲取候選字詞配對，每筆皆帶有組字器候選原本的來源標記（Provenance）。
+  func generateCandidatePairs(fixOrder: Bool = true) -> [Homa.CandidatePair] {
     /// 警告：不要對游標前置風格使用 nodesCrossing，否則會導致游標行為與 macOS 內建注音輸入法不一致。
     /// 微軟新注音輸入法的游標後置風格也是不允許 nodeCrossing 的。
     let rawCandidates = fetchRawQueriedCandidatesFromAssembler()
@@ -667,7 +679,15 @@ extension InputHandlerProtocol {
       }
     }
 
-    return arrCandidates.map { ($0.keyArray, $0.value) }
+    // POM 建議與倚天排序會另行生成不帶來源標記的配對，故按讀音與詞值自組字器的原始候選取回。
+    // 配對的相等比較與雜湊皆不含來源標記。
+    let provenanceMap = Dictionary(
+      rawCandidates.map { ($0.pair, $0.pair.provenance) },
+      uniquingKeysWith: { $0.union($1) }
+    )
+    return arrCandidates.map {
+      .init(keyArray: $0.keyArray, value: $0.value, provenance: provenanceMap[$0] ?? $0.provenance)
+    }
   }
 
   /// 移除重複候選字詞（以讀音 + 詞值做鍵），維持原順序。
@@ -752,7 +772,8 @@ extension InputHandlerProtocol {
       let suggestedUnigram = Homa.Gram(
         keyArray: candidate.keyArray,
         value: candidate.value,
-        score: candidate.probability
+        score: candidate.probability,
+        provenance: .perceived
       )
       let signature = makeCanonicalPair(keyArray: candidate.keyArray, value: suggestedUnigram.current)
       if let rawScore = rawLookup[signature], suggestedUnigram.probability < rawScore {
@@ -774,9 +795,9 @@ extension InputHandlerProtocol {
     if prefs.useSCPCTypingMode { return arrResult }
     /// 如果這個開關沒打開的話，直接放棄執行這個函式。
     if !prefs.fetchSuggestionsFromPerceptionOverrideModel { return arrResult }
-    /// 獲取來自漸退記憶模組的建議結果
+    /// 獲取來自漸退記憶模組的建議結果（同一組句結果與游標位置的重複詢問會命中快取）。
     let suggestion = currentLM.fetchPOMSuggestion(
-      assembledResult: assembler.assembledSentence,
+      assembler: assembler,
       cursor: actualNodeCursorPosition,
       timestamp: Date().timeIntervalSince1970
     )
@@ -792,7 +813,10 @@ extension InputHandlerProtocol {
           : .withTopGramScore
         let cursorForOverride = suggestion.overrideCursor ?? actualNodeCursorPosition
         var effectiveCursorForOverride = cursorForOverride
-        if let gramHit = assembler.assembledSentence.findGram(at: cursorForOverride) {
+        if let gramHit = assembler.assembledSentence.findGram(
+          at: cursorForOverride,
+          using: assembler.assembledSentenceBorderMap
+        ) {
           if gramHit.gram.keyArray.count > newestSuggestedCandidate.keyArray.count {
             // 當現有節點比 POM 建議長時（例：多段詞「多期」vs 單段詞「奇」），
             // 先將多段詞拆分為獨立單段詞，後續 literal override 才能正確匹配。
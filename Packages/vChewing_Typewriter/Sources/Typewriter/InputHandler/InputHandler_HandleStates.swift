@@ -25,6 +25,8 @@ extension InputHandlerProtocol {
     guarded: Bool = false
   )
     -> State {
+    let probe = PerfProbe.begin("Typewriter.generateStateOfInputting")
+    defer { PerfProbe.end(probe) }
     if isConsideredEmptyForNow, !guarded { return State.ofAbortion() }
     restoreBackupCursor() // 只要叫了 Inputting 狀態，就盡可能還原游標備份。
     var segHighlightedAt: Int?
@@ -32,64 +34,33 @@ extension InputHandlerProtocol {
     let handleAsRomanNumeralInput = currentTypingMethod == .romanNumerals && !sansReading
     /// 「更新內文組字區 (Update the composing buffer)」是指要求客體軟體將組字緩衝區的內容
     /// 換成由此處重新生成的原始資料在 IMEStateData 當中生成的 NSAttributeString。
-    var displayTextSegments: [String] = handleAsCodePointInput || handleAsRomanNumeralInput
-      ? [strCodePointBuffer]
-      : compositionBufferDisplayTextSegments(reflectBPMFVS: !sansReading)
+    /// 組字區索引會沿用上一次按鍵時的結果、僅重建有變動的節點，故此處無須逐字重組文字片段。
+    let bufferIndex: CompositionBufferIndex? = handleAsCodePointInput || handleAsRomanNumeralInput
+      ? nil
+      : compositionBufferIndex(reflectBPMFVS: !sansReading && isReflectingBPMFVSInCompositionBuffer)
+    var displayTextSegments: [String] = bufferIndex?.trimmedDisplaySegments
+      ?? [strCodePointBuffer.trimmingCharacters(in: .newlines)]
     // 原始（未經 BPMFVS 投影）的文字片段。僅在 BPMFVS 投影啟用時才需要額外追蹤。
-    var rawSegments: [String]? = (!handleAsCodePointInput && !handleAsRomanNumeralInput && !sansReading)
-      ? rawDisplayTextSegmentsIfNeeded
+    var rawSegments: [String]? = (bufferIndex?.reflectsBPMFVS ?? false)
+      ? bufferIndex?.trimmedRawSegments
       : nil
-    var cursor = handleAsCodePointInput || handleAsRomanNumeralInput
-      ? displayTextSegments.joined().count
-      : convertCursorForDisplay(assembler.cursor)
+    var cursor = bufferIndex?.displayCursor(forRawCursor: assembler.cursor) ?? strCodePointBuffer.count
     let cursorSansReading = cursor
     // 先提出來讀音資料，減輕運算負擔。
     let noReading = sansReading || [.codePoint, .romanNumerals].contains(currentTypingMethod)
     let reading: String = noReading ? "" : readingForDisplay
-    if !reading.isEmpty {
-      var newDisplayTextSegments = [String]()
-      var temporaryNode = ""
-      var charCounter = 0
-      for node in displayTextSegments {
-        for char in node {
-          if charCounter == cursor {
-            newDisplayTextSegments.append(temporaryNode)
-            temporaryNode = ""
-            // 處理在組字區中間或者最後方插入游標的情形。
-            segHighlightedAt = newDisplayTextSegments.count
-            newDisplayTextSegments.append(reading)
-          }
-          temporaryNode += String(char)
-          charCounter += 1
-        }
-        newDisplayTextSegments.append(temporaryNode)
-        temporaryNode = ""
-      }
-      if newDisplayTextSegments == displayTextSegments {
-        // 處理在組字區最前方插入游標的情形。
-        segHighlightedAt = newDisplayTextSegments.count
-        newDisplayTextSegments.append(reading)
-      }
-      displayTextSegments = newDisplayTextSegments
+    if !reading.isEmpty, let bufferIndex {
+      (displayTextSegments, segHighlightedAt) = bufferIndex.segmentsInsertingReading(
+        reading, at: cursor, projected: true
+      )
       cursor += reading.count
       // 同步將讀音插入到原始文字片段。
-      if let raw = rawSegments {
-        rawSegments = Self.insertReadingIntoSegments(
-          in: raw,
-          reading: reading,
-          at: cursorSansReading
-        )
+      if rawSegments != nil {
+        rawSegments = bufferIndex.segmentsInsertingReading(
+          reading, at: cursorSansReading, projected: false
+        ).segments
       }
     }
-    for i in 0 ..< displayTextSegments.count {
-      displayTextSegments[i] = displayTextSegments[i].trimmingCharacters(in: .newlines)
-    }
-    if var raw = rawSegments {
-      for i in 0 ..< raw.count {
-        raw[i] = raw[i].trimmingCharacters(in: .newlines)
-      }
-      rawSegments = raw
-    }
     /// 這裡生成準備要拿來回呼的「正在輸入」狀態。
     var result = State.ofInputting(
       displayTextSegments: displayTextSegments,
@@ -98,7 +69,7 @@ extension InputHandlerProtocol {
     result.marker = cursorSansReading
     result.data.rawDisplayTextSegments = rawSegments
     /// 特殊情形，否則方向鍵事件無法正常攔截。
-    if guarded, result.displayTextSegments.joined().isEmpty {
+    if guarded, result.displayedText.isEmpty {
       result.data.displayTextSegments = [" "]
       result.cursor = 0
       result.marker = 0
@@ -112,63 +83,29 @@ extension InputHandlerProtocol {
   }
 
   func compositionBufferDisplayTextSegments(reflectBPMFVS: Bool = true) -> [String] {
-    guard reflectBPMFVS,
-          prefs.reflectBPMFVSInCompositionBuffer,
-          prefs.specifyCmdOptCtrlEnterBehavior == 4
-    else {
-      return assembler.assembledSentence.values
-    }
-    return assembler.assembledSentence.map {
-      guard !$0.isReadingMismatched else { return $0.value }
-      return BPMFVS.convert(value: $0.value, readings: Array($0.keyArray))
-    }
+    compositionBufferIndex(
+      reflectBPMFVS: reflectBPMFVS && isReflectingBPMFVSInCompositionBuffer
+    ).displaySegments
   }
 
   /// 當 BPMFVS 投影處於啟用狀態時，回傳原始（未投影）的組字區文字片段。否則回傳 nil。
   var rawDisplayTextSegmentsIfNeeded: [String]? {
-    guard prefs.reflectBPMFVSInCompositionBuffer,
-          prefs.specifyCmdOptCtrlEnterBehavior == 4
-    else { return nil }
-    return assembler.assembledSentence.values
+    guard isReflectingBPMFVSInCompositionBuffer else { return nil }
+    return compositionBufferIndex(reflectBPMFVS: true).rawSegments
   }
 
-  /// 將讀音插入到文字片段陣列的指定游標位置。
-  static func insertReadingIntoSegments(
-    in segments: [String],
-    reading: String,
-    at cursor: Int
-  )
-    -> [String] {
-    var newSegments = [String]()
-    var temporaryNode = ""
-    var charCounter = 0
-    for node in segments {
-      for char in node {
-        if charCounter == cursor {
-          newSegments.append(temporaryNode)
-          temporaryNode = ""
-          newSegments.append(reading)
-        }
-        temporaryNode += String(char)
-        charCounter += 1
-      }
-      newSegments.append(temporaryNode)
-      temporaryNode = ""
-    }
-    if newSegments == segments {
-      newSegments.append(reading)
-    }
-    return newSegments
+  /// 組字區是否要以 BPMFVS 投影顯示。
+  var isReflectingBPMFVSInCompositionBuffer: Bool {
+    prefs.reflectBPMFVSInCompositionBuffer && prefs.specifyCmdOptCtrlEnterBehavior == 4
   }
 
   /// 組字區可以投影成 BPMFVS 顯示，但一般遞交流程只能吃原始內容。
   public func committableDisplayText(sansReading: Bool = false) -> String {
     let handleAsCodePointInput = currentTypingMethod == .codePoint && !sansReading
     let handleAsRomanNumeralInput = currentTypingMethod == .romanNumerals && !sansReading
-    var displayTextSegments: [String] = handleAsCodePointInput || handleAsRomanNumeralInput
-      ? [strCodePointBuffer]
-      : compositionBufferDisplayTextSegments(reflectBPMFVS: false)
-    displayTextSegments = displayTextSegments.map { $0.trimmingCharacters(in: .newlines) }
+    let displayTextSegments: [String] = handleAsCodePointInput || handleAsRomanNumeralInput
+      ? [strCodePointBuffer.trimmingCharacters(in: .newlines)]
+      : compositionBufferIndexForRawContent().trimmedRawSegments
     var displayedText = displayTextSegments.joined()
     let noReading = sansReading || [.codePoint, .romanNumerals].contains(currentTypingMethod)
     let reading: String = noReading ? "" : readingForDisplay
@@ -200,34 +137,9 @@ extension InputHandlerProtocol {
   /// - Parameter rawCursor: 原始游標。
   /// - Returns: 用以顯示的游標。
   func convertCursorForDisplay(_ rawCursor: Int) -> Int {
-    var composedStringCursorIndex = 0
-    var readingCursorIndex = 0
-    for theNode in assembler.assembledSentence {
-      let strNodeValue = theNode.value
-      /// 藉下述步驟重新將「可見游標位置」對齊至「組字器內的游標所在的讀音位置」。
-      /// 每個節錨（NodeAnchor）都有自身的幅節長度（segLength），可以用來
-      /// 累加、以此為依據，來校正「可見游標位置」。
-      let segLength: Int = theNode.keyArray.count
-      if readingCursorIndex + segLength <= rawCursor {
-        composedStringCursorIndex += strNodeValue.count
-        readingCursorIndex += segLength
-        continue
-      }
-      if !theNode.isReadingMismatched {
-        strNodeValue.forEach { _ in
-          if readingCursorIndex < rawCursor {
-            composedStringCursorIndex += 1
-            readingCursorIndex += 1
-          }
-        }
-        continue
-      }
-      guard readingCursorIndex < rawCursor else { continue }
-      composedStringCursorIndex += strNodeValue.count
-      readingCursorIndex += segLength
-      readingCursorIndex = min(readingCursorIndex, rawCursor)
-    }
-    return composedStringCursorIndex
+    /// 每個節點的幅節長度（segLength）與字長皆已在組字區索引內累加成偏移量表，
+    /// 故此處僅需二分搜尋游標所在的節點、再據此校正「可見游標位置」即可。
+    compositionBufferIndexForRawContent().displayCursor(forRawCursor: rawCursor)
   }
 
   // MARK: - 用以生成候選詞陣列及狀態
@@ -243,11 +155,17 @@ extension InputHandlerProtocol {
     if restoreCursorAfterSelectingCandidate, backupCursor == nil {
       backupCursor = cursorPriorToCandidateSelection
     }
+    let candidatePairs = generateCandidatePairs(fixOrder: prefs.useFixedCandidateOrderOnSelection)
     var result = State.ofCandidates(
-      candidates: generateArrayOfCandidates(fixOrder: prefs.useFixedCandidateOrderOnSelection),
+      candidates: candidatePairs.map { ($0.keyArray, $0.value) },
       displayTextSegments: compositionBufferDisplayTextSegments(),
       cursor: assembler.cursor
     )
+    result.data.macroCandidates = Set(
+      candidatePairs.lazy.filter { $0.provenance.contains(.macro) }.map {
+        CandidateSignature(keyArray: $0.keyArray, value: $0.value)
+      }
+    )
     result.data.rawDisplayTextSegments = rawDisplayTextSegmentsIfNeeded
     if !prefs.useRearCursorMode {
       let markerBackup = assembler.marker
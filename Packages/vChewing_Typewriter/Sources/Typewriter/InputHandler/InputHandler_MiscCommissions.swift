@@ -96,7 +96,9 @@ extension InputHandlerProtocol {
 
   private func specifyTextMarkupToCommit(behavior: CommitableMarkupType) -> String {
     if behavior == .bpmfvsAnnotationButKo {
-      return BPMFVS.convertToBPMFVS(smashedPairs: assembler.assembledSentence.smashedPairs)
+      return BPMFVS.convert(sentence: assembler.assembledSentence.lazy.map {
+        (value: $0.value, readings: $0.keyArray)
+      })
     }
     var composed = ""
     assembler.assembledSentence.smashedPairs.forEach { key, value in
@@ -0,0 +1,245 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+/// 該檔案乃輸入調度模組的用以承載「中英混輸緩衝區索引」的部分。
+
+import Foundation
+
+// MARK: - MixedAlphanumericalBufferIndex
+
+/// 中英混輸緩衝區索引：按前綴長度逐字累計的緩衝區特徵，以及「ASCII 前綴 + 注音後綴」自動拆分的評估記憶。
+///
+/// 中英混輸時每敲一個鍵，都得判斷整段內容（緩衝區 + 當前按鍵）能否拆出注音後綴；
+/// 而緩衝區在相鄰兩次按鍵之間通常只是在尾端多了一個字元。
+/// 故此處將開頭被阻斷的鍵位數量、英數與大寫字母的分佈、逐鍵餵入注拼槽時的破壞性覆寫次數等特徵逐字記下：
+/// 追加字元時只計算新字元；內容有其他變動時，則沿用與新內容相同的開頭部分。
+/// 如此一來，每次按鍵的評估工作量只取決於單一音節的最大碼長，不隨緩衝區變長而增加。
+public struct MixedAlphanumericalBufferIndex {
+  // MARK: Lifecycle
+
+  /// - Parameter composer: 用來判斷各鍵位性質的注拼槽。此處只沿用其設定，不沿用其內容。
+  init(composer: Tekkon.Composer) {
+    var probe = composer
+    probe.clear()
+    self.probe = probe
+    self.letterRunComposers = [probe]
+  }
+
+  // MARK: Public
+
+  /// 某個前綴（緩衝區開頭的若干字元）的累計特徵。
+  public struct PrefixTraits {
+    /// 前綴的字元數量。
+    public fileprivate(set) var length = 0
+    /// 開頭連續的被阻斷鍵位（大寫英文字母、獨立聲調鍵）的數量。
+    public fileprivate(set) var blockedLeadingLength = 0
+    /// 開頭連續的 ASCII 英文字母的數量。
+    public fileprivate(set) var leadingLetterCount = 0
+    /// ASCII 大寫英文字母的數量。
+    public fileprivate(set) var uppercaseLetterCount = 0
+    /// 是否含有 ASCII 小寫英文字母。
+    public fileprivate(set) var hasLowercaseLetter = false
+    /// 是否含有 ASCII 數字。
+    public fileprivate(set) var hasASCIIDigit = false
+    /// 是否全為 ASCII 英數字元。
+    public fileprivate(set) var isAllASCIIAlnum = true
+    /// 是否含有當前注音排列不認得的鍵位。
+    public fileprivate(set) var containsNonPhoneticKey = false
+    /// 將開頭連續的英文字母逐鍵餵入注拼槽時，未能佔用新注拼槽的次數。
+    public fileprivate(set) var destructiveOverwriteCount = 0
+
+    /// 是否含有 ASCII 英文字母。
+    public var hasASCIILetter: Bool { uppercaseLetterCount > 0 || hasLowercaseLetter }
+    /// 是否含有 ASCII 英數字元。
+    public var hasASCIIAlnum: Bool { hasASCIILetter || hasASCIIDigit }
+    /// 是否全為 ASCII 英文字母（且不為空）。
+    public var isAllLetters: Bool { length > 0 && leadingLetterCount == length }
+    /// 是否像是英文單字（開頭至少三個英文字母，其後只有英數字元）。
+    public var isWordLike: Bool { isAllASCIIAlnum && leadingLetterCount >= 3 }
+  }
+
+  /// 自動拆分時選出的候選：前綴以 ASCII 原樣遞交，後綴則以 `readingKey` 作為讀音插入組字器。
+  public struct SplitCandidate {
+    /// 注音後綴的字元數量。
+    public let suffixLength: Int
+    /// 注音後綴的讀音。
+    public let readingKey: String
+  }
+
+  /// 對某段注音後綴（與前綴無關的部分）的評估結果。
+  public struct SuffixReading {
+    /// 後綴是否以 ASCII 標點起頭。
+    public let startsWithASCIIPunctuation: Bool
+    /// 後綴所組成的讀音。無法組成合法讀音時為 nil。
+    public let readingKey: String?
+    /// 該讀音在語言模組內是否有單元圖。
+    public let hasUnigrams: Bool
+    /// 該讀音在語言模組內是否能以快速路徑查得單元圖。
+    public let hasFastUnigrams: Bool
+  }
+
+  /// 當前所追蹤的內容。
+  public private(set) var text = ""
+
+  /// 當前所追蹤的內容的字元數量。
+  public var count: Int { characters.count }
+
+  /// 給定長度的前綴的累計特徵。
+  public func traits(ofPrefix length: Int) -> PrefixTraits {
+    prefixTraits[length]
+  }
+
+  /// 當前所追蹤的內容的尾端給定數量的字元。
+  public func suffixText(length: Int) -> String {
+    String(characters[(characters.count - length)...])
+  }
+
+  /// 當前所追蹤的內容的第一個字元。
+  public var firstCharacter: Character? { characters.first }
+
+  // MARK: Internal
+
+  /// 自動拆分的選取結果的記憶，以「是否要求前綴像是英文單字」為鍵。內容有變時即清空。
+  var memorizedSplits: [Bool: SplitCandidate?] = [:]
+
+  /// 取得給定長度的後綴的評估結果；同一份內容的同一段後綴只會評估一次。
+  mutating func suffixReading(
+    length: Int,
+    evaluate: (String) -> SuffixReading
+  )
+    -> SuffixReading {
+    if let memorized = memorizedSuffixReadings[length] { return memorized }
+    let result = evaluate(suffixText(length: length))
+    memorizedSuffixReadings[length] = result
+    return result
+  }
+
+  /// 令索引與給定的內容同步：追加的字元逐一計入，其餘變動則退回共同開頭之後重新計入。
+  mutating func synchronize(to newText: String, composer: Tekkon.Composer) {
+    if !isProbeCompatible(with: composer) {
+      self = .init(composer: composer)
+    }
+    guard newText != text else { return }
+    memorizedSplits.removeAll(keepingCapacity: true)
+    memorizedSuffixReadings.removeAll(keepingCapacity: true)
+    let appendedText: Substring
+    let appendedStart = newText.utf8.index(
+      newText.startIndex, offsetBy: text.utf8.count, limitedBy: newText.endIndex
+    )
+    if let appendedStart, newText.utf8.starts(with: text.utf8),
+       !(newText.unicodeScalars[appendedStart...].first?.properties.isGraphemeExtend ?? false) {
+      // 追加的內容不會與原有的最後一個字元合併成同一個字元時，原有的字元皆可沿用。
+      appendedText = newText[appendedStart...]
+    } else {
+      var sharedLength = 0
+      var newTextIndex = newText.startIndex
+      while sharedLength < characters.count, newTextIndex < newText.endIndex,
+            newText[newTextIndex] == characters[sharedLength] {
+        sharedLength += 1
+        newTextIndex = newText.index(after: newTextIndex)
+      }
+      truncate(to: sharedLength)
+      appendedText = newText[newTextIndex...]
+    }
+    for char in appendedText {
+      append(char)
+    }
+    text = newText
+  }
+
+  // MARK: Private
+
+  /// 只用來判斷鍵位性質的空白注拼槽。
+  private let probe: Tekkon.Composer
+  private var characters: [Character] = []
+  /// 各前綴長度的累計特徵，以前綴長度為索引（第 0 筆為空前綴）。
+  private var prefixTraits: [PrefixTraits] = [.init()]
+  /// 將開頭連續的英文字母逐鍵餵入注拼槽之後的注拼槽狀態，以已餵入的字母數量為索引。
+  private var letterRunComposers: [Tekkon.Composer]
+  private var memorizedSuffixReadings: [Int: SuffixReading] = [:]
+
+  private func isProbeCompatible(with composer: Tekkon.Composer) -> Bool {
+    probe.parser == composer.parser
+      && probe.phonabetCombinationCorrectionEnabled == composer.phonabetCombinationCorrectionEnabled
+      && probe.enforceCSVTOrdering == composer.enforceCSVTOrdering
+  }
+
+  private mutating func truncate(to length: Int) {
+    characters.removeSubrange(length...)
+    prefixTraits.removeSubrange((length + 1)...)
+    let letterRunLength = prefixTraits[length].leadingLetterCount
+    letterRunComposers.removeSubrange((letterRunLength + 1)...)
+  }
+
+  private mutating func append(_ char: Character) {
+    let previous = prefixTraits[prefixTraits.count - 1]
+    var traits = previous
+    traits.length += 1
+    let scalars = char.unicodeScalars
+    let scalar: Unicode.Scalar? = scalars.count == 1 ? scalars.first : nil
+    let isUppercase = scalar.map { ("A" ... "Z").contains($0) } ?? false
+    let isLowercase = scalar.map { ("a" ... "z").contains($0) } ?? false
+    let isDigit = scalar.map { ("0" ... "9").contains($0) } ?? false
+    let charStr = char.description
+
+    if previous.blockedLeadingLength == previous.length {
+      let isToneKey: Bool = {
+        var testComposer = probe
+        testComposer.receiveKey(fromString: charStr)
+        return testComposer.hasIntonation(withNothingElse: true)
+      }()
+      if isUppercase || isToneKey { traits.blockedLeadingLength += 1 }
+    }
+    if isUppercase { traits.uppercaseLetterCount += 1 }
+    if isLowercase { traits.hasLowercaseLetter = true }
+    if isDigit { traits.hasASCIIDigit = true }
+    if !(isUppercase || isLowercase || isDigit) { traits.isAllASCIIAlnum = false }
+    if !probe.inputValidityCheck(charStr: charStr) { traits.containsNonPhoneticKey = true }
+
+    if previous.leadingLetterCount == previous.length, isUppercase || isLowercase {
+      traits.leadingLetterCount += 1
+      var composer = letterRunComposers[letterRunComposers.count - 1]
+      let beforeOccupiedSlotCount = composer.count(withIntonation: true)
+      composer.receiveKey(fromString: charStr)
+      let afterOccupiedSlotCount = composer.count(withIntonation: true)
+      if beforeOccupiedSlotCount > 0, afterOccupiedSlotCount <= beforeOccupiedSlotCount {
+        traits.destructiveOverwriteCount += 1
+      }
+      letterRunComposers.append(composer)
+    }
+
+    characters.append(char)
+    prefixTraits.append(traits)
+  }
+}
+
+// MARK: - InputHandlerProtocol Extension
+
+extension InputHandlerProtocol {
+  /// 令中英混輸緩衝區索引與給定內容同步之後，交給給定的閉包就地存取（含其評估記憶）。
+  /// - Parameters:
+  ///   - text: 要同步的內容，通常是 `mixedAlphanumericalBuffer`（或其後追加了當前按鍵的內容）。
+  ///   - body: 存取索引的閉包。
+  func withMixedAlphanumericalBufferIndex<T>(
+    synchronizedTo text: String,
+    _ body: (inout MixedAlphanumericalBufferIndex) -> T
+  )
+    -> T {
+    // 先自快取取出，以免就地修改時觸發寫時複製。
+    var index = mixedAlphanumericalBufferIndexCache ?? .init(composer: composer)
+    mixedAlphanumericalBufferIndexCache = nil
+    defer { mixedAlphanumericalBufferIndexCache = index }
+    index.synchronize(to: text, composer: composer)
+    return body(&index)
+  }
+
+  /// 給定內容（整段）的累計特徵。
+  func mixedAlphanumericalTraits(of text: String) -> MixedAlphanumericalBufferIndex.PrefixTraits {
+    withMixedAlphanumericalBufferIndex(synchronizedTo: text) { $0.traits(ofPrefix: $0.count) }
+  }
+}
@@ -14,6 +14,8 @@
 extension InputHandlerProtocol {
   public func triageInput(event input: InputSignalProtocol) -> Bool {
     guard let session = session else { return false }
+    let probe = PerfProbe.begin("Typewriter.triageInput")
+    defer { PerfProbe.end(probe) }
     var state: State { session.state }
     currentLM.syncPrefs()
 
@@ -179,7 +179,9 @@ public struct BPMFFullMatchTypewriter<Handler: InputHandlerProtocol>: Typewriter
       ) {
         return (autoChopHandled, true)
       }
+      let probe = PerfProbe.begin("Typewriter.composer.receiveKey")
       handler.composer.receiveKey(fromString: confirmCombination ? " " : inputText)
+      PerfProbe.end(probe)
       keyConsumedByReading = true
       narrateTheComposer(
         narrator: handler.narrator,
@@ -374,7 +376,10 @@ extension BPMFFullMatchTypewriter {
     if playbackComposer.hasIntonation() { playbackComposer.doBackSpace() }
     // 注意：移除聲調後的 composer 可能無法查詢，但仍可用於重建讀音。
     let surfaceText: String? = {
-      let gramHit = assembler.assembledSentence.findGram(at: cursorPrevious)
+      let gramHit = assembler.assembledSentence.findGram(
+        at: cursorPrevious,
+        using: assembler.assembledSentenceBorderMap
+      )
       guard let gramHit else { return nil }
       let offset = cursorPrevious - gramHit.range.lowerBound
       let characters = gramHit.gram.value.map(\.description)
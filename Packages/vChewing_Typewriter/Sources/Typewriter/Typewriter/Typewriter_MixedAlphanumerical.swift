@@ -57,10 +57,8 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
     }
     if input.isSpace {
       guard !handler.mixedAlphanumericalBuffer.isEmpty else { return nil }
-      let shouldPreferASCIIWordOnSpace = shouldPreferASCIIWordPath(
-        fullInput: handler.mixedAlphanumericalBuffer,
-        minimumOverwriteCount: 1
-      )
+      let bufferTraits = handler.mixedAlphanumericalTraits(of: handler.mixedAlphanumericalBuffer)
+      let shouldPreferASCIIWordOnSpace = shouldPreferASCIIWordPath(bufferTraits, minimumOverwriteCount: 1)
       // shouldPreferASCIIWordPath 會阻斷 auto-split，以防止 tod / film 等英文詞被誤拆為注音。
       // 但該啟發式也會誤傷 mixed 輸入（如 aiq / aijo6）。
       // 若前兩個字元本身即可組成佔用 >= 2 個注拼槽且詞庫有命中的讀音，
@@ -68,9 +66,8 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
       // 反之若前兩字僅佔 1 槽（如 he=ㄍ）或無詞庫命中（如 to=ㄔㄟ），
       // 則維持 ASCII 提交（保護 tod / film / hell 等）。
       let twoCharPrefixIsPhonetic: Bool = {
-        let buffer = handler.mixedAlphanumericalBuffer
-        guard buffer.count >= 3 else { return false }
-        let prefix = String(buffer.prefix(2))
+        guard bufferTraits.length >= 3 else { return false }
+        let prefix = String(handler.mixedAlphanumericalBuffer.prefix(2))
         guard prefix.range(of: "[A-Za-z]", options: .regularExpression) != nil else { return false }
         var trialComposer = handler.composer
         trialComposer.clear()
@@ -78,11 +75,7 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
         guard let readingKey = trialComposer.phonabetKeyForQuery(pronounceableOnly: true) else {
           return false
         }
-        let occupiedSlots = [
-          trialComposer.consonant.value,
-          trialComposer.semivowel.value,
-          trialComposer.vowel.value,
-        ].filter { !$0.isEmpty }.count
+        let occupiedSlots = trialComposer.count()
         let hasUnigrams = !handler.currentLM.unigramsFor(keyArray: [readingKey]).isEmpty
         return occupiedSlots >= 2 && hasUnigrams
       }()
@@ -91,29 +84,20 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
       // 這防止 auto-split 將純注音序列（如 "1u," = ㄅㄧㄝ）誤拆為
       // ASCII 前綴 + 注音後綴（如 "1u" + ㄝ），導致音節被撕裂。
       let bufferIsSingleSyllablePhonetic: Bool = {
-        let buffer = handler.mixedAlphanumericalBuffer
-        guard buffer.count >= 1, buffer.count <= maxSingleSyllableKeyCount else { return false }
-        let hasUppercase = buffer.range(of: "[A-Z]", options: .regularExpression) != nil
-        guard !hasUppercase else { return false }
-        let isFullyParserCovered = buffer.allSatisfy {
-          handler.composer.inputValidityCheck(charStr: $0.description)
-        }
+        let bufferLength = bufferTraits.length
+        guard bufferLength >= 1, bufferLength <= maxSingleSyllableKeyCount else { return false }
+        guard bufferTraits.uppercaseLetterCount == 0 else { return false }
+        let isFullyParserCovered = !bufferTraits.containsNonPhoneticKey
         guard isFullyParserCovered else { return false }
         // dachen26 碼長不定（4 或 5），暫時不啟用此檢查。
         guard handler.composer.parser != .ofDachen26 else { return false }
         var trialComposer = handler.composer
         trialComposer.clear()
-        trialComposer.receiveSequence(buffer, isRomaji: false)
+        trialComposer.receiveSequence(handler.mixedAlphanumericalBuffer, isRomaji: false)
         guard trialComposer.isPronounceable else { return false }
         // 對於非 dachen26 排列，檢查鍵位數量與 composer 內有效 slot 數量是否一致。
         // 若一致，表示無 destructive overwrite，整段為單一音節。
-        let occupiedSlotCount = [
-          trialComposer.consonant.value,
-          trialComposer.semivowel.value,
-          trialComposer.vowel.value,
-          trialComposer.intonation.value,
-        ].filter { !$0.isEmpty }.count
-        return buffer.count == occupiedSlotCount
+        return bufferLength == trialComposer.count(withIntonation: true)
       }()
       // 優先嘗試 BPMF 全匹配：當 buffer 可視為單一注音時，
       // 避免 auto-split 將音節撕裂。若 BPMF 失敗，仍回退到 auto-split。
@@ -142,16 +126,12 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
       // 即使 shouldPreferASCIIWordOnSpace 為 true，仍應嘗試 auto-split，
       // 以支援「cOS + 注音」這類混輸。
       // 條件：≥2 個大寫 + ≥1 個小寫，可區分於簡單首字大寫詞（Hello、Mac）或全大寫詞（HELLO）。
-      let bufferHasMultipleUppercaseAndLowercase: Bool = {
-        let buffer = handler.mixedAlphanumericalBuffer
-        let hasLower = buffer.range(of: "[a-z]", options: .regularExpression) != nil
-        let ucCount = buffer.unicodeScalars.filter { "A" ... "Z" ~= $0 }.count
-        return hasLower && ucCount >= 2
-      }()
+      let bufferHasMultipleUppercaseAndLowercase = bufferTraits.hasLowercaseLetter
+        && bufferTraits.uppercaseLetterCount >= 2
       // 當 buffer 較長（>= 5 字元）時，即使 shouldPreferASCIIWordOnSpace 為 true
       // 也嘗試 auto-split，以支援 hello你好 等長 ASCII prefix 的混輸情境。
       if !shouldPreferASCIIWordOnSpace || twoCharPrefixIsPhonetic
-        || handler.mixedAlphanumericalBuffer.count >= 5
+        || bufferTraits.length >= 5
         || bufferHasMultipleUppercaseAndLowercase {
         // 先嘗試無 word-like 限制的 auto-split（fallback），以正確保留常見雙字母前綴（如 ai）。
         // 若 fallback 失敗，再嘗試 word-like 限制，以支援 hello你好 類型混輸。
@@ -223,13 +203,9 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
         $0.isASCII && isPunctCharOrSymbol($0)
       }
     let isUppercaseLetter = visibleInputText.range(of: "^[A-Z]$", options: .regularExpression) != nil
-    let bufferHasASCIIAlnum = handler.mixedAlphanumericalBuffer.range(
-      of: "[A-Za-z0-9]",
-      options: .regularExpression
-    ) != nil
-    let bufferContainsNonPhoneticKey = handler.mixedAlphanumericalBuffer.contains {
-      !handler.composer.inputValidityCheck(charStr: $0.description)
-    }
+    let bufferTraits = handler.mixedAlphanumericalTraits(of: handler.mixedAlphanumericalBuffer)
+    let bufferHasASCIIAlnum = bufferTraits.hasASCIIAlnum
+    let bufferContainsNonPhoneticKey = bufferTraits.containsNonPhoneticKey
     let baseInputTextIgnoringModifiers = (input.inputTextIgnoringModifiers ?? input.text)
       .lowercased().applyingTransformFW2HW(reverse: false)
     let isBaseInputPhoneticKey = handler.composer.inputValidityCheck(charStr: baseInputTextIgnoringModifiers)
@@ -293,7 +269,9 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
 
     if handler.mixedAlphanumericalBuffer.isEmpty {
       if isPhoneticKey, !shouldBlockPhoneticAbsorption {
+        let probe = PerfProbe.begin("Typewriter.composer.receiveKey")
         handler.composer.receiveKey(fromString: inputText)
+        PerfProbe.end(probe)
       } else {
         handler.composer.clear()
       }
@@ -303,6 +281,7 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
     }
 
     let fullInput = handler.mixedAlphanumericalBuffer + inputText
+    let fullInputTraits = handler.mixedAlphanumericalTraits(of: fullInput)
 
     // 決定處理順序：長後綴優先 auto-split，短後綴優先整段注音。
     // 這可正確區分 aijo6（ai + jo6，後綴 3 碼）與 xu.6（整段 ㄌㄧㄡˊ，後綴 2 碼）。
@@ -332,16 +311,14 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
 
     // 若 fullInput 包含 ASCII 數字或大寫字母，視為非 fully-parser-covered，
     // 讓 auto-split 有機會拆出 ASCII 前綴與注音後綴。
-    let fullInputHasUppercase = fullInput.range(of: "[A-Z]", options: .regularExpression) != nil
-    let isFullyParserCovered = fullInput.allSatisfy {
-      handler.composer.inputValidityCheck(charStr: $0.description)
-    } && !fullInputHasUppercase
-    let shouldPreferASCIIWordPath = shouldPreferASCIIWordPath(fullInput: fullInput)
+    let fullInputHasUppercase = fullInputTraits.uppercaseLetterCount > 0
+    let isFullyParserCovered = !fullInputTraits.containsNonPhoneticKey && !fullInputHasUppercase
+    let shouldPreferASCIIWordPath = shouldPreferASCIIWordPath(fullInputTraits)
 
     // 僅在 fullInput 不超過單音節最大碼長時才進入 full-phonetic 路徑。
     // 過長的輸入（如 hello + bopomofo）應跳過此路徑，交由 auto-split 處理。
     if isFullyParserCovered, !forceASCIIPunctuationPath, !shouldPreferASCIIWordPath,
-       fullInput.count <= maxSingleSyllableKeyCount {
+       fullInputTraits.length <= maxSingleSyllableKeyCount {
       var trialComposer = handler.composer
       trialComposer.clear()
       trialComposer.receiveSequence(fullInput, isRomaji: false)
@@ -358,13 +335,7 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
       }()
 
       if !isLeadingToneBlocked, trialComposer.isPronounceable {
-        let occupiedSlotCount = [
-          trialComposer.consonant.value,
-          trialComposer.semivowel.value,
-          trialComposer.vowel.value,
-          trialComposer.intonation.value,
-        ].filter { !$0.isEmpty }.count
-        let hasNoDestructiveOverwrite = fullInput.count == occupiedSlotCount
+        let hasNoDestructiveOverwrite = fullInputTraits.length == trialComposer.count(withIntonation: true)
 
         if trialComposer.hasIntonation() {
           if let readingKey = trialComposer.phonabetKeyForQuery(
@@ -375,7 +346,7 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
             // 避免將「ASCII 前綴 + 注音後綴」的 mixed 輸入誤吞為單一音節。
             // 同樣地，若鍵位數與實際佔用槽數不一致（destructive overwrite），
             // 也表示前面的 ASCII 前綴被 composer 誤吸收了，應交給 auto-split 處理。
-            if fullInput.count <= maxSingleSyllableKeyCount,
+            if fullInputTraits.length <= maxSingleSyllableKeyCount,
                hasNoDestructiveOverwrite {
               handler.composer = trialComposer
               guard !input.isInvalid, (try? handler.assembler.insertKey(readingKey)) != nil else {
@@ -438,14 +409,7 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
 
   // MARK: Private
 
-  private struct AutoSplitCandidate {
-    let suffixLength: Int
-    let prefixText: String
-    let readingKey: String
-    let bestProbability: Double
-    let prefersDigitLeadingSuffix: Bool
-    let prefersLongerPureAlnumSuffix: Bool
-  }
+  private typealias AutoSplitCandidate = MixedAlphanumericalBufferIndex.SplitCandidate
 
   // Tekkon 的單一注音音節最多只會佔用 4 個鍵位（聲、介、韻、調）。
   private var maxSingleSyllableKeyCount: Int {
@@ -468,228 +432,169 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
     requiresWordLikePrefix: Bool = false
   )
     -> Bool {
-    guard fullInput.count > 1 else { return false }
     guard let selectedCandidate = bestAutoSplitCandidate(
       fullInput: fullInput,
       requiresWordLikePrefix: requiresWordLikePrefix
     ) else { return false }
-    return applyAutoSplitCandidate(selectedCandidate, inputInvalid: inputInvalid, session: session)
+    return applyAutoSplitCandidate(
+      selectedCandidate,
+      prefixText: String(fullInput.dropLast(selectedCandidate.suffixLength)),
+      inputInvalid: inputInvalid,
+      session: session
+    )
   }
 
+  /// 同一份內容在同一次按鍵當中可能會被評估數次（先判斷長後綴、再分別以有無 word-like 限制嘗試拆分），
+  /// 故選取結果會記在中英混輸緩衝區索引內，內容有變時才重新評估。
   private func bestAutoSplitCandidate(
     fullInput: String,
     requiresWordLikePrefix: Bool
   )
     -> AutoSplitCandidate? {
+    handler.withMixedAlphanumericalBufferIndex(synchronizedTo: fullInput) { index in
+      if let memorized = index.memorizedSplits[requiresWordLikePrefix] { return memorized }
+      let result = selectAutoSplitCandidate(in: &index, requiresWordLikePrefix: requiresWordLikePrefix)
+      index.memorizedSplits[requiresWordLikePrefix] = .some(result)
+      return result
+    }
+  }
+
+  private func selectAutoSplitCandidate(
+    in index: inout MixedAlphanumericalBufferIndex,
+    requiresWordLikePrefix: Bool
+  )
+    -> AutoSplitCandidate? {
+    let fullLength = index.count
+    guard fullLength > 1 else { return nil }
     // Tekkon 的單一注音音節最多只會佔用 4 個鍵位（聲、介、韻、調）。
     // 若多個 raw suffix 最終對應到同一個 reading key，
     // 代表較長者只是用多餘鍵位覆寫出同一個結果，應保留最短 raw suffix。
-    // 額外保守排除含 separator / 空白的怪異 query key，避免把多段 key 當成單筆讀音。
-    let maxSuffixLength = min(maxSingleSyllableKeyCount, fullInput.count - 1)
-    // 重用單一 trial composer 以減少 struct 複製與 heap 分配。
-    var sharedComposer = handler.composer
-    // 計算開頭的「被阻斷 ASCII 前綴」長度（大寫字母與聲調數字鍵）。
-    // 這些鍵位在 buffer 為空時不會被 composer 吸收，理應視為固定 ASCII 前綴。
-    let blockedPrefixLength: Int = {
-      var length = 0
-      for char in fullInput {
-        let charStr = char.description
-        let isUppercase = charStr.range(of: "^[A-Z]$", options: .regularExpression) != nil
-        let isToneDigit: Bool = {
-          sharedComposer.clear()
-          sharedComposer.receiveKey(fromString: charStr)
-          return sharedComposer.hasIntonation(withNothingElse: true)
-        }()
-        if isUppercase || isToneDigit {
-          length += 1
-        } else {
-          break
-        }
-      }
-      return length
-    }()
-    var candidateByReadingKey: [String: AutoSplitCandidate] = [:]
+    let maxSuffixLength = min(maxSingleSyllableKeyCount, fullLength - 1)
+    var seenReadingKeys: [String] = []
+    var longestCandidate: AutoSplitCandidate?
 
     for suffixLength in 1 ... maxSuffixLength {
-      let prefixLength = fullInput.count - suffixLength
-      let prefixText = String(fullInput.prefix(prefixLength))
-      let suffixText = String(fullInput.suffix(suffixLength))
-      guard !requiresWordLikePrefix || isWordLikeASCIIPrefix(prefixText) else { continue }
-      guard let candidate = buildAutoSplitCandidate(
+      let prefixTraits = index.traits(ofPrefix: fullLength - suffixLength)
+      guard !requiresWordLikePrefix || prefixTraits.isWordLike else { continue }
+      guard let readingKey = autoSplitReadingKey(
         suffixLength: suffixLength,
-        prefixText: prefixText,
-        suffixText: suffixText,
+        prefixTraits: prefixTraits,
         requiresWordLikePrefix: requiresWordLikePrefix,
-        trialComposer: &sharedComposer
+        index: &index
       ) else { continue }
-
-      if let existing = candidateByReadingKey[candidate.readingKey] {
-        if candidate.suffixLength < existing.suffixLength {
-          candidateByReadingKey[candidate.readingKey] = candidate
-        }
-      } else {
-        candidateByReadingKey[candidate.readingKey] = candidate
-      }
+      guard !seenReadingKeys.contains(readingKey) else { continue }
+      seenReadingKeys.append(readingKey)
+      longestCandidate = .init(suffixLength: suffixLength, readingKey: readingKey)
     }
 
     // 若多個候選的 suffix 存在 subset/superset 關係（如 "u4" 是 "qu4" 的後綴），
     // 僅保留 superset（更長的 suffix = 更完整的讀音），捨棄 subset。
     // 這解決 helloqu4 中 u4（ㄧˋ）擊敗 qu4（ㄆㄧˋ）的問題。
-    let suffixTextsByKey: [String: String] = Dictionary(
-      uniqueKeysWithValues: candidateByReadingKey.map { key, candidate in
-        (key, String(fullInput.suffix(candidate.suffixLength)))
-      }
-    )
-    let keysToRemove = candidateByReadingKey.compactMap { key, candidate -> String? in
-      let mySuffix = String(fullInput.suffix(candidate.suffixLength))
-      for (otherKey, otherSuffix) in suffixTextsByKey where otherKey != key {
-        if otherSuffix.hasSuffix(mySuffix), otherSuffix.count > mySuffix.count {
-          return key
-        }
-      }
-      return nil
-    }
-    for key in keysToRemove { candidateByReadingKey.removeValue(forKey: key) }
+    // 由於所有候選的 suffix 皆是同一段輸入的尾端，較短者必為較長者的後綴，故最後只會剩下最長的候選。
+    guard let candidate = longestCandidate else { return nil }
+    let prefixTraits = index.traits(ofPrefix: fullLength - candidate.suffixLength)
 
-    // 選擇最長的有效後綴，但前綴長度必須滿足最小限制：
+    // 該候選的前綴長度必須滿足最小限制：
     // - 若開頭有被阻斷鍵（大寫/聲調數字），最小前綴長度 = 被阻斷段落長度。
     // - 若前綴含有英文字母，最小前綴長度 = 2。這避免單一字母（如 a=ㄇ）被誤認為
     //   ASCII 前綴，同時保留常見雙字母前綴（如 ai）於 mixed 輸入中的 ASCII 語義。
     // - 若前綴僅含數字與符號（皆為大千鍵盤下的合法注音鍵），最小前綴長度 = 1，
     //   使「5k4」等純注音輸入仍可正確以整段注音路徑處理。
-    let validCandidates = candidateByReadingKey.values.filter { candidate in
-      if blockedPrefixLength > 0 {
-        // 當開頭有被阻斷鍵（聲調數字或大寫字母）且後綴全為 ASCII 數字時，
-        // 整段輸入極可能為純數字序列（如 IP 位址 192.168.100.1），不應拆分。
-        // 此狀況特別影響倚天傳統佈局：1-4 為聲調鍵、7-9/0 為韻母鍵，
-        // 導致如 192 被拆為 1(˙) + 92(ㄣˊ=嗯)。
-        let suffixStr = String(fullInput.suffix(candidate.suffixLength))
-        let suffixIsPureDigits = suffixStr.unicodeScalars.allSatisfy {
-          $0.isASCII && CharacterSet.decimalDigits.contains($0)
-        }
-        if suffixIsPureDigits {
-          return false
-        }
-        return candidate.prefixText.count >= blockedPrefixLength
+    let blockedPrefixLength = index.traits(ofPrefix: fullLength).blockedLeadingLength
+    if blockedPrefixLength > 0 {
+      // 當開頭有被阻斷鍵（聲調數字或大寫字母）且後綴全為 ASCII 數字時，
+      // 整段輸入極可能為純數字序列（如 IP 位址 192.168.100.1），不應拆分。
+      // 此狀況特別影響倚天傳統佈局：1-4 為聲調鍵、7-9/0 為韻母鍵，
+      // 導致如 192 被拆為 1(˙) + 92(ㄣˊ=嗯)。
+      let suffixIsPureDigits = index.suffixText(length: candidate.suffixLength).unicodeScalars.allSatisfy {
+        $0.isASCII && CharacterSet.decimalDigits.contains($0)
       }
-      let hasASCIILetter = candidate.prefixText.range(
-        of: "[A-Za-z]", options: .regularExpression
-      ) != nil
-      let hasOnlyDigits = !hasASCIILetter
-        && candidate.prefixText.range(of: "[0-9]", options: .regularExpression) != nil
-      let requiredMinLength = hasASCIILetter || hasOnlyDigits ? 2 : 1
-      return candidate.prefixText.count >= requiredMinLength
+      guard !suffixIsPureDigits, prefixTraits.length >= blockedPrefixLength else { return nil }
+      return candidate
     }
-
-    return validCandidates.max(by: {
-      let lhsDigitLeading = $0.prefersDigitLeadingSuffix
-      let rhsDigitLeading = $1.prefersDigitLeadingSuffix
-      if lhsDigitLeading != rhsDigitLeading {
-        let digitLeadingCandidate = lhsDigitLeading ? $0 : $1
-        let nonDigitLeadingCandidate = lhsDigitLeading ? $1 : $0
-        // 僅當 digit-leading 後綴長度 >= 非 digit-leading 後綴時，
-        // 才優先 digit-leading（保留 This5jp3 行為）。
-        // 否則優先非 digit-leading（避免 ainj03 被誤拆為 ai + ㄢˇ）。
-        if digitLeadingCandidate.suffixLength >= nonDigitLeadingCandidate.suffixLength {
-          return !lhsDigitLeading && rhsDigitLeading
-        } else {
-          return lhsDigitLeading && !rhsDigitLeading
-        }
-      }
-      if $0.prefersLongerPureAlnumSuffix, $1.prefersLongerPureAlnumSuffix,
-         $0.suffixLength != $1.suffixLength {
-        return $0.suffixLength < $1.suffixLength
-      }
-      let lhsPrefixWordLike = isWordLikeASCIIPrefix($0.prefixText)
-      let rhsPrefixWordLike = isWordLikeASCIIPrefix($1.prefixText)
-      // 若雙方前綴皆為 word-like，優先以概率排序（保留 Twinsu.4 行為）。
-      // 若僅一方為 word-like，優先保留 word-like 前綴（避免 ello→el 等誤拆）。
-      // 若雙方皆非 word-like，優先以後綴長度排序（保留 aizj/4 與 aijo6 行為）。
-      switch (lhsPrefixWordLike, rhsPrefixWordLike) {
-      case (true, true):
-        if $0.bestProbability != $1.bestProbability {
-          return $0.bestProbability < $1.bestProbability
-        }
-        // 同為 word-like 且概率相同時，偏好較長的前綴（較短的後綴），
-        // 避免 ello→el 或 hello→hel 等誤拆。
-        if $0.prefixText.count != $1.prefixText.count {
-          return $0.prefixText.count < $1.prefixText.count
-        }
-      case (false, false):
-        if $0.suffixLength != $1.suffixLength {
-          return $0.suffixLength < $1.suffixLength
-        }
-        if $0.bestProbability != $1.bestProbability {
-          return $0.bestProbability < $1.bestProbability
-        }
-      case (true, false): return false
-      case (false, true): return true
-      }
-      return $0.suffixLength < $1.suffixLength
-    })
+    let requiredMinLength = prefixTraits.hasASCIIAlnum ? 2 : 1
+    return prefixTraits.length >= requiredMinLength ? candidate : nil
   }
 
-  // 接受 inout trialComposer 以在 bestAutoSplitCandidate 的迴圈中重用。
-  private func buildAutoSplitCandidate(
+  /// 給定長度的後綴在給定前綴之下可否成為注音後綴。可以的話，回傳其讀音。
+  private func autoSplitReadingKey(
     suffixLength: Int,
-    prefixText: String,
-    suffixText: String,
+    prefixTraits: MixedAlphanumericalBufferIndex.PrefixTraits,
     requiresWordLikePrefix: Bool,
-    trialComposer: inout Tekkon.Composer
+    index: inout MixedAlphanumericalBufferIndex
   )
-    -> AutoSplitCandidate? {
-    let prefixHasASCIIAlnum = prefixText.range(of: "[A-Za-z0-9]", options: .regularExpression) != nil
-    let suffixStartsWithASCIIDigit = suffixText.unicodeScalars.first.map {
-      $0.isASCII && CharacterSet.decimalDigits.contains($0)
-    } ?? false
-    let suffixStartsWithASCIIPunctuation = suffixText.first?.description.range(
-      of: "^[!\"#$%&'()*+,\\\\-./:;<=>?@[\\\\\\\\\\]^_`{|}~]$",
-      options: .regularExpression
-    ) != nil
+    -> String? {
+    let suffixReading = index.suffixReading(length: suffixLength, evaluate: evaluateAutoSplitSuffix)
+    let prefixHasASCIIAlnum = prefixTraits.hasASCIIAlnum
 
-    if prefixHasASCIIAlnum, suffixStartsWithASCIIPunctuation {
+    if prefixHasASCIIAlnum, suffixReading.startsWithASCIIPunctuation {
       return nil
     }
 
     // 單一標點字元不得作為 ASCII 前綴（如倚天傳統布局的 ;→ㄗ ,→ㄓ .→ㄔ）。
-    if prefixText.count == 1, !prefixHasASCIIAlnum,
-       prefixText.unicodeScalars.allSatisfy(isPunctCharOrSymbol) {
+    if prefixTraits.length == 1, !prefixHasASCIIAlnum,
+       let firstChar = index.firstCharacter,
+       firstChar.unicodeScalars.allSatisfy(isPunctCharOrSymbol) {
+      return nil
+    }
+
+    // Word-like 情境維持 fast-path 限制，避免 digit-leading 後綴意外勝出；
+    // 非 word-like fallback 則放寬為接受 ETenDOS 條目，以支援合法注音前綴的保留。
+    guard suffixReading.hasUnigrams,
+          suffixReading.hasFastUnigrams || !requiresWordLikePrefix
+    else {
       return nil
     }
+    return suffixReading.readingKey
+  }
+
+  /// 評估給定的後綴本身能否組成可查得單元圖的讀音。結果與前綴無關，故可記在中英混輸緩衝區索引內重複使用。
+  private func evaluateAutoSplitSuffix(_ suffixText: String) -> MixedAlphanumericalBufferIndex.SuffixReading {
+    let suffixStartsWithASCIIPunctuation = suffixText.first?.description.range(
+      of: "^[!\"#$%&'()*+,\\\\-./:;<=>?@[\\\\\\\\\\]^_`{|}~]$",
+      options: .regularExpression
+    ) != nil
+    let rejected = MixedAlphanumericalBufferIndex.SuffixReading(
+      startsWithASCIIPunctuation: suffixStartsWithASCIIPunctuation,
+      readingKey: nil,
+      hasUnigrams: false,
+      hasFastUnigrams: false
+    )
 
     let suffixEndsWithSpace = suffixText.last == " "
 
+    var trialComposer = handler.composer
+    trialComposer.clear()
+    // 在評估 mixed 輸入時，暫時停用自動糾正。否則 auto-correct 會讓不同的 suffix
+    // 坍縮到同一個 reading key（例如「zj/4」被糾正為「ㄈㄥˋ」而與「z/4」相同），
+    // 導致 dedup 誤刪較長的合法 suffix，使 ASCII prefix 被錯誤拉長。
+    trialComposer.phonabetCombinationCorrectionEnabled = false
+    // 啟用 CSVT 順序強制，逐字檢查 receiveKey 返回值。
+    // 若任何字元被 CSVT 拒絕，整個 suffix 候選直接作廢，
+    // 避免半成品 composer（如僅有 vowel）被 trailing space 誤判為合法。
+    trialComposer.enforceCSVTOrdering = true
+
     // Mixed mode 永遠不接受聲調前置鍵入。
     // 後綴不能以獨立聲調鍵作為首鍵（在 receiveSequence 前先檢查，避免破壞 composer 狀態）。
     let suffixScalars = suffixText.unicodeScalars
     let scalarCount = suffixEndsWithSpace ? suffixScalars.count - 1 : suffixScalars.count
     if scalarCount > 0, let firstScalar = suffixScalars.first {
-      trialComposer.clear()
       trialComposer.receiveKey(fromScalar: firstScalar)
-      if trialComposer.hasIntonation(withNothingElse: true) { return nil }
+      if trialComposer.hasIntonation(withNothingElse: true) { return rejected }
     }
 
     // 後綴若包含大寫字母，不得被視為注音後綴。
     // 大寫字母只能透過 Shift 鍵入，在 mixed mode 下明確代表 ASCII 意圖。
     // 若允許大寫字母進入注音 composer（因 receiveKey 對大小寫不敏感），
     // 則「macOS 」這類 camelCase 輸入會被誤拆為 ASCII 前綴 + 注音後綴。
-    let suffixHasUppercase = suffixText.range(of: "[A-Z]", options: .regularExpression) != nil
-    guard !suffixHasUppercase else { return nil }
+    guard !suffixScalars.contains(where: { "A" ... "Z" ~= $0 }) else { return rejected }
 
     trialComposer.clear()
-    // 在評估 mixed 輸入時，暫時停用自動糾正。否則 auto-correct 會讓不同的 suffix
-    // 坍縮到同一個 reading key（例如「zj/4」被糾正為「ㄈㄥˋ」而與「z/4」相同），
-    // 導致 dedup 誤刪較長的合法 suffix，使 ASCII prefix 被錯誤拉長。
-    trialComposer.phonabetCombinationCorrectionEnabled = false
-    // 啟用 CSVT 順序強制，逐字檢查 receiveKey 返回值。
-    // 若任何字元被 CSVT 拒絕，整個 suffix 候選直接作廢（return nil），
-    // 避免半成品 composer（如僅有 vowel）被 trailing space 誤判為合法。
-    trialComposer.enforceCSVTOrdering = true
     // 使用 UnicodeScalar iteration + receiveKey(fromScalar:) 繞過 Character/String 的 CFString 橋接。
     var scalarIndex = 0
     for scalar in suffixScalars {
       if scalarIndex >= scalarCount { break }
-      if !trialComposer.receiveKey(fromScalar: scalar) { return nil }
+      if !trialComposer.receiveKey(fromScalar: scalar) { return rejected }
       scalarIndex += 1
     }
 
@@ -698,44 +603,29 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
     guard trialComposer.isPronounceable,
           trialComposer.hasIntonation() || suffixEndsWithSpace
     else {
-      return nil
-    }
-
-    guard let readingKey = trialComposer.phonabetKeyForQuery(
-      pronounceableOnly: true
-    ) else {
-      return nil
+      return rejected
     }
 
-    guard !readingKey.contains(handler.keySeparator),
+    // 額外保守排除含 separator / 空白的怪異 query key，避免把多段 key 當成單筆讀音。
+    guard let readingKey = trialComposer.phonabetKeyForQuery(pronounceableOnly: true),
+          !readingKey.contains(handler.keySeparator),
           readingKey.rangeOfCharacter(from: .whitespacesAndNewlines) == nil
     else {
-      return nil
-    }
-
-    let hasFast = handler.currentLM.hasUnigramsForFast(keyArray: [readingKey])
-    let unigrams = handler.currentLM.unigramsFor(keyArray: [readingKey])
-    // Word-like 情境維持 fast-path 限制，避免 digit-leading 後綴意外勝出；
-    // 非 word-like fallback 則放寬為接受 ETenDOS 條目，以支援合法注音前綴的保留。
-    let hasUnigrams = hasFast || (!requiresWordLikePrefix && !unigrams.isEmpty)
-    guard hasUnigrams else { return nil }
-    guard let bestProbability = unigrams.map(\.probability).max() else {
-      return nil
+      return rejected
     }
 
+    let hasUnigrams = !handler.currentLM.unigramsFor(keyArray: [readingKey]).isEmpty
     return .init(
-      suffixLength: suffixLength,
-      prefixText: prefixText,
+      startsWithASCIIPunctuation: suffixStartsWithASCIIPunctuation,
       readingKey: readingKey,
-      bestProbability: bestProbability,
-      prefersDigitLeadingSuffix: isWordLikeASCIIPrefix(prefixText) && suffixStartsWithASCIIDigit,
-      prefersLongerPureAlnumSuffix: requiresWordLikePrefix
-        && suffixText.range(of: "^[A-Za-z0-9]+$", options: .regularExpression) != nil
+      hasUnigrams: hasUnigrams,
+      hasFastUnigrams: hasUnigrams && handler.currentLM.hasUnigramsForFast(keyArray: [readingKey])
     )
   }
 
   private func applyAutoSplitCandidate(
     _ selectedCandidate: AutoSplitCandidate,
+    prefixText: String,
     inputInvalid: Bool,
     session: Session
   )
@@ -756,7 +646,6 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
       return true
     }
 
-    let prefixText = selectedCandidate.prefixText
     let overflowText = handler.commitOverflownComposition
     handler.retrievePOMSuggestions(apply: true)
     handler.composer.clear()
@@ -769,43 +658,14 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
     return true
   }
 
-  private func isWordLikeASCIIPrefix(_ text: String) -> Bool {
-    text.range(of: "^[A-Za-z]{3,}[A-Za-z0-9]*$", options: .regularExpression) != nil
-  }
-
-  private func shouldPreferASCIIWordPath(fullInput: String, minimumOverwriteCount: Int = 2) -> Bool {
-    guard fullInput.count >= 3,
-          fullInput.range(of: "^[A-Za-z]+$", options: .regularExpression) != nil
-    else {
-      return false
-    }
-
-    var trialComposer = handler.composer
-    trialComposer.clear()
-    var destructiveOverwriteCount = 0
-
-    for currentChar in fullInput {
-      let beforeSlots = composerSlotValues(of: trialComposer)
-      trialComposer.receiveKey(fromString: currentChar.description)
-      let afterSlots = composerSlotValues(of: trialComposer)
-
-      if isNonAdvancingSlotConsumption(from: beforeSlots, to: afterSlots) {
-        destructiveOverwriteCount += 1
-      }
-    }
-
-    return destructiveOverwriteCount >= minimumOverwriteCount
-  }
-
-  private func composerSlotValues(of composer: Tekkon.Composer) -> [String] {
-    [composer.consonant.value, composer.semivowel.value, composer.vowel.value, composer.intonation.value]
-  }
-
-  private func isNonAdvancingSlotConsumption(from beforeSlots: [String], to afterSlots: [String]) -> Bool {
-    let beforeOccupiedSlotCount = beforeSlots.filter { !$0.isEmpty }.count
-    let afterOccupiedSlotCount = afterSlots.filter { !$0.isEmpty }.count
-    guard beforeOccupiedSlotCount > 0 else { return false }
-    return afterOccupiedSlotCount <= beforeOccupiedSlotCount
+  /// 整段皆為英文字母、且逐鍵餵入注拼槽時有足夠多次的破壞性覆寫者，較可能是英文單字（如 tod、film）。
+  private func shouldPreferASCIIWordPath(
+    _ traits: MixedAlphanumericalBufferIndex.PrefixTraits,
+    minimumOverwriteCount: Int = 2
+  )
+    -> Bool {
+    guard traits.length >= 3, traits.isAllLetters else { return false }
+    return traits.destructiveOverwriteCount >= minimumOverwriteCount
   }
 
   private func resolveVisibleInputText(_ input: some InputSignalProtocol) -> String {
@@ -820,11 +680,11 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
       return transformedInputText
     }
 
-    let keyboardLayout = inferredLatinKeyboardLayout()
-    guard let mappedTuple = keyboardLayout.mapTable[input.keyCode] else {
+    // 編譯後的對照表內的字元皆已是半形。
+    guard let mappedGlyphs = inferredLatinKeyboardLayout().compiledTable.glyphs(for: input.keyCode) else {
       return transformedInputText
     }
-    return mappedTuple.1.applyingTransformFW2HW(reverse: false)
+    return mappedGlyphs.shifted
   }
 
   private func resolveLiteralASCIIMainAreaText(_ input: some InputSignalProtocol) -> String? {
@@ -836,16 +696,10 @@ public struct MixedAlphanumericalTypewriter<Handler: InputHandlerProtocol>: Type
       return nil
     }
 
-    guard let mappedTuple = inferredLatinKeyboardLayout().mapTable[input.keyCode] else {
-      return nil
-    }
-
-    let literalASCII = (input.isShiftHeld ? mappedTuple.1 : mappedTuple.0)
-      .applyingTransformFW2HW(reverse: false)
-    guard literalASCII.range(of: "^[ -~]$", options: .regularExpression) != nil else {
-      return nil
-    }
-    return literalASCII
+    return inferredLatinKeyboardLayout().compiledTable.printableASCII(
+      for: input.keyCode,
+      shifted: input.isShiftHeld
+    )
   }
 
   private func commitLiteralASCIIImmediately(_ text: String, session: Session) -> Bool {
@@ -0,0 +1,114 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+import Hotenka
+import LMAssemblyMaterials4Tests
+import Typewriter
+
+/// 以單元測試用的辭典資料重現輸入法的冷啟動流程，並印出各元件的載入耗時與記憶體變化。
+/// 不依賴 AppKit，故亦可在 Linux 上執行。
+@main
+struct ColdStartProfiler {
+  static func main() {
+    let launchTime = DispatchTime.now().uptimeNanoseconds
+    let args = Set(CommandLine.arguments.dropFirst())
+    if args.contains("--help") {
+      printUsage()
+      return
+    }
+    LMAssembly.LMInstantiator.asyncLoadingUserData = !args.contains("--sync")
+    guard let textMapPath = LMATestsData.getCINPath4Tests("vanguardTextMap_test", ext: "txtMap") else {
+      print("Factory TextMap fixture not found.")
+      exit(1)
+    }
+    let userDataFolder = FileManager.default.temporaryDirectory
+      .appendingPathComponent("vChewingColdStartProfiler-\(ProcessInfo.processInfo.processIdentifier)")
+    let userFiles = prepareUserDataFiles(in: userDataFolder)
+    let langModel = LMAssembly.LMInstantiator(isCHS: false)
+    let convdictPath = convdictPath4Tests()
+
+    let loaders = ColdStartPlan.Loaders(
+      factoryDictionary: { done in
+        _ = LMAssembly.LMInstantiator.loadFactoryDictionary(textMapPath: textMapPath)
+        done()
+      },
+      cassette: args.contains("--cassette") ? { done in
+        let cinPath = LMATestsData.getCINPath4Tests("wubi", ext: "cin") ?? ""
+        LMAssembly.LMInstantiator.loadCassetteData(path: cinPath) { _ in done() }
+      } : nil,
+      isCassetteCritical: args.contains("--cassette"),
+      userLangModels: { done in
+        langModel.loadUserPhrasesData(path: userFiles.phrases, filterPath: userFiles.filter)
+        langModel.loadUserSymbolData(path: userFiles.symbols)
+        langModel.loadUserAssociatesData(path: userFiles.associates)
+        LMAssembly.afterPendingFileLoads { done() }
+      },
+      chineseConverter: args.contains("--convdict") ? {
+        if (try? HotenkaChineseConverter(stringMapPath: convdictPath)) == nil {
+          print("Failed loading convdict: \(convdictPath)")
+        }
+      } : nil,
+      parser: args.contains("--parser") ? .ofHanyuPinyin : nil
+    )
+
+    let orchestrator = ColdStartPlan.makeOrchestrator(loaders: loaders)
+    orchestrator.start()
+    let criticalPathReady = orchestrator.waitForCriticalPath(timeout: 30)
+    let criticalPathMS = Double(DispatchTime.now().uptimeNanoseconds - launchTime) / 1_000_000
+    let allReady = orchestrator.waitUntilReady(timeout: 60)
+    print(orchestrator.dump())
+    print("# Critical path ready: \(criticalPathReady) (\(criticalPathMS.rounded(toPlaces: 3)) ms since launch)")
+    print("# All ready: \(allReady)")
+    let probe = langModel.unigramsFor(keyArray: ["ㄋㄧㄢˊ", "ㄓㄨㄥ"])
+    print("# Probe ㄋㄧㄢˊ-ㄓㄨㄥ: \(probe.map(\.value).joined(separator: ", "))")
+    try? FileManager.default.removeItem(at: userDataFolder)
+    exit(criticalPathReady && allReady ? 0 : 1)
+  }
+
+  // MARK: Private
+
+  private static func printUsage() {
+    print("vChewingColdStartProfiler — reproduces the IME cold start against the test fixtures.")
+    print("Usage: swift run vChewingColdStartProfiler [--sync] [--cassette] [--parser] [--convdict]")
+    print("  --sync      Load user data synchronously (as unit tests do).")
+    print("  --cassette  Load a cassette fixture as part of the critical path.")
+    print("  --parser    Warm up the Hanyu Pinyin trie on the background executor.")
+    print("  --convdict  Load Hotenka's test convdict as the Chinese converter stage.")
+  }
+
+  private static func prepareUserDataFiles(
+    in folder: URL
+  )
+    -> (phrases: String, filter: String, symbols: String, associates: String) {
+    try? FileManager.default.createDirectory(at: folder, withIntermediateDirectories: true)
+    let contents: [(String, String)] = [
+      ("userdata-cht.txt", "年終 ㄋㄧㄢˊ-ㄓㄨㄥ\n中年 ㄓㄨㄥ-ㄋㄧㄢˊ\n"),
+      ("exclude-phrases-cht.txt", ""),
+      ("usersymbolphrases-cht.txt", "☆ ㄒㄧㄥ\n"),
+      ("associatedPhrases-cht.txt", "年終 年-終\n"),
+    ]
+    let paths = contents.map { name, text in
+      let url = folder.appendingPathComponent(name)
+      try? text.write(to: url, atomically: true, encoding: .utf8)
+      return url.path
+    }
+    return (paths[0], paths[1], paths[2], paths[3])
+  }
+
+  /// Hotenka 單元測試用的 convdict，以本檔案的位置推算路徑。
+  private static func convdictPath4Tests() -> String {
+    URL(fileURLWithPath: #filePath)
+      .deletingLastPathComponent() // vChewingColdStartProfiler
+      .deletingLastPathComponent() // Sources
+      .deletingLastPathComponent() // vChewing_Typewriter
+      .deletingLastPathComponent() // Packages
+      .appendingPathComponent("vChewing_Hotenka/Tests/HotenkaTestDictData/convdict.stringmap")
+      .path
+  }
+}
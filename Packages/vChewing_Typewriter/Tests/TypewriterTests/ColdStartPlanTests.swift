@@ -0,0 +1,77 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+import Testing
+@testable import Typewriter
+
+@Suite("ColdStartPlanTests")
+struct ColdStartPlanTests {
+  @Test
+  func testCriticalPathGatesDeferredStages() async {
+    let startedStages = NSMutex([String]())
+    let loaders = ColdStartPlan.Loaders(
+      factoryDictionary: { done in
+        startedStages.withLock { $0.append("factoryDictionary") }
+        // 模擬在背景佇列上完成的原廠辭典載入。
+        DispatchQueue.global().asyncAfter(deadline: .now() + 0.05) { done() }
+      },
+      userLangModels: { done in
+        startedStages.withLock { $0.append("userLangModels") }
+        done()
+      },
+      chineseConverter: {},
+      parser: .ofHanyuPinyin
+    )
+    let orchestrator = ColdStartPlan.makeOrchestrator(loaders: loaders)
+    #expect(orchestrator.phase(of: .factoryDictionary) == .pending)
+    // 未登記的元件視為已就緒。
+    #expect(orchestrator.isReady(.cassette))
+
+    await withCheckedContinuation { continuation in
+      orchestrator.whenAllReady { continuation.resume() }
+      orchestrator.start()
+    }
+
+    #expect(orchestrator.isAllReady)
+    #expect(orchestrator.isCriticalPathReady)
+    #expect(startedStages.value == ["factoryDictionary", "userLangModels"])
+    let reports = Dictionary(uniqueKeysWithValues: orchestrator.reports.map { ($0.name, $0) })
+    #expect(Set(reports.keys) == [
+      "factoryDictionary", "userLangModels", "bpmfvs", "pinyinTrie", "chineseConverter",
+    ])
+    guard let factory = reports["factoryDictionary"] else { return }
+    let factoryEnd = factory.startOffset + factory.duration
+    #expect(factory.isCritical)
+    // 相依於原廠辭典的元件須等到原廠辭典就緒後才開始；預熱類的元件則一律在背景佇列上執行。
+    #expect((reports["userLangModels"]?.startOffset ?? 0) >= factoryEnd)
+    #expect(reports["bpmfvs"]?.executor == .background)
+    #expect(reports["pinyinTrie"]?.executor == .background)
+    #expect(reports["chineseConverter"]?.executor == .background)
+    #expect(orchestrator.totalDuration != nil)
+    print(orchestrator.dump())
+  }
+
+  @Test
+  func testOptionalStagesFollowLoaders() {
+    let loaders = ColdStartPlan.Loaders(
+      factoryDictionary: { $0() },
+      cassette: { $0() },
+      isCassetteCritical: true,
+      userLangModels: { $0() },
+      parser: .ofDachen
+    )
+    let orchestrator = ColdStartPlan.makeOrchestrator(loaders: loaders)
+    // 注音排列不需要拼音 Trie；磁帶則在啟用時屬於關鍵路徑。
+    #expect(orchestrator.phase(of: .cassette) == .pending)
+    #expect(orchestrator.isReady(.pinyinTrie))
+    // 未提供繁簡轉換辭典的預熱動作時，不登記該元件。
+    #expect(orchestrator.isReady(.chineseConverter))
+    #expect(!orchestrator.isCriticalPathReady)
+  }
+}
@@ -1429,4 +1429,27 @@ extension InputHandlerTests {
     #expect(testHandler.triageInput(event: KBEvent.KeyEventData.dataEnterReturn.asEvent))
     #expect(testSession.recentCommissions.joined() == "ˊ")
   }
+
+  @Test
+  func test_IH116_CandidateStateCarriesMacroProvenance() throws {
+    guard let testHandler, let testSession else {
+      Issue.record("testHandler and testSession at least one of them is nil.")
+      return
+    }
+    clearTestPOM()
+    testHandler.prefs.fetchSuggestionsFromPerceptionOverrideModel = false
+    defer { testHandler.clear() }
+    testSession.resetInputHandler(forceComposerCleanup: true)
+
+    #expect(throws: Never.self) { try testHandler.assembler.insertKey("ㄕˊ") }
+    #expect(throws: Never.self) { try testHandler.assembler.insertKey("ㄐㄧㄢ") }
+
+    // 時間巨集的展開結果每次查詢都可能不同，故巨集標記須於生成選字狀態時自組字器候選謄入。
+    let candidateState = testHandler.generateStateOfCandidates(dodge: false)
+    let flagged = candidateState.candidates.filter { candidateState.isMacroCandidate($0) }
+    #expect(!flagged.isEmpty)
+    #expect(flagged.allSatisfy { $0.keyArray == ["ㄕˊ", "ㄐㄧㄢ"] })
+    #expect(flagged.count < candidateState.candidates.count)
+    #expect(candidateState.data.macroCandidates.count == flagged.count)
+  }
 }
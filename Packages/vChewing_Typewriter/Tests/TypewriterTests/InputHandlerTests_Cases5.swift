@@ -143,3 +143,183 @@ extension InputHandlerTests {
     #expect(narrator.lastNarratedText?.contains("ㄋㄧ") == true)
   }
 }
+
+// MARK: - CompositionBufferIndexTests
+
+extension InputHandlerTests {
+  /// 組字區索引的游標換算與讀音插入結果，須與逐字重組文字片段的結果一致；
+  /// 沿用舊索引增量重建所得的索引，亦須與從頭建立者一致。
+  @Test
+  func test_IH504_CompositionBufferIndexMatchesPerCharacterRebuild() throws {
+    guard let testHandler, let testSession else {
+      Issue.record("testHandler and testSession at least one of them is nil.")
+      return
+    }
+    testHandler.prefs.useSCPCTypingMode = false
+    clearTestPOM()
+    // 插入一筆讀音數與字長不一致的臨時語料，以涵蓋游標切入這類節點的情形。
+    testHandler.currentLM.insertTemporaryData(
+      unigram: Homa.Gram(keyArray: ["ㄈㄤ"], value: "芳芳芳", score: 0),
+      isFiltering: false
+    )
+    defer {
+      testHandler.currentLM.clearTemporaryData(isFiltering: false)
+      testHandler.composer.clear()
+      testSession.resetInputHandler(forceComposerCleanup: true)
+    }
+    testSession.resetInputHandler(forceComposerCleanup: true)
+    typeSentence("u. 2u,6s/6xu.6u4xm3z; ")
+    #expect(testHandler.assembler.assembledSentence.contains { $0.isReadingMismatched })
+
+    // 以下為舊版逐字處理的參考實作。
+    func legacyDisplayCursor(_ rawCursor: Int) -> Int {
+      var composedStringCursorIndex = 0
+      var readingCursorIndex = 0
+      for theNode in testHandler.assembler.assembledSentence {
+        let segLength = theNode.keyArray.count
+        if readingCursorIndex + segLength <= rawCursor {
+          composedStringCursorIndex += theNode.value.count
+          readingCursorIndex += segLength
+          continue
+        }
+        if !theNode.isReadingMismatched {
+          theNode.value.forEach { _ in
+            if readingCursorIndex < rawCursor {
+              composedStringCursorIndex += 1
+              readingCursorIndex += 1
+            }
+          }
+          continue
+        }
+        guard readingCursorIndex < rawCursor else { continue }
+        composedStringCursorIndex += theNode.value.count
+        readingCursorIndex = min(readingCursorIndex + segLength, rawCursor)
+      }
+      return composedStringCursorIndex
+    }
+
+    func legacySegments(inserting reading: String, at cursor: Int) -> (segments: [String], readingAt: Int?) {
+      let segments = testHandler.assembler.assembledSentence.values
+      var newSegments = [String]()
+      var readingAt: Int?
+      var temporaryNode = ""
+      var charCounter = 0
+      for node in segments {
+        for char in node {
+          if charCounter == cursor {
+            newSegments.append(temporaryNode)
+            temporaryNode = ""
+            readingAt = newSegments.count
+            newSegments.append(reading)
+          }
+          temporaryNode += String(char)
+          charCounter += 1
+        }
+        newSegments.append(temporaryNode)
+        temporaryNode = ""
+      }
+      if newSegments == segments {
+        readingAt = newSegments.count
+        newSegments.append(reading)
+      }
+      return (newSegments, readingAt)
+    }
+
+    for rawCursor in 0 ... testHandler.assembler.length {
+      testHandler.assembler.cursor = rawCursor
+      let expectedCursor = legacyDisplayCursor(rawCursor)
+      #expect(testHandler.convertCursorForDisplay(rawCursor) == expectedCursor)
+      testHandler.composer.clear()
+      _ = testHandler.composer.receiveKey(fromString: "1") // ㄅ
+      let reading = testHandler.readingForDisplay
+      let state = testHandler.generateStateOfInputting()
+      let expected = legacySegments(inserting: reading, at: expectedCursor)
+      #expect(state.displayTextSegments == expected.segments)
+      #expect(state.data.highlightAtSegment == expected.readingAt)
+      #expect(state.cursor == expectedCursor + reading.count)
+      let prefixText = state.displayedText.prefix(state.cursor)
+      #expect(state.u16Cursor == prefixText.utf16.count)
+    }
+    testHandler.composer.clear()
+
+    // 增量重建：追加讀音之後，沿用舊索引所得的結果須與從頭建立者一致。
+    testHandler.assembler.cursor = testHandler.assembler.length
+    typeSentence("5j/ ")
+    let reusedIndex = testHandler.compositionBufferIndex(reflectBPMFVS: false)
+    let freshIndex = CompositionBufferIndex(
+      sentence: testHandler.assembler.assembledSentence,
+      generation: testHandler.assembler.assemblyGeneration,
+      reflectBPMFVS: false
+    )
+    #expect(reusedIndex.rawSegments == freshIndex.rawSegments)
+    #expect(reusedIndex.trimmedDisplaySegments == freshIndex.trimmedDisplaySegments)
+    for rawCursor in 0 ... testHandler.assembler.length {
+      #expect(reusedIndex.displayCursor(forRawCursor: rawCursor) == freshIndex.displayCursor(forRawCursor: rawCursor))
+      #expect(reusedIndex.displayCursor(forRawCursor: rawCursor) == legacyDisplayCursor(rawCursor))
+    }
+  }
+}
+
+// MARK: - MixedAlphanumericalBufferIndexTests
+
+extension InputHandlerTests {
+  /// 中英混輸緩衝區索引在追加、刪除、改寫內容之後所得的各前綴特徵，須與從頭建立者、以及逐字掃描的結果一致。
+  @Test
+  func test_IH505_MixedAlphanumericalBufferIndexMatchesFullRescan() throws {
+    guard let testHandler else {
+      Issue.record("testHandler is nil.")
+      return
+    }
+    var composer = testHandler.composer
+    composer.clear()
+
+    func rescannedTraits(of text: String) -> (blocked: Int, hasUppercase: Bool, isWordLike: Bool, overwrites: Int) {
+      var blocked = 0
+      for char in text {
+        var testComposer = composer
+        testComposer.receiveKey(fromString: char.description)
+        let isBlocked = char.description.range(of: "^[A-Z]$", options: .regularExpression) != nil
+          || testComposer.hasIntonation(withNothingElse: true)
+        guard isBlocked else { break }
+        blocked += 1
+      }
+      var overwrites = 0
+      if text.range(of: "^[A-Za-z]+$", options: .regularExpression) != nil {
+        var trialComposer = composer
+        for char in text {
+          let before = trialComposer.count(withIntonation: true)
+          trialComposer.receiveKey(fromString: char.description)
+          if before > 0, trialComposer.count(withIntonation: true) <= before { overwrites += 1 }
+        }
+      }
+      return (
+        blocked,
+        text.range(of: "[A-Z]", options: .regularExpression) != nil,
+        text.range(of: "^[A-Za-z]{3,}[A-Za-z0-9]*$", options: .regularExpression) != nil,
+        overwrites
+      )
+    }
+
+    var index = MixedAlphanumericalBufferIndex(composer: composer)
+    let snapshots = ["Th", "This", "This su3", "This", "Thin", "3Dmodel", "", "helloqu4", "hello qu4 "]
+    for text in snapshots {
+      index.synchronize(to: text, composer: composer)
+      var freshIndex = MixedAlphanumericalBufferIndex(composer: composer)
+      freshIndex.synchronize(to: text, composer: composer)
+      #expect(index.count == text.count)
+      for length in 0 ... text.count {
+        let prefix = String(text.prefix(length))
+        let traits = index.traits(ofPrefix: length)
+        let freshTraits = freshIndex.traits(ofPrefix: length)
+        let expected = rescannedTraits(of: prefix)
+        #expect(traits.blockedLeadingLength == expected.blocked, "\(prefix)")
+        #expect(traits.blockedLeadingLength == freshTraits.blockedLeadingLength, "\(prefix)")
+        #expect((traits.uppercaseLetterCount > 0) == expected.hasUppercase, "\(prefix)")
+        #expect(traits.isWordLike == expected.isWordLike, "\(prefix)")
+        // 破壞性覆寫次數僅在整段皆為英文字母時才有意義。
+        #expect((traits.isAllLetters ? traits.destructiveOverwriteCount : 0) == expected.overwrites, "\(prefix)")
+        #expect(traits.destructiveOverwriteCount == freshTraits.destructiveOverwriteCount, "\(prefix)")
+      }
+    }
+  }
+}
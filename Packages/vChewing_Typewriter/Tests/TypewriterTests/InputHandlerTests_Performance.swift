@@ -0,0 +1,361 @@
+// (c) 2021 and onwards The vChewing Project (MIT-NTL License).
+// ====================
+// This code is released under the MIT license (SPDX-License-Identifier: MIT)
+// ... with NTL restriction stating that:
+// No trademark license is granted to use the trade names, trademarks, service
+// marks, or product names of Contributor, except as required to fulfill notice
+// requirements defined in MIT License.
+
+import Foundation
+import Homa
+@testable import LangModelAssembly
+import Shared
+import Tekkon
+import Testing
+@testable import Typewriter
+
+// MARK: - 按鍵回放效能測試 (Keystroke Replay Benchmarks)
+
+/// 將預錄的按鍵序列經由 `triageInput` 逐鍵回放，量測「按鍵 → 狀態更新」的端對端延遲。
+///
+/// 每組序列皆會輸出一行以 `// [BENCH-JSON]` 開頭的 JSON 報告（含 p50/p95/p99 與各階段統計），
+/// 方便 CI 以 grep 擷取後與基準值比對。若有設定 `VCHEWING_BENCHMARK_REPORT_PATH` 環境變數，
+/// 則同一份報告亦會以 JSON Lines 格式追加寫入該檔案。
+extension InputHandlerTests {
+  // MARK: - 按鍵序列
+
+  struct KeystrokeTrace {
+    // MARK: Lifecycle
+
+    init(
+      name: String,
+      parser: KeyboardParser = .ofStandard,
+      cassette: (stem: String, ext: String)? = nil,
+      needsCandidateWindow: Bool = false,
+      mixedAlphanumerical: Bool = false,
+      events: [KBEvent.KeyEventData]
+    ) {
+      self.name = name
+      self.parser = parser
+      self.cassette = cassette
+      self.needsCandidateWindow = needsCandidateWindow
+      self.mixedAlphanumerical = mixedAlphanumerical
+      self.events = events
+    }
+
+    init(
+      name: String,
+      parser: KeyboardParser = .ofStandard,
+      cassette: (stem: String, ext: String)? = nil,
+      needsCandidateWindow: Bool = false,
+      mixedAlphanumerical: Bool = false,
+      typing sequence: String,
+      then extraEvents: [KBEvent.KeyEventData] = []
+    ) {
+      self.init(
+        name: name,
+        parser: parser,
+        cassette: cassette,
+        needsCandidateWindow: needsCandidateWindow,
+        mixedAlphanumerical: mixedAlphanumerical,
+        events: sequence.map { KBEvent.KeyEventData(chars: $0.description) } + extraEvents
+      )
+    }
+
+    // MARK: Internal
+
+    let name: String
+    let parser: KeyboardParser
+    let cassette: (stem: String, ext: String)?
+    let needsCandidateWindow: Bool
+    /// 是否以中英混輸模式回放。
+    let mixedAlphanumerical: Bool
+    let events: [KBEvent.KeyEventData]
+  }
+
+  // MARK: - 報告格式
+
+  struct BenchmarkStageReport: Codable {
+    var calls: Int = 0
+    var totalMicroseconds: Double = 0
+
+    var meanMicroseconds: Double {
+      calls == 0 ? 0 : totalMicroseconds / Double(calls)
+    }
+
+    mutating func record(nanoseconds: UInt64) {
+      calls += 1
+      totalMicroseconds += Double(nanoseconds) / 1_000
+    }
+
+    /// 以回放前後的兩份 `PerfProbe` 鏡照之差，求得回放期間該計時區段的統計。
+    static func delta(
+      of spanName: String,
+      from before: PerfProbe.Snapshot,
+      to after: PerfProbe.Snapshot
+    )
+      -> Self {
+      guard let afterMetric = after.span(named: spanName) else { return .init() }
+      let beforeMetric = before.span(named: spanName)
+      let calls = afterMetric.calls - (beforeMetric?.calls ?? 0)
+      let nanoseconds = afterMetric.totalNanoseconds - (beforeMetric?.totalNanoseconds ?? 0)
+      return .init(calls: Int(calls), totalMicroseconds: Double(nanoseconds) / 1_000)
+    }
+  }
+
+  struct BenchmarkReport: Codable {
+    let suite: String
+    let trace: String
+    let iterations: Int
+    let keystrokes: Int
+    let p50Microseconds: Double
+    let p95Microseconds: Double
+    let p99Microseconds: Double
+    let maxMicroseconds: Double
+    let meanMicroseconds: Double
+    /// 各階段的呼叫次數與累計耗時，皆為 `triageInput` 期間的實際呼叫。
+    /// - `lmQuery`：組字器向語言模型查詢的呼叫。
+    /// - 其餘各階段見 `probedBenchmarkStages`，僅在以 `-DVCHEWING_PERF_PROBES` 建置時才會列出。
+    let stages: [String: BenchmarkStageReport]
+
+    var jsonLine: String {
+      let encoder = JSONEncoder()
+      encoder.outputFormatting = [.sortedKeys]
+      guard let data = try? encoder.encode(self) else { return "{}" }
+      return String(decoding: data, as: UTF8.self)
+    }
+  }
+
+  /// 取自 `PerfProbe` 計時區段的各階段（階段名稱、計時區段名稱）。
+  ///
+  /// 這些計時區段只有在以 `swift test -Xswiftc -DVCHEWING_PERF_PROBES` 建置時才會記錄資料；
+  /// 一般建置下 `PerfProbe` 的呼叫皆為空操作，故報告只會列出 `lmQuery`。
+  static let probedBenchmarkStages: [(stage: String, span: String)] = [
+    ("tekkon", "Typewriter.composer.receiveKey"),
+    ("assemble", "Homa.Assembler.assemble"),
+    ("assignNodes", "Homa.Assembler.assignNodes"),
+    ("stateBuild", "Typewriter.generateStateOfInputting"),
+  ]
+
+  // MARK: - 量測工具
+
+  static func nanosecondsElapsed(_ task: () -> ()) -> UInt64 {
+    let startTime = DispatchTime.now().uptimeNanoseconds
+    task()
+    return DispatchTime.now().uptimeNanoseconds - startTime
+  }
+
+  /// 以 nearest-rank 法求百分位數。`sortedSamples` 須已排序。
+  static func percentile(_ sortedSamples: [Double], _ ratio: Double) -> Double {
+    guard !sortedSamples.isEmpty else { return 0 }
+    let rank = Int((ratio * Double(sortedSamples.count)).rounded(.up))
+    return sortedSamples[max(0, min(sortedSamples.count - 1, rank - 1))]
+  }
+
+  static func emitBenchmarkReport(_ report: BenchmarkReport) {
+    let line = report.jsonLine
+    print("// [BENCH-JSON] \(line)")
+    guard let path = ProcessInfo.processInfo.environment["VCHEWING_BENCHMARK_REPORT_PATH"],
+          !path.isEmpty else { return }
+    let url = URL(fileURLWithPath: path)
+    let payload = Data((line + "\n").utf8)
+    if let handle = try? FileHandle(forWritingTo: url) {
+      defer { try? handle.close() }
+      _ = try? handle.seekToEnd()
+      try? handle.write(contentsOf: payload)
+    } else {
+      try? payload.write(to: url)
+    }
+  }
+
+  /// 將給定的按鍵序列回放 `iterations` 次，並回傳統計報告。
+  /// - Parameter onSample: 每量得一次按鍵延遲時，以「該按鍵在序列內的位置、延遲（微秒）」呼叫之。
+  func replayKeystrokeTrace(
+    _ trace: KeystrokeTrace,
+    iterations: Int,
+    onSample: ((_ position: Int, _ microseconds: Double) -> ())? = nil
+  )
+    -> BenchmarkReport? {
+    guard let testHandler, let testSession else { return nil }
+
+    if let cassette = trace.cassette {
+      guard let cassetteURL = cassetteURLForTests(cassette.stem, ext: cassette.ext) else {
+        Issue.record("無法存取用以測試的資料。當前嘗試存取的檔案：\(cassette.stem).\(cassette.ext)")
+        return nil
+      }
+      LMAssembly.LMInstantiator.loadCassetteData(path: cassetteURL.path)
+    }
+    testHandler.prefs.cassetteEnabled = trace.cassette != nil
+    testHandler.prefs.keyboardParser = trace.parser.rawValue
+    testHandler.ensureKeyboardParser()
+    testHandler.prefs.mixedAlphanumericalEnabled = trace.mixedAlphanumerical
+    testSession.mockCandidateController = trace.needsCandidateWindow ? .init(visible: true) : nil
+
+    // 以包裝過的查詢函式統計語言模型查詢的次數與耗時。
+    let originalQuerier = testHandler.assembler.gramQuerier
+    var lmQueryStage = BenchmarkStageReport()
+    testHandler.assembler.gramQuerier = { keyArray in
+      var result = [Homa.Gram]()
+      let elapsed = Self.nanosecondsElapsed { result = originalQuerier(keyArray) }
+      lmQueryStage.record(nanoseconds: elapsed)
+      return result
+    }
+    defer {
+      testHandler.assembler.gramQuerier = originalQuerier
+      if trace.cassette != nil {
+        LMAssembly.LMInstantiator.lmCassette.clear()
+        LMAssembly.LMInstantiator.mtxFactoryGeneration.value &+= 1
+      }
+      testHandler.prefs.cassetteEnabled = false
+      testHandler.prefs.keyboardParser = KeyboardParser.ofStandard.rawValue
+      testHandler.ensureKeyboardParser()
+      testHandler.prefs.mixedAlphanumericalEnabled = false
+      testSession.mockCandidateController = nil
+      testSession.resetInputHandler(forceComposerCleanup: true)
+    }
+
+    let events = trace.events.map(\.asEvent)
+    var samples = [Double]()
+    samples.reserveCapacity(events.count * iterations)
+
+    // 其餘各階段的耗時由輸入調度模組內的量測點記錄；此處只取回放前後的鏡照之差。
+    #if VCHEWING_PERF_PROBES
+      let probesBefore = PerfProbe.snapshot()
+    #endif
+    for _ in 0 ..< iterations {
+      testSession.switchState(.ofAbortion())
+      testSession.resetInputHandler(forceComposerCleanup: true)
+      for (position, event) in events.enumerated() {
+        let elapsed = Self.nanosecondsElapsed { _ = testHandler.triageInput(event: event) }
+        samples.append(Double(elapsed) / 1_000)
+        onSample?(position, Double(elapsed) / 1_000)
+      }
+    }
+
+    var stages: [String: BenchmarkStageReport] = ["lmQuery": lmQueryStage]
+    #if VCHEWING_PERF_PROBES
+      let probesAfter = PerfProbe.snapshot()
+      Self.probedBenchmarkStages.forEach { stage, span in
+        stages[stage] = .delta(of: span, from: probesBefore, to: probesAfter)
+      }
+    #endif
+
+    let sorted = samples.sorted()
+    return BenchmarkReport(
+      suite: "Typewriter.KeystrokeReplay",
+      trace: trace.name,
+      iterations: iterations,
+      keystrokes: samples.count,
+      p50Microseconds: Self.percentile(sorted, 0.50),
+      p95Microseconds: Self.percentile(sorted, 0.95),
+      p99Microseconds: Self.percentile(sorted, 0.99),
+      maxMicroseconds: sorted.last ?? 0,
+      meanMicroseconds: sorted.isEmpty ? 0 : sorted.reduce(0, +) / Double(sorted.count),
+      stages: stages
+    )
+  }
+
+  // MARK: - 效能測試本體
+
+  /// 以常見打字情境回放按鍵序列，輸出每鍵延遲的百分位數與各階段統計。
+  @Test("[Typewriter] Bench_KeystrokeReplayLatency")
+  func test_IHBench01_KeystrokeReplayLatency() throws {
+    guard let testHandler else {
+      Issue.record("testHandler is nil.")
+      return
+    }
+    let originalAsyncLoading = LMAssembly.LMInstantiator.asyncLoadingUserData
+    LMAssembly.LMInstantiator.asyncLoadingUserData = false
+    defer { LMAssembly.LMInstantiator.asyncLoadingUserData = originalAsyncLoading }
+    testHandler.prefs.useSCPCTypingMode = false
+    testHandler.prefs.fetchSuggestionsFromPerceptionOverrideModel = true
+    clearTestPOM()
+
+    let traces: [KeystrokeTrace] = [
+      .init(name: "plainTyping", typing: "u. 2u,6s/6xu.6u4xm3z; "),
+      .init(
+        name: "candidateSelection",
+        needsCandidateWindow: true,
+        typing: "u. 2u,6s/6xu.6u4xm3z; ",
+        then: [
+          .dataArrowLeft, .dataArrowDown, KBEvent.KeyEventData(chars: "1"),
+          .dataArrowHome, .dataArrowRight, .dataArrowDown, KBEvent.KeyEventData(chars: "3"),
+          .dataTab, .dataTab,
+        ]
+      ),
+      .init(
+        name: "longBufferEdits",
+        typing: "el dk ru4ej/ n 2k7su065j/ ru;3rup " + "u. 2u,6s/6xu.6u4xm3z; ",
+        then: [
+          .dataArrowHome, .dataArrowRight, .dataArrowRight, .forwardDelete,
+          .dataArrowEnd, .backspace, .backspace, .dataArrowLeft, .dataArrowLeft,
+        ] + "xu.6".map { KBEvent.KeyEventData(chars: $0.description) }
+      ),
+      .init(name: "pinyinAbbreviation", parser: .ofHanyuPinyin, typing: "shijiedaz"),
+      .init(name: "cassetteTyping", cassette: ("wubi", "cin"), typing: "qqqq qqqq "),
+    ]
+
+    for trace in traces {
+      guard let report = replayKeystrokeTrace(trace, iterations: 20) else { continue }
+      Self.emitBenchmarkReport(report)
+      print("// \(trace.name): p50 \(report.p50Microseconds)µs, p95 \(report.p95Microseconds)µs, p99 \(report.p99Microseconds)µs")
+      #expect(report.keystrokes == trace.events.count * report.iterations)
+      // 絕對延遲受執行環境影響太大，故百分位數只做報告、不做斷言，交由 CI 與基準值比對。
+      #if VCHEWING_PERF_PROBES
+        for (stage, _) in Self.probedBenchmarkStages {
+          #expect(report.stages[stage] != nil, "\(trace.name) is missing stage \(stage)")
+        }
+        #expect((report.stages["assemble"]?.calls ?? 0) > 0)
+        #expect((report.stages["stateBuild"]?.calls ?? 0) > 0)
+      #endif
+    }
+  }
+
+  /// 以中英混輸模式回放一段不斷變長的英文識別字（中途不會觸發自動拆分），最後再接上注音後綴。
+  ///
+  /// 混輸緩衝區越長，每次按鍵要判斷的內容就越長；此處比較序列前段與後段的平均每鍵延遲，
+  /// 以確認每鍵延遲不會隨著緩衝區變長而明顯增加。
+  @Test("[Typewriter] Bench_MixedAlphanumericalLongRunLatency")
+  func test_IHBench02_MixedAlphanumericalLongRunLatency() throws {
+    guard let testHandler else {
+      Issue.record("testHandler is nil.")
+      return
+    }
+    let originalAsyncLoading = LMAssembly.LMInstantiator.asyncLoadingUserData
+    LMAssembly.LMInstantiator.asyncLoadingUserData = false
+    defer { LMAssembly.LMInstantiator.asyncLoadingUserData = originalAsyncLoading }
+    testHandler.prefs.useSCPCTypingMode = false
+    testHandler.prefs.fetchSuggestionsFromPerceptionOverrideModel = false
+
+    // 大千排列下英文字母皆非聲調鍵，故這段識別字在敲完之前都只會留在混輸緩衝區內。
+    let identifier = String(repeating: "ThisIsAnIdentifierForMixedModeInVChewing", count: 4)
+    let trace = KeystrokeTrace(
+      name: "mixedLongRun",
+      mixedAlphanumerical: true,
+      typing: identifier + "su3cl3 "
+    )
+    let measuredCount = identifier.count
+    let bucketSize = measuredCount / 4
+    var earlyTotal: Double = 0
+    var lateTotal: Double = 0
+    guard let report = replayKeystrokeTrace(trace, iterations: 10, onSample: { position, microseconds in
+      if position < bucketSize {
+        earlyTotal += microseconds
+      } else if position >= measuredCount - bucketSize, position < measuredCount {
+        lateTotal += microseconds
+      }
+    }) else { return }
+    Self.emitBenchmarkReport(report)
+
+    let sampleCount = Double(bucketSize * report.iterations)
+    let earlyMean = earlyTotal / sampleCount
+    let lateMean = lateTotal / sampleCount
+    print("// \(trace.name): early mean \(earlyMean)µs, late mean \(lateMean)µs")
+    #expect(report.keystrokes == trace.events.count * report.iterations)
+    // 寬鬆門檻，僅用來抓「每鍵延遲隨緩衝區長度線性增加」這類嚴重退化。
+    #expect(
+      lateMean < earlyMean * 4 + 100,
+      "\(trace.name) per-key latency grows with the buffer: early \(earlyMean)µs, late \(lateMean)µs"
+    )
+  }
+}
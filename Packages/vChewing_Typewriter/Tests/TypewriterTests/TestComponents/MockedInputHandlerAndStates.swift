@@ -62,6 +62,8 @@ public final class MockInputHandler: @MainActor InputHandlerProtocol {
   public var markingTooltipGenerator: ((_ state: State) -> (tooltip: String, colorState: TooltipColorState))?
 
   public var backupCursor: Int?
+  public var compositionBufferIndexCache: CompositionBufferIndex?
+  public var mixedAlphanumericalBufferIndexCache: MixedAlphanumericalBufferIndex?
   public var currentTypingMethod: TypingMethod = .vChewingFactory
 
   public var strCodePointBuffer = ""